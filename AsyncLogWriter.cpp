@@ -0,0 +1,555 @@
+/**
+ * @file AsyncLogWriter.cpp
+ * @brief Implementation of the AsyncLogWriter class.
+ * @date October 2026
+ */
+
+#include "AsyncLogWriter.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+/** @brief Page size used for buffer alignment and direct I/O padding. */
+static const size_t PAGE_BYTES = 4096;
+
+/** @brief Source of writer identifiers; 0 marks an empty cache entry. */
+static atomic<unsigned long> nextWriterId(1);
+
+/**
+ * @struct RingCacheEntry
+ * @brief Remembers the ring of the current thread for one writer.
+ */
+struct RingCacheEntry {
+    unsigned long writer; /**< Writer identifier. */
+    void* ring;           /**< The thread's ring in that writer. */
+};
+
+/** @brief Per-thread cache so that appends find their ring without taking a lock. */
+static thread_local RingCacheEntry ringCache[4] = {};
+
+/** @brief Next cache entry to replace. */
+static thread_local int ringCacheNext = 0;
+
+/**
+ * @brief Copies bytes into a ring, wrapping around its end.
+ * @param ring Ring storage.
+ * @param mask Capacity - 1.
+ * @param position Logical position of the first byte.
+ * @param source The bytes (nullptr writes zeros).
+ * @param size Number of bytes.
+ */
+static void ringWrite(uint8_t* ring, uint64_t mask, uint64_t position, const void* source, size_t size) {
+    size_t offset = static_cast<size_t>(position & mask);
+    size_t first = size < mask + 1 - offset ? size : static_cast<size_t>(mask + 1 - offset);
+    const uint8_t* bytes = static_cast<const uint8_t*>(source);
+    if (bytes) {
+        memcpy(ring + offset, bytes, first);
+        memcpy(ring, bytes + first, size - first);
+    }
+    else {
+        memset(ring + offset, 0, first);
+        memset(ring, 0, size - first);
+    }
+}
+
+/**
+ * @brief Copies bytes out of a ring, wrapping around its end.
+ * @param ring Ring storage.
+ * @param mask Capacity - 1.
+ * @param position Logical position of the first byte.
+ * @param target Destination.
+ * @param size Number of bytes.
+ */
+static void ringRead(const uint8_t* ring, uint64_t mask, uint64_t position, void* target, size_t size) {
+    size_t offset = static_cast<size_t>(position & mask);
+    size_t first = size < mask + 1 - offset ? size : static_cast<size_t>(mask + 1 - offset);
+    uint8_t* bytes = static_cast<uint8_t*>(target);
+    memcpy(bytes, ring + offset, first);
+    memcpy(bytes + first, ring, size - first);
+}
+
+/**
+ * @brief Constructor for the AsyncLogWriter class.
+ */
+AsyncLogWriter::AsyncLogWriter()
+    : fileDescriptor(-1), directIO(false), wantDirectIO(true), archiver(nullptr), id(nextWriterId++), ringBytes(1 << 20), chunkBytes(1 << 20),
+    maxAgeSeconds(1.0), chunk(nullptr), chunkCapacity(0), chunkUsed(sizeof(ChunkHeader)), chunkRecords(0),
+    chunkFirst(0.0), chunkLast(0.0), running(false), flushRequested(0), flushCompleted(0),
+    bytesWritten(0), recordsWritten(0), droppedRecords(0), chunksWritten(0) {}
+
+/**
+ * @brief Destructor for the AsyncLogWriter class. Writes everything appended so far.
+ */
+AsyncLogWriter::~AsyncLogWriter() {
+    if (isOpen()) {
+        close();
+    }
+    telemetryFree(chunk);
+}
+
+/**
+ * @brief Sets the buffer sizes and the age threshold. Must be called before open().
+ * @param ringSize Capacity of each producer ring in bytes (rounded up to a power of two).
+ * @param chunkSize Chunk size in bytes.
+ * @param maxAge Oldest buffered record age in seconds that forces a write.
+ */
+void AsyncLogWriter::configure(size_t ringSize, size_t chunkSize, double maxAge) {
+    if (isOpen()) {
+        cerr << "Error: Configure the log before opening it." << endl;
+        return;
+    }
+    size_t size = 64;
+    while (size < ringSize) {
+        size <<= 1;
+    }
+    ringBytes = size;
+    chunkBytes = chunkSize > PAGE_BYTES ? chunkSize : PAGE_BYTES;
+    maxAgeSeconds = maxAge;
+    rings.clear();
+    id = nextWriterId++; // Invalidates the per-thread ring caches
+}
+
+/**
+ * @brief Sends closed segments to an archiver. Must be called before open().
+ * @param segmentArchiver The started archiver, or nullptr to append to one file.
+ */
+void AsyncLogWriter::setArchiver(LogArchiver* segmentArchiver) {
+    if (isOpen()) {
+        cerr << "Error: Set the archiver before opening the log." << endl;
+        return;
+    }
+    archiver = segmentArchiver;
+}
+
+/**
+ * @brief Opens a log for appending and starts the writer thread.
+ * @param name Name of the log file.
+ * @param useDirectIO True to try O_DIRECT.
+ * @return True on success.
+ */
+bool AsyncLogWriter::open(const string& name, bool useDirectIO) {
+    if (isOpen()) {
+        close();
+    }
+    if (!openFile(name, useDirectIO)) {
+        cerr << "Failed to open telemetry log: " << name << endl;
+        return false;
+    }
+
+    // Room for the largest record a ring can hold, plus direct I/O padding
+    size_t largest = chunkBytes > ringBytes ? chunkBytes : ringBytes;
+    size_t capacity = (sizeof(ChunkHeader) + largest + 2 * PAGE_BYTES) & ~(PAGE_BYTES - 1);
+    if (capacity != chunkCapacity) {
+        telemetryFree(chunk);
+        chunk = static_cast<uint8_t*>(telemetryAlloc(capacity, PAGE_BYTES));
+        chunkCapacity = chunk ? capacity : 0;
+    }
+    if (!chunk) {
+        cerr << "Error: Could not allocate the telemetry buffer." << endl;
+        closeFile();
+        return false;
+    }
+
+    fileName = name;
+    wantDirectIO = useDirectIO;
+    index.open(name); // Without an index the log is still complete; readers rebuild the index
+    chunkUsed = sizeof(ChunkHeader);
+    chunkRecords = 0;
+    chunkSpans.reset();
+    bytesWritten = 0;
+    recordsWritten = 0;
+    droppedRecords = 0;
+    chunksWritten = 0;
+    running = true;
+    worker = thread(&AsyncLogWriter::run, this);
+    return true;
+}
+
+/**
+ * @brief Opens the log file, with O_DIRECT if requested and possible.
+ * @param name Name of the log file.
+ * @param useDirectIO True to try O_DIRECT.
+ * @return True on success.
+ */
+bool AsyncLogWriter::openFile(const string& name, bool useDirectIO) {
+    directIO = false;
+    fileDescriptor = -1;
+#ifdef _WIN32
+    (void)useDirectIO;
+    fileDescriptor = _open(name.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    const int flags = O_WRONLY | O_CREAT | O_APPEND;
+#ifdef O_DIRECT
+    if (useDirectIO) {
+        fileDescriptor = ::open(name.c_str(), flags | O_DIRECT, 0644);
+        struct stat info;
+        if (fileDescriptor >= 0 && fstat(fileDescriptor, &info) == 0 && info.st_size % PAGE_BYTES == 0) {
+            directIO = true;
+        }
+        else if (fileDescriptor >= 0) {
+            ::close(fileDescriptor); // Appending at an unaligned end of file is not possible with O_DIRECT
+            fileDescriptor = -1;
+        }
+    }
+#else
+    (void)useDirectIO;
+#endif
+    if (fileDescriptor < 0) {
+        fileDescriptor = ::open(name.c_str(), flags, 0644);
+    }
+#endif
+    return fileDescriptor >= 0;
+}
+
+/**
+ * @brief Closes the log file.
+ * @return True on success.
+ */
+bool AsyncLogWriter::closeFile() {
+    if (fileDescriptor < 0) {
+        return false;
+    }
+#ifdef _WIN32
+    bool closed = _close(fileDescriptor) == 0;
+#else
+    bool closed = ::close(fileDescriptor) == 0;
+#endif
+    fileDescriptor = -1;
+    return closed;
+}
+
+/**
+ * @brief Writes everything appended so far, stops the writer thread and closes the log.
+ * @return True on success.
+ */
+bool AsyncLogWriter::close() {
+    if (!worker.joinable()) {
+        return false;
+    }
+    running = false;
+    worker.join(); // The writer thread waits for appends in progress and drains the rings before it exits
+    bool closed = closeFile();
+    index.close();
+    return closed;
+}
+
+/**
+ * @brief Checks whether a log is open.
+ * @return True if open.
+ */
+bool AsyncLogWriter::isOpen() const {
+    return running.load();
+}
+
+/**
+ * @brief Returns the calling thread's ring, creating it on first use.
+ * @return The ring.
+ */
+AsyncLogWriter::Ring* AsyncLogWriter::ringForThisThread() {
+    for (int i = 0; i < 4; i++) {
+        if (ringCache[i].writer == id) {
+            return static_cast<Ring*>(ringCache[i].ring);
+        }
+    }
+
+    lock_guard<mutex> lock(ringMutex);
+    Ring* ring = nullptr;
+    for (size_t i = 0; i < rings.size() && !ring; i++) {
+        if (rings[i]->owner == this_thread::get_id()) {
+            ring = rings[i].get();
+        }
+    }
+    if (!ring) {
+        rings.push_back(unique_ptr<Ring>(new Ring()));
+        ring = rings.back().get();
+        ring->owner = this_thread::get_id();
+        ring->data.reset(new uint8_t[ringBytes]);
+        ring->mask = ringBytes - 1;
+        ring->head.store(0, memory_order_relaxed);
+        ring->tail.store(0, memory_order_relaxed);
+        ring->active.store(false, memory_order_relaxed);
+    }
+    ringCache[ringCacheNext].writer = id;
+    ringCache[ringCacheNext].ring = ring;
+    ringCacheNext = (ringCacheNext + 1) % 4;
+    return ring;
+}
+
+/**
+ * @brief Appends a record from any thread without blocking.
+ * @param type One of TelemetryRecordType.
+ * @param timestamp Time of the record in seconds.
+ * @param head The fixed part of the payload.
+ * @param headSize Size of the fixed part.
+ * @param body The array part of the payload (may be nullptr if bodySize is 0).
+ * @param bodySize Size of the array part.
+ * @return True if the record was queued, false if it was dropped.
+ */
+bool AsyncLogWriter::append(uint16_t type, double timestamp, const void* head, uint32_t headSize,
+    const void* body, uint32_t bodySize) {
+    if (!running.load(memory_order_relaxed)) {
+        return false;
+    }
+    Ring* ring = ringForThisThread();
+    // Either close() sees the ring active and waits for it, or this sees the writer stopped
+    ring->active.store(true);
+    if (!running.load()) {
+        ring->active.store(false, memory_order_release);
+        return false;
+    }
+    size_t payloadSize = static_cast<size_t>(headSize) + bodySize;
+    size_t recordSize = telemetryAlign(sizeof(RecordHeader) + payloadSize);
+    uint64_t tail = ring->tail.load(memory_order_relaxed);
+    uint64_t used = tail - ring->head.load(memory_order_acquire);
+    if (recordSize > ring->mask + 1 - used) {
+        droppedRecords.fetch_add(1, memory_order_relaxed);
+        ring->active.store(false, memory_order_release);
+        return false;
+    }
+
+    RecordHeader header;
+    header.type = type;
+    header.reserved = 0;
+    header.size = static_cast<uint32_t>(payloadSize);
+    header.timestamp = timestamp;
+    uint8_t* data = ring->data.get();
+    ringWrite(data, ring->mask, tail, &header, sizeof(header));
+    ringWrite(data, ring->mask, tail + sizeof(header), head, headSize);
+    ringWrite(data, ring->mask, tail + sizeof(header) + headSize, body, bodySize);
+    ringWrite(data, ring->mask, tail + sizeof(header) + payloadSize, nullptr,
+        recordSize - sizeof(header) - payloadSize);
+    ring->tail.store(tail + recordSize, memory_order_release);
+    ring->active.store(false, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Blocks until every record appended before the call has been written to the file.
+ * @return True on success.
+ */
+bool AsyncLogWriter::flush() {
+    if (!isOpen()) {
+        return false;
+    }
+    unique_lock<mutex> lock(flushMutex);
+    unsigned long target = ++flushRequested;
+    flushDone.wait(lock, [this, target]() { return flushCompleted >= target || !running; });
+    return flushCompleted >= target;
+}
+
+/**
+ * @brief Writer thread: drains the rings and writes chunks until stopped.
+ */
+void AsyncLogWriter::run() {
+    while (running.load()) {
+        unsigned long moved = drain();
+
+        unsigned long requested;
+        {
+            lock_guard<mutex> lock(flushMutex);
+            requested = flushRequested;
+        }
+        if (requested != flushCompleted) {
+            drain();
+            writeChunk();
+            {
+                lock_guard<mutex> lock(flushMutex);
+                flushCompleted = requested;
+            }
+            flushDone.notify_all();
+        }
+        else if (chunkRecords > 0
+            && chrono::duration<double>(chrono::steady_clock::now() - chunkStarted).count() >= maxAgeSeconds) {
+            writeChunk();
+        }
+
+        if (moved == 0) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+    {
+        // Producers that passed the running check before close() cleared it finish their record first
+        lock_guard<mutex> lock(ringMutex);
+        for (size_t i = 0; i < rings.size(); i++) {
+            while (rings[i]->active.load(memory_order_acquire)) {
+                this_thread::yield();
+            }
+        }
+    }
+    drain();
+    writeChunk();
+    {
+        lock_guard<mutex> lock(flushMutex);
+        flushCompleted = flushRequested;
+    }
+    flushDone.notify_all();
+}
+
+/**
+ * @brief Moves every complete record from the rings into the chunk, writing full chunks.
+ * @return The number of records moved.
+ */
+unsigned long AsyncLogWriter::drain() {
+    vector<Ring*> snapshot;
+    {
+        lock_guard<mutex> lock(ringMutex);
+        for (size_t i = 0; i < rings.size(); i++) {
+            snapshot.push_back(rings[i].get());
+        }
+    }
+
+    unsigned long moved = 0;
+    for (size_t r = 0; r < snapshot.size(); r++) {
+        Ring* ring = snapshot[r];
+        const uint8_t* data = ring->data.get();
+        uint64_t head = ring->head.load(memory_order_relaxed);
+        uint64_t tail = ring->tail.load(memory_order_acquire);
+        while (tail - head >= sizeof(RecordHeader)) {
+            RecordHeader header;
+            ringRead(data, ring->mask, head, &header, sizeof(header));
+            size_t recordSize = telemetryAlign(sizeof(RecordHeader) + header.size);
+            if (chunkRecords > 0 && chunkUsed + recordSize > chunkBytes) {
+                writeChunk();
+            }
+            ringRead(data, ring->mask, head, chunk + chunkUsed, recordSize);
+            if (chunkRecords == 0) {
+                chunkFirst = header.timestamp;
+                chunkLast = header.timestamp;
+                chunkStarted = chrono::steady_clock::now();
+            }
+            chunkFirst = header.timestamp < chunkFirst ? header.timestamp : chunkFirst;
+            chunkLast = header.timestamp > chunkLast ? header.timestamp : chunkLast;
+            chunkSpans.add(header.type, header.timestamp);
+            chunkUsed += recordSize;
+            chunkRecords++;
+            head += recordSize;
+            ring->head.store(head, memory_order_release);
+            moved++;
+        }
+    }
+    return moved;
+}
+
+/**
+ * @brief Writes the chunk under construction, padded for direct I/O if needed.
+ * @return True on success.
+ */
+bool AsyncLogWriter::writeChunk() {
+    if (chunkRecords == 0) {
+        return true;
+    }
+    uint32_t records = chunkRecords;
+    if (directIO && chunkUsed % PAGE_BYTES != 0) {
+        // Fill up to the next page boundary with a padding record (at least a record header)
+        size_t padded = (chunkUsed + sizeof(RecordHeader) + PAGE_BYTES - 1) & ~(PAGE_BYTES - 1);
+        RecordHeader padding;
+        padding.type = RECORD_PADDING;
+        padding.reserved = 0;
+        padding.size = static_cast<uint32_t>(padded - chunkUsed - sizeof(RecordHeader));
+        padding.timestamp = chunkLast;
+        memcpy(chunk + chunkUsed, &padding, sizeof(padding));
+        memset(chunk + chunkUsed + sizeof(padding), 0, padding.size);
+        chunkUsed = padded;
+        chunkRecords++;
+    }
+    telemetryFinishChunk(chunk, chunkUsed - sizeof(ChunkHeader), chunkRecords, chunkFirst, chunkLast);
+    bool written = writeFully(chunk, chunkUsed);
+    if (written) {
+        index.append(chunkUsed, chunkSpans);
+        bytesWritten.fetch_add(chunkUsed, memory_order_relaxed);
+        recordsWritten.fetch_add(records, memory_order_relaxed);
+        chunksWritten.fetch_add(1, memory_order_relaxed);
+    }
+    else {
+        droppedRecords.fetch_add(records, memory_order_relaxed);
+        index.close(); // Offsets are unknown after a partial write
+    }
+    bool rotate = written && archiver && archiver->addBytes(chunkUsed);
+    chunkUsed = sizeof(ChunkHeader);
+    chunkRecords = 0;
+    chunkSpans.reset();
+    if (rotate) {
+        rotateSegment();
+    }
+    return written;
+}
+
+/**
+ * @brief Closes the file, hands it to the archiver as a segment and opens a new one under the same name.
+ */
+void AsyncLogWriter::rotateSegment() {
+    closeFile();
+    index.close();
+    archiver->archive(); // On failure the same file is opened again
+    if (!openFile(fileName, wantDirectIO)) {
+        cerr << "Error: Failed to reopen telemetry log after rotation: " << fileName << endl;
+        return;
+    }
+    index.open(fileName);
+}
+
+/**
+ * @brief Writes a buffer to the file, falling back to buffered I/O if direct I/O is refused.
+ * @param data The bytes.
+ * @param size Number of bytes.
+ * @return True on success.
+ */
+bool AsyncLogWriter::writeFully(const uint8_t* data, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+#ifdef _WIN32
+        int result = _write(fileDescriptor, data + done, static_cast<unsigned int>(size - done));
+#else
+        ssize_t result = ::write(fileDescriptor, data + done, size - done);
+#endif
+        if (result > 0) {
+            done += static_cast<size_t>(result);
+            continue;
+        }
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+#if !defined(_WIN32) && defined(O_DIRECT)
+        if (result < 0 && errno == EINVAL && directIO) {
+            // The file system accepted O_DIRECT at open but refuses the write; continue buffered
+            fcntl(fileDescriptor, F_SETFL, fcntl(fileDescriptor, F_GETFL) & ~O_DIRECT);
+            directIO = false;
+            continue;
+        }
+#endif
+        cerr << "Error: Failed to write telemetry chunk to " << fileName << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the counters of the log.
+ * @return The counters.
+ */
+LogStats AsyncLogWriter::getStats() {
+    LogStats stats;
+    stats.queueDepth = 0;
+    {
+        lock_guard<mutex> lock(ringMutex);
+        for (size_t i = 0; i < rings.size(); i++) {
+            stats.queueDepth += rings[i]->tail.load(memory_order_acquire) - rings[i]->head.load(memory_order_acquire);
+        }
+    }
+    stats.bytesWritten = bytesWritten.load();
+    stats.recordsWritten = recordsWritten.load();
+    stats.droppedRecords = droppedRecords.load();
+    stats.chunksWritten = chunksWritten.load();
+    stats.directIO = directIO.load();
+    return stats;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file AsyncLogWriter.h
+ * @brief Declaration of the AsyncLogWriter class, which writes telemetry records from a background thread.
+ * @date October 2026
+ */
+
+#ifndef ASYNCLOGWRITER_H
+#define ASYNCLOGWRITER_H
+
+#include "TelemetryLog.h"
+#include "TelemetryIndex.h"
+#include "LogArchiver.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct LogStats
+ * @brief Counters of an asynchronous telemetry log.
+ */
+struct LogStats {
+    uint64_t queueDepth;          /**< Bytes appended but not yet taken by the writer thread. */
+    uint64_t bytesWritten;        /**< Bytes written to the file. */
+    unsigned long recordsWritten; /**< Records written to the file. */
+    unsigned long droppedRecords; /**< Records discarded because a producer buffer was full. */
+    unsigned long chunksWritten;  /**< Chunks written to the file. */
+    bool directIO;                /**< True if the file is written with O_DIRECT. */
+};
+
+/**
+ * @class AsyncLogWriter
+ * @brief Appends telemetry records without blocking the caller; a background thread writes them.
+ *
+ * Each producer thread gets its own single-producer ring buffer the first time it appends, so
+ * appending is a copy into memory plus a few atomic operations on that ring and never takes a lock. When a ring is
+ * full the record is dropped and counted instead of stalling the producer. While a producer
+ * copies a record it marks its ring active; close() lets those copies finish before the final
+ * drain, so a record that append() accepted is always written or counted. The writer thread
+ * moves records from all rings into a page-aligned chunk buffer and writes whole chunks with
+ * one sequential write each. On Linux the file is opened with O_DIRECT when the file system
+ * supports it; chunks are then padded to whole pages with a RECORD_PADDING record. Otherwise
+ * (and on Windows) plain buffered writes are used. Each written chunk is also recorded in the
+ * sidecar time index (see TelemetryIndex.h). With an archiver the writer thread rotates the
+ * file between chunks, so producers never wait for a rotation.
+ */
+class AsyncLogWriter {
+private:
+    /**
+     * @struct Ring
+     * @brief Byte ring buffer written by one producer thread and read by the writer thread.
+     */
+    struct Ring {
+        std::thread::id owner;           /**< Producer thread. */
+        std::unique_ptr<uint8_t[]> data; /**< Ring storage. */
+        uint64_t mask;                   /**< Capacity - 1 (capacity is a power of two). */
+        char pad0[64];                   /**< Keeps head on its own cache line. */
+        std::atomic<uint64_t> head;      /**< Bytes consumed by the writer thread. */
+        char pad1[64];                   /**< Keeps tail on its own cache line. */
+        std::atomic<uint64_t> tail;      /**< Bytes produced by the owner. */
+        std::atomic<bool> active;        /**< True while the owner is inside append(). */
+    };
+
+    std::string fileName;                /**< Name of the open file. */
+    int fileDescriptor;                  /**< Output file, or -1. */
+    std::atomic<bool> directIO;          /**< True while the file is written with O_DIRECT. */
+    bool wantDirectIO;                   /**< True if O_DIRECT was requested in open(). */
+    LogArchiver* archiver;               /**< Receives closed segments, or nullptr. */
+    unsigned long id;                    /**< Identifies this writer in the per-thread ring cache. */
+    size_t ringBytes;                    /**< Capacity of each producer ring. */
+    size_t chunkBytes;                   /**< Chunk size that triggers a write. */
+    double maxAgeSeconds;                /**< Age of the oldest buffered record that triggers a write. */
+
+    std::mutex ringMutex;                /**< Guards the ring list (registration only). */
+    std::vector<std::unique_ptr<Ring> > rings; /**< One ring per producer thread. */
+
+    uint8_t* chunk;                      /**< Chunk under construction (writer thread only). */
+    size_t chunkCapacity;                /**< Size of the chunk buffer. */
+    size_t chunkUsed;                    /**< Bytes in use, including the chunk header. */
+    uint32_t chunkRecords;               /**< Records in the chunk under construction. */
+    double chunkFirst;                   /**< Earliest timestamp in the chunk. */
+    double chunkLast;                    /**< Latest timestamp in the chunk. */
+    std::chrono::steady_clock::time_point chunkStarted; /**< When the first record entered the chunk. */
+    ChunkTypeSpans chunkSpans;           /**< Per-type time spans of the chunk under construction. */
+    TelemetryIndexWriter index;          /**< Sidecar time index (writer thread only while open). */
+
+    std::thread worker;                  /**< Writer thread. */
+    std::atomic<bool> running;           /**< True while the writer thread should run. */
+    std::mutex flushMutex;               /**< Guards the flush handshake. */
+    std::condition_variable flushDone;   /**< Signals completed flushes. */
+    unsigned long flushRequested;        /**< Flushes requested so far. */
+    unsigned long flushCompleted;        /**< Flushes completed so far. */
+
+    std::atomic<uint64_t> bytesWritten;  /**< Bytes written to the file. */
+    std::atomic<unsigned long> recordsWritten; /**< Records written to the file. */
+    std::atomic<unsigned long> droppedRecords; /**< Records dropped by full rings. */
+    std::atomic<unsigned long> chunksWritten;  /**< Chunks written to the file. */
+
+    /**
+     * @brief Returns the calling thread's ring, creating it on first use.
+     * @return The ring.
+     */
+    Ring* ringForThisThread();
+
+    /**
+     * @brief Writer thread: drains the rings and writes chunks until stopped.
+     */
+    void run();
+
+    /**
+     * @brief Moves every complete record from the rings into the chunk, writing full chunks.
+     * @return The number of records moved.
+     */
+    unsigned long drain();
+
+    /**
+     * @brief Writes the chunk under construction, padded for direct I/O if needed.
+     * @return True on success.
+     */
+    bool writeChunk();
+
+    /**
+     * @brief Closes the file, hands it to the archiver as a segment and opens a new one under the same name.
+     */
+    void rotateSegment();
+
+    /**
+     * @brief Opens the log file, with O_DIRECT if requested and possible.
+     * @param name Name of the log file.
+     * @param useDirectIO True to try O_DIRECT.
+     * @return True on success.
+     */
+    bool openFile(const std::string& name, bool useDirectIO);
+
+    /**
+     * @brief Closes the log file.
+     * @return True on success.
+     */
+    bool closeFile();
+
+    /**
+     * @brief Writes a buffer to the file, falling back to buffered I/O if direct I/O is refused.
+     * @param data The bytes.
+     * @param size Number of bytes.
+     * @return True on success.
+     */
+    bool writeFully(const uint8_t* data, size_t size);
+
+public:
+    /**
+     * @brief Constructor for the AsyncLogWriter class.
+     */
+    AsyncLogWriter();
+
+    /**
+     * @brief Destructor for the AsyncLogWriter class. Writes everything appended so far.
+     */
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(const AsyncLogWriter&) = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+    /**
+     * @brief Sets the buffer sizes and the age threshold. Must be called before open().
+     * @param ringSize Capacity of each producer ring in bytes.
+     * @param chunkSize Chunk size in bytes.
+     * @param maxAge Oldest buffered record age in seconds that forces a write.
+     */
+    void configure(size_t ringSize, size_t chunkSize, double maxAge);
+
+    /**
+     * @brief Sends closed segments to an archiver, which decides when to rotate. Must be called before open().
+     * @param segmentArchiver The started archiver, or nullptr to append to one file.
+     */
+    void setArchiver(LogArchiver* segmentArchiver);
+
+    /**
+     * @brief Opens a log for appending and starts the writer thread.
+     * @param name Name of the log file.
+     * @param useDirectIO True to try O_DIRECT.
+     * @return True on success.
+     */
+    bool open(const std::string& name, bool useDirectIO = true);
+
+    /**
+     * @brief Writes everything appended so far, stops the writer thread and closes the log.
+     * @return True on success.
+     */
+    bool close();
+
+    /**
+     * @brief Checks whether a log is open.
+     * @return True if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends a record from any thread without blocking.
+     * @param type One of TelemetryRecordType.
+     * @param timestamp Time of the record in seconds.
+     * @param head The fixed part of the payload.
+     * @param headSize Size of the fixed part.
+     * @param body The array part of the payload (may be nullptr if bodySize is 0).
+     * @param bodySize Size of the array part.
+     * @return True if the record was queued, false if it was dropped.
+     */
+    bool append(uint16_t type, double timestamp, const void* head, uint32_t headSize,
+        const void* body = nullptr, uint32_t bodySize = 0);
+
+    /**
+     * @brief Blocks until every record appended before the call has been written to the file.
+     * @return True on success.
+     */
+    bool flush();
+
+    /**
+     * @brief Returns the counters of the log.
+     * @return The counters.
+     */
+    LogStats getStats();
+};
+
+#endif // ASYNCLOGWRITER_H
@@ -0,0 +1,167 @@
+/**
+ * @file AsyncLogWriterTest.cpp
+ * @brief Test application for the AsyncLogWriter class.
+ * @details Logs from several threads at once, reads the log back, provokes drops with a ring
+ * that is too small, and compares the cost of an append with a synchronous TelemetryWriter.
+ * @date October, 2026
+ */
+
+#include "AsyncLogWriter.h"
+#include "TelemetryWriter.h"
+#include "TelemetryReader.h"
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Main function for testing the AsyncLogWriter class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const char* fileName = "async_test.tlog";
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 1: Records from four threads all reach the file, in order per thread.
+     */
+    AsyncLogWriter writer;
+    writer.configure(1 << 22, 1 << 20, 0.05);
+    assert(writer.open(fileName));
+    const int producers = 4, perProducer = 20000;
+    vector<thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.push_back(thread([&writer, p, perProducer]() {
+            for (int i = 0; i < perProducer; i++) {
+                CommandRecord command = { 0.1, 0.0, 0.0, p, static_cast<uint32_t>(i) };
+                while (!writer.append(RECORD_COMMAND, i * 0.01, &command, sizeof(command))) {
+                    this_thread::yield(); // Only while the test fills the rings faster than the disk
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    assert(writer.flush());
+    LogStats stats = writer.getStats();
+    cout << "Direct I/O: " << (stats.directIO ? "yes" : "no (plain write)") << ", chunks: "
+        << stats.chunksWritten << ", bytes: " << stats.bytesWritten << endl;
+    assert(stats.queueDepth == 0);
+
+    TelemetryReader reader;
+    assert(reader.open(fileName));
+    RecordView view;
+    vector<int> nextExpected(producers, 0);
+    int count = 0;
+    while (reader.next(view)) {
+        const CommandRecord* command = view.as<CommandRecord>();
+        assert(view.type == RECORD_COMMAND && command);
+        assert(static_cast<int>(command->reserved) == nextExpected[command->source]);
+        nextExpected[command->source]++;
+        count++;
+    }
+    assert(count == producers * perProducer && reader.getCorruptChunks() == 0);
+    reader.close();
+    assert(writer.close());
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 2: When the ring is full, records are dropped and counted instead of blocking.
+     */
+    AsyncLogWriter small;
+    small.configure(8192, 1 << 20, 1.0);
+    assert(small.open(fileName));
+    float ranges[667] = {};
+    LidarScanRecord fixed = { 0.0, 0.0, 0.0, -120.0f, 0.36f, 667, 0 };
+    int accepted = 0;
+    const int attempts = 1000;
+    for (int i = 0; i < attempts; i++) {
+        accepted += small.append(RECORD_LIDAR_SCAN, i * 0.1, &fixed, sizeof(fixed), ranges, sizeof(ranges)) ? 1 : 0;
+    }
+    small.close();
+    stats = small.getStats();
+    cout << "Burst of " << attempts << " scans into an 8 KB ring: written=" << stats.recordsWritten
+        << ", dropped=" << stats.droppedRecords << endl;
+    assert(stats.droppedRecords > 0);
+    assert(stats.recordsWritten == static_cast<unsigned long>(accepted));
+    assert(stats.recordsWritten + stats.droppedRecords == static_cast<unsigned long>(attempts));
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 3: An async append costs far less than a synchronous one that writes chunks.
+     */
+    TelemetryWriter syncWriter;
+    syncWriter.open(fileName);
+    syncWriter.setFlushThresholds(64 * 1024, 1.0);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < 2000; i++) {
+        syncWriter.append(RECORD_LIDAR_SCAN, i * 0.1, &fixed, sizeof(fixed), ranges, sizeof(ranges));
+    }
+    double syncUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / 2000;
+    syncWriter.close();
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    AsyncLogWriter async;
+    async.configure(1 << 24, 64 * 1024, 1.0);
+    async.open(fileName);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < 2000; i++) {
+        async.append(RECORD_LIDAR_SCAN, i * 0.1, &fixed, sizeof(fixed), ranges, sizeof(ranges));
+    }
+    double asyncUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / 2000;
+    async.close();
+    cout << "Mean append: sync " << syncUs << " us, async " << asyncUs << " us" << endl;
+    assert(async.getStats().droppedRecords == 0);
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 4: Every record accepted by append() while another thread closes the log is in the file.
+     */
+    for (int round = 0; round < 20; round++) {
+        AsyncLogWriter closing;
+        closing.configure(1 << 22, 1 << 20, 0.05);
+        assert(closing.open(fileName));
+        atomic<unsigned long> acceptedRecords(0);
+        threads.clear();
+        for (int p = 0; p < producers; p++) {
+            threads.push_back(thread([&closing, &acceptedRecords, p]() {
+                CommandRecord command = { 0.1, 0.0, 0.0, p, 0 };
+                while (closing.isOpen()) {
+                    if (closing.append(RECORD_COMMAND, 0.0, &command, sizeof(command))) {
+                        acceptedRecords++;
+                        command.reserved++;
+                    }
+                }
+            }));
+        }
+        this_thread::sleep_for(chrono::milliseconds(2));
+        assert(closing.close());
+        for (size_t i = 0; i < threads.size(); i++) {
+            threads[i].join();
+        }
+        stats = closing.getStats();
+        assert(stats.recordsWritten == acceptedRecords.load()); // Records the full rings refused are only counted as dropped
+        assert(reader.open(fileName));
+        count = 0;
+        while (reader.next(view)) {
+            count++;
+        }
+        reader.close();
+        assert(static_cast<unsigned long>(count) == acceptedRecords.load());
+        remove(fileName);
+        remove(telemetryIndexName(fileName).c_str());
+    }
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file BatchGeometry.cpp
+ * @brief Implementation of the batch distance and bearing kernels.
+ * @date October 2026
+ */
+
+#include "BatchGeometry.h"
+#include "SimdOps.h"
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+
+/** @brief Coefficients of the odd minimax polynomial for atan on [0, 1], error below 1.8e-6. */
+static const float ATAN_A1 = 0.99997726f;
+static const float ATAN_A3 = -0.33262347f;
+static const float ATAN_A5 = 0.19354346f;
+static const float ATAN_A7 = -0.11643287f;
+static const float ATAN_A9 = 0.05265332f;
+static const float ATAN_A11 = -0.01172120f;
+static const float HALF_PI_F = 1.57079632679f;
+static const float PI_F = 3.14159265359f;
+static const float RAD_TO_DEG_F = 57.2957795131f;
+
+/**
+ * @brief Converts an angle from fastAtan2 to a bearing in degrees.
+ * @param radians The angle in [-pi, pi].
+ * @return The angle in degrees in [0, 360).
+ */
+static inline float toBearing(float radians) {
+    float degrees = radians * RAD_TO_DEG_F;
+    if (degrees < 0.0f) {
+        degrees += 360.0f;
+    }
+    return degrees >= 360.0f ? 0.0f : degrees; // -tiny + 360 rounds to 360
+}
+
+/**
+ * @brief Polynomial approximation of atan2.
+ * @param y Y component.
+ * @param x X component.
+ * @return The angle in radians in [-pi, pi]; 0 for (0, 0).
+ */
+float fastAtan2(float y, float x) {
+    float ax = fabs(x);
+    float ay = fabs(y);
+    float big = ax > ay ? ax : ay;
+    float small = ax > ay ? ay : ax;
+    float a = small / (big > FLT_MIN ? big : FLT_MIN);
+    float s = a * a;
+    float r = a * (ATAN_A1 + s * (ATAN_A3 + s * (ATAN_A5 + s * (ATAN_A7 + s * (ATAN_A9 + s * ATAN_A11)))));
+    if (ay > ax) {
+        r = HALF_PI_F - r;
+    }
+    if (signbit(x)) {
+        r = PI_F - r;
+    }
+    return signbit(y) ? -r : r;
+}
+
+#ifdef SIMD_OPS_VECTOR
+
+/**
+ * @brief fastAtan2 on all lanes, converted to a bearing like toBearing.
+ * @param y Y components.
+ * @param x X components.
+ * @return The angles in degrees in [0, 360).
+ */
+static inline SimdOps::V bearingLanes(SimdOps::V y, SimdOps::V x) {
+    typedef SimdOps S;
+    const S::V sign = S::set(-0.0f);
+    S::V ax = S::bitAndNot(sign, x);
+    S::V ay = S::bitAndNot(sign, y);
+    S::V big = S::maximum(ax, ay);
+    S::V small = S::minimum(ax, ay);
+    S::V a = S::div(small, S::maximum(big, S::set(FLT_MIN)));
+    S::V s = S::mul(a, a);
+    S::V poly = S::add(S::set(ATAN_A9), S::mul(s, S::set(ATAN_A11)));
+    poly = S::add(S::set(ATAN_A7), S::mul(s, poly));
+    poly = S::add(S::set(ATAN_A5), S::mul(s, poly));
+    poly = S::add(S::set(ATAN_A3), S::mul(s, poly));
+    poly = S::add(S::set(ATAN_A1), S::mul(s, poly));
+    S::V r = S::mul(a, poly);
+    r = S::select(S::less(ax, ay), S::sub(S::set(HALF_PI_F), r), r);
+    r = S::select(S::signMask(x), S::sub(S::set(PI_F), r), r);
+    r = S::bitXor(r, S::bitAnd(y, sign));
+    S::V degrees = S::mul(r, S::set(RAD_TO_DEG_F));
+    degrees = S::add(degrees, S::bitAnd(S::less(degrees, S::set(0.0f)), S::set(360.0f)));
+    return S::bitAndNot(S::greaterEqual(degrees, S::set(360.0f)), degrees);
+}
+
+#endif
+
+/**
+ * @brief Returns the instruction set the kernels were compiled for.
+ * @return "AVX2", "SSE2" or "scalar".
+ */
+const char* batchGeometryBackend() {
+    return simdOpsBackend();
+}
+
+/**
+ * @brief Computes distances and bearings from an origin to points; either output may be nullptr.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distances Receives count distances, or nullptr.
+ * @param bearings Receives count bearings in degrees, or nullptr.
+ */
+static void originKernel(float originX, float originY, const float* xs, const float* ys, size_t count,
+    float* distances, float* bearings) {
+    size_t i = 0;
+#ifdef SIMD_OPS_VECTOR
+    typedef SimdOps S;
+    const S::V ox = S::set(originX);
+    const S::V oy = S::set(originY);
+    for (; i + S::WIDTH <= count; i += S::WIDTH) {
+        S::V dx = S::sub(S::load(xs + i), ox);
+        S::V dy = S::sub(S::load(ys + i), oy);
+        if (distances) {
+            S::store(distances + i, S::sqrt(S::add(S::mul(dx, dx), S::mul(dy, dy))));
+        }
+        if (bearings) {
+            S::store(bearings + i, bearingLanes(dy, dx));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        float dx = xs[i] - originX;
+        float dy = ys[i] - originY;
+        if (distances) {
+            distances[i] = std::sqrt(dx * dx + dy * dy);
+        }
+        if (bearings) {
+            bearings[i] = toBearing(fastAtan2(dy, dx));
+        }
+    }
+}
+
+/**
+ * @brief Computes distances and bearings from a[i] to b[i]; either output may be nullptr.
+ * @param ax X coordinates of the first points.
+ * @param ay Y coordinates of the first points.
+ * @param bx X coordinates of the second points.
+ * @param by Y coordinates of the second points.
+ * @param count Number of pairs.
+ * @param distances Receives count distances, or nullptr.
+ * @param bearings Receives count bearings in degrees, or nullptr.
+ */
+static void pairKernel(const float* ax, const float* ay, const float* bx, const float* by, size_t count,
+    float* distances, float* bearings) {
+    size_t i = 0;
+#ifdef SIMD_OPS_VECTOR
+    typedef SimdOps S;
+    for (; i + S::WIDTH <= count; i += S::WIDTH) {
+        S::V dx = S::sub(S::load(bx + i), S::load(ax + i));
+        S::V dy = S::sub(S::load(by + i), S::load(ay + i));
+        if (distances) {
+            S::store(distances + i, S::sqrt(S::add(S::mul(dx, dx), S::mul(dy, dy))));
+        }
+        if (bearings) {
+            S::store(bearings + i, bearingLanes(dy, dx));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        float dx = bx[i] - ax[i];
+        float dy = by[i] - ay[i];
+        if (distances) {
+            distances[i] = std::sqrt(dx * dx + dy * dy);
+        }
+        if (bearings) {
+            bearings[i] = toBearing(fastAtan2(dy, dx));
+        }
+    }
+}
+
+/**
+ * @brief Computes the distance from an origin to each point.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distances Receives count distances.
+ */
+void batchDistances(double originX, double originY, const float* xs, const float* ys, size_t count, float* distances) {
+    originKernel(static_cast<float>(originX), static_cast<float>(originY), xs, ys, count, distances, nullptr);
+}
+
+/**
+ * @brief Computes the bearing from an origin to each point.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchBearings(double originX, double originY, const float* xs, const float* ys, size_t count, float* bearings) {
+    originKernel(static_cast<float>(originX), static_cast<float>(originY), xs, ys, count, nullptr, bearings);
+}
+
+/**
+ * @brief Computes distance and bearing from an origin to each point in one pass.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distances Receives count distances.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchPolar(double originX, double originY, const float* xs, const float* ys, size_t count, float* distances,
+    float* bearings) {
+    originKernel(static_cast<float>(originX), static_cast<float>(originY), xs, ys, count, distances, bearings);
+}
+
+/**
+ * @brief Computes the distance between each pair (a[i], b[i]).
+ * @param ax X coordinates of the first points.
+ * @param ay Y coordinates of the first points.
+ * @param bx X coordinates of the second points.
+ * @param by Y coordinates of the second points.
+ * @param count Number of pairs.
+ * @param distances Receives count distances.
+ */
+void batchPairDistances(const float* ax, const float* ay, const float* bx, const float* by, size_t count,
+    float* distances) {
+    pairKernel(ax, ay, bx, by, count, distances, nullptr);
+}
+
+/**
+ * @brief Computes the bearing from a[i] to b[i] for each pair.
+ * @param ax X coordinates of the first points.
+ * @param ay Y coordinates of the first points.
+ * @param bx X coordinates of the second points.
+ * @param by Y coordinates of the second points.
+ * @param count Number of pairs.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchPairBearings(const float* ax, const float* ay, const float* bx, const float* by, size_t count,
+    float* bearings) {
+    pairKernel(ax, ay, bx, by, count, nullptr, bearings);
+}
+
+/**
+ * @brief Computes the distance between every point of a and every point of b.
+ * @param ax X coordinates of the first set.
+ * @param ay Y coordinates of the first set.
+ * @param countA Number of points in the first set.
+ * @param bx X coordinates of the second set.
+ * @param by Y coordinates of the second set.
+ * @param countB Number of points in the second set.
+ * @param distances Receives countA rows of countB distances.
+ */
+void batchDistanceMatrix(const float* ax, const float* ay, size_t countA, const float* bx, const float* by,
+    size_t countB, float* distances) {
+    for (size_t row = 0; row < countA; row++) {
+        originKernel(ax[row], ay[row], bx, by, countB, distances + row * countB, nullptr);
+    }
+}
+
+/**
+ * @brief Finds the point nearest to an origin.
+ *
+ * Each lane keeps its smallest squared distance and the index it was found at; the lanes are
+ * merged at the end, preferring the lower index on ties.
+ *
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distance Receives the distance to the nearest point (unchanged if count is 0).
+ * @return The index of the nearest point (the first one on ties), or -1 if count is 0.
+ */
+long batchNearest(double originX, double originY, const float* xs, const float* ys, size_t count, float& distance) {
+    const float ox = static_cast<float>(originX);
+    const float oy = static_cast<float>(originY);
+    float best = FLT_MAX;
+    long bestIndex = -1;
+    size_t i = 0;
+#if defined(SIMD_OPS_AVX2)
+    if (count >= 8 && count <= 0x7FFFFFFF) {
+        __m256 laneBest = _mm256_set1_ps(FLT_MAX);
+        __m256i laneIndex = _mm256_set1_epi32(-1);
+        __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i step = _mm256_set1_epi32(8);
+        for (; i + 8 <= count; i += 8) {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), _mm256_set1_ps(ox));
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), _mm256_set1_ps(oy));
+            __m256 squared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            __m256 closer = _mm256_cmp_ps(squared, laneBest, _CMP_LT_OQ);
+            laneBest = _mm256_blendv_ps(laneBest, squared, closer);
+            laneIndex = _mm256_blendv_epi8(laneIndex, index, _mm256_castps_si256(closer));
+            index = _mm256_add_epi32(index, step);
+        }
+        float values[8];
+        int indices[8];
+        _mm256_storeu_ps(values, laneBest);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices), laneIndex);
+        for (int lane = 0; lane < 8; lane++) {
+            if (indices[lane] >= 0 && (values[lane] < best || (values[lane] == best && indices[lane] < bestIndex))) {
+                best = values[lane];
+                bestIndex = indices[lane];
+            }
+        }
+    }
+#elif defined(SIMD_OPS_SSE2)
+    if (count >= 4 && count <= 0x7FFFFFFF) {
+        __m128 laneBest = _mm_set1_ps(FLT_MAX);
+        __m128i laneIndex = _mm_set1_epi32(-1);
+        __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+        const __m128i step = _mm_set1_epi32(4);
+        for (; i + 4 <= count; i += 4) {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), _mm_set1_ps(ox));
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), _mm_set1_ps(oy));
+            __m128 squared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 closer = _mm_cmplt_ps(squared, laneBest);
+            __m128i mask = _mm_castps_si128(closer);
+            laneBest = _mm_or_ps(_mm_and_ps(closer, squared), _mm_andnot_ps(closer, laneBest));
+            laneIndex = _mm_or_si128(_mm_and_si128(mask, index), _mm_andnot_si128(mask, laneIndex));
+            index = _mm_add_epi32(index, step);
+        }
+        float values[4];
+        int indices[4];
+        _mm_storeu_ps(values, laneBest);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), laneIndex);
+        for (int lane = 0; lane < 4; lane++) {
+            if (indices[lane] >= 0 && (values[lane] < best || (values[lane] == best && indices[lane] < bestIndex))) {
+                best = values[lane];
+                bestIndex = indices[lane];
+            }
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        float dx = xs[i] - ox;
+        float dy = ys[i] - oy;
+        float squared = dx * dx + dy * dy;
+        if (squared < best || bestIndex < 0) {
+            best = squared;
+            bestIndex = static_cast<long>(i);
+        }
+    }
+    if (bestIndex < 0 && count > 0) { // Every distance overflowed or was NaN
+        bestIndex = 0;
+        best = (xs[0] - ox) * (xs[0] - ox) + (ys[0] - oy) * (ys[0] - oy);
+    }
+    if (bestIndex >= 0) {
+        distance = std::sqrt(best);
+    }
+    return bestIndex;
+}
+
+/**
+ * @brief Computes the distance from a pose to each point of a cloud.
+ * @param pose The pose.
+ * @param cloud The points.
+ * @param distances Receives one distance per point.
+ */
+void batchDistances(const Pose& pose, const PointCloud2D& cloud, vector<float>& distances) {
+    distances.resize(cloud.size());
+    if (!cloud.empty()) {
+        batchDistances(pose.getX(), pose.getY(), cloud.x(), cloud.y(), cloud.size(), &distances[0]);
+    }
+}
+
+/**
+ * @brief Computes the bearing from a pose to each point of a cloud, like Pose::findAngleTo.
+ * @param pose The pose (its heading is not used).
+ * @param cloud The points.
+ * @param bearings Receives one angle in degrees in [0, 360) per point.
+ */
+void batchBearings(const Pose& pose, const PointCloud2D& cloud, vector<float>& bearings) {
+    bearings.resize(cloud.size());
+    if (!cloud.empty()) {
+        batchBearings(pose.getX(), pose.getY(), cloud.x(), cloud.y(), cloud.size(), &bearings[0]);
+    }
+}
@@ -0,0 +1,140 @@
+/**
+ * @file BatchGeometry.h
+ * @brief Batch distance and bearing kernels over structure-of-arrays points.
+ * @date October 2026
+ *
+ * The kernels compute what Point::findDistanceTo and Point::findAngleTo compute, for many points
+ * at once: from one origin to N points, between N pairs of points and for every pair of two sets.
+ * Points are given as separate float x and y arrays, as kept by PointCloud2D. The AVX2 path is
+ * used when the compiler targets AVX2 (/arch:AVX2, -mavx2), the SSE2 path on every other x86
+ * target, and plain loops elsewhere or when SIMD_OPS_SCALAR is defined; all three give the
+ * same results to float rounding.
+ * Bearings use fastAtan2 instead of atan2 and are in degrees in [0, 360) like the originals.
+ */
+
+#ifndef BATCHGEOMETRY_H
+#define BATCHGEOMETRY_H
+
+#include "Pose.h"
+#include "PointCloud2D.h"
+#include <cstddef>
+#include <vector>
+
+/** @brief Largest error of fastAtan2 in radians: the polynomial's 1.8e-6 plus float rounding. */
+const double FAST_ATAN2_MAX_ERROR = 2.5e-6;
+
+/**
+ * @brief Polynomial approximation of atan2.
+ * @param y Y component.
+ * @param x X component.
+ * @return The angle in radians in [-pi, pi], within FAST_ATAN2_MAX_ERROR of atan2(y, x); 0 for (0, 0).
+ */
+float fastAtan2(float y, float x);
+
+/**
+ * @brief Returns the instruction set the kernels were compiled for.
+ * @return "AVX2", "SSE2" or "scalar".
+ */
+const char* batchGeometryBackend();
+
+/**
+ * @brief Computes the distance from an origin to each point.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distances Receives count distances.
+ */
+void batchDistances(double originX, double originY, const float* xs, const float* ys, size_t count, float* distances);
+
+/**
+ * @brief Computes the bearing from an origin to each point, like Point::findAngleTo.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchBearings(double originX, double originY, const float* xs, const float* ys, size_t count, float* bearings);
+
+/**
+ * @brief Computes distance and bearing from an origin to each point in one pass.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distances Receives count distances.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchPolar(double originX, double originY, const float* xs, const float* ys, size_t count, float* distances,
+    float* bearings);
+
+/**
+ * @brief Computes the distance between each pair (a[i], b[i]).
+ * @param ax X coordinates of the first points.
+ * @param ay Y coordinates of the first points.
+ * @param bx X coordinates of the second points.
+ * @param by Y coordinates of the second points.
+ * @param count Number of pairs.
+ * @param distances Receives count distances.
+ */
+void batchPairDistances(const float* ax, const float* ay, const float* bx, const float* by, size_t count,
+    float* distances);
+
+/**
+ * @brief Computes the bearing from a[i] to b[i] for each pair.
+ * @param ax X coordinates of the first points.
+ * @param ay Y coordinates of the first points.
+ * @param bx X coordinates of the second points.
+ * @param by Y coordinates of the second points.
+ * @param count Number of pairs.
+ * @param bearings Receives count angles in degrees in [0, 360).
+ */
+void batchPairBearings(const float* ax, const float* ay, const float* bx, const float* by, size_t count,
+    float* bearings);
+
+/**
+ * @brief Computes the distance between every point of a and every point of b.
+ * @param ax X coordinates of the first set.
+ * @param ay Y coordinates of the first set.
+ * @param countA Number of points in the first set.
+ * @param bx X coordinates of the second set.
+ * @param by Y coordinates of the second set.
+ * @param countB Number of points in the second set.
+ * @param distances Receives countA rows of countB distances.
+ */
+void batchDistanceMatrix(const float* ax, const float* ay, size_t countA, const float* bx, const float* by,
+    size_t countB, float* distances);
+
+/**
+ * @brief Finds the point nearest to an origin.
+ * @param originX X of the origin.
+ * @param originY Y of the origin.
+ * @param xs X coordinates of the points.
+ * @param ys Y coordinates of the points.
+ * @param count Number of points.
+ * @param distance Receives the distance to the nearest point (unchanged if count is 0).
+ * @return The index of the nearest point (the first one on ties), or -1 if count is 0.
+ */
+long batchNearest(double originX, double originY, const float* xs, const float* ys, size_t count, float& distance);
+
+/**
+ * @brief Computes the distance from a pose to each point of a cloud.
+ * @param pose The pose.
+ * @param cloud The points.
+ * @param distances Receives one distance per point.
+ */
+void batchDistances(const Pose& pose, const PointCloud2D& cloud, std::vector<float>& distances);
+
+/**
+ * @brief Computes the bearing from a pose to each point of a cloud, like Pose::findAngleTo.
+ * @param pose The pose (its heading is not used).
+ * @param cloud The points.
+ * @param bearings Receives one angle in degrees in [0, 360) per point.
+ */
+void batchBearings(const Pose& pose, const PointCloud2D& cloud, std::vector<float>& bearings);
+
+#endif // BATCHGEOMETRY_H
@@ -0,0 +1,194 @@
+/**
+ * @file BatchGeometryTest.cpp
+ * @brief Test and benchmark application for the batch distance and bearing kernels.
+ * @details Measures the error of fastAtan2 against atan2, checks every kernel against
+ * Point::findDistanceTo, Point::findAngleTo and the Pose versions, including counts that leave a
+ * tail after the last full vector, and compares the throughput with the scalar originals.
+ * @date October, 2026
+ */
+
+#include "BatchGeometry.h"
+#include "Point.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Returns the difference of two angles in degrees, accounting for the wrap at 360.
+ * @param a First angle.
+ * @param b Second angle.
+ * @return The absolute difference in [0, 180].
+ */
+double angleError(double a, double b) {
+    double d = fmod(fabs(a - b), 360.0);
+    return d > 180.0 ? 360.0 - d : d;
+}
+
+/**
+ * @brief Main function for testing the batch kernels.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    cout << "Backend: " << batchGeometryBackend() << endl;
+
+    /**
+     * @test Test 1: fastAtan2 stays within its error bound all around the circle and at any scale.
+     */
+    double worst = 0.0;
+    for (int i = 0; i <= 200000; i++) {
+        double angle = -M_PI + i * (2.0 * M_PI / 200000);
+        for (double scale = 1e-3; scale < 1e4; scale *= 37.0) {
+            float x = static_cast<float>(scale * cos(angle));
+            float y = static_cast<float>(scale * sin(angle));
+            double error = fabs(fastAtan2(y, x) - atan2(static_cast<double>(y), static_cast<double>(x)));
+            error = error > M_PI ? 2.0 * M_PI - error : error; // -pi and pi are the same direction
+            worst = error > worst ? error : worst;
+        }
+    }
+    assert(worst <= FAST_ATAN2_MAX_ERROR);
+    assert(fastAtan2(0.0f, 0.0f) == 0.0f && fastAtan2(0.0f, 1.0f) == 0.0f);
+    assert(fabs(fastAtan2(1.0f, 0.0f) - M_PI / 2) < 1e-6 && fabs(fastAtan2(-1.0f, 0.0f) + M_PI / 2) < 1e-6);
+    assert(fabs(fastAtan2(0.0f, -1.0f) - M_PI) < 1e-6 && fabs(fastAtan2(-0.0f, -1.0f) + M_PI) < 1e-6);
+    cout << "fastAtan2 max error: " << worst << " rad" << endl;
+
+    /**
+     * @test Test 2: One-to-N distances and bearings match Point and Pose, for every tail length.
+     */
+    mt19937 rng(11);
+    uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+    const size_t pointCount = 10007;
+    vector<float> xs(pointCount), ys(pointCount);
+    for (size_t i = 0; i < pointCount; i++) {
+        xs[i] = coordinate(rng);
+        ys[i] = coordinate(rng);
+    }
+    Point origin(3.25, -7.5);
+    vector<float> distances(pointCount), bearings(pointCount);
+    double worstDistance = 0.0, worstBearing = 0.0;
+    for (size_t count = 0; count <= 19; count++) { // Every tail length on every backend
+        batchPolar(origin.getX(), origin.getY(), &xs[0], &ys[0], count, &distances[0], &bearings[0]);
+        for (size_t i = 0; i < count; i++) {
+            Point p(xs[i], ys[i]);
+            assert(fabs(distances[i] - origin.findDistanceTo(p)) < 1e-4);
+            assert(angleError(bearings[i], origin.findAngleTo(p)) < 1e-3);
+        }
+    }
+    batchDistances(origin.getX(), origin.getY(), &xs[0], &ys[0], pointCount, &distances[0]);
+    batchBearings(origin.getX(), origin.getY(), &xs[0], &ys[0], pointCount, &bearings[0]);
+    for (size_t i = 0; i < pointCount; i++) {
+        Point p(xs[i], ys[i]);
+        double e = fabs(distances[i] - origin.findDistanceTo(p)) / origin.findDistanceTo(p);
+        worstDistance = e > worstDistance ? e : worstDistance;
+        e = angleError(bearings[i], origin.findAngleTo(p));
+        worstBearing = e > worstBearing ? e : worstBearing;
+        assert(bearings[i] >= 0.0f && bearings[i] < 360.0f);
+    }
+    assert(worstDistance < 1e-6 && worstBearing < 2e-4);
+    cout << "Worst relative distance error " << worstDistance << ", worst bearing error " << worstBearing << " deg"
+        << endl;
+
+    PointCloud2D cloud;
+    for (size_t i = 0; i < 1001; i++) {
+        cloud.push(xs[i], ys[i]);
+    }
+    Pose pose(-4.0, 12.5, 1.0);
+    vector<float> poseDistances, poseBearings;
+    batchDistances(pose, cloud, poseDistances);
+    batchBearings(pose, cloud, poseBearings);
+    assert(poseDistances.size() == 1001 && poseBearings.size() == 1001);
+    for (size_t i = 0; i < cloud.size(); i++) {
+        Pose target(xs[i], ys[i], 0.0);
+        assert(fabs(poseDistances[i] - pose.findDistanceTo(target)) < 1e-4);
+        assert(angleError(poseBearings[i], pose.findAngleTo(target)) < 1e-3);
+    }
+
+    /**
+     * @test Test 3: Pair and matrix kernels match the one-to-N results.
+     */
+    const size_t pairs = 1003;
+    vector<float> pairDistances(pairs), pairBearings(pairs);
+    batchPairDistances(&xs[0], &ys[0], &xs[pairs], &ys[pairs], pairs, &pairDistances[0]);
+    batchPairBearings(&xs[0], &ys[0], &xs[pairs], &ys[pairs], pairs, &pairBearings[0]);
+    for (size_t i = 0; i < pairs; i++) {
+        Point a(xs[i], ys[i]);
+        Point b(xs[pairs + i], ys[pairs + i]);
+        assert(fabs(pairDistances[i] - a.findDistanceTo(b)) < 1e-4);
+        assert(angleError(pairBearings[i], a.findAngleTo(b)) < 1e-3);
+    }
+    const size_t rows = 13, columns = 29;
+    vector<float> matrix(rows * columns), row(columns);
+    batchDistanceMatrix(&xs[0], &ys[0], rows, &xs[100], &ys[100], columns, &matrix[0]);
+    for (size_t r = 0; r < rows; r++) {
+        batchDistances(xs[r], ys[r], &xs[100], &ys[100], columns, &row[0]);
+        for (size_t c = 0; c < columns; c++) {
+            assert(matrix[r * columns + c] == row[c]);
+        }
+    }
+
+    /**
+     * @test Test 4: The nearest point is found, the first one wins on ties and empty input gives -1.
+     */
+    for (size_t count = 1; count <= pointCount; count += count < 40 ? 1 : 997) {
+        float nearest = -1.0f;
+        long index = batchNearest(origin.getX(), origin.getY(), &xs[0], &ys[0], count, nearest);
+        size_t expected = 0;
+        for (size_t i = 1; i < count; i++) {
+            if (origin.findDistanceTo(Point(xs[i], ys[i])) < origin.findDistanceTo(Point(xs[expected], ys[expected]))) {
+                expected = i;
+            }
+        }
+        assert(index == static_cast<long>(expected));
+        assert(fabs(nearest - origin.findDistanceTo(Point(xs[expected], ys[expected]))) < 1e-4);
+    }
+    vector<float> same(21, 2.0f);
+    float nearest = -1.0f;
+    assert(batchNearest(0.0, 0.0, &same[0], &same[0], same.size(), nearest) == 0);
+    same[9] = same[17] = 1.0f;
+    assert(batchNearest(0.0, 0.0, &same[0], &same[0], same.size(), nearest) == 9);
+    assert(batchNearest(0.0, 0.0, &same[0], &same[0], 0, nearest) == -1 && nearest == static_cast<float>(sqrt(2.0)));
+
+    /**
+     * @test Test 5: Throughput of the kernels against the scalar originals.
+     */
+    const int repeats = 200;
+    vector<Point> points;
+    for (size_t i = 0; i < pointCount; i++) {
+        points.push_back(Point(xs[i], ys[i]));
+    }
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        for (size_t i = 0; i < pointCount; i++) {
+            checksum += origin.findDistanceTo(points[i]) + origin.findAngleTo(points[i]);
+        }
+    }
+    double scalarMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        batchPolar(origin.getX(), origin.getY(), &xs[0], &ys[0], pointCount, &distances[0], &bearings[0]);
+        checksum -= distances[r] + bearings[r];
+    }
+    double batchMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        checksum += batchNearest(origin.getX(), origin.getY(), &xs[0], &ys[0], pointCount, nearest);
+    }
+    double nearestMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    double million = repeats * static_cast<double>(pointCount) / 1e6;
+    cout << "Distance + bearing: scalar " << million / scalarMs * 1000.0 << " M/s, batch "
+        << million / batchMs * 1000.0 << " M/s (" << scalarMs / batchMs << "x); nearest search "
+        << million / nearestMs * 1000.0 << " M/s" << endl;
+    volatile double sink = checksum; // Keeps the timed loops from being optimized away
+    (void)sink;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
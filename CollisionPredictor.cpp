@@ -0,0 +1,329 @@
+/**
+ * @file CollisionPredictor.cpp
+ * @brief Implementation of the CollisionPredictor class.
+ * @date October 2026
+ */
+
+#include "CollisionPredictor.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Constructor for the CollisionPredictor class.
+ * @param maxObstacles Number of obstacles that can be added; further ones are dropped.
+ * @param robotRadius Radius of the robot, in meters.
+ * @param horizonSeconds Time looked ahead, in seconds.
+ * @param stepCount Segments the path over the horizon is divided into.
+ */
+CollisionPredictor::CollisionPredictor(size_t maxObstacles, double robotRadius, double horizonSeconds, int stepCount)
+    : obstacles(maxObstacles), obstacleCount(0), droppedObstacles(0), pathX(stepCount > 0 ? stepCount + 1 : 2),
+      pathY(stepCount > 0 ? stepCount + 1 : 2), radius(robotRadius), horizon(horizonSeconds),
+      steps(stepCount > 0 ? stepCount : 1), stopTime(1.0), slowTime(2.5), nearestObstacle(-1), lastUs(0.0) {}
+
+/**
+ * @brief Sets the times to collision that stop the robot and slow it down.
+ * @param stopSeconds Collisions sooner than this stop the robot.
+ * @param slowSeconds Collisions sooner than this slow the robot down; at least stopSeconds.
+ * @return True on success, false if the times are invalid, in which case they are not changed.
+ */
+bool CollisionPredictor::setThresholds(double stopSeconds, double slowSeconds) {
+    if (stopSeconds < 0.0 || slowSeconds < stopSeconds) {
+        cerr << "Error: Invalid collision thresholds!" << endl;
+        return false;
+    }
+    stopTime = stopSeconds;
+    slowTime = slowSeconds;
+    return true;
+}
+
+/**
+ * @brief Removes every obstacle.
+ */
+void CollisionPredictor::clearObstacles() {
+    obstacleCount = 0;
+    droppedObstacles = 0;
+}
+
+/**
+ * @brief Adds a convex polygon.
+ * @param xs X of the vertices in the world frame, in either winding order.
+ * @param ys Y of the vertices in the world frame.
+ * @param vertexCount Number of vertices: 2 for a segment, up to MAX_VERTICES.
+ * @param vx Velocity of the obstacle along x, in meters per second.
+ * @param vy Velocity of the obstacle along y, in meters per second.
+ * @return True on success, false if the polygon is invalid or the array is full.
+ */
+bool CollisionPredictor::addPolygon(const float* xs, const float* ys, int vertexCount, double vx, double vy) {
+    if (vertexCount < 2 || vertexCount > MAX_VERTICES) {
+        cerr << "Error: An obstacle needs 2 to " << MAX_VERTICES << " vertices!" << endl;
+        return false;
+    }
+    if (obstacleCount == obstacles.size()) {
+        droppedObstacles++;
+        return false;
+    }
+    double area = 0.0;
+    for (int i = 0, j = vertexCount - 1; i < vertexCount; j = i++) {
+        area += static_cast<double>(xs[j]) * ys[i] - static_cast<double>(xs[i]) * ys[j];
+    }
+    Obstacle& o = obstacles[obstacleCount++];
+    for (int i = 0; i < vertexCount; i++) {
+        int from = area < 0.0 ? vertexCount - 1 - i : i; // Clockwise polygons are reversed
+        o.xs[i] = xs[from];
+        o.ys[i] = ys[from];
+        o.minX = i == 0 || xs[from] < o.minX ? xs[from] : o.minX;
+        o.minY = i == 0 || ys[from] < o.minY ? ys[from] : o.minY;
+        o.maxX = i == 0 || xs[from] > o.maxX ? xs[from] : o.maxX;
+        o.maxY = i == 0 || ys[from] > o.maxY ? ys[from] : o.maxY;
+    }
+    o.count = vertexCount;
+    o.vx = static_cast<float>(vx);
+    o.vy = static_cast<float>(vy);
+    return true;
+}
+
+/**
+ * @brief Adds an axis-aligned box.
+ * @param x X of the centre in the world frame.
+ * @param y Y of the centre in the world frame.
+ * @param halfWidth Half the x extent.
+ * @param halfHeight Half the y extent.
+ * @param vx Velocity of the obstacle along x, in meters per second.
+ * @param vy Velocity of the obstacle along y, in meters per second.
+ * @return True on success, false if the array is full.
+ */
+bool CollisionPredictor::addBox(double x, double y, double halfWidth, double halfHeight, double vx, double vy) {
+    const float xs[4] = { static_cast<float>(x - halfWidth), static_cast<float>(x + halfWidth),
+        static_cast<float>(x + halfWidth), static_cast<float>(x - halfWidth) };
+    const float ys[4] = { static_cast<float>(y - halfHeight), static_cast<float>(y - halfHeight),
+        static_cast<float>(y + halfHeight), static_cast<float>(y + halfHeight) };
+    return addPolygon(xs, ys, 4, vx, vy);
+}
+
+/**
+ * @brief Adds the box of every track with the track's velocity.
+ * @param tracker The tracker.
+ * @return The number of obstacles added.
+ */
+size_t CollisionPredictor::addTracks(const ObstacleTracker& tracker) {
+    size_t added = 0;
+    for (size_t i = 0; i < tracker.getTrackCount(); i++) {
+        const ObstacleTrack& t = tracker.getTrack(i);
+        added += addBox(t.x, t.y, t.halfWidth, t.halfHeight, t.vx, t.vy) ? 1 : 0;
+    }
+    return added;
+}
+
+/**
+ * @brief Adds every line as a standing segment.
+ * @param extractor The extractor, after extracting a scan in the world frame.
+ * @return The number of obstacles added.
+ */
+size_t CollisionPredictor::addLines(const LineExtractor& extractor) {
+    size_t added = 0;
+    for (size_t i = 0; i < extractor.getLineCount(); i++) {
+        const LineFeature& line = extractor.getLine(i);
+        const float xs[2] = { line.x0, line.x1 };
+        const float ys[2] = { line.y0, line.y1 };
+        added += addPolygon(xs, ys, 2) ? 1 : 0;
+    }
+    return added;
+}
+
+/**
+ * @brief Returns the number of obstacles.
+ * @return The number of obstacles.
+ */
+size_t CollisionPredictor::getObstacleCount() const {
+    return obstacleCount;
+}
+
+/**
+ * @brief Returns the number of obstacles that did not fit in the array since clearObstacles().
+ * @return The number of dropped obstacles.
+ */
+unsigned long CollisionPredictor::getDroppedObstacles() const {
+    return droppedObstacles;
+}
+
+/**
+ * @brief Finds where a point moving along a segment first comes within the radius of an obstacle.
+ *
+ * The region within the radius of a convex polygon is bounded by its edges pushed out along
+ * their outward normals and by circles around its vertices. A start outside the region enters
+ * it first through one of these pieces, so the earliest hit over all of them is the contact.
+ * A segment's two edges, one per direction, bound it on both sides. A start that is already
+ * within the radius is a contact at 0 unless the motion increases its distance to every edge
+ * it touches; the robot may then back out, and the sweep goes on for a later contact.
+ *
+ * @param obstacle The obstacle, at the position it was added at.
+ * @param ax X of the start of the segment, relative to the obstacle's motion.
+ * @param ay Y of the start of the segment.
+ * @param dx X component of the segment.
+ * @param dy Y component of the segment.
+ * @return The fraction of the segment in [0, 1] at the first contact, or -1 if there is none.
+ */
+double CollisionPredictor::sweep(const Obstacle& obstacle, double ax, double ay, double dx, double dy) const {
+    const double r2 = radius * radius;
+    const int n = obstacle.count;
+
+    // Already touching: inside the polygon, or within the radius of an edge and not moving away from it
+    bool inside = n >= 3;
+    for (int i = 0; i < n; i++) {
+        int j = i + 1 < n ? i + 1 : 0;
+        double px = obstacle.xs[i], py = obstacle.ys[i];
+        double ex = obstacle.xs[j] - px, ey = obstacle.ys[j] - py;
+        double length2 = ex * ex + ey * ey;
+        double u = length2 > 0.0 ? ((ax - px) * ex + (ay - py) * ey) / length2 : 0.0;
+        u = u < 0.0 ? 0.0 : (u > 1.0 ? 1.0 : u);
+        double fx = ax - px - u * ex, fy = ay - py - u * ey;
+        if (fx * fx + fy * fy <= r2 && fx * dx + fy * dy <= 0.0) {
+            return 0.0;
+        }
+        inside = inside && (ax - px) * ey - (ay - py) * ex <= 0.0;
+    }
+    if (inside) {
+        return 0.0;
+    }
+
+    double best = 2.0;
+    const double a = dx * dx + dy * dy;
+    if (a <= 0.0) {
+        return -1.0; // No relative motion
+    }
+    for (int i = 0; i < n; i++) {
+        int j = i + 1 < n ? i + 1 : 0;
+        double px = obstacle.xs[i], py = obstacle.ys[i];
+        double ex = obstacle.xs[j] - px, ey = obstacle.ys[j] - py;
+        double length = sqrt(ex * ex + ey * ey);
+
+        // The edge pushed out along its outward (right-hand) normal
+        if (length > 0.0) {
+            double nx = ey / length, ny = -ex / length;
+            double approach = dx * nx + dy * ny;
+            double height = (ax - px) * nx + (ay - py) * ny - radius;
+            if (approach < 0.0 && height >= 0.0) {
+                double s = height / -approach;
+                double u = ((ax + s * dx - px) * ex + (ay + s * dy - py) * ey) / (length * length);
+                if (s < best && u >= 0.0 && u <= 1.0) {
+                    best = s;
+                }
+            }
+        }
+
+        // The circle around the vertex
+        double fx = ax - px, fy = ay - py;
+        double b = fx * dx + fy * dy;
+        double c = fx * fx + fy * fy - r2;
+        double discriminant = b * b - a * c;
+        if (b < 0.0 && c >= 0.0 && discriminant >= 0.0) { // A start within the circle is moving away (see above)
+            double s = (-b - sqrt(discriminant)) / a;
+            best = s < best ? s : best;
+        }
+    }
+    return best <= 1.0 ? best : -1.0;
+}
+
+/**
+ * @brief Predicts the time to collision of a velocity command.
+ *
+ * The path is sampled once; with a constant body velocity (vx, vy) and turn rate w, the robot
+ * has moved by R(th) * [vx sin(wt) - vy (1 - cos(wt)), vx (1 - cos(wt)) + vy sin(wt)] / w at
+ * time t. Each obstacle is then checked step by step, relative to its own motion, up to the
+ * earliest collision found so far.
+ *
+ * @param pose Current pose of the robot in the world frame (th in radians).
+ * @param command Body-frame velocity the robot is commanded to keep.
+ * @return The time until the robot touches an obstacle, 0 if it already does, or -1 if it
+ *         touches none within the horizon.
+ */
+double CollisionPredictor::timeToCollision(const Pose& pose, const VelocityCommand& command) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    const double dt = horizon / steps;
+    const double c = cos(pose.getTh()), s = sin(pose.getTh());
+    const double w = command.omega;
+    double reachMinX = pose.getX(), reachMinY = pose.getY();
+    double reachMaxX = reachMinX, reachMaxY = reachMinY;
+    for (int k = 0; k <= steps; k++) {
+        double t = k * dt, bx, by;
+        if (fabs(w) > 1e-9) {
+            double sw = sin(w * t), cw = 1.0 - cos(w * t);
+            bx = (command.vx * sw - command.vy * cw) / w;
+            by = (command.vx * cw + command.vy * sw) / w;
+        }
+        else {
+            bx = command.vx * t;
+            by = command.vy * t;
+        }
+        pathX[k] = pose.getX() + c * bx - s * by;
+        pathY[k] = pose.getY() + s * bx + c * by;
+        reachMinX = pathX[k] < reachMinX ? pathX[k] : reachMinX;
+        reachMinY = pathY[k] < reachMinY ? pathY[k] : reachMinY;
+        reachMaxX = pathX[k] > reachMaxX ? pathX[k] : reachMaxX;
+        reachMaxY = pathY[k] > reachMaxY ? pathY[k] : reachMaxY;
+    }
+    reachMinX -= radius;
+    reachMinY -= radius;
+    reachMaxX += radius;
+    reachMaxY += radius;
+
+    double earliest = -1.0;
+    nearestObstacle = -1;
+    for (size_t i = 0; i < obstacleCount; i++) {
+        const Obstacle& o = obstacles[i];
+        // Skip obstacles whose box, swept over the horizon, misses the box of the path
+        double shiftX = o.vx * horizon, shiftY = o.vy * horizon;
+        if (o.minX + (shiftX < 0.0 ? shiftX : 0.0) > reachMaxX || o.maxX + (shiftX > 0.0 ? shiftX : 0.0) < reachMinX
+            || o.minY + (shiftY < 0.0 ? shiftY : 0.0) > reachMaxY || o.maxY + (shiftY > 0.0 ? shiftY : 0.0) < reachMinY) {
+            continue;
+        }
+        for (int k = 0; k < steps && (earliest < 0.0 || k * dt < earliest); k++) {
+            double t0 = k * dt, t1 = t0 + dt;
+            double ax = pathX[k] - o.vx * t0, ay = pathY[k] - o.vy * t0;
+            double fraction = sweep(o, ax, ay, pathX[k + 1] - o.vx * t1 - ax, pathY[k + 1] - o.vy * t1 - ay);
+            if (fraction >= 0.0) {
+                double time = t0 + fraction * dt;
+                if (earliest < 0.0 || time < earliest) {
+                    earliest = time;
+                    nearestObstacle = static_cast<long>(i);
+                }
+                break;
+            }
+        }
+    }
+    lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+    return earliest;
+}
+
+/**
+ * @brief Decides whether the robot can keep a velocity command.
+ * @param pose Current pose of the robot in the world frame (th in radians).
+ * @param command Body-frame velocity the robot is commanded to keep.
+ * @return STOP or SLOW if the time to collision is below the stop or slow-down time, else CLEAR.
+ */
+CollisionPredictor::Decision CollisionPredictor::evaluate(const Pose& pose, const VelocityCommand& command) {
+    double time = timeToCollision(pose, command);
+    if (time < 0.0 || time >= slowTime) {
+        return CLEAR;
+    }
+    return time < stopTime ? STOP : SLOW;
+}
+
+/**
+ * @brief Returns the obstacle of the earliest collision of the last evaluation.
+ * @return The index of the obstacle in the order they were added, or -1 if there was no collision.
+ */
+long CollisionPredictor::getNearestObstacle() const {
+    return nearestObstacle;
+}
+
+/**
+ * @brief Returns the duration of the last evaluation.
+ * @return The duration in microseconds.
+ */
+double CollisionPredictor::getLastUs() const {
+    return lastUs;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file CollisionPredictor.h
+ * @brief Declaration of the CollisionPredictor class, which predicts the time to collision of a commanded motion.
+ * @date October 2026
+ */
+
+#ifndef COLLISIONPREDICTOR_H
+#define COLLISIONPREDICTOR_H
+
+#include "CommandStreamer.h"
+#include "LineExtractor.h"
+#include "ObstacleTracker.h"
+#include "Pose.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class CollisionPredictor
+ * @brief Predicts when the robot, following a velocity command, would touch an obstacle.
+ *
+ * The robot is a circle; obstacles are convex polygons that move at constant velocity: the
+ * boxes of tracked obstacles, or walls as two-vertex polygons. The robot path under a constant
+ * body velocity is an arc, sampled at a fixed number of steps over the horizon. Within a step,
+ * the robot moves along a straight segment relative to each obstacle, so the first contact is
+ * where that segment enters the polygon grown by the robot radius: the polygon's edges pushed
+ * out by the radius and circles around its vertices. The result is exact for straight motion
+ * and follows arcs to within the sagitta of a step.
+ *
+ * The cost of evaluate() is at most obstacles times steps times vertices; obstacles that cannot
+ * be reached within the horizon are skipped after a box test.
+ */
+class CollisionPredictor {
+public:
+    /** @brief What the robot should do about the predicted time to collision. */
+    enum Decision {
+        CLEAR,  /**< No collision within the slow-down time. */
+        SLOW,   /**< A collision within the slow-down time; the robot should slow down. */
+        STOP    /**< A collision within the stop time; the robot should stop. */
+    };
+
+    /** @brief Largest number of vertices of an obstacle polygon. */
+    static const int MAX_VERTICES = 8;
+
+private:
+    /**
+     * @struct Obstacle
+     * @brief A convex polygon with counter-clockwise vertices moving at constant velocity.
+     */
+    struct Obstacle {
+        float xs[MAX_VERTICES];  /**< X of the vertices in the world frame. */
+        float ys[MAX_VERTICES];  /**< Y of the vertices in the world frame. */
+        int count;               /**< Number of vertices: 2 for a segment, 3 or more for a polygon. */
+        float vx, vy;            /**< Velocity in meters per second. */
+        float minX, minY;        /**< Lower corner of the bounding box. */
+        float maxX, maxY;        /**< Upper corner of the bounding box. */
+    };
+
+    std::vector<Obstacle> obstacles;  /**< The obstacles; only the first obstacleCount are valid. */
+    size_t obstacleCount;             /**< Number of obstacles. */
+    unsigned long droppedObstacles;   /**< Obstacles that did not fit in the array since clearObstacles(). */
+    std::vector<double> pathX;        /**< X of the robot at each step of the last evaluation. */
+    std::vector<double> pathY;        /**< Y of the robot at each step of the last evaluation. */
+    double radius;                    /**< Radius of the robot, in meters. */
+    double horizon;                   /**< Time looked ahead, in seconds. */
+    int steps;                        /**< Segments the path over the horizon is divided into. */
+    double stopTime;                  /**< Collisions sooner than this stop the robot, in seconds. */
+    double slowTime;                  /**< Collisions sooner than this slow the robot down, in seconds. */
+    long nearestObstacle;             /**< Obstacle of the earliest collision of the last evaluation, or -1. */
+    double lastUs;                    /**< Duration of the last timeToCollision() call, in microseconds. */
+
+    /**
+     * @brief Finds where a point moving along a segment first comes within the radius of an obstacle.
+     * @param obstacle The obstacle, at the position it was added at.
+     * @param ax X of the start of the segment, relative to the obstacle's motion.
+     * @param ay Y of the start of the segment.
+     * @param dx X component of the segment.
+     * @param dy Y component of the segment.
+     * @return The fraction of the segment in [0, 1] at the first contact, or -1 if there is none.
+     */
+    double sweep(const Obstacle& obstacle, double ax, double ay, double dx, double dy) const;
+
+public:
+    /**
+     * @brief Constructor for the CollisionPredictor class.
+     * @param maxObstacles Number of obstacles that can be added; further ones are dropped.
+     * @param robotRadius Radius of the robot, in meters.
+     * @param horizonSeconds Time looked ahead, in seconds.
+     * @param stepCount Segments the path over the horizon is divided into.
+     */
+    explicit CollisionPredictor(size_t maxObstacles = 256, double robotRadius = 0.25, double horizonSeconds = 3.0,
+        int stepCount = 12);
+
+    /**
+     * @brief Sets the times to collision that stop the robot and slow it down.
+     * @param stopSeconds Collisions sooner than this stop the robot.
+     * @param slowSeconds Collisions sooner than this slow the robot down; at least stopSeconds.
+     * @return True on success, false if the times are invalid, in which case they are not changed.
+     */
+    bool setThresholds(double stopSeconds, double slowSeconds);
+
+    /**
+     * @brief Removes every obstacle.
+     */
+    void clearObstacles();
+
+    /**
+     * @brief Adds a convex polygon.
+     * @param xs X of the vertices in the world frame, in either winding order.
+     * @param ys Y of the vertices in the world frame.
+     * @param vertexCount Number of vertices: 2 for a segment, up to MAX_VERTICES.
+     * @param vx Velocity of the obstacle along x, in meters per second.
+     * @param vy Velocity of the obstacle along y, in meters per second.
+     * @return True on success, false if the polygon is invalid or the array is full.
+     */
+    bool addPolygon(const float* xs, const float* ys, int vertexCount, double vx = 0.0, double vy = 0.0);
+
+    /**
+     * @brief Adds an axis-aligned box.
+     * @param x X of the centre in the world frame.
+     * @param y Y of the centre in the world frame.
+     * @param halfWidth Half the x extent.
+     * @param halfHeight Half the y extent.
+     * @param vx Velocity of the obstacle along x, in meters per second.
+     * @param vy Velocity of the obstacle along y, in meters per second.
+     * @return True on success, false if the array is full.
+     */
+    bool addBox(double x, double y, double halfWidth, double halfHeight, double vx = 0.0, double vy = 0.0);
+
+    /**
+     * @brief Adds the box of every track with the track's velocity.
+     * @param tracker The tracker.
+     * @return The number of obstacles added.
+     */
+    size_t addTracks(const ObstacleTracker& tracker);
+
+    /**
+     * @brief Adds every line as a standing segment.
+     * @param extractor The extractor, after extracting a scan in the world frame.
+     * @return The number of obstacles added.
+     */
+    size_t addLines(const LineExtractor& extractor);
+
+    /**
+     * @brief Returns the number of obstacles.
+     * @return The number of obstacles.
+     */
+    size_t getObstacleCount() const;
+
+    /**
+     * @brief Returns the number of obstacles that did not fit in the array since clearObstacles().
+     * @return The number of dropped obstacles.
+     */
+    unsigned long getDroppedObstacles() const;
+
+    /**
+     * @brief Predicts the time to collision of a velocity command.
+     * @param pose Current pose of the robot in the world frame (th in radians).
+     * @param command Body-frame velocity the robot is commanded to keep.
+     * @return The time until the robot touches an obstacle, 0 if it already does, or -1 if it
+     *         touches none within the horizon.
+     */
+    double timeToCollision(const Pose& pose, const VelocityCommand& command);
+
+    /**
+     * @brief Decides whether the robot can keep a velocity command.
+     * @param pose Current pose of the robot in the world frame (th in radians).
+     * @param command Body-frame velocity the robot is commanded to keep.
+     * @return STOP or SLOW if the time to collision is below the stop or slow-down time, else CLEAR.
+     */
+    Decision evaluate(const Pose& pose, const VelocityCommand& command);
+
+    /**
+     * @brief Returns the obstacle of the earliest collision of the last evaluation.
+     * @return The index of the obstacle in the order they were added, or -1 if there was no collision.
+     */
+    long getNearestObstacle() const;
+
+    /**
+     * @brief Returns the duration of the last evaluation.
+     * @return The duration in microseconds.
+     */
+    double getLastUs() const;
+};
+
+#endif // COLLISIONPREDICTOR_H
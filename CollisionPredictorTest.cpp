@@ -0,0 +1,181 @@
+/**
+ * @file CollisionPredictorTest.cpp
+ * @brief Test and benchmark application for the CollisionPredictor class.
+ * @details Checks the time to collision against closed-form values for straight motion toward
+ * boxes and walls, crossing and receding obstacles, turning away, contact at the start, the
+ * decisions and the obstacle capacity, and measures the time per evaluation with a crowd of
+ * tracked obstacles and walls.
+ * @date October, 2026
+ */
+
+#include "CollisionPredictor.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+using namespace std;
+
+/**
+ * @brief Builds a velocity command.
+ * @param vx Forward velocity in m/s.
+ * @param vy Lateral velocity in m/s.
+ * @param omega Turn rate in rad/s.
+ * @return The command.
+ */
+VelocityCommand makeCommand(double vx, double vy, double omega) {
+    VelocityCommand command = { vx, vy, omega };
+    return command;
+}
+
+/**
+ * @brief Main function for testing the collision predictor.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const Pose origin(0.0, 0.0, 0.0);
+
+    /**
+     * @test Test 1: Driving straight at a standing box, the time to collision is the gap over
+     * the speed, and the decision follows the thresholds.
+     */
+    CollisionPredictor predictor; // Radius 0.25 m, horizon 3 s, stop below 1 s, slow below 2.5 s
+    predictor.addBox(1.5, 0.0, 0.2, 0.2);
+    double time = predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 0.0));
+    assert(fabs(time - (1.5 - 0.2 - 0.25) / 0.5) < 1e-6 && predictor.getNearestObstacle() == 0);
+    assert(predictor.evaluate(origin, makeCommand(0.5, 0.0, 0.0)) == CollisionPredictor::SLOW);
+    assert(predictor.evaluate(origin, makeCommand(1.5, 0.0, 0.0)) == CollisionPredictor::STOP);
+    assert(predictor.evaluate(origin, makeCommand(0.2, 0.0, 0.0)) == CollisionPredictor::CLEAR);
+    assert(predictor.evaluate(origin, makeCommand(-0.5, 0.0, 0.0)) == CollisionPredictor::CLEAR);
+    assert(predictor.timeToCollision(origin, makeCommand(-0.5, 0.0, 0.0)) < 0.0);
+    cout << "Straight at a box 1.5 m ahead at 0.5 m/s: " << (1.5 - 0.2 - 0.25) / 0.5 << " s" << endl;
+
+    /**
+     * @test Test 2: A wall segment is hit at the same time from either side and in either
+     * vertex order; a clockwise polygon behaves like its counter-clockwise twin.
+     */
+    predictor.clearObstacles();
+    const float wallX[2] = { 1.0f, 1.0f }, wallY[2] = { -2.0f, 2.0f };
+    const float wallXReversed[2] = { 1.0f, 1.0f }, wallYReversed[2] = { 2.0f, -2.0f };
+    assert(predictor.addPolygon(wallX, wallY, 2));
+    double forward = predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 0.0));
+    double fromBehind = predictor.timeToCollision(Pose(2.0, 0.0, SE2_PI), makeCommand(0.5, 0.0, 0.0));
+    predictor.clearObstacles();
+    assert(predictor.addPolygon(wallXReversed, wallYReversed, 2));
+    double reversed = predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 0.0));
+    assert(fabs(forward - 1.5) < 1e-6 && fabs(fromBehind - 1.5) < 1e-6 && fabs(reversed - 1.5) < 1e-6);
+    // Sideways motion of the omnidirectional base
+    assert(fabs(predictor.timeToCollision(Pose(1.0, -3.0, 0.0), makeCommand(0.0, 1.0, 0.0)) - 0.75) < 1e-6);
+
+    predictor.clearObstacles();
+    const float clockwiseX[4] = { 1.5f, 1.5f, 2.0f, 2.0f }, clockwiseY[4] = { -0.3f, 0.3f, 0.3f, -0.3f };
+    assert(predictor.addPolygon(clockwiseX, clockwiseY, 4));
+    assert(fabs(predictor.timeToCollision(origin, makeCommand(1.0, 0.0, 0.0)) - 1.25) < 1e-6);
+    assert(!predictor.addPolygon(clockwiseX, clockwiseY, 1));
+    assert(!predictor.addPolygon(clockwiseX, clockwiseY, CollisionPredictor::MAX_VERTICES + 1));
+
+    /**
+     * @test Test 3: A moving obstacle that crosses the path is hit although it starts away from
+     * it; the same obstacle standing still or moving away is not.
+     */
+    predictor.clearObstacles();
+    predictor.addBox(2.0, -2.0, 0.2, 0.2, 0.0, 1.0);
+    time = predictor.timeToCollision(origin, makeCommand(1.0, 0.0, 0.0));
+    assert(time > 1.3 && time < 2.0);
+    predictor.clearObstacles();
+    predictor.addBox(2.0, -2.0, 0.2, 0.2);
+    assert(predictor.timeToCollision(origin, makeCommand(1.0, 0.0, 0.0)) < 0.0);
+    predictor.clearObstacles();
+    predictor.addBox(1.0, 0.0, 0.2, 0.2, 1.0, 0.0);
+    assert(predictor.timeToCollision(origin, makeCommand(0.8, 0.0, 0.0)) < 0.0);
+    // An obstacle coming head-on is hit sooner than a standing one
+    predictor.clearObstacles();
+    predictor.addBox(3.0, 0.0, 0.2, 0.2, -1.0, 0.0);
+    assert(fabs(predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 0.0)) - (3.0 - 0.45) / 1.5) < 1e-6);
+    cout << "Crossing obstacle: " << time << " s" << endl;
+
+    /**
+     * @test Test 4: Turning away avoids an obstacle that driving straight would hit, and a
+     * robot already touching an obstacle has a time to collision of 0 unless it backs away.
+     */
+    predictor.clearObstacles();
+    predictor.addBox(1.5, 0.0, 0.2, 0.2);
+    assert(predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 1.0)) < 0.0);
+    assert(predictor.timeToCollision(origin, makeCommand(0.5, 0.0, 0.0)) > 0.0);
+    // Turning in place does not move the circle
+    assert(predictor.timeToCollision(origin, makeCommand(0.0, 0.0, 1.0)) < 0.0);
+    assert(predictor.timeToCollision(Pose(1.1, 0.0, 0.0), makeCommand(0.0, 0.0, 0.0)) == 0.0);
+    assert(predictor.timeToCollision(Pose(1.5, 0.0, 0.0), makeCommand(-0.5, 0.0, 0.0)) == 0.0);
+    assert(predictor.evaluate(Pose(1.5, 0.0, 0.0), makeCommand(0.0, 0.0, 0.0)) == CollisionPredictor::STOP);
+    assert(predictor.evaluate(Pose(1.1, 0.0, 0.0), makeCommand(0.1, 0.0, 0.0)) == CollisionPredictor::STOP);
+    assert(predictor.evaluate(Pose(1.1, 0.0, 0.0), makeCommand(0.0, 0.3, 0.0)) == CollisionPredictor::STOP);
+    assert(predictor.timeToCollision(Pose(1.1, 0.0, 0.0), makeCommand(-0.5, 0.0, 0.0)) < 0.0);
+    assert(predictor.evaluate(Pose(1.1, 0.0, 0.0), makeCommand(-0.5, 0.0, 0.0)) == CollisionPredictor::CLEAR);
+    // Backing out of contact towards a second box still finds that one
+    predictor.addBox(0.0, 0.0, 0.2, 0.2);
+    assert(fabs(predictor.timeToCollision(Pose(1.1, 0.0, 0.0), makeCommand(-0.5, 0.0, 0.0)) - (1.1 - 0.45) / 0.5) < 1e-6);
+
+    /**
+     * @test Test 5: Tracks are added with their velocity, obstacles beyond the capacity are
+     * counted as dropped, and invalid thresholds are rejected.
+     */
+    ObstacleTracker tracker;
+    for (int k = 0; k < 20; k++) {
+        ScanCluster cluster = ScanCluster();
+        cluster.centroidX = 2.0f;
+        cluster.centroidY = static_cast<float>(-3.0 + 0.1 * k);
+        cluster.minX = cluster.centroidX - 0.2f;
+        cluster.maxX = cluster.centroidX + 0.2f;
+        cluster.minY = cluster.centroidY - 0.2f;
+        cluster.maxY = cluster.centroidY + 0.2f;
+        tracker.update(&cluster, 1, 0.1 * k);
+    }
+    predictor.clearObstacles();
+    assert(predictor.addTracks(tracker) == 1 && predictor.getObstacleCount() == 1);
+    // The track is at (2, -1.1) heading +y at 1 m/s: it crosses the path, a standing box would not
+    time = predictor.timeToCollision(origin, makeCommand(1.5, 0.0, 0.0));
+    assert(time > 0.8 && time < 1.1);
+    const ObstacleTrack& track = tracker.getTrack(0);
+    predictor.clearObstacles();
+    predictor.addBox(track.x, track.y, track.halfWidth, track.halfHeight);
+    assert(predictor.timeToCollision(origin, makeCommand(1.5, 0.0, 0.0)) < 0.0);
+
+    CollisionPredictor small(2);
+    assert(small.addBox(1.0, 0.0, 0.1, 0.1) && small.addBox(2.0, 0.0, 0.1, 0.1));
+    assert(!small.addBox(3.0, 0.0, 0.1, 0.1));
+    assert(small.getObstacleCount() == 2 && small.getDroppedObstacles() == 1);
+    small.clearObstacles();
+    assert(small.getObstacleCount() == 0 && small.getDroppedObstacles() == 0);
+    assert(!small.setThresholds(2.0, 1.0) && !small.setThresholds(-1.0, 1.0) && small.setThresholds(0.5, 2.0));
+
+    /**
+     * @test Test 6: An evaluation against 128 tracked obstacles and 64 walls takes a small part
+     * of a control cycle.
+     */
+    CollisionPredictor crowd;
+    mt19937 rng(3);
+    uniform_real_distribution<double> position(-6.0, 6.0), speed(-1.0, 1.0);
+    for (int i = 0; i < 128; i++) {
+        crowd.addBox(position(rng), position(rng), 0.2, 0.2, speed(rng), speed(rng));
+    }
+    for (int i = 0; i < 64; i++) {
+        const float xs[2] = { static_cast<float>(position(rng)), static_cast<float>(position(rng)) };
+        const float ys[2] = { static_cast<float>(position(rng)), static_cast<float>(position(rng)) };
+        crowd.addPolygon(xs, ys, 2);
+    }
+    const int evaluations = 20000;
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int e = 0; e < evaluations; e++) {
+        double heading = e * 0.001;
+        checksum += crowd.timeToCollision(Pose(0.0, 0.0, heading), makeCommand(0.6, 0.1, 0.3));
+    }
+    double perEvaluationUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / evaluations;
+    assert(perEvaluationUs < 200.0);
+    cout << "Evaluation, 192 obstacles: " << perEvaluationUs << " us" << endl;
+    volatile double sink = checksum; // Keeps the timed loop from being optimized away
+    (void)sink;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * @file CommandStreamer.cpp
+ * @brief Implementation of the CommandStreamer class for rate-limited velocity command streaming.
+ * @date October 2026
+ */
+
+#include "CommandStreamer.h"
+#include <cmath>
+using namespace std;
+
+/**
+ * @brief Constructor for the CommandStreamer class.
+ * @param robotAPI Pointer to the FestoRobotAPI object the commands are sent to.
+ * @param apiMutex Mutex that serializes access to robotAPI.
+ */
+CommandStreamer::CommandStreamer(FestoRobotAPI* robotAPI, mutex* apiMutex)
+    : robotAPI(robotAPI), apiMutex(apiMutex), target{ 0.0, 0.0, 0.0 },
+      lastTargetTime(chrono::steady_clock::now()), pendingTargets(0),
+      commanded{ 0.0, 0.0, 0.0 }, lastOutput(OUT_NONE), active(false), haltRequested(false),
+      controlPeriodMs(50), deadmanTimeoutMs(500), maxLinearAccel(0.5), maxAngularAccel(2.0),
+      nominalLinearSpeed(0.2), nominalAngularSpeed(0.5), running(false),
+      sentCount(0), coalescedCount(0), deadmanTrips(0) {
+    dutyAccumulator[0] = dutyAccumulator[1] = dutyAccumulator[2] = 0.0;
+}
+
+/**
+ * @brief Destructor; stops the control thread.
+ */
+CommandStreamer::~CommandStreamer() {
+    stop();
+}
+
+/**
+ * @brief Replaces the robot API the commands are sent to.
+ * @param api New robot API pointer (may be nullptr).
+ */
+void CommandStreamer::attach(FestoRobotAPI* api) {
+    lock_guard<mutex> lock(*apiMutex);
+    robotAPI = api;
+}
+
+/**
+ * @brief Starts the control thread if it is not running.
+ */
+void CommandStreamer::start() {
+    lock_guard<mutex> lock(lifecycleMutex); // The first setVelocity() may come from two threads at once
+    if (running) {
+        return;
+    }
+    resetState();
+    running = true;
+    worker = thread(&CommandStreamer::run, this);
+}
+
+/**
+ * @brief Stops the control thread and, if a velocity was being streamed, the robot.
+ */
+void CommandStreamer::stop() {
+    lock_guard<mutex> lock(lifecycleMutex);
+    if (!running) {
+        return;
+    }
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (active) {
+        emit(OUT_STOP);
+    }
+    {
+        lock_guard<mutex> lock(targetMutex);
+        target = VelocityCommand{ 0.0, 0.0, 0.0 };
+        pendingTargets = 0;
+    }
+    resetState();
+}
+
+/**
+ * @brief Returns whether the control thread is running.
+ * @return True if running, false otherwise.
+ */
+bool CommandStreamer::isRunning() const {
+    return running;
+}
+
+/**
+ * @brief Stores the latest target velocity. Only the most recent call before a tick is used.
+ * @param vx Forward velocity in m/s.
+ * @param vy Lateral velocity in m/s (positive = left).
+ * @param omega Angular velocity in rad/s (positive = counter-clockwise).
+ */
+void CommandStreamer::setTarget(double vx, double vy, double omega) {
+    lock_guard<mutex> lock(targetMutex);
+    target = VelocityCommand{ vx, vy, omega };
+    lastTargetTime = chrono::steady_clock::now();
+    pendingTargets++;
+}
+
+/**
+ * @brief Drops the current target so that a discrete command can take over.
+ *
+ * The flag is raised under the API mutex, so once this returns the control thread cannot
+ * overwrite a direction command issued by the caller.
+ */
+void CommandStreamer::halt() {
+    {
+        lock_guard<mutex> lock(targetMutex);
+        target = VelocityCommand{ 0.0, 0.0, 0.0 };
+        pendingTargets = 0;
+    }
+    lock_guard<mutex> lock(*apiMutex);
+    haltRequested = true;
+}
+
+/**
+ * @brief Sets the control period.
+ * @param ms Control period in milliseconds (minimum 1).
+ */
+void CommandStreamer::setControlPeriod(int ms) {
+    controlPeriodMs = ms < 1 ? 1 : ms;
+}
+
+/**
+ * @brief Sets the deadman timeout.
+ * @param ms Timeout in milliseconds; 0 disables the deadman.
+ */
+void CommandStreamer::setDeadmanTimeout(int ms) {
+    deadmanTimeoutMs = ms < 0 ? 0 : ms;
+}
+
+/**
+ * @brief Sets the acceleration limits used to ramp the commanded velocity.
+ * @param linear Maximum linear acceleration in m/s^2.
+ * @param angular Maximum angular acceleration in rad/s^2.
+ */
+void CommandStreamer::setAccelerationLimits(double linear, double angular) {
+    maxLinearAccel = linear;
+    maxAngularAccel = angular;
+}
+
+/**
+ * @brief Sets the speeds produced by the backend's fixed-speed direction commands.
+ * @param linear Speed of a move() command in m/s.
+ * @param angular Speed of a rotate() command in rad/s.
+ */
+void CommandStreamer::setNominalSpeeds(double linear, double angular) {
+    nominalLinearSpeed = linear;
+    nominalAngularSpeed = angular;
+}
+
+/**
+ * @brief Returns the acceleration-limited velocity currently being produced.
+ * @return The commanded velocity.
+ */
+VelocityCommand CommandStreamer::getCommanded() {
+    lock_guard<mutex> lock(targetMutex);
+    return commanded;
+}
+
+/**
+ * @brief Returns the number of direction commands sent to the robot API.
+ * @return The number of API calls.
+ */
+unsigned long CommandStreamer::getSentCount() const {
+    return sentCount;
+}
+
+/**
+ * @brief Returns the number of targets that were overwritten before a control tick used them.
+ * @return The number of coalesced targets.
+ */
+unsigned long CommandStreamer::getCoalescedCount() const {
+    return coalescedCount;
+}
+
+/**
+ * @brief Returns how many times the deadman timeout stopped the robot.
+ * @return The number of deadman stops.
+ */
+unsigned long CommandStreamer::getDeadmanTrips() const {
+    return deadmanTrips;
+}
+
+/**
+ * @brief Control thread body. Sleeps until absolute deadlines so the period does not drift.
+ */
+void CommandStreamer::run() {
+    chrono::steady_clock::time_point previous = chrono::steady_clock::now();
+    chrono::steady_clock::time_point next = previous;
+    while (running) {
+        chrono::milliseconds period(controlPeriodMs.load()); // May be changed by setControlPeriod() meanwhile
+        next += period;
+        this_thread::sleep_until(next);
+        chrono::steady_clock::time_point now = chrono::steady_clock::now();
+        if (now - next > period) {
+            next = now; // Fell more than one period behind; resynchronize instead of bursting
+        }
+        step(chrono::duration<double>(now - previous).count());
+        previous = now;
+    }
+}
+
+/**
+ * @brief Performs one control tick: consume the latest target, apply the deadman and
+ *        acceleration limits, and emit the duty-cycled direction command.
+ * @param dt Elapsed time since the previous tick in seconds.
+ */
+void CommandStreamer::step(double dt) {
+    {
+        lock_guard<mutex> lock(*apiMutex);
+        if (haltRequested) {
+            haltRequested = false;
+            resetState();
+        }
+    }
+
+    VelocityCommand goal;
+    chrono::steady_clock::duration age;
+    {
+        lock_guard<mutex> lock(targetMutex);
+        goal = target;
+        age = chrono::steady_clock::now() - lastTargetTime;
+        if (pendingTargets > 1) {
+            coalescedCount += pendingTargets - 1;
+        }
+        pendingTargets = 0;
+    }
+
+    bool goalIsZero = goal.vx == 0.0 && goal.vy == 0.0 && goal.omega == 0.0;
+    int deadmanMs = deadmanTimeoutMs.load();
+    if (deadmanMs > 0 && !goalIsZero && age > chrono::milliseconds(deadmanMs)) {
+        // Commands stopped arriving: stop immediately instead of ramping down.
+        {
+            lock_guard<mutex> lock(targetMutex);
+            target = VelocityCommand{ 0.0, 0.0, 0.0 };
+            commanded = target;
+        }
+        deadmanTrips++;
+        dutyAccumulator[0] = dutyAccumulator[1] = dutyAccumulator[2] = 0.0;
+        emit(OUT_STOP);
+        active = false;
+        return;
+    }
+
+    // Ramp the commanded velocity toward the goal within the acceleration limits.
+    VelocityCommand next = commanded;
+    double dvx = goal.vx - next.vx;
+    double dvy = goal.vy - next.vy;
+    double dv = sqrt(dvx * dvx + dvy * dvy);
+    double maxDv = maxLinearAccel.load() * dt; // The limits and speeds may be changed by their setters meanwhile
+    if (dv > maxDv && dv > 0.0) {
+        dvx *= maxDv / dv;
+        dvy *= maxDv / dv;
+    }
+    next.vx += dvx;
+    next.vy += dvy;
+    double dw = goal.omega - next.omega;
+    double maxDw = maxAngularAccel.load() * dt;
+    if (dw > maxDw) dw = maxDw;
+    if (dw < -maxDw) dw = -maxDw;
+    next.omega += dw;
+    {
+        lock_guard<mutex> lock(targetMutex);
+        commanded = next;
+    }
+
+    if (next.vx == 0.0 && next.vy == 0.0 && next.omega == 0.0) {
+        if (active) {
+            emit(OUT_STOP);
+            active = false;
+        }
+        dutyAccumulator[0] = dutyAccumulator[1] = dutyAccumulator[2] = 0.0;
+        return;
+    }
+    active = true;
+
+    // Duty cycle of each axis relative to the fixed backend speed. When the axes together
+    // need more than the whole period they share it proportionally, preserving direction.
+    double duty[3];
+    double linearSpeed = nominalLinearSpeed.load();
+    double angularSpeed = nominalAngularSpeed.load();
+    duty[0] = linearSpeed > 0.0 ? fabs(next.vx) / linearSpeed : 0.0;
+    duty[1] = linearSpeed > 0.0 ? fabs(next.vy) / linearSpeed : 0.0;
+    duty[2] = angularSpeed > 0.0 ? fabs(next.omega) / angularSpeed : 0.0;
+    double sum = 0.0;
+    for (int i = 0; i < 3; i++) {
+        if (duty[i] > 1.0) duty[i] = 1.0;
+        sum += duty[i];
+    }
+    int best = 0;
+    for (int i = 0; i < 3; i++) {
+        if (sum > 1.0) duty[i] /= sum;
+        if (duty[i] == 0.0) {
+            dutyAccumulator[i] = 0.0;
+        }
+        dutyAccumulator[i] += duty[i];
+        if (dutyAccumulator[i] > dutyAccumulator[best]) {
+            best = i;
+        }
+    }
+
+    Output out = OUT_STOP;
+    if (dutyAccumulator[best] >= 0.5) {
+        dutyAccumulator[best] -= 1.0;
+        if (best == 0) {
+            out = next.vx > 0.0 ? OUT_FORWARD : OUT_BACKWARD;
+        }
+        else if (best == 1) {
+            out = next.vy > 0.0 ? OUT_LEFT : OUT_RIGHT;
+        }
+        else {
+            out = next.omega > 0.0 ? OUT_TURN_LEFT : OUT_TURN_RIGHT;
+        }
+    }
+    emit(out);
+}
+
+/**
+ * @brief Sends a direction command if it differs from the last one sent.
+ * Nothing is sent after halt() until the control thread has acknowledged it.
+ * @param out The direction command to emit.
+ */
+void CommandStreamer::emit(Output out) {
+    if (out == lastOutput) {
+        return;
+    }
+    lock_guard<mutex> lock(*apiMutex);
+    if (haltRequested || robotAPI == nullptr) {
+        return;
+    }
+    switch (out) {
+    case OUT_FORWARD:    robotAPI->move(DIRECTION::FORWARD); break;
+    case OUT_BACKWARD:   robotAPI->move(DIRECTION::BACKWARD); break;
+    case OUT_LEFT:       robotAPI->move(DIRECTION::LEFT); break;
+    case OUT_RIGHT:      robotAPI->move(DIRECTION::RIGHT); break;
+    case OUT_TURN_LEFT:  robotAPI->rotate(DIRECTION::LEFT); break;
+    case OUT_TURN_RIGHT: robotAPI->rotate(DIRECTION::RIGHT); break;
+    default:             robotAPI->stop(); break;
+    }
+    lastOutput = out;
+    sentCount++;
+}
+
+/**
+ * @brief Resets the ramp and modulation state without touching the robot.
+ */
+void CommandStreamer::resetState() {
+    {
+        lock_guard<mutex> lock(targetMutex);
+        commanded = VelocityCommand{ 0.0, 0.0, 0.0 };
+    }
+    dutyAccumulator[0] = dutyAccumulator[1] = dutyAccumulator[2] = 0.0;
+    lastOutput = OUT_NONE;
+    active = false;
+}
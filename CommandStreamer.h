@@ -0,0 +1,208 @@
+/**
+ * @file CommandStreamer.h
+ * @brief Declaration of the CommandStreamer class, which turns continuous velocity commands into
+ *        rate-limited FestoRobotAPI direction commands.
+ * @date October 2026
+ */
+
+#ifndef COMMANDSTREAMER_H
+#define COMMANDSTREAMER_H
+
+#include "FestoRobotAPI.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+/**
+ * @struct VelocityCommand
+ * @brief A body-frame velocity command for the omnidirectional base.
+ */
+struct VelocityCommand {
+    double vx;    /**< Forward velocity in m/s (positive = FORWARD). */
+    double vy;    /**< Lateral velocity in m/s (positive = LEFT). */
+    double omega; /**< Angular velocity in rad/s (positive = counter-clockwise / LEFT). */
+};
+
+/**
+ * @class CommandStreamer
+ * @brief Streams velocity commands to the robot at a fixed control period.
+ *
+ * Callers may call setTarget() at any rate; only the latest target is used on each control tick
+ * (latest-wins coalescing). The commanded velocity is ramped toward the target within the
+ * configured acceleration limits, and the robot is stopped if no target arrives within the
+ * deadman timeout. Because FestoRobotAPI only supports fixed-speed direction commands, each
+ * velocity component is approximated by duty-cycling the matching direction command
+ * (sigma-delta modulation over consecutive ticks). The API is only called when the emitted
+ * direction changes.
+ */
+class CommandStreamer {
+private:
+    /**
+     * @brief The direction command emitted on a control tick.
+     */
+    enum Output {
+        OUT_NONE,
+        OUT_STOP,
+        OUT_FORWARD,
+        OUT_BACKWARD,
+        OUT_LEFT,
+        OUT_RIGHT,
+        OUT_TURN_LEFT,
+        OUT_TURN_RIGHT
+    };
+
+    FestoRobotAPI* robotAPI;     /**< Robot API the commands are sent to. */
+    std::mutex* apiMutex;        /**< Mutex serializing access to robotAPI (shared with the owner). */
+
+    std::mutex targetMutex;      /**< Protects the latest-wins target slot. */
+    VelocityCommand target;      /**< Latest requested velocity. */
+    std::chrono::steady_clock::time_point lastTargetTime; /**< Arrival time of the latest target. */
+    unsigned long pendingTargets; /**< Targets received since the last control tick. */
+
+    VelocityCommand commanded;   /**< Acceleration-limited velocity currently being produced. */
+    double dutyAccumulator[3];   /**< Sigma-delta accumulators for vx, vy and omega. */
+    Output lastOutput;           /**< Last direction command sent to the API. */
+    bool active;                 /**< True while a non-zero velocity is being streamed. */
+    bool haltRequested;          /**< Set by halt(); guarded by apiMutex. */
+
+    std::atomic<int> controlPeriodMs;  /**< Control period in milliseconds. */
+    std::atomic<int> deadmanTimeoutMs; /**< Time without a new target after which the robot is stopped. */
+    std::atomic<double> maxLinearAccel;      /**< Maximum linear acceleration in m/s^2. */
+    std::atomic<double> maxAngularAccel;     /**< Maximum angular acceleration in rad/s^2. */
+    std::atomic<double> nominalLinearSpeed;  /**< Speed of a FestoRobotAPI::move() command in m/s. */
+    std::atomic<double> nominalAngularSpeed; /**< Speed of a FestoRobotAPI::rotate() command in rad/s. */
+
+    std::mutex lifecycleMutex;   /**< Serializes start() and stop(), which may come from several threads. */
+    std::thread worker;          /**< Control thread. */
+    std::atomic<bool> running;   /**< True while the control thread runs. */
+
+    std::atomic<unsigned long> sentCount;      /**< Number of API calls issued. */
+    std::atomic<unsigned long> coalescedCount; /**< Targets overwritten before being used. */
+    std::atomic<unsigned long> deadmanTrips;   /**< Number of deadman stops. */
+
+    /**
+     * @brief Control thread body; ticks at absolute deadlines of controlPeriodMs.
+     */
+    void run();
+
+    /**
+     * @brief Performs one control tick.
+     * @param dt Elapsed time since the previous tick in seconds.
+     */
+    void step(double dt);
+
+    /**
+     * @brief Sends a direction command if it differs from the last one sent.
+     * Nothing is sent after halt() until the control thread has acknowledged it.
+     * @param out The direction command to emit.
+     */
+    void emit(Output out);
+
+    /**
+     * @brief Resets the modulation state without touching the robot.
+     */
+    void resetState();
+
+public:
+    /**
+     * @brief Constructor for the CommandStreamer class.
+     * @param robotAPI Pointer to the FestoRobotAPI object the commands are sent to.
+     * @param apiMutex Mutex that serializes access to robotAPI.
+     */
+    CommandStreamer(FestoRobotAPI* robotAPI, std::mutex* apiMutex);
+
+    /**
+     * @brief Destructor; stops the control thread.
+     */
+    ~CommandStreamer();
+
+    /**
+     * @brief Replaces the robot API the commands are sent to.
+     * The control thread must be stopped before calling this.
+     * @param api New robot API pointer (may be nullptr).
+     */
+    void attach(FestoRobotAPI* api);
+
+    /**
+     * @brief Starts the control thread if it is not running.
+     */
+    void start();
+
+    /**
+     * @brief Stops the control thread and the robot.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether the control thread is running.
+     * @return True if running, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Sets the velocity to stream. Thread-safe and non-blocking; the latest call wins.
+     * @param vx Forward velocity in m/s.
+     * @param vy Lateral velocity in m/s (positive = left).
+     * @param omega Angular velocity in rad/s (positive = counter-clockwise).
+     */
+    void setTarget(double vx, double vy, double omega);
+
+    /**
+     * @brief Drops the current target and ramp state so that a discrete command can take over.
+     * Does not send anything to the robot.
+     */
+    void halt();
+
+    /**
+     * @brief Sets the control period.
+     * @param ms Control period in milliseconds (minimum 1).
+     */
+    void setControlPeriod(int ms);
+
+    /**
+     * @brief Sets the deadman timeout.
+     * @param ms Timeout in milliseconds; 0 disables the deadman.
+     */
+    void setDeadmanTimeout(int ms);
+
+    /**
+     * @brief Sets the acceleration limits used to ramp the commanded velocity.
+     * @param linear Maximum linear acceleration in m/s^2.
+     * @param angular Maximum angular acceleration in rad/s^2.
+     */
+    void setAccelerationLimits(double linear, double angular);
+
+    /**
+     * @brief Sets the speeds produced by the backend's fixed-speed direction commands.
+     * @param linear Speed of a move() command in m/s.
+     * @param angular Speed of a rotate() command in rad/s.
+     */
+    void setNominalSpeeds(double linear, double angular);
+
+    /**
+     * @brief Returns the acceleration-limited velocity currently being produced.
+     * @return The commanded velocity.
+     */
+    VelocityCommand getCommanded();
+
+    /**
+     * @brief Returns the number of direction commands sent to the robot API.
+     * @return The number of API calls.
+     */
+    unsigned long getSentCount() const;
+
+    /**
+     * @brief Returns the number of targets that were overwritten before a control tick used them.
+     * @return The number of coalesced targets.
+     */
+    unsigned long getCoalescedCount() const;
+
+    /**
+     * @brief Returns how many times the deadman timeout stopped the robot.
+     * @return The number of deadman stops.
+     */
+    unsigned long getDeadmanTrips() const;
+};
+
+#endif // COMMANDSTREAMER_H
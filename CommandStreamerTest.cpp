@@ -0,0 +1,97 @@
+/**
+ * @file CommandStreamerTest.cpp
+ * @brief Test application for continuous velocity streaming through RobotControler::setVelocity.
+ * @details Streams velocity commands at a high rate, checks latest-wins coalescing, acceleration
+ * limiting and the deadman timeout, and prints the resulting pose.
+ * @date October, 2026
+ */
+
+#include "RobotControler.h"
+#include "CommandStreamer.h"
+#include "Pose.h"
+#include "FestoRobotAPI.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Main function for testing the CommandStreamer through RobotControler.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    Pose* position = new Pose(0.0, 0.0, 0.0);
+    FestoRobotAPI* robotino = new FestoRobotAPI();
+    RobotControler control(position, robotino);
+
+    control.connectRobot();
+    control.configureStreaming(50, 300, 0.5, 2.0);
+    CommandStreamer& streamer = control.getStreamer();
+
+    /**
+     * @test Test 1: Commands sent much faster than the control period are coalesced.
+     */
+    for (int i = 0; i < 100; i++) {
+        control.setVelocity(0.1, 0.0, 0.0);
+        Sleep(5);
+    }
+    cout << "Sent commands: " << streamer.getSentCount()
+        << ", coalesced targets: " << streamer.getCoalescedCount() << endl;
+    assert(streamer.getCoalescedCount() > 0 && "Targets were not coalesced!");
+    assert(streamer.getSentCount() < 100 && "Every target reached the robot API!");
+
+    /**
+     * @test Test 2: The commanded velocity never exceeds the acceleration limit.
+     */
+    control.setVelocity(0.0, 0.0, 0.0);
+    Sleep(500);
+    control.setVelocity(0.0, 0.2, 0.0);
+    Sleep(100);
+    VelocityCommand ramp = control.getStreamer().getCommanded();
+    cout << "Commanded vy after 100 ms: " << ramp.vy << " m/s" << endl;
+    assert(ramp.vy < 0.2 && "Acceleration limit was not applied!");
+
+    /**
+     * @test Test 3: The deadman timeout stops the robot when commands stop arriving.
+     */
+    unsigned long trips = streamer.getDeadmanTrips();
+    Sleep(600);
+    VelocityCommand stopped = streamer.getCommanded();
+    cout << "Deadman trips: " << streamer.getDeadmanTrips() << endl;
+    assert(streamer.getDeadmanTrips() > trips && "Deadman did not trip!");
+    assert(stopped.vx == 0.0 && stopped.vy == 0.0 && stopped.omega == 0.0);
+
+    /**
+     * @test Test 4: A discrete command takes over from the stream.
+     */
+    control.setVelocity(0.05, 0.0, 0.3);
+    Sleep(300);
+    control.moveForward();
+    Sleep(500);
+    control.stop();
+
+    Pose currentPose = control.getPose();
+    cout << "Current Position: x=" << currentPose.getX()
+        << ", y=" << currentPose.getY()
+        << ", th=" << currentPose.getTh() << endl;
+
+    /**
+     * @test Test 5: Several threads starting the stream at once start one control thread.
+     */
+    for (int round = 0; round < 50; round++) {
+        streamer.stop();
+        vector<thread> starters;
+        for (int i = 0; i < 4; i++) {
+            starters.push_back(thread([&control]() { control.setVelocity(0.05, 0.0, 0.0); }));
+        }
+        for (size_t i = 0; i < starters.size(); i++) {
+            starters[i].join();
+        }
+    }
+    streamer.stop();
+
+    control.disconnectRobot();
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
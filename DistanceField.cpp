@@ -0,0 +1,181 @@
+/**
+ * @file DistanceField.cpp
+ * @brief Implementation of the DistanceField class.
+ * @date October 2026
+ */
+
+#include "DistanceField.h"
+#include <cmath>
+
+using namespace std;
+
+/**
+ * @brief Squared distance of a cell with no obstacle on its line yet.
+ */
+static const float FAR_AWAY = 1e20f;
+
+/**
+ * @brief Constructor for the DistanceField class. The field is empty until compute() is called.
+ */
+DistanceField::DistanceField()
+    : firstX(0), firstY(0), width(0), height(0), cellSize(1.0), maxDistance(0.0f) {}
+
+/**
+ * @brief Transforms squared distances along one line in place.
+ *
+ * Each finite value f(q) is a parabola (p - q)^2 + f(q); the result at p is the lowest parabola
+ * there. The lower envelope is built left to right, dropping parabolas that the new one hides,
+ * and then read off. Cells without an obstacle on their line add no parabola, which keeps the
+ * arithmetic away from the "far away" value.
+ *
+ * @param values The squared distances, in cells squared; count of them, stride apart.
+ * @param count Number of values.
+ * @param stride Distance between consecutive values.
+ */
+void DistanceField::transformLine(float* values, int count, int stride) {
+    int k = -1;
+    for (int q = 0; q < count; q++) {
+        float f = values[q * stride];
+        line[q] = f;
+        if (f >= FAR_AWAY) {
+            continue;
+        }
+        double s = 0.0;
+        while (k >= 0) {
+            int v = parabolas[k];
+            s = ((f + static_cast<double>(q) * q) - (line[v] + static_cast<double>(v) * v)) / (2.0 * (q - v));
+            if (s > lowerEnvelope[k]) {
+                break;
+            }
+            k--;
+        }
+        k++;
+        parabolas[k] = q;
+        lowerEnvelope[k] = k == 0 ? -FAR_AWAY : static_cast<float>(s);
+    }
+    if (k < 0) {
+        return; // No obstacle on this line: everything stays far away
+    }
+    lowerEnvelope[k + 1] = FAR_AWAY;
+    int j = 0;
+    for (int q = 0; q < count; q++) {
+        while (lowerEnvelope[j + 1] < q) {
+            j++;
+        }
+        float d = static_cast<float>(q - parabolas[j]);
+        values[q * stride] = d * d + line[parabolas[j]];
+    }
+}
+
+/**
+ * @brief Computes the distances in a square window of a map.
+ *
+ * The window is grown by the cap on every side, so that obstacles just outside it are seen and
+ * the distances inside it are exact up to the cap.
+ *
+ * @param map The map.
+ * @param centerX X of the window centre in meters.
+ * @param centerY Y of the window centre in meters.
+ * @param halfSize Half the edge of the window in meters; 0 or less covers the whole map.
+ * @param cap Largest distance stored, in meters.
+ */
+void DistanceField::compute(const Map& map, double centerX, double centerY, double halfSize, float cap) {
+    cellSize = map.getGridSize();
+    maxDistance = cap;
+    int lastX = map.getNumberX() - 1, lastY = map.getNumberY() - 1;
+    firstX = firstY = 0;
+    if (halfSize > 0.0) {
+        double reach = halfSize + cap;
+        firstX = static_cast<int>(floor((centerX - reach) / cellSize));
+        firstY = static_cast<int>(floor((centerY - reach) / cellSize));
+        int endX = static_cast<int>(floor((centerX + reach) / cellSize));
+        int endY = static_cast<int>(floor((centerY + reach) / cellSize));
+        firstX = firstX > 0 ? firstX : 0;
+        firstY = firstY > 0 ? firstY : 0;
+        lastX = endX < lastX ? endX : lastX;
+        lastY = endY < lastY ? endY : lastY;
+    }
+    width = lastX >= firstX ? lastX - firstX + 1 : 0;
+    height = lastY >= firstY ? lastY - firstY + 1 : 0;
+    distances.resize(static_cast<size_t>(width) * height);
+    int longest = width > height ? width : height;
+    line.resize(longest);
+    parabolas.resize(longest);
+    lowerEnvelope.resize(longest + 1);
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    for (int x = 0; x < width; x++) {
+        float* column = &distances[static_cast<size_t>(x) * height];
+        for (int y = 0; y < height; y++) {
+            column[y] = map.getGrid(firstX + x, firstY + y) == Map::CELL_OCCUPIED ? 0.0f : FAR_AWAY;
+        }
+        transformLine(column, height, 1);
+    }
+    for (int y = 0; y < height; y++) {
+        transformLine(&distances[y], width, height);
+    }
+    const float capSquared = static_cast<float>((cap / cellSize) * (cap / cellSize));
+    const float scale = static_cast<float>(cellSize);
+    for (size_t i = 0; i < distances.size(); i++) {
+        distances[i] = distances[i] < capSquared ? sqrt(distances[i]) * scale : cap;
+    }
+}
+
+/**
+ * @brief Returns the distance from a point to the nearest occupied cell.
+ * @param x X of the point in meters.
+ * @param y Y of the point in meters.
+ * @return The distance of the point's cell in meters, at most the cap; 0 outside the window.
+ */
+float DistanceField::getDistance(double x, double y) const {
+    int cx = static_cast<int>(floor(x / cellSize)) - firstX;
+    int cy = static_cast<int>(floor(y / cellSize)) - firstY;
+    if (cx < 0 || cx >= width || cy < 0 || cy >= height) {
+        return 0.0f;
+    }
+    return distances[static_cast<size_t>(cx) * height + cy];
+}
+
+/**
+ * @brief Returns the distance stored for a cell of the window.
+ * @param x Column in the window.
+ * @param y Row in the window.
+ * @return The distance in meters.
+ */
+float DistanceField::getCellDistance(int x, int y) const {
+    return distances[static_cast<size_t>(x) * height + y];
+}
+
+/**
+ * @brief Returns the map column of the first column of the window.
+ * @return The column.
+ */
+int DistanceField::getFirstX() const {
+    return firstX;
+}
+
+/**
+ * @brief Returns the map row of the first row of the window.
+ * @return The row.
+ */
+int DistanceField::getFirstY() const {
+    return firstY;
+}
+
+/**
+ * @brief Returns the number of columns of the window.
+ * @return The number of columns.
+ */
+int DistanceField::getWidth() const {
+    return width;
+}
+
+/**
+ * @brief Returns the number of rows of the window.
+ * @return The number of rows.
+ */
+int DistanceField::getHeight() const {
+    return height;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file DistanceField.h
+ * @brief Declaration of the DistanceField class, the Euclidean distance transform of an occupancy map.
+ * @date October 2026
+ */
+
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include "Map.h"
+#include <vector>
+
+/**
+ * @class DistanceField
+ * @brief Holds, for every cell of a window of a Map, the distance to the nearest occupied cell.
+ *
+ * The exact Euclidean distance transform of Felzenszwalb and Huttenlocher is computed in two
+ * passes of the 1-D transform, first along y and then along x, so the cost is linear in the
+ * number of cells. Only occupied cells are obstacles; unknown cells count as free. Distances
+ * are measured between cell centres and capped, since planners only care about the near field.
+ *
+ * Local planners recompute a window around the robot each cycle instead of the whole map;
+ * compute() does not allocate once the window size is known.
+ */
+class DistanceField {
+private:
+    std::vector<float> distances;  /**< Distance of each cell of the window in meters, x-major: index = x * height + y. */
+    std::vector<float> line;       /**< Squared distances along the line being transformed. */
+    std::vector<float> lowerEnvelope; /**< Parabola boundaries of the 1-D transform. */
+    std::vector<int> parabolas;    /**< Parabola apexes of the 1-D transform. */
+    std::vector<float> result;     /**< Output of the 1-D transform. */
+    int firstX;                    /**< Map column of the first column of the window. */
+    int firstY;                    /**< Map row of the first row of the window. */
+    int width;                     /**< Columns of the window. */
+    int height;                    /**< Rows of the window. */
+    double cellSize;               /**< Edge length of a cell in meters. */
+    float maxDistance;             /**< Cap on the distances in meters. */
+
+    /**
+     * @brief Transforms squared distances along one line in place.
+     * @param values The squared distances, in cells squared; count of them, stride apart.
+     * @param count Number of values.
+     * @param stride Distance between consecutive values.
+     */
+    void transformLine(float* values, int count, int stride);
+
+public:
+    /**
+     * @brief Constructor for the DistanceField class. The field is empty until compute() is called.
+     */
+    DistanceField();
+
+    /**
+     * @brief Computes the distances in a square window of a map.
+     * @param map The map.
+     * @param centerX X of the window centre in meters.
+     * @param centerY Y of the window centre in meters.
+     * @param halfSize Half the edge of the window in meters; 0 or less covers the whole map.
+     * @param cap Largest distance stored, in meters.
+     */
+    void compute(const Map& map, double centerX, double centerY, double halfSize, float cap = 2.0f);
+
+    /**
+     * @brief Returns the distance from a point to the nearest occupied cell.
+     * @param x X of the point in meters.
+     * @param y Y of the point in meters.
+     * @return The distance of the point's cell in meters, at most the cap; 0 outside the window,
+     *         so that planners never leave the area they can see.
+     */
+    float getDistance(double x, double y) const;
+
+    /**
+     * @brief Returns the distance stored for a cell of the window.
+     * @param x Column in the window.
+     * @param y Row in the window.
+     * @return The distance in meters.
+     */
+    float getCellDistance(int x, int y) const;
+
+    /**
+     * @brief Returns the map column of the first column of the window.
+     * @return The column.
+     */
+    int getFirstX() const;
+
+    /**
+     * @brief Returns the map row of the first row of the window.
+     * @return The row.
+     */
+    int getFirstY() const;
+
+    /**
+     * @brief Returns the number of columns of the window.
+     * @return The number of columns.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Returns the number of rows of the window.
+     * @return The number of rows.
+     */
+    int getHeight() const;
+};
+
+#endif // DISTANCEFIELD_H
@@ -0,0 +1,104 @@
+/**
+ * @file DistanceFieldTest.cpp
+ * @brief Test and benchmark application for the DistanceField class.
+ * @details Compares the transform with a brute-force search on random maps, over the whole map
+ * and in windows, checks the cap and the lookups outside the window, and measures the time of
+ * a local window.
+ * @date October, 2026
+ */
+
+#include "DistanceField.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Finds the distance from a cell to the nearest occupied cell by visiting all of them.
+ * @param map The map.
+ * @param x Column of the cell.
+ * @param y Row of the cell.
+ * @return The distance in meters, or a large value if the map has no occupied cell.
+ */
+double bruteForce(const Map& map, int x, int y) {
+    double best = 1e9;
+    for (int i = 0; i < map.getNumberX(); i++) {
+        for (int j = 0; j < map.getNumberY(); j++) {
+            if (map.getGrid(i, j) == Map::CELL_OCCUPIED) {
+                double d = sqrt(static_cast<double>((i - x) * (i - x) + (j - y) * (j - y))) * map.getGridSize();
+                best = d < best ? d : best;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Main function for testing the distance field.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    mt19937 rng(11);
+    uniform_int_distribution<int> cell(0, 59);
+
+    /**
+     * @test Test 1: Over the whole map, every distance matches the brute-force search up to the cap.
+     */
+    Map map(60, 50, 0.1);
+    for (int k = 0; k < 40; k++) {
+        map.setGrid(cell(rng), cell(rng) % 50, Map::CELL_OCCUPIED);
+    }
+    map.setGrid(10, 10, Map::CELL_FREE); // Free and unknown cells are both free
+    DistanceField field;
+    field.compute(map, 0.0, 0.0, 0.0, 10.0f);
+    assert(field.getWidth() == 60 && field.getHeight() == 50 && field.getFirstX() == 0 && field.getFirstY() == 0);
+    for (int x = 0; x < 60; x++) {
+        for (int y = 0; y < 50; y++) {
+            assert(fabs(field.getCellDistance(x, y) - bruteForce(map, x, y)) < 1e-4);
+        }
+    }
+
+    /**
+     * @test Test 2: In a window, distances are exact up to the cap, obstacles just outside the
+     * window count, and points outside the window read 0.
+     */
+    field.compute(map, 3.0, 2.5, 1.0, 0.5f);
+    assert(field.getFirstX() == 15 && field.getFirstY() == 10);
+    assert(field.getWidth() == 31 && field.getHeight() == 31);
+    for (int x = 5; x < field.getWidth() - 5; x++) { // The window is grown by the cap, 5 cells
+        for (int y = 5; y < field.getHeight() - 5; y++) {
+            double expected = bruteForce(map, field.getFirstX() + x, field.getFirstY() + y);
+            assert(fabs(field.getCellDistance(x, y) - (expected < 0.5 ? expected : 0.5)) < 1e-4);
+        }
+    }
+    assert(field.getDistance(0.5, 0.5) == 0.0f && field.getDistance(5.0, 4.9) == 0.0f);
+    assert(field.getDistance(3.0, 2.5) == field.getCellDistance(15, 15));
+
+    Map empty(20, 20, 0.1);
+    field.compute(empty, 1.0, 1.0, 0.5, 0.7f);
+    assert(field.getDistance(1.0, 1.0) == 0.7f);
+
+    /**
+     * @test Test 3: A 6 m window around the robot on a 5 cm grid takes well under a control cycle.
+     */
+    Map large(400, 400, 0.05);
+    uniform_int_distribution<int> largeCell(0, 399);
+    for (int k = 0; k < 4000; k++) {
+        large.setGrid(largeCell(rng), largeCell(rng), Map::CELL_OCCUPIED);
+    }
+    field.compute(large, 10.0, 10.0, 3.0, 1.0f);
+    const int runs = 200;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < runs; r++) {
+        field.compute(large, 10.0 + 0.01 * r, 10.0, 3.0, 1.0f);
+    }
+    double perWindowUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / runs;
+    assert(perWindowUs < 20000.0);
+    cout << "Window of " << field.getWidth() << " x " << field.getHeight() << " cells: " << perWindowUs << " us" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,308 @@
+/**
+ * @file DwaPlanner.cpp
+ * @brief Implementation of the DwaPlanner class.
+ * @date October 2026
+ */
+
+#include "DwaPlanner.h"
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * @brief Limits a value to a range.
+ * @param value The value.
+ * @param low Lower end of the range.
+ * @param high Upper end of the range.
+ * @return The limited value.
+ */
+static double clampValue(double value, double low, double high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+/**
+ * @brief Returns the greatest common divisor of two positive integers.
+ * @param a First integer.
+ * @param b Second integer.
+ * @return The greatest common divisor.
+ */
+static int greatestCommonDivisor(int a, int b) {
+    while (b != 0) {
+        int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * @brief Constructor for the DwaPlanner class.
+ * @param controller Controller used to read the pose and to send velocities; may be nullptr
+ *        if only computeCommand() is used.
+ * @param safety Safety layer the commands of step() go through, or nullptr to send them directly.
+ */
+DwaPlanner::DwaPlanner(RobotControler* controller, SafeNavigation* safety)
+    : controller(controller), safety(safety), maxSpeed(0.3), maxAngularSpeed(1.0), maxAccel(0.5),
+      maxAngularAccel(1.5), period(0.1), linearSamples(7), angularSamples(5), horizon(1.5), rolloutSteps(10),
+      goalWeight(1.0), clearanceWeight(0.3), speedWeight(0.1), robotRadius(0.25), clearanceCap(1.0),
+      budgetUs(2000.0), goalX(0.0), goalY(0.0), goalTolerance(0.05), hasGoal(false), metrics(),
+      rollX(BLOCK), rollY(BLOCK), rollCos(BLOCK), rollSin(BLOCK), clearance(BLOCK) {}
+
+/**
+ * @brief Sets the velocity and acceleration limits.
+ * @param speed Maximum translational speed in m/s.
+ * @param angularSpeed Maximum angular speed in rad/s.
+ * @param accel Translational acceleration limit in m/s^2.
+ * @param angularAccel Angular acceleration limit in rad/s^2.
+ */
+void DwaPlanner::setLimits(double speed, double angularSpeed, double accel, double angularAccel) {
+    if (speed > 0.0) maxSpeed = speed;
+    if (angularSpeed >= 0.0) maxAngularSpeed = angularSpeed;
+    if (accel > 0.0) maxAccel = accel;
+    if (angularAccel >= 0.0) maxAngularAccel = angularAccel;
+}
+
+/**
+ * @brief Sets the sampling of the window and the rollouts.
+ * @param linear Samples of vx and of vy across the window (at least 1).
+ * @param angular Samples of omega across the window (at least 1).
+ * @param horizonSeconds Duration of a rollout in seconds.
+ * @param steps Integration steps of a rollout (at least 1).
+ */
+void DwaPlanner::setSampling(int linear, int angular, double horizonSeconds, int steps) {
+    if (linear >= 1) linearSamples = linear;
+    if (angular >= 1) angularSamples = angular;
+    if (horizonSeconds > 0.0) horizon = horizonSeconds;
+    if (steps >= 1) rolloutSteps = steps;
+}
+
+/**
+ * @brief Sets the weights of the score.
+ * @param goal Weight of the progress toward the goal.
+ * @param clearanceScore Weight of the clearance.
+ * @param speed Weight of the speed.
+ */
+void DwaPlanner::setWeights(double goal, double clearanceScore, double speed) {
+    goalWeight = goal;
+    clearanceWeight = clearanceScore;
+    speedWeight = speed;
+}
+
+/**
+ * @brief Sets the robot radius and the clearance beyond which the score no longer grows.
+ * @param radius Radius of the robot in meters.
+ * @param cap Clearance cap in meters.
+ */
+void DwaPlanner::setFootprint(double radius, double cap) {
+    if (radius >= 0.0) robotRadius = radius;
+    if (cap > 0.0) clearanceCap = cap;
+}
+
+/**
+ * @brief Sets the control period and the per-cycle compute budget.
+ * @param periodSeconds Control period in seconds.
+ * @param cycleBudgetUs Compute budget per cycle in microseconds.
+ */
+void DwaPlanner::setRate(double periodSeconds, double cycleBudgetUs) {
+    if (periodSeconds > 0.0) period = periodSeconds;
+    if (cycleBudgetUs > 0.0) budgetUs = cycleBudgetUs;
+}
+
+/**
+ * @brief Sets the goal.
+ * @param x X of the goal in meters.
+ * @param y Y of the goal in meters.
+ * @param tolerance Distance at which the goal counts as reached, in meters.
+ */
+void DwaPlanner::setGoal(double x, double y, double tolerance) {
+    goalX = x;
+    goalY = y;
+    goalTolerance = tolerance;
+    hasGoal = true;
+}
+
+/**
+ * @brief Fills the samples of the dynamic window in interleaved order.
+ *
+ * Sample n of the grid is stored at the position n * stride mod count, with the stride coprime
+ * to the count and near its golden section, so any run of consecutive samples is spread over
+ * the whole window.
+ *
+ * @param current The velocity currently commanded.
+ * @return The number of samples.
+ */
+int DwaPlanner::fillSamples(const VelocityCommand& current) {
+    const double linearStep = maxAccel * period;
+    const double angularStep = maxAngularAccel * period;
+    const double vxLow = clampValue(current.vx - linearStep, -maxSpeed, maxSpeed);
+    const double vxHigh = clampValue(current.vx + linearStep, -maxSpeed, maxSpeed);
+    const double vyLow = clampValue(current.vy - linearStep, -maxSpeed, maxSpeed);
+    const double vyHigh = clampValue(current.vy + linearStep, -maxSpeed, maxSpeed);
+    const double omegaLow = clampValue(current.omega - angularStep, -maxAngularSpeed, maxAngularSpeed);
+    const double omegaHigh = clampValue(current.omega + angularStep, -maxAngularSpeed, maxAngularSpeed);
+    const int count = linearSamples * linearSamples * angularSamples;
+    sampleVx.resize(count);
+    sampleVy.resize(count);
+    sampleOmega.resize(count);
+    halfCos.resize(count);
+    halfSin.resize(count);
+
+    int stride = static_cast<int>(count * 0.618) + 1;
+    while (greatestCommonDivisor(stride, count) != 1) {
+        stride++;
+    }
+    const double linearSpan = linearSamples > 1 ? 1.0 / (linearSamples - 1) : 0.0;
+    const double angularSpan = angularSamples > 1 ? 1.0 / (angularSamples - 1) : 0.0;
+    const double halfStep = 0.5 * horizon / rolloutSteps;
+    for (int n = 0; n < count; n++) {
+        int i = n % linearSamples;
+        int j = n / linearSamples % linearSamples;
+        int k = n / (linearSamples * linearSamples);
+        int slot = static_cast<int>(static_cast<long long>(n) * stride % count);
+        double omega = angularSamples > 1 ? omegaLow + (omegaHigh - omegaLow) * k * angularSpan
+            : clampValue(current.omega, omegaLow, omegaHigh);
+        sampleVx[slot] = static_cast<float>(linearSamples > 1 ? vxLow + (vxHigh - vxLow) * i * linearSpan
+            : clampValue(current.vx, vxLow, vxHigh));
+        sampleVy[slot] = static_cast<float>(linearSamples > 1 ? vyLow + (vyHigh - vyLow) * j * linearSpan
+            : clampValue(current.vy, vyLow, vyHigh));
+        sampleOmega[slot] = static_cast<float>(omega);
+        halfCos[slot] = static_cast<float>(cos(omega * halfStep));
+        halfSin[slot] = static_cast<float>(sin(omega * halfStep));
+    }
+    return count;
+}
+
+/**
+ * @brief Computes the velocity command for a pose without touching the robot.
+ *
+ * A rollout step turns the heading by half the step's rotation, moves along it and turns the
+ * other half, which follows the arc to second order without calling sin or cos. The clearance
+ * of a rollout is taken over its steps but not its start, so a robot that already touches an
+ * obstacle can still move away from it.
+ *
+ * @param pose Current pose of the robot (th in radians).
+ * @param current Velocity currently commanded, the centre of the dynamic window.
+ * @param field Distances to obstacles around the robot.
+ * @param command Receives the command: the best sample, or zero if the goal is reached or
+ *        no sample is admissible.
+ * @return True if the goal is reached.
+ */
+bool DwaPlanner::computeCommand(const Pose& pose, const VelocityCommand& current, const DistanceField& field,
+    VelocityCommand& command) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    command.vx = command.vy = command.omega = 0.0;
+    metrics.cycles++;
+    metrics.lastSamples = 0;
+    const double startDistance = sqrt((goalX - pose.getX()) * (goalX - pose.getX())
+        + (goalY - pose.getY()) * (goalY - pose.getY()));
+    if (!hasGoal || startDistance <= goalTolerance) {
+        metrics.lastCycleUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+        return true;
+    }
+
+    const int count = fillSamples(current);
+    const float dt = static_cast<float>(horizon / rolloutSteps);
+    const float startX = static_cast<float>(pose.getX()), startY = static_cast<float>(pose.getY());
+    const float startCos = static_cast<float>(cos(pose.getTh())), startSin = static_cast<float>(sin(pose.getTh()));
+    const float radius = static_cast<float>(robotRadius);
+    const double reach = maxSpeed * horizon;
+    double bestScore = -DBL_MAX, bestClearance = 0.0;
+    int best = -1;
+    for (int first = 0; first < count; first += BLOCK) {
+        if (first > 0 && chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count() > budgetUs) {
+            metrics.budgetOverruns++;
+            break;
+        }
+        const int n = count - first < BLOCK ? count - first : BLOCK;
+        const float* vx = &sampleVx[first];
+        const float* vy = &sampleVy[first];
+        const float* hc = &halfCos[first];
+        const float* hs = &halfSin[first];
+        float* x = &rollX[0];
+        float* y = &rollY[0];
+        float* c = &rollCos[0];
+        float* s = &rollSin[0];
+        for (int j = 0; j < n; j++) {
+            x[j] = startX;
+            y[j] = startY;
+            c[j] = startCos;
+            s[j] = startSin;
+            clearance[j] = FLT_MAX;
+        }
+        for (int step = 0; step < rolloutSteps; step++) {
+            for (int j = 0; j < n; j++) {
+                float c1 = c[j] * hc[j] - s[j] * hs[j];
+                float s1 = s[j] * hc[j] + c[j] * hs[j];
+                x[j] += (vx[j] * c1 - vy[j] * s1) * dt;
+                y[j] += (vx[j] * s1 + vy[j] * c1) * dt;
+                c[j] = c1 * hc[j] - s1 * hs[j];
+                s[j] = s1 * hc[j] + c1 * hs[j];
+            }
+            for (int j = 0; j < n; j++) {
+                float d = field.getDistance(x[j], y[j]) - radius;
+                clearance[j] = d < clearance[j] ? d : clearance[j];
+            }
+        }
+        for (int j = 0; j < n; j++) {
+            double speed = sqrt(static_cast<double>(vx[j]) * vx[j] + static_cast<double>(vy[j]) * vy[j]);
+            double gap = clearance[j];
+            if (speed > maxSpeed * (1.0 + 1e-6) || gap <= 0.0 || speed * speed > 2.0 * maxAccel * gap) {
+                continue; // Too fast for the limit, touches an obstacle, or could not stop in time
+            }
+            double endDistance = sqrt((goalX - x[j]) * (goalX - x[j]) + (goalY - y[j]) * (goalY - y[j]));
+            double score = goalWeight * (startDistance - endDistance) / reach
+                + clearanceWeight * (gap < clearanceCap ? gap : clearanceCap) / clearanceCap
+                + speedWeight * speed / maxSpeed;
+            if (score > bestScore) {
+                bestScore = score;
+                bestClearance = gap;
+                best = first + j;
+            }
+        }
+        metrics.lastSamples += n;
+    }
+
+    if (best >= 0) {
+        command.vx = sampleVx[best];
+        command.vy = sampleVy[best];
+        command.omega = sampleOmega[best];
+        metrics.lastScore = bestScore;
+        metrics.lastClearance = bestClearance;
+    }
+    else {
+        metrics.blockedCycles++;
+        metrics.lastScore = 0.0;
+        metrics.lastClearance = 0.0;
+    }
+    metrics.lastCycleUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+    metrics.maxCycleUs = metrics.lastCycleUs > metrics.maxCycleUs ? metrics.lastCycleUs : metrics.maxCycleUs;
+    return false;
+}
+
+/**
+ * @brief Runs one planning cycle: reads the pose and the current command, computes the
+ * command and sends it through the safety layer, or directly to the controller.
+ * @param field Distances to obstacles around the robot.
+ * @return True if the goal is reached.
+ */
+bool DwaPlanner::step(const DistanceField& field) {
+    VelocityCommand command;
+    bool reached = computeCommand(controller->getPose(), controller->getStreamer().getCommanded(), field, command);
+    if (safety != nullptr) {
+        safety->driveSafe(command);
+    }
+    else {
+        controller->setVelocity(command.vx, command.vy, command.omega);
+    }
+    return reached;
+}
+
+/**
+ * @brief Returns the cycle statistics.
+ * @return The statistics.
+ */
+PlannerMetrics DwaPlanner::getMetrics() const {
+    return metrics;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file DwaPlanner.h
+ * @brief Declaration of the DwaPlanner class, a Dynamic Window Approach local planner for the omnidirectional base.
+ * @date October 2026
+ */
+
+#ifndef DWAPLANNER_H
+#define DWAPLANNER_H
+
+#include "RobotControler.h"
+#include "SafeNavigation.h"
+#include "CommandStreamer.h"
+#include "DistanceField.h"
+#include "Pose.h"
+#include <vector>
+
+/**
+ * @struct PlannerMetrics
+ * @brief Timing and outcome statistics of the planner's cycles.
+ */
+struct PlannerMetrics {
+    unsigned long cycles;         /**< Number of planning cycles executed. */
+    unsigned long budgetOverruns; /**< Cycles that ran out of budget before evaluating every sample. */
+    unsigned long blockedCycles;  /**< Cycles in which no sample was admissible. */
+    int lastSamples;              /**< Samples evaluated in the last cycle. */
+    double lastCycleUs;           /**< Compute time of the last cycle in microseconds. */
+    double maxCycleUs;            /**< Largest compute time in microseconds. */
+    double lastScore;             /**< Score of the command chosen in the last cycle. */
+    double lastClearance;         /**< Smallest clearance along the chosen rollout in meters. */
+};
+
+/**
+ * @class DwaPlanner
+ * @brief Picks a body-frame velocity each cycle by rolling out samples of the dynamic window.
+ *
+ * The dynamic window holds the velocities (vx, vy, omega) reachable from the current command
+ * within one control period under the acceleration limits. A grid of samples of the window is
+ * rolled out over a short horizon at constant velocity, and each rollout is scored by
+ *
+ *     goalWeight * progress + clearanceWeight * clearance + speedWeight * speed
+ *
+ * where progress is how much closer to the goal the rollout ends, clearance the smallest
+ * distance of the rollout from obstacles in the DistanceField (less the robot radius), and
+ * speed the translational speed, each scaled to about [0, 1]. Rollouts that touch an obstacle,
+ * or that could not stop before it, are not admissible.
+ *
+ * Samples are kept as structure-of-arrays and rolled out a block at a time: the pose update of
+ * every sample of a block is one loop without branches or trigonometry, which the compiler
+ * vectorizes, and only the distance lookups are scalar. The samples are visited in an
+ * interleaved order, so when the compute budget runs out the evaluated part still covers the
+ * whole window.
+ */
+class DwaPlanner {
+private:
+    RobotControler* controller;   /**< Controller used to read the pose and the current command and to send velocities. */
+    SafeNavigation* safety;       /**< Safety layer the commands go through, or nullptr to send them directly. */
+
+    double maxSpeed;              /**< Maximum translational speed in m/s. */
+    double maxAngularSpeed;       /**< Maximum angular speed in rad/s. */
+    double maxAccel;              /**< Translational acceleration limit in m/s^2. */
+    double maxAngularAccel;       /**< Angular acceleration limit in rad/s^2. */
+    double period;                /**< Control period in seconds, the time the window spans. */
+    int linearSamples;            /**< Samples of vx and of vy across the window. */
+    int angularSamples;           /**< Samples of omega across the window. */
+    double horizon;               /**< Duration of a rollout in seconds. */
+    int rolloutSteps;             /**< Integration steps of a rollout. */
+    double goalWeight;            /**< Weight of the progress toward the goal. */
+    double clearanceWeight;       /**< Weight of the clearance. */
+    double speedWeight;           /**< Weight of the speed. */
+    double robotRadius;           /**< Radius of the robot in meters. */
+    double clearanceCap;          /**< Clearance beyond which the score no longer grows, in meters. */
+    double budgetUs;              /**< Per-cycle compute budget in microseconds. */
+
+    double goalX;                 /**< X of the goal in meters. */
+    double goalY;                 /**< Y of the goal in meters. */
+    double goalTolerance;         /**< Distance from the goal at which it counts as reached, in meters. */
+    bool hasGoal;                 /**< True once a goal is set. */
+    PlannerMetrics metrics;       /**< Cycle statistics. */
+
+    std::vector<float> sampleVx;  /**< Forward velocity of each sample. */
+    std::vector<float> sampleVy;  /**< Lateral velocity of each sample. */
+    std::vector<float> sampleOmega; /**< Angular velocity of each sample. */
+    std::vector<float> halfCos;   /**< Cosine of each sample's half-step rotation. */
+    std::vector<float> halfSin;   /**< Sine of each sample's half-step rotation. */
+    std::vector<float> rollX;     /**< X of each rollout of the current block. */
+    std::vector<float> rollY;     /**< Y of each rollout of the current block. */
+    std::vector<float> rollCos;   /**< Cosine of the heading of each rollout of the current block. */
+    std::vector<float> rollSin;   /**< Sine of the heading of each rollout of the current block. */
+    std::vector<float> clearance; /**< Smallest clearance of each rollout of the current block. */
+
+    /**
+     * @brief Fills the samples of the dynamic window in interleaved order.
+     * @param current The velocity currently commanded.
+     * @return The number of samples.
+     */
+    int fillSamples(const VelocityCommand& current);
+
+public:
+    /** @brief Samples rolled out together between two budget checks. */
+    static const int BLOCK = 64;
+
+    /**
+     * @brief Constructor for the DwaPlanner class.
+     * @param controller Controller used to read the pose and to send velocities; may be nullptr
+     *        if only computeCommand() is used.
+     * @param safety Safety layer the commands of step() go through, or nullptr to send them directly.
+     */
+    explicit DwaPlanner(RobotControler* controller, SafeNavigation* safety = nullptr);
+
+    /**
+     * @brief Sets the velocity and acceleration limits.
+     * @param speed Maximum translational speed in m/s.
+     * @param angularSpeed Maximum angular speed in rad/s.
+     * @param accel Translational acceleration limit in m/s^2.
+     * @param angularAccel Angular acceleration limit in rad/s^2.
+     */
+    void setLimits(double speed, double angularSpeed, double accel, double angularAccel);
+
+    /**
+     * @brief Sets the sampling of the window and the rollouts.
+     * @param linear Samples of vx and of vy across the window (at least 1).
+     * @param angular Samples of omega across the window (at least 1).
+     * @param horizonSeconds Duration of a rollout in seconds.
+     * @param steps Integration steps of a rollout (at least 1).
+     */
+    void setSampling(int linear, int angular, double horizonSeconds, int steps);
+
+    /**
+     * @brief Sets the weights of the score.
+     * @param goal Weight of the progress toward the goal.
+     * @param clearanceScore Weight of the clearance.
+     * @param speed Weight of the speed.
+     */
+    void setWeights(double goal, double clearanceScore, double speed);
+
+    /**
+     * @brief Sets the robot radius and the clearance beyond which the score no longer grows.
+     * @param radius Radius of the robot in meters.
+     * @param cap Clearance cap in meters.
+     */
+    void setFootprint(double radius, double cap);
+
+    /**
+     * @brief Sets the control period and the per-cycle compute budget.
+     * @param periodSeconds Control period in seconds.
+     * @param cycleBudgetUs Compute budget per cycle in microseconds.
+     */
+    void setRate(double periodSeconds, double cycleBudgetUs);
+
+    /**
+     * @brief Sets the goal.
+     * @param x X of the goal in meters.
+     * @param y Y of the goal in meters.
+     * @param tolerance Distance at which the goal counts as reached, in meters.
+     */
+    void setGoal(double x, double y, double tolerance);
+
+    /**
+     * @brief Computes the velocity command for a pose without touching the robot.
+     * @param pose Current pose of the robot (th in radians).
+     * @param current Velocity currently commanded, the centre of the dynamic window.
+     * @param field Distances to obstacles around the robot.
+     * @param command Receives the command: the best sample, or zero if the goal is reached or
+     *        no sample is admissible.
+     * @return True if the goal is reached.
+     */
+    bool computeCommand(const Pose& pose, const VelocityCommand& current, const DistanceField& field,
+        VelocityCommand& command);
+
+    /**
+     * @brief Runs one planning cycle: reads the pose and the current command, computes the
+     * command and sends it through the safety layer, or directly to the controller.
+     * @param field Distances to obstacles around the robot.
+     * @return True if the goal is reached.
+     */
+    bool step(const DistanceField& field);
+
+    /**
+     * @brief Returns the cycle statistics.
+     * @return The statistics.
+     */
+    PlannerMetrics getMetrics() const;
+};
+
+#endif // DWAPLANNER_H
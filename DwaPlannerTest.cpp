@@ -0,0 +1,170 @@
+/**
+ * @file DwaPlannerTest.cpp
+ * @brief Test and benchmark application for the DwaPlanner class.
+ * @details Checks that the chosen commands stay in the dynamic window and head for the goal,
+ * that the omnidirectional base moves sideways when that is best, drives a simulated robot
+ * through a doorway without touching the walls, checks the blocked and goal-reached cases and
+ * the compute budget, and measures the time per cycle.
+ * @date October, 2026
+ */
+
+#include "DwaPlanner.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+using namespace std;
+
+/**
+ * @brief Builds a velocity command.
+ * @param vx Forward velocity in m/s.
+ * @param vy Lateral velocity in m/s.
+ * @param omega Turn rate in rad/s.
+ * @return The command.
+ */
+VelocityCommand makeCommand(double vx, double vy, double omega) {
+    VelocityCommand command = { vx, vy, omega };
+    return command;
+}
+
+/**
+ * @brief Marks a rectangle of cells as occupied.
+ * @param map The map.
+ * @param x0 First column.
+ * @param y0 First row.
+ * @param x1 Last column.
+ * @param y1 Last row.
+ */
+void fill(Map& map, int x0, int y0, int x1, int y1) {
+    for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+            map.setGrid(x, y, Map::CELL_OCCUPIED);
+        }
+    }
+}
+
+/**
+ * @brief Main function for testing the DWA planner.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    // A 6 m by 6 m room on a 5 cm grid, walled all round
+    Map room(120, 120, 0.05);
+    fill(room, 0, 0, 119, 1);
+    fill(room, 0, 118, 119, 119);
+    fill(room, 0, 0, 1, 119);
+    fill(room, 118, 0, 119, 119);
+    DistanceField field;
+    field.compute(room, 3.0, 3.0, 0.0, 1.0f);
+
+    /**
+     * @test Test 1: In free space the command heads for the goal and stays in the dynamic
+     * window around the current command.
+     */
+    DwaPlanner planner(nullptr);
+    planner.setGoal(5.0, 3.0, 0.05);
+    VelocityCommand current = makeCommand(0.1, 0.0, 0.0);
+    VelocityCommand command;
+    assert(!planner.computeCommand(Pose(2.0, 3.0, 0.0), current, field, command));
+    assert(command.vx > 0.1 && fabs(command.vx - 0.1) <= 0.05 + 1e-6);
+    assert(fabs(command.vy) <= 0.05 + 1e-6 && fabs(command.omega) <= 0.15 + 1e-6);
+    assert(planner.getMetrics().lastSamples == 7 * 7 * 5);
+
+    /**
+     * @test Test 2: The omnidirectional base drives sideways to a goal on its left, without
+     * turning first.
+     */
+    planner.setGoal(3.0, 5.0, 0.05);
+    Pose pose(3.0, 3.0, 0.0);
+    current = makeCommand(0.0, 0.0, 0.0);
+    for (int cycle = 0; cycle < 10; cycle++) {
+        planner.computeCommand(pose, current, field, command);
+        current = command;
+    }
+    assert(command.vy > 0.25 && fabs(command.vx) < 0.1);
+
+    /**
+     * @test Test 3: A simulated robot reaches a goal behind a wall through a doorway, keeping
+     * clear of the walls all the way.
+     */
+    Map doorway(120, 120, 0.05);
+    fill(doorway, 0, 0, 119, 1);
+    fill(doorway, 0, 118, 119, 119);
+    fill(doorway, 0, 0, 1, 119);
+    fill(doorway, 118, 0, 119, 119);
+    fill(doorway, 58, 0, 61, 49);   // The wall at x = 3 m, open between y = 2.5 m and 3.5 m
+    fill(doorway, 58, 70, 61, 119);
+    planner.setGoal(5.0, 3.0, 0.1);
+    planner.setLimits(0.4, 1.0, 0.8, 2.0);
+    pose = Pose(1.0, 1.5, 0.0);
+    current = makeCommand(0.0, 0.0, 0.0);
+    const double dt = 0.1;
+    bool reached = false;
+    double closest = 1e9;
+    int cycles = 0;
+    for (; cycles < 400 && !reached; cycles++) {
+        field.compute(doorway, pose.getX(), pose.getY(), 2.5, 1.0f); // Local window, as on the robot
+        reached = planner.computeCommand(pose, current, field, command);
+        double c = cos(pose.getTh()), s = sin(pose.getTh());
+        pose = Pose(pose.getX() + (command.vx * c - command.vy * s) * dt,
+            pose.getY() + (command.vx * s + command.vy * c) * dt, normalizeAngle(pose.getTh() + command.omega * dt));
+        current = command;
+        field.compute(doorway, pose.getX(), pose.getY(), 0.5, 1.0f);
+        double gap = field.getDistance(pose.getX(), pose.getY());
+        closest = gap < closest ? gap : closest;
+    }
+    assert(reached);
+    assert(closest > 0.25);
+    assert(planner.getMetrics().blockedCycles == 0);
+    cout << "Through the doorway in " << cycles * dt << " s, closest approach to a wall " << closest << " m" << endl;
+
+    /**
+     * @test Test 4: With the goal reached the command is zero; boxed in, no sample is
+     * admissible and the command is zero too.
+     */
+    field.compute(room, 3.0, 3.0, 0.0, 1.0f);
+    planner.setGoal(3.0, 3.0, 0.1);
+    assert(planner.computeCommand(Pose(3.02, 3.0, 0.0), makeCommand(0.2, 0.0, 0.0), field, command));
+    assert(command.vx == 0.0 && command.vy == 0.0 && command.omega == 0.0);
+
+    Map box(40, 40, 0.05);
+    fill(box, 0, 0, 39, 39);
+    for (int x = 17; x <= 22; x++) {
+        for (int y = 17; y <= 22; y++) {
+            box.setGrid(x, y, Map::CELL_FREE);
+        }
+    }
+    field.compute(box, 1.0, 1.0, 0.0, 1.0f);
+    planner.setGoal(1.8, 1.0, 0.05);
+    unsigned long blocked = planner.getMetrics().blockedCycles;
+    assert(!planner.computeCommand(Pose(1.0, 1.0, 0.0), makeCommand(0.1, 0.0, 0.0), field, command));
+    assert(command.vx == 0.0 && command.vy == 0.0 && command.omega == 0.0);
+    assert(planner.getMetrics().blockedCycles == blocked + 1);
+
+    /**
+     * @test Test 5: A tiny budget stops the evaluation after the first block but still gives a
+     * usable command; with the default budget a cycle of 1225 samples fits a control period.
+     */
+    field.compute(room, 3.0, 3.0, 0.0, 1.0f);
+    planner.setGoal(5.0, 3.0, 0.05);
+    planner.setRate(0.1, 0.001);
+    unsigned long overruns = planner.getMetrics().budgetOverruns;
+    planner.computeCommand(Pose(2.0, 3.0, 0.0), makeCommand(0.2, 0.0, 0.0), field, command);
+    assert(planner.getMetrics().budgetOverruns == overruns + 1);
+    assert(planner.getMetrics().lastSamples == DwaPlanner::BLOCK && command.vx > 0.0);
+
+    planner.setRate(0.1, 100000.0);
+    planner.setSampling(7, 25, 1.5, 15);
+    const int runs = 200;
+    double totalUs = 0.0;
+    for (int r = 0; r < runs; r++) {
+        planner.computeCommand(Pose(2.0, 3.0 + 0.001 * r, 0.0), makeCommand(0.2, 0.0, 0.0), field, command);
+        totalUs += planner.getMetrics().lastCycleUs;
+    }
+    assert(planner.getMetrics().lastSamples == 7 * 7 * 25);
+    assert(totalUs / runs < 20000.0);
+    cout << "Planning cycle, " << planner.getMetrics().lastSamples << " samples x 15 steps: " << totalUs / runs
+         << " us" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -4,8 +4,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef _WIN32
 #include <process.h>
 #include <windows.h>
+#endif
 
 enum DIRECTION {
 	FORWARD = 0,
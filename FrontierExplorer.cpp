@@ -0,0 +1,371 @@
+/**
+ * @file FrontierExplorer.cpp
+ * @brief Implementation of the FrontierExplorer class.
+ * @date October 2026
+ */
+
+#include "FrontierExplorer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * @brief Orders clusters best first.
+ * @param a First cluster.
+ * @param b Second cluster.
+ * @return True if a ranks before b.
+ */
+static bool betterCluster(const FrontierCluster& a, const FrontierCluster& b) {
+    return a.score > b.score;
+}
+
+/**
+ * @brief Constructor for the FrontierExplorer class.
+ * Turns on the mapper's ray clearing, since frontiers are free cells next to unknown ones.
+ * @param mapper Mapper updated by step().
+ * @param controller Controller used to read the pose.
+ * @param follower Follower that drives the chosen paths.
+ * @param robotRadius Radius of the robot in meters.
+ */
+FrontierExplorer::FrontierExplorer(Mapper* mapper, RobotControler* controller, TrajectoryFollower* follower,
+    double robotRadius)
+    : mapper(mapper), controller(controller), follower(follower), planner(robotRadius), numberX(0), numberY(0),
+      cellSize(0.0), stamp(0), minClusterSize(5), gainRadius(1.5), costWeight(0.2), goalTolerance(0.3),
+      hasGoal(false), goalX(0), goalY(0), stats() {
+    if (mapper != nullptr) {
+        mapper->setRayClearing(true);
+    }
+}
+
+/**
+ * @brief Sets the ranking parameters.
+ * @param minimumSize Clusters with fewer cells are ignored (at least 1).
+ * @param radius Radius around a target in which unknown cells count as gain, in meters.
+ * @param weight Discount of the gain per meter of path (0 ranks by gain alone).
+ * @param tolerance Distance from the goal at which the robot has arrived, in meters.
+ */
+void FrontierExplorer::setParameters(int minimumSize, double radius, double weight, double tolerance) {
+    minClusterSize = minimumSize > 1 ? minimumSize : 1;
+    gainRadius = radius > 0.0 ? radius : 0.0;
+    costWeight = weight > 0.0 ? weight : 0.0;
+    goalTolerance = tolerance > 0.0 ? tolerance : 0.0;
+    buildGainDisc();
+}
+
+/**
+ * @brief Rebuilds the gain disc for the current cell size and gain radius.
+ */
+void FrontierExplorer::buildGainDisc() {
+    if (cellSize <= 0.0) {
+        return;
+    }
+    double reach = gainRadius / cellSize;
+    int r = static_cast<int>(floor(reach));
+    gainDisc.assign(2 * r + 1, 0);
+    for (int dx = -r; dx <= r; dx++) {
+        gainDisc[dx + r] = static_cast<int>(floor(sqrt(reach * reach - static_cast<double>(dx) * dx)));
+    }
+}
+
+/**
+ * @brief Adds a cell to or removes it from the frontier.
+ *
+ * The list is kept without holes: a removed cell is replaced by the last one.
+ *
+ * @param cell Index of the cell.
+ * @param isFrontier True if the cell is a frontier cell.
+ */
+void FrontierExplorer::setFrontier(int cell, bool isFrontier) {
+    if (isFrontier == (frontier[cell] != 0)) {
+        return;
+    }
+    frontier[cell] = isFrontier ? 1 : 0;
+    if (isFrontier) {
+        slots[cell] = static_cast<int>(frontierCells.size());
+        frontierCells.push_back(cell);
+        return;
+    }
+    int slot = slots[cell];
+    int moved = frontierCells.back();
+    frontierCells[slot] = moved;
+    slots[moved] = slot;
+    frontierCells.pop_back();
+    slots[cell] = -1;
+}
+
+/**
+ * @brief Groups the frontier cells into 8-connected clusters.
+ *
+ * A flood fill from every frontier cell not yet visited; cells are marked with the stamp of this
+ * clustering, so nothing has to be cleared between updates.
+ */
+void FrontierExplorer::cluster() {
+    members.clear();
+    memberStart.clear();
+    if (++stamp == 0) {
+        fill(visited.begin(), visited.end(), 0u);
+        stamp = 1;
+    }
+    for (size_t i = 0; i < frontierCells.size(); i++) {
+        int seed = frontierCells[i];
+        if (visited[seed] == stamp) {
+            continue;
+        }
+        size_t first = members.size();
+        visited[seed] = stamp;
+        members.push_back(seed);
+        for (size_t next = first; next < members.size(); next++) { // members doubles as the queue
+            int x = members[next] / numberY, y = members[next] % numberY;
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    int nx = x + dx, ny = y + dy;
+                    if (nx < 0 || nx >= numberX || ny < 0 || ny >= numberY) {
+                        continue;
+                    }
+                    int neighbour = nx * numberY + ny;
+                    if (frontier[neighbour] && visited[neighbour] != stamp) {
+                        visited[neighbour] = stamp;
+                        members.push_back(neighbour);
+                    }
+                }
+            }
+        }
+        if (members.size() - first < static_cast<size_t>(minClusterSize)) {
+            members.resize(first); // Too small: noise at the edge of a scan
+        }
+        else {
+            memberStart.push_back(first);
+        }
+    }
+}
+
+/**
+ * @brief Updates the frontier after a map update, clusters and ranks it.
+ *
+ * Whether a cell is a frontier depends on the cell and its four neighbours, so only the changed
+ * region grown by one cell is revisited.
+ *
+ * @param map The map.
+ * @param region The cells that changed since the last call.
+ * @param pose Current pose of the robot.
+ * @return The number of reachable clusters.
+ */
+size_t FrontierExplorer::update(const Map& map, const MapRegion& region, const Pose& pose) {
+    auto start = chrono::steady_clock::now();
+    MapRegion area = region;
+    if (map.getNumberX() != numberX || map.getNumberY() != numberY || map.getGridSize() != cellSize) {
+        numberX = map.getNumberX();
+        numberY = map.getNumberY();
+        cellSize = map.getGridSize();
+        size_t cellCount = static_cast<size_t>(numberX) * numberY;
+        frontier.assign(cellCount, 0);
+        slots.assign(cellCount, -1);
+        visited.assign(cellCount, 0u);
+        frontierCells.clear();
+        rejected.clear();
+        hasGoal = false;
+        buildGainDisc();
+        area.xMin = 0;
+        area.yMin = 0;
+        area.xMax = numberX;
+        area.yMax = numberY;
+        planner.update(map);
+    }
+    else {
+        planner.update(map, region);
+    }
+
+    stats.cellsChecked = 0;
+    if (area.xMin >= area.xMax || area.yMin >= area.yMax) {
+        area.xMax = area.xMin; // Nothing changed
+    }
+    else {
+        area.xMin = area.xMin > 1 ? area.xMin - 1 : 0;
+        area.yMin = area.yMin > 1 ? area.yMin - 1 : 0;
+        area.xMax = area.xMax + 1 < numberX ? area.xMax + 1 : numberX;
+        area.yMax = area.yMax + 1 < numberY ? area.yMax + 1 : numberY;
+    }
+    for (int x = area.xMin; x < area.xMax; x++) {
+        for (int y = area.yMin; y < area.yMax; y++) {
+            bool isFrontier = map.getGrid(x, y) == Map::CELL_FREE
+                && ((x > 0 && map.getGrid(x - 1, y) == Map::CELL_UNKNOWN)
+                    || (x + 1 < numberX && map.getGrid(x + 1, y) == Map::CELL_UNKNOWN)
+                    || (y > 0 && map.getGrid(x, y - 1) == Map::CELL_UNKNOWN)
+                    || (y + 1 < numberY && map.getGrid(x, y + 1) == Map::CELL_UNKNOWN));
+            setFrontier(x * numberY + y, isFrontier);
+        }
+    }
+    if (area.xMax > area.xMin && area.yMax > area.yMin) {
+        stats.cellsChecked = static_cast<unsigned long>(area.xMax - area.xMin) * (area.yMax - area.yMin);
+    }
+    if (hasGoal && hypot((goalX + 0.5) * cellSize - pose.getX(), (goalY + 0.5) * cellSize - pose.getY()) <= goalTolerance) {
+        if (isFrontier(goalX, goalY)) {
+            rejected.push_back(goalX * numberY + goalY); // The frontier cannot be cleared from there
+            stats.goalsRejected++;
+        }
+        hasGoal = false;
+    }
+
+    cluster();
+    clusters.clear();
+    if (!memberStart.empty()) {
+        planner.computeCosts(static_cast<int>(floor(pose.getX() / cellSize)),
+            static_cast<int>(floor(pose.getY() / cellSize)));
+    }
+    const int r = static_cast<int>(gainDisc.size() / 2);
+    for (size_t c = 0; c < memberStart.size(); c++) {
+        size_t first = memberStart[c];
+        size_t last = c + 1 < memberStart.size() ? memberStart[c + 1] : members.size();
+        double sumX = 0.0, sumY = 0.0;
+        for (size_t m = first; m < last; m++) {
+            sumX += members[m] / numberY;
+            sumY += members[m] % numberY;
+        }
+        double cx = sumX / (last - first), cy = sumY / (last - first);
+        int target = -1;
+        double nearest = 0.0;
+        for (size_t m = first; m < last; m++) {
+            int x = members[m] / numberY, y = members[m] % numberY;
+            double d = (x - cx) * (x - cx) + (y - cy) * (y - cy);
+            if (planner.getCost(x, y) >= 0.0 && (target < 0 || d < nearest)) {
+                target = members[m];
+                nearest = d;
+            }
+        }
+        if (target < 0) {
+            continue; // No member is reachable
+        }
+        FrontierCluster found;
+        found.size = static_cast<int>(last - first);
+        found.centroidX = static_cast<float>((cx + 0.5) * cellSize);
+        found.centroidY = static_cast<float>((cy + 0.5) * cellSize);
+        found.targetX = target / numberY;
+        found.targetY = target % numberY;
+        int unknown = 0;
+        for (int dx = -r; dx <= r; dx++) {
+            int x = found.targetX + dx;
+            if (x < 0 || x >= numberX) {
+                continue;
+            }
+            int yFirst = found.targetY - gainDisc[dx + r] > 0 ? found.targetY - gainDisc[dx + r] : 0;
+            int yLast = found.targetY + gainDisc[dx + r] < numberY - 1 ? found.targetY + gainDisc[dx + r] : numberY - 1;
+            for (int y = yFirst; y <= yLast; y++) {
+                unknown += map.getGrid(x, y) == Map::CELL_UNKNOWN ? 1 : 0;
+            }
+        }
+        found.gain = static_cast<float>(unknown * cellSize * cellSize);
+        found.pathCost = static_cast<float>(planner.getCost(found.targetX, found.targetY));
+        found.score = static_cast<float>(found.gain * exp(-costWeight * found.pathCost));
+        clusters.push_back(found);
+    }
+    sort(clusters.begin(), clusters.end(), betterCluster);
+
+    stats.updates++;
+    stats.frontierCells = frontierCells.size();
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    stats.longestUs = stats.lastUs > stats.longestUs ? stats.lastUs : stats.longestUs;
+    return clusters.size();
+}
+
+/**
+ * @brief Chooses the best cluster of the last update() as the goal.
+ * Clusters whose target lies within half the gain radius of a rejected goal are passed over.
+ * @param goalPath Receives the path from the robot to the goal's target cell.
+ * @return False if no reachable cluster is left.
+ */
+bool FrontierExplorer::selectGoal(vector<Pose>& goalPath) {
+    const double reject = 0.5 * gainRadius / cellSize;
+    for (size_t c = 0; c < clusters.size(); c++) {
+        const FrontierCluster& candidate = clusters[c];
+        bool passed = false;
+        for (size_t g = 0; g < rejected.size() && !passed; g++) {
+            int dx = rejected[g] / numberY - candidate.targetX, dy = rejected[g] % numberY - candidate.targetY;
+            passed = dx * dx + dy * dy <= reject * reject;
+        }
+        if (!passed && planner.extractPath(candidate.targetX, candidate.targetY, goalPath)) {
+            hasGoal = true;
+            goalX = candidate.targetX;
+            goalY = candidate.targetY;
+            return true;
+        }
+    }
+    hasGoal = false;
+    goalPath.clear();
+    return false;
+}
+
+/**
+ * @brief Runs one exploration cycle.
+ *
+ * Meant to run periodically (see PeriodicExecutor) while the follower drives on its own thread.
+ *
+ * @return False once no reachable frontier is left; the follower is then stopped.
+ */
+bool FrontierExplorer::step() {
+    mapper->updateMap();
+    update(mapper->getMap(), mapper->takeChangedRegion(), controller->getPose());
+    if (hasGoal && follower->isRunning() && isFrontier(goalX, goalY)) {
+        return true; // Still on the way
+    }
+    if (!selectGoal(path)) {
+        follower->stop();
+        return false;
+    }
+    follower->setPath(path);
+    follower->start();
+    stats.goalsSent++;
+    return true;
+}
+
+/**
+ * @brief Tells whether a cell is a frontier cell.
+ * @param x Column.
+ * @param y Row.
+ * @return True if the cell is a frontier cell.
+ */
+bool FrontierExplorer::isFrontier(int x, int y) const {
+    return x >= 0 && x < numberX && y >= 0 && y < numberY && frontier[static_cast<size_t>(x) * numberY + y] != 0;
+}
+
+/**
+ * @brief Returns the number of frontier cells.
+ * @return The number of frontier cells.
+ */
+size_t FrontierExplorer::getFrontierCount() const {
+    return frontierCells.size();
+}
+
+/**
+ * @brief Returns the number of reachable clusters of the last update().
+ * @return The number of clusters.
+ */
+size_t FrontierExplorer::getClusterCount() const {
+    return clusters.size();
+}
+
+/**
+ * @brief Returns a reachable cluster of the last update().
+ * @param index Index of the cluster, less than getClusterCount().
+ * @return The cluster.
+ */
+const FrontierCluster& FrontierExplorer::getCluster(size_t index) const {
+    return clusters[index];
+}
+
+/**
+ * @brief Returns the planner.
+ * @return The planner.
+ */
+const GridPlanner& FrontierExplorer::getPlanner() const {
+    return planner;
+}
+
+/**
+ * @brief Returns the counters.
+ * @return The counters.
+ */
+ExplorerStats FrontierExplorer::getStats() const {
+    return stats;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file FrontierExplorer.h
+ * @brief Declaration of the FrontierExplorer class, autonomous frontier-based exploration with the Mapper.
+ * @date October 2026
+ */
+
+#ifndef FRONTIEREXPLORER_H
+#define FRONTIEREXPLORER_H
+
+#include "Mapper.h"
+#include "RobotControler.h"
+#include "TrajectoryFollower.h"
+#include "GridPlanner.h"
+#include <vector>
+
+/**
+ * @struct FrontierCluster
+ * @brief A connected group of frontier cells the robot can reach.
+ */
+struct FrontierCluster {
+    int size;            /**< Number of frontier cells. */
+    float centroidX;     /**< X of the centroid in meters. */
+    float centroidY;     /**< Y of the centroid in meters. */
+    int targetX;         /**< Column of the cell the robot is sent to: the reachable member closest to the centroid. */
+    int targetY;         /**< Row of the target cell. */
+    float gain;          /**< Unknown area within the gain radius of the target, in square meters. */
+    float pathCost;      /**< Length of the shortest path from the robot to the target, in meters. */
+    float score;         /**< Rank of the cluster: gain * exp(-costWeight * pathCost). */
+};
+
+/**
+ * @struct ExplorerStats
+ * @brief Counters of a FrontierExplorer.
+ */
+struct ExplorerStats {
+    unsigned long updates;       /**< Calls to update(). */
+    unsigned long cellsChecked;  /**< Cells whose frontier status was recomputed by the last update(). */
+    unsigned long goalsSent;     /**< Paths handed to the follower. */
+    unsigned long goalsRejected; /**< Goals arrived at without their frontier disappearing. */
+    size_t frontierCells;        /**< Frontier cells after the last update(). */
+    double lastUs;               /**< Duration of the last update(), in microseconds. */
+    double longestUs;            /**< Longest update(), in microseconds. */
+};
+
+/**
+ * @class FrontierExplorer
+ * @brief Drives the robot to the most promising frontier until the reachable space is mapped.
+ *
+ * A frontier cell is a free cell next to an unknown one. The explorer keeps a frontier flag per
+ * cell and a list of the frontier cells, and after each map update only recomputes the flags in
+ * the region the Mapper reports as changed (grown by one cell), so detection costs the area of a
+ * scan rather than the area of the map. Clustering walks the frontier cells only.
+ *
+ * Each cluster is scored by the unknown area around its target, discounted by the length of the
+ * path to it, which one Dijkstra search of a GridPlanner provides for every cluster at once. The
+ * best cluster's path is handed to a TrajectoryFollower; a new goal is chosen when the follower
+ * stops or the goal's frontier disappears. A goal the robot arrives at without its frontier
+ * disappearing, such as a sliver of cells at a grazing angle to a wall, is not chosen again, nor
+ * are goals near it.
+ */
+class FrontierExplorer {
+private:
+    Mapper* mapper;                          /**< Mapper updated by step(). */
+    RobotControler* controller;              /**< Controller used to read the pose. */
+    TrajectoryFollower* follower;            /**< Follower that drives the chosen paths. */
+    GridPlanner planner;                     /**< Passable cells and path costs. */
+
+    int numberX;                             /**< Number of columns of the map. */
+    int numberY;                             /**< Number of rows of the map. */
+    double cellSize;                         /**< Edge of a cell in meters. */
+    std::vector<unsigned char> frontier;     /**< 1 for a frontier cell, indexed x * numberY + y. */
+    std::vector<int> frontierCells;          /**< Indices of the frontier cells, in no particular order. */
+    std::vector<int> slots;                  /**< Position of each cell in frontierCells, or -1. */
+    std::vector<unsigned int> visited;       /**< Clustering stamp of each cell. */
+    unsigned int stamp;                      /**< Stamp of the current clustering. */
+    std::vector<int> members;                /**< Cells of all clusters, cluster by cluster. */
+    std::vector<size_t> memberStart;         /**< First entry in members of each cluster found. */
+    std::vector<FrontierCluster> clusters;   /**< Reachable clusters, best first. */
+    std::vector<int> gainDisc;               /**< Half-height of the gain disc per column offset. */
+    std::vector<int> rejected;               /**< Goal cells reached without their frontier disappearing. */
+
+    int minClusterSize;                      /**< Smaller clusters are ignored. */
+    double gainRadius;                       /**< Radius around a target in which unknown cells count, in meters. */
+    double costWeight;                       /**< Discount of the gain per meter of path. */
+    double goalTolerance;                    /**< Distance from the goal at which the robot has arrived, in meters. */
+    bool hasGoal;                            /**< True while a goal is being driven to. */
+    int goalX;                               /**< Column of the current goal. */
+    int goalY;                               /**< Row of the current goal. */
+    std::vector<Pose> path;                  /**< Path to the current goal. */
+    ExplorerStats stats;                     /**< Counters. */
+
+    /**
+     * @brief Adds a cell to or removes it from the frontier.
+     * @param cell Index of the cell.
+     * @param isFrontier True if the cell is a frontier cell.
+     */
+    void setFrontier(int cell, bool isFrontier);
+
+    /**
+     * @brief Groups the frontier cells into 8-connected clusters.
+     */
+    void cluster();
+
+    /**
+     * @brief Rebuilds the gain disc for the current cell size and gain radius.
+     */
+    void buildGainDisc();
+
+public:
+    /**
+     * @brief Constructor for the FrontierExplorer class.
+     * @param mapper Mapper updated by step(), with its ray clearing turned on; may be nullptr if only
+     *        update() and selectGoal() are used (their map then needs free cells, see Mapper::setRayClearing()).
+     * @param controller Controller used to read the pose; may be nullptr likewise.
+     * @param follower Follower that drives the chosen paths; may be nullptr likewise.
+     * @param robotRadius Radius of the robot in meters, kept clear of obstacles by the paths.
+     */
+    FrontierExplorer(Mapper* mapper, RobotControler* controller, TrajectoryFollower* follower,
+        double robotRadius = 0.25);
+
+    /**
+     * @brief Sets the ranking parameters.
+     * @param minimumSize Clusters with fewer cells are ignored (at least 1).
+     * @param radius Radius around a target in which unknown cells count as gain, in meters.
+     * @param weight Discount of the gain per meter of path (0 ranks by gain alone).
+     * @param tolerance Distance from the goal at which the robot has arrived, in meters.
+     */
+    void setParameters(int minimumSize, double radius, double weight, double tolerance = 0.3);
+
+    /**
+     * @brief Updates the frontier after a map update, clusters and ranks it.
+     * If the robot has arrived at the goal, the goal is dropped, and rejected if its frontier is still there.
+     * @param map The map.
+     * @param region The cells that changed since the last call; the first call, or a call after
+     *        the map size changed, checks the whole map.
+     * @param pose Current pose of the robot.
+     * @return The number of reachable clusters.
+     */
+    size_t update(const Map& map, const MapRegion& region, const Pose& pose);
+
+    /**
+     * @brief Chooses the best cluster of the last update() as the goal.
+     * @param goalPath Receives the path from the robot to the goal's target cell.
+     * @return False if no reachable cluster is left.
+     */
+    bool selectGoal(std::vector<Pose>& goalPath);
+
+    /**
+     * @brief Runs one exploration cycle: updates the map from the Lidar, updates the frontier and,
+     * when the follower has arrived or the goal's frontier has disappeared, sends it to the next goal.
+     * @return False once no reachable frontier is left; the follower is then stopped.
+     */
+    bool step();
+
+    /**
+     * @brief Tells whether a cell is a frontier cell.
+     * @param x Column.
+     * @param y Row.
+     * @return True if the cell is a frontier cell.
+     */
+    bool isFrontier(int x, int y) const;
+
+    /**
+     * @brief Returns the number of frontier cells.
+     * @return The number of frontier cells.
+     */
+    size_t getFrontierCount() const;
+
+    /**
+     * @brief Returns the number of reachable clusters of the last update().
+     * @return The number of clusters.
+     */
+    size_t getClusterCount() const;
+
+    /**
+     * @brief Returns a reachable cluster of the last update().
+     * @param index Index of the cluster, less than getClusterCount(); 0 is the best.
+     * @return The cluster.
+     */
+    const FrontierCluster& getCluster(size_t index) const;
+
+    /**
+     * @brief Returns the planner, e.g. to plan other paths on the same passable cells.
+     * @return The planner.
+     */
+    const GridPlanner& getPlanner() const;
+
+    /**
+     * @brief Returns the counters.
+     * @return The counters.
+     */
+    ExplorerStats getStats() const;
+};
+
+#endif // FRONTIEREXPLORER_H
@@ -0,0 +1,205 @@
+/**
+ * @file FrontierExplorerTest.cpp
+ * @brief Test and benchmark application for the FrontierExplorer class.
+ * @details Checks frontier detection and ranking on hand-made maps, then explores a simulated
+ * three-room floor with the Mapper, checking that the incremental frontier always matches a full
+ * recomputation, that the paths stay in passable space and that the floor ends up mapped.
+ * @date October, 2026
+ */
+
+#include "FrontierExplorer.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Simulates a scan of the Lidar (-120 to 120 degrees in steps of 0.36) in a ground-truth map.
+ * @param truth The ground-truth map; occupied cells reflect the beams.
+ * @param pose Pose of the robot (th in radians).
+ * @param scan Receives the scan; beams without a return within 6 m read 0.
+ */
+void simulateScan(const Map& truth, const Pose& pose, LidarScan& scan) {
+    scan.timestamp = 0.0;
+    scan.pose = pose;
+    scan.angleMin = -120.0;
+    scan.angleIncrement = 0.36;
+    scan.rangeNumber = 667;
+    const double cell = truth.getGridSize();
+    for (int i = 0; i < scan.rangeNumber; i++) {
+        double angle = pose.getTh() + degToRad(scan.angleMin + i * scan.angleIncrement);
+        double dx = cos(angle), dy = sin(angle);
+        scan.ranges[i] = 0.0f;
+        for (double r = 0.0; r < 6.0; r += 0.01) {
+            int x = static_cast<int>(floor((pose.getX() + r * dx) / cell));
+            int y = static_cast<int>(floor((pose.getY() + r * dy) / cell));
+            if (x < 0 || x >= truth.getNumberX() || y < 0 || y >= truth.getNumberY()) {
+                break;
+            }
+            if (truth.getGrid(x, y) == Map::CELL_OCCUPIED) {
+                scan.ranges[i] = static_cast<float>(r + 0.005);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Marks a rectangle of cells.
+ * @param map The map.
+ * @param x0 First column.
+ * @param y0 First row.
+ * @param x1 Last column.
+ * @param y1 Last row.
+ * @param value The cell value.
+ */
+void fill(Map& map, int x0, int y0, int x1, int y1, int value) {
+    for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+            map.setGrid(x, y, value);
+        }
+    }
+}
+
+/**
+ * @brief Tells whether two explorers see the same frontier cells.
+ * @param a First explorer.
+ * @param b Second explorer.
+ * @param map The map both have processed.
+ * @return True if every cell has the same frontier status.
+ */
+bool sameFrontier(const FrontierExplorer& a, const FrontierExplorer& b, const Map& map) {
+    for (int x = 0; x < map.getNumberX(); x++) {
+        for (int y = 0; y < map.getNumberY(); y++) {
+            if (a.isFrontier(x, y) != b.isFrontier(x, y)) {
+                return false;
+            }
+        }
+    }
+    return a.getFrontierCount() == b.getFrontierCount();
+}
+
+/**
+ * @brief Main function for testing the frontier explorer.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    MapRegion none = { 0, 0, 0, 0 };
+
+    /**
+     * @test Test 1: A free rectangle in unknown space has its border as one frontier cluster;
+     * a wall on one side removes that side from the frontier.
+     */
+    Map map(60, 60, 0.1);
+    fill(map, 20, 20, 39, 39, Map::CELL_FREE);
+    FrontierExplorer explorer(nullptr, nullptr, nullptr, 0.1);
+    assert(explorer.update(map, none, Pose(3.0, 3.0, 0.0)) == 1);
+    assert(explorer.getFrontierCount() == 4 * 20 - 4);
+    assert(explorer.isFrontier(20, 20) && explorer.isFrontier(39, 30) && !explorer.isFrontier(30, 30));
+    const FrontierCluster& ring = explorer.getCluster(0);
+    assert(ring.size == 76 && fabs(ring.centroidX - 3.0) < 0.06 && fabs(ring.centroidY - 3.0) < 0.06);
+    assert(ring.gain > 0.0f && ring.pathCost > 0.0f);
+
+    fill(map, 19, 19, 40, 19, Map::CELL_OCCUPIED);
+    MapRegion wall = { 19, 19, 41, 20 };
+    explorer.update(map, wall, Pose(3.0, 3.0, 0.0));
+    assert(!explorer.isFrontier(30, 20) && explorer.isFrontier(30, 39));
+    assert(explorer.getFrontierCount() == 3 * 20 - 2);
+
+    /**
+     * @test Test 2: Of two equal openings the nearer one ranks first, and an opening the robot
+     * cannot reach is left out.
+     */
+    Map corridor(100, 20, 0.1);
+    fill(corridor, 10, 5, 89, 14, Map::CELL_FREE);
+    fill(corridor, 10, 4, 89, 4, Map::CELL_OCCUPIED);
+    fill(corridor, 10, 15, 89, 15, Map::CELL_OCCUPIED);
+    fill(corridor, 50, 2, 52, 3, Map::CELL_FREE); // An unreachable pocket behind the wall
+    FrontierExplorer ranking(nullptr, nullptr, nullptr, 0.1);
+    ranking.setParameters(3, 1.0, 0.2);
+    assert(ranking.update(corridor, none, Pose(2.0, 1.0, 0.0)) == 2);
+    assert(ranking.getCluster(0).targetX == 10 && ranking.getCluster(1).targetX == 89);
+    assert(ranking.getCluster(0).pathCost < ranking.getCluster(1).pathCost);
+    vector<Pose> path;
+    assert(ranking.selectGoal(path) && fabs(path.back().getX() - 1.05) < 1e-9);
+
+    /**
+     * @test Test 3: Exploring a simulated 20 m by 12 m floor of three rooms joined by doorways
+     * maps nearly all of it, with the incremental frontier matching a full recomputation after
+     * every update.
+     */
+    const int width = 400, height = 240;
+    Map truth(width, height, 0.05);
+    fill(truth, 0, 0, width - 1, height - 1, Map::CELL_FREE);
+    fill(truth, 0, 0, width - 1, 1, Map::CELL_OCCUPIED);
+    fill(truth, 0, height - 2, width - 1, height - 1, Map::CELL_OCCUPIED);
+    fill(truth, 0, 0, 1, height - 1, Map::CELL_OCCUPIED);
+    fill(truth, width - 2, 0, width - 1, height - 1, Map::CELL_OCCUPIED);
+    fill(truth, 130, 0, 131, 169, Map::CELL_OCCUPIED); // Doorway at y = 8.5 to 9.5 m
+    fill(truth, 130, 190, 131, height - 1, Map::CELL_OCCUPIED);
+    fill(truth, 270, 0, 271, 39, Map::CELL_OCCUPIED); // Doorway at y = 2 to 3 m
+    fill(truth, 270, 60, 271, height - 1, Map::CELL_OCCUPIED);
+    fill(truth, 271, 120, 349, 121, Map::CELL_OCCUPIED); // A partition in the last room
+    fill(truth, 50, 90, 70, 110, Map::CELL_OCCUPIED); // A cabinet in the first room
+
+    Mapper mapper(width, height, 0.05, nullptr, nullptr);
+    mapper.setRayClearing(true); // Frontiers are free cells next to unknown ones
+    FrontierExplorer exploring(nullptr, nullptr, nullptr, 0.2);
+    static LidarScan scan;
+    Pose pose(1.0, 1.0, degToRad(45.0));
+    int goals = 0;
+    double totalUs = 0.0, longestUs = 0.0;
+    unsigned long checked = 0;
+    for (; goals < 60; goals++) {
+        simulateScan(truth, pose, scan);
+        mapper.updateMap(scan);
+        exploring.update(mapper.getMap(), mapper.takeChangedRegion(), pose);
+        totalUs += exploring.getStats().lastUs;
+        longestUs = exploring.getStats().lastUs > longestUs ? exploring.getStats().lastUs : longestUs;
+        checked += goals > 0 ? exploring.getStats().cellsChecked : 0; // The first update checks the whole map
+
+        FrontierExplorer full(nullptr, nullptr, nullptr, 0.2);
+        full.update(mapper.getMap(), none, pose);
+        assert(sameFrontier(exploring, full, mapper.getMap()));
+        assert(full.getClusterCount() == exploring.getClusterCount());
+
+        if (!exploring.selectGoal(path)) {
+            break;
+        }
+        for (size_t i = 0; i < path.size(); i++) {
+            int x = static_cast<int>(floor(path[i].getX() / 0.05)), y = static_cast<int>(floor(path[i].getY() / 0.05));
+            assert(truth.getGrid(x, y) == Map::CELL_FREE);
+            if (i % 10 == 9 && i + 1 < path.size()) { // Scan every half meter on the way
+                simulateScan(truth, path[i], scan);
+                mapper.updateMap(scan);
+            }
+        }
+        pose = path.back();
+    }
+    assert(goals < 60);
+    int freeCells = 0, mappedCells = 0;
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            if (truth.getGrid(x, y) == Map::CELL_FREE) {
+                freeCells++;
+                mappedCells += mapper.getMap().getGrid(x, y) == Map::CELL_FREE ? 1 : 0;
+            }
+        }
+    }
+    double coverage = static_cast<double>(mappedCells) / freeCells;
+    assert(coverage > 0.95);
+    cout << "Explored " << coverage * 100.0 << " % of the floor with " << goals << " goals" << endl;
+
+    /**
+     * @test Test 4: An update only checks the cells near the scan, and takes a small part of
+     * an exploration cycle.
+     */
+    double meanChecked = static_cast<double>(checked) / goals;
+    assert(meanChecked < width * height / 2);
+    cout << "Update: " << meanChecked << " of " << width * height << " cells checked, " << totalUs / (goals + 1)
+         << " us on average, " << longestUs << " us at most" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
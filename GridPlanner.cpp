@@ -0,0 +1,645 @@
+/**
+ * @file GridPlanner.cpp
+ * @brief Implementation of the GridPlanner class.
+ * @date October 2026
+ */
+
+#include "GridPlanner.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+const float GridPlanner::UNREACHED = -1.0f;
+
+/**
+ * @brief Cost of a diagonal step in cells.
+ */
+static const float DIAGONAL = 1.41421356f;
+
+/**
+ * @brief Octile distance, the cost of the shortest path between two cells in free space.
+ * @param dx Column difference.
+ * @param dy Row difference.
+ * @return The cost in cells.
+ */
+static float octile(int dx, int dy) {
+    dx = dx < 0 ? -dx : dx;
+    dy = dy < 0 ? -dy : dy;
+    return dx < dy ? DIAGONAL * dx + (dy - dx) : DIAGONAL * dy + (dx - dy);
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero word.
+ * @param word The word.
+ * @return The bit index, 0 to 63.
+ */
+static int lowestBit(uint64_t word) {
+    static const int DE_BRUIJN[64] = {
+        0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+    return DE_BRUIJN[((word & (0 - word)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero word.
+ * @param word The word.
+ * @return The bit index, 0 to 63.
+ */
+static int highestBit(uint64_t word) {
+    int bit = 0;
+    for (int shift = 32; shift > 0; shift >>= 1) {
+        if (word >> shift) {
+            word >>= shift;
+            bit += shift;
+        }
+    }
+    return bit;
+}
+
+/**
+ * @brief Sets or clears a bit of a line of a padded bit grid.
+ * @param bits The bit grid.
+ * @param words Words per line.
+ * @param line Line, -1 to the line count.
+ * @param position Position on the line, -1 to the line length.
+ * @param value True to set the bit.
+ */
+static void setBit(vector<uint64_t>& bits, int words, int line, int position, bool value) {
+    uint64_t& word = bits[static_cast<size_t>(line + 1) * words + (position + 1) / 64];
+    uint64_t mask = 1ULL << ((position + 1) % 64);
+    word = value ? word | mask : word & ~mask;
+}
+
+/**
+ * @brief Constructor for the GridPlanner class. The planner has no cells until update() is called.
+ * @param radius Radius of the robot in meters.
+ */
+GridPlanner::GridPlanner(double radius)
+    : numberX(0), numberY(0), cellSize(0.0), robotRadius(radius > 0.0 ? radius : 0.0), rowWords(0), columnWords(0),
+      searchId(0), startCell(-1), stats() {}
+
+/**
+ * @brief Orders open entries so that the heap yields the lowest priority first.
+ * @param a First entry.
+ * @param b Second entry.
+ * @return True if a comes after b.
+ */
+bool GridPlanner::later(const OpenEntry& a, const OpenEntry& b) {
+    return a.priority > b.priority;
+}
+
+/**
+ * @brief Rebuilds the passable cells from the whole map.
+ * @param map The map.
+ */
+void GridPlanner::update(const Map& map) {
+    MapRegion all = { 0, 0, map.getNumberX(), map.getNumberY() };
+    numberX = 0; // Forces the rebuild
+    update(map, all);
+}
+
+/**
+ * @brief Recomputes the passable cells a change of the map can affect.
+ *
+ * A cell's passability depends on the map within the robot radius of it, so the region grown by
+ * the radius is reset from the map and the footprint is stamped around every occupied cell
+ * within the radius of that.
+ *
+ * @param map The map; if its size differs from the last update, the whole map is rebuilt.
+ * @param region The cells that changed, e.g. from Mapper::takeChangedRegion().
+ * @return The cells whose passability was recomputed: the region grown by the robot radius,
+ *         the whole grid after a rebuild, or an empty region.
+ */
+MapRegion GridPlanner::update(const Map& map, const MapRegion& region) {
+    auto start = chrono::steady_clock::now();
+    MapRegion area = region;
+    if (map.getNumberX() != numberX || map.getNumberY() != numberY || map.getGridSize() != cellSize) {
+        numberX = map.getNumberX();
+        numberY = map.getNumberY();
+        cellSize = map.getGridSize();
+        size_t cellCount = static_cast<size_t>(numberX) * numberY;
+        blocked.assign(cellCount, 1);
+        costs.assign(cellCount, FLT_MAX);
+        parents.assign(cellCount, -1);
+        visits.assign(cellCount, 0);
+        searchId = 0;
+        // Bits of the lines and positions outside the grid stay set, so scans stop at the border
+        rowWords = (numberX + 2 + 63) / 64;
+        columnWords = (numberY + 2 + 63) / 64;
+        rowBits.assign(static_cast<size_t>(numberY + 2) * rowWords, ~0ULL);
+        columnBits.assign(static_cast<size_t>(numberX + 2) * columnWords, ~0ULL);
+        startCell = -1;
+        double reach = robotRadius / cellSize;
+        int r = static_cast<int>(ceil(reach - 1e-9));
+        footprint.assign(2 * r + 1, 0);
+        for (int dx = -r; dx <= r; dx++) {
+            double span = reach * reach - static_cast<double>(dx) * dx;
+            footprint[dx + r] = span >= 0.0 ? static_cast<int>(floor(sqrt(span) + 1e-9)) : -1;
+        }
+        area.xMin = 0;
+        area.yMin = 0;
+        area.xMax = numberX;
+        area.yMax = numberY;
+    }
+    if (area.xMin >= area.xMax || area.yMin >= area.yMax) {
+        MapRegion none = { 0, 0, 0, 0 };
+        return none; // Nothing changed
+    }
+    const int r = static_cast<int>(footprint.size() / 2);
+    area.xMin = area.xMin - r > 0 ? area.xMin - r : 0;
+    area.yMin = area.yMin - r > 0 ? area.yMin - r : 0;
+    area.xMax = area.xMax + r < numberX ? area.xMax + r : numberX;
+    area.yMax = area.yMax + r < numberY ? area.yMax + r : numberY;
+
+    for (int x = area.xMin; x < area.xMax; x++) {
+        unsigned char* column = &blocked[static_cast<size_t>(x) * numberY];
+        for (int y = area.yMin; y < area.yMax; y++) {
+            column[y] = map.getGrid(x, y) == Map::CELL_FREE ? 0 : 1;
+        }
+    }
+    int sourceXMin = area.xMin - r > 0 ? area.xMin - r : 0;
+    int sourceYMin = area.yMin - r > 0 ? area.yMin - r : 0;
+    int sourceXMax = area.xMax + r < numberX ? area.xMax + r : numberX;
+    int sourceYMax = area.yMax + r < numberY ? area.yMax + r : numberY;
+    for (int x = sourceXMin; x < sourceXMax; x++) {
+        for (int y = sourceYMin; y < sourceYMax; y++) {
+            if (map.getGrid(x, y) != Map::CELL_OCCUPIED) {
+                continue;
+            }
+            for (int dx = -r; dx <= r; dx++) {
+                int cx = x + dx;
+                int half = footprint[dx + r];
+                if (cx < area.xMin || cx >= area.xMax || half < 0) {
+                    continue;
+                }
+                int first = y - half > area.yMin ? y - half : area.yMin;
+                int last = y + half < area.yMax - 1 ? y + half : area.yMax - 1;
+                unsigned char* column = &blocked[static_cast<size_t>(cx) * numberY];
+                for (int cy = first; cy <= last; cy++) {
+                    column[cy] = 1;
+                }
+            }
+        }
+    }
+    for (int x = area.xMin; x < area.xMax; x++) {
+        const unsigned char* column = &blocked[static_cast<size_t>(x) * numberY];
+        for (int y = area.yMin; y < area.yMax; y++) {
+            setBit(rowBits, rowWords, y, x, column[y] != 0);
+            setBit(columnBits, columnWords, x, y, column[y] != 0);
+        }
+    }
+    stats.lastUpdateUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    return area;
+}
+
+/**
+ * @brief Tells whether the robot can occupy a cell.
+ * @param x Column.
+ * @param y Row.
+ * @return True if the cell is inside the grid and passable.
+ */
+bool GridPlanner::isPassable(int x, int y) const {
+    return x >= 0 && x < numberX && y >= 0 && y < numberY && !blocked[static_cast<size_t>(x) * numberY + y];
+}
+
+/**
+ * @brief Computes the path cost of every reachable cell from a start cell (Dijkstra).
+ * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+ * @param startY Row of the start.
+ * @param maxCost Cells beyond this cost in meters are left unreached; 0 or less for no limit.
+ * @return The number of cells reached.
+ */
+size_t GridPlanner::computeCosts(int startX, int startY, double maxCost) {
+    auto start = chrono::steady_clock::now();
+    if (!beginSearch(startX, startY)) {
+        stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        return 0;
+    }
+    const float limit = maxCost > 0.0 ? static_cast<float>(maxCost / cellSize) : FLT_MAX;
+    size_t reached = 0;
+    while (!open.empty()) {
+        pop_heap(open.begin(), open.end(), later);
+        OpenEntry entry = open.back();
+        open.pop_back();
+        if (entry.priority > costs[entry.cell]) {
+            continue; // A cheaper entry of this cell was expanded already
+        }
+        stats.expanded++;
+        reached++;
+        int x = entry.cell / numberY, y = entry.cell % numberY;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                if ((dx == 0 && dy == 0) || !canStep(x, y, dx, dy)) {
+                    continue;
+                }
+                float cost = entry.priority + (dx != 0 && dy != 0 ? DIAGONAL : 1.0f);
+                if (cost <= limit) {
+                    relax(entry.cell + dx * numberY + dy, entry.cell, cost, 0.0f);
+                }
+            }
+        }
+    }
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    return reached;
+}
+
+/**
+ * @brief Starts a search: invalidates the costs of the last one and puts the start on the open list.
+ * @param startX Column of the start.
+ * @param startY Row of the start.
+ * @return False if the start is outside the grid.
+ */
+bool GridPlanner::beginSearch(int startX, int startY) {
+    stats.expanded = 0;
+    stats.scanned = 0;
+    open.clear();
+    startCell = -1;
+    if (++searchId == 0) { // The stamp wrapped around: old stamps could match again
+        fill(visits.begin(), visits.end(), 0u);
+        searchId = 1;
+    }
+    if (startX < 0 || startX >= numberX || startY < 0 || startY >= numberY) {
+        return false;
+    }
+    startCell = startX * numberY + startY;
+    visits[startCell] = searchId;
+    costs[startCell] = 0.0f;
+    parents[startCell] = -1;
+    OpenEntry first = { 0.0f, startCell };
+    open.push_back(first);
+    return true;
+}
+
+/**
+ * @brief Tells whether a step from a cell to a neighbour is allowed.
+ * @param x Column of the cell.
+ * @param y Row of the cell.
+ * @param dx Column step (-1, 0 or 1).
+ * @param dy Row step (-1, 0 or 1).
+ * @return True if the neighbour is passable and a diagonal step does not cut a blocked corner.
+ */
+bool GridPlanner::canStep(int x, int y, int dx, int dy) const {
+    if (!isPassable(x + dx, y + dy)) {
+        return false;
+    }
+    return dx == 0 || dy == 0 || (isPassable(x + dx, y) && isPassable(x, y + dy));
+}
+
+/**
+ * @brief Lowers the cost of a cell if a cheaper way to it was found, and queues it.
+ * @param cell Index of the cell.
+ * @param parent Index of the cell it is reached from.
+ * @param cost Cost of the cell through the parent, in cells.
+ * @param estimate Estimated remaining cost to the goal, in cells (0 for Dijkstra).
+ */
+void GridPlanner::relax(int cell, int parent, float cost, float estimate) {
+    if (visits[cell] == searchId && cost >= costs[cell]) {
+        return;
+    }
+    visits[cell] = searchId;
+    costs[cell] = cost;
+    parents[cell] = parent;
+    OpenEntry item = { cost + estimate, cell };
+    open.push_back(item);
+    push_heap(open.begin(), open.end(), later);
+}
+
+/**
+ * @brief Finds a shortest path from a start cell to a goal cell (A* with the octile distance).
+ * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+ * @param startY Row of the start.
+ * @param goalX Column of the goal.
+ * @param goalY Row of the goal.
+ * @param path Receives the cell centres in meters, from the start to the goal.
+ * @return False if the goal is not passable or cannot be reached.
+ */
+bool GridPlanner::findPath(int startX, int startY, int goalX, int goalY, vector<Pose>& path) {
+    auto start = chrono::steady_clock::now();
+    path.clear();
+    bool found = false;
+    if (beginSearch(startX, startY) && (isPassable(goalX, goalY) || (startX == goalX && startY == goalY))) {
+        const int goalCell = goalX * numberY + goalY;
+        while (!open.empty()) {
+            pop_heap(open.begin(), open.end(), later);
+            OpenEntry entry = open.back();
+            open.pop_back();
+            int x = entry.cell / numberY, y = entry.cell % numberY;
+            if (entry.priority > costs[entry.cell] + octile(goalX - x, goalY - y)) {
+                continue; // A cheaper entry of this cell was expanded already
+            }
+            stats.expanded++;
+            if (entry.cell == goalCell) {
+                found = true;
+                break;
+            }
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    if ((dx != 0 || dy != 0) && canStep(x, y, dx, dy)) {
+                        relax(entry.cell + dx * numberY + dy, entry.cell,
+                            costs[entry.cell] + (dx != 0 && dy != 0 ? DIAGONAL : 1.0f), octile(goalX - x - dx, goalY - y - dy));
+                    }
+                }
+            }
+        }
+        if (found) {
+            tracePath(goalCell, path);
+        }
+    }
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    return found;
+}
+
+/**
+ * @brief Scans a row or column of bits for the next jump point of a straight jump.
+ *
+ * A position is a jump point if a cell beside it on a neighbouring line is passable while the
+ * one beside the previous position is blocked. Per 64-bit word the blocked bits of the line and
+ * these forced bits are combined, and the first set bit ahead ends the scan.
+ *
+ * @param bits rowBits for a scan along a row, columnBits for a scan along a column.
+ * @param words Words per line of bits.
+ * @param line Row or column of the scan.
+ * @param position Column or row the scan starts from (excluded).
+ * @param direction 1 or -1.
+ * @param goalPosition Position of the goal if it lies on the line, else -1.
+ * @param hitBlocked Set to true if the scan ends at a blocked cell rather than a jump point.
+ * @return Position of the jump point or the goal, or of the blocked cell that ends the scan.
+ */
+int GridPlanner::scanLine(const vector<uint64_t>& bits, int words, int line, int position, int direction,
+    int goalPosition, bool& hitBlocked) const {
+    const uint64_t* below = &bits[static_cast<size_t>(line) * words];
+    const uint64_t* here = below + words;
+    const uint64_t* above = here + words;
+    int first = position + 1 + direction; // Bit of the first position scanned
+    int found = -1;
+    hitBlocked = false;
+    for (int w = first / 64; w >= 0 && w < words; w += direction) {
+        uint64_t stop;
+        if (direction > 0) {
+            uint64_t belowBack = (below[w] << 1) | (w > 0 ? below[w - 1] >> 63 : 0);
+            uint64_t aboveBack = (above[w] << 1) | (w > 0 ? above[w - 1] >> 63 : 0);
+            stop = here[w] | (~below[w] & belowBack) | (~above[w] & aboveBack);
+            stop &= w == first / 64 ? ~0ULL << (first % 64) : ~0ULL;
+        }
+        else {
+            uint64_t belowBack = (below[w] >> 1) | (w + 1 < words ? below[w + 1] << 63 : 0);
+            uint64_t aboveBack = (above[w] >> 1) | (w + 1 < words ? above[w + 1] << 63 : 0);
+            stop = here[w] | (~below[w] & belowBack) | (~above[w] & aboveBack);
+            stop &= w == first / 64 ? ~0ULL >> (63 - first % 64) : ~0ULL;
+        }
+        if (stop != 0) {
+            int bit = w * 64 + (direction > 0 ? lowestBit(stop) : highestBit(stop));
+            hitBlocked = ((here[bit / 64] >> (bit % 64)) & 1) != 0;
+            found = bit - 1;
+            break;
+        }
+    }
+    // The padding bits guarantee a stop; the goal counts if it comes first
+    if (goalPosition >= 0 && (goalPosition - position) * direction > 0 && (found - goalPosition) * direction >= 0) {
+        hitBlocked = false;
+        return goalPosition;
+    }
+    return found;
+}
+
+/**
+ * @brief Scans from a cell in one direction for the next jump point.
+ *
+ * A straight scan stops at a cell with a forced neighbour: a passable cell beside it whose
+ * counterpart beside the previous cell is blocked, so a shortest path may turn there; it runs on
+ * the bit lines with scanLine(). A diagonal scan steps cell by cell and stops where one of its
+ * two straight scans finds a jump point. Diagonal steps obey the same corner rule as the other
+ * searches.
+ *
+ * @param x Column of the cell.
+ * @param y Row of the cell.
+ * @param dx Column step (-1, 0 or 1).
+ * @param dy Row step (-1, 0 or 1).
+ * @param goalCell Index of the goal cell.
+ * @return Index of the jump point, or -1 if the scan runs into a blocked cell.
+ */
+int GridPlanner::jump(int x, int y, int dx, int dy, int goalCell) {
+    const int goalX = goalCell / numberY, goalY = goalCell % numberY;
+    if (dx == 0 || dy == 0) {
+        bool hitBlocked;
+        int next = dy == 0 ? scanLine(rowBits, rowWords, y, x, dx, goalY == y ? goalX : -1, hitBlocked)
+                           : scanLine(columnBits, columnWords, x, y, dy, goalX == x ? goalY : -1, hitBlocked);
+        stats.scanned += dy == 0 ? (next - x) * dx : (next - y) * dy;
+        if (hitBlocked) {
+            return -1;
+        }
+        return dy == 0 ? next * numberY + y : x * numberY + next;
+    }
+    while (canStep(x, y, dx, dy)) {
+        x += dx;
+        y += dy;
+        stats.scanned++;
+        int cell = x * numberY + y;
+        if (cell == goalCell || jump(x, y, dx, 0, goalCell) >= 0 || jump(x, y, 0, dy, goalCell) >= 0) {
+            return cell;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Finds a shortest path from a start cell to a goal cell with Jump Point Search.
+ *
+ * The start is expanded in all eight directions. Any other jump point is only expanded in the
+ * directions a shortest path through it can continue in: straight on, and for a straight
+ * arrival also sideways and diagonally forward where those cells are passable; for a diagonal
+ * arrival its two straight components and the diagonal itself.
+ *
+ * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+ * @param startY Row of the start.
+ * @param goalX Column of the goal.
+ * @param goalY Row of the goal.
+ * @param path Receives the cell centres in meters, every cell of the path included.
+ * @return False if the goal is not passable or cannot be reached.
+ */
+bool GridPlanner::findJumpPath(int startX, int startY, int goalX, int goalY, vector<Pose>& path) {
+    auto start = chrono::steady_clock::now();
+    path.clear();
+    bool found = false;
+    if (beginSearch(startX, startY) && (isPassable(goalX, goalY) || (startX == goalX && startY == goalY))) {
+        const int goalCell = goalX * numberY + goalY;
+        int directions[8][2];
+        while (!open.empty()) {
+            pop_heap(open.begin(), open.end(), later);
+            OpenEntry entry = open.back();
+            open.pop_back();
+            int x = entry.cell / numberY, y = entry.cell % numberY;
+            if (entry.priority > costs[entry.cell] + octile(goalX - x, goalY - y)) {
+                continue; // A cheaper entry of this cell was expanded already
+            }
+            stats.expanded++;
+            if (entry.cell == goalCell) {
+                found = true;
+                break;
+            }
+            int count = 0;
+            int parent = parents[entry.cell];
+            if (parent < 0) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        if (dx != 0 || dy != 0) {
+                            directions[count][0] = dx;
+                            directions[count++][1] = dy;
+                        }
+                    }
+                }
+            }
+            else {
+                int px = parent / numberY, py = parent % numberY;
+                int dx = x > px ? 1 : (x < px ? -1 : 0);
+                int dy = y > py ? 1 : (y < py ? -1 : 0);
+                if (dx != 0 && dy != 0) {
+                    int pruned[3][2] = { { dx, 0 }, { 0, dy }, { dx, dy } };
+                    for (int k = 0; k < 3; k++) {
+                        directions[count][0] = pruned[k][0];
+                        directions[count++][1] = pruned[k][1];
+                    }
+                }
+                else {
+                    // Sideways steps, and forward steps on the arrival axis
+                    int sideX = dy != 0 ? 1 : 0, sideY = dx != 0 ? 1 : 0;
+                    int pruned[5][2] = { { dx, dy }, { dx + sideX, dy + sideY }, { dx - sideX, dy - sideY },
+                        { sideX, sideY }, { -sideX, -sideY } };
+                    for (int k = 0; k < 5; k++) {
+                        directions[count][0] = pruned[k][0];
+                        directions[count++][1] = pruned[k][1];
+                    }
+                }
+            }
+            for (int k = 0; k < count; k++) {
+                int next = jump(x, y, directions[k][0], directions[k][1], goalCell);
+                if (next >= 0) {
+                    int nx = next / numberY, ny = next % numberY;
+                    relax(next, entry.cell, costs[entry.cell] + octile(nx - x, ny - y), octile(goalX - nx, goalY - ny));
+                }
+            }
+        }
+        if (found) {
+            tracePath(goalCell, path);
+        }
+    }
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    return found;
+}
+
+/**
+ * @brief Follows the parents from a cell back to the start, filling in the cells between jump points.
+ * @param endCell Index of the end cell.
+ * @param path Receives the cell centres from the start to the end cell.
+ */
+void GridPlanner::tracePath(int endCell, vector<Pose>& path) {
+    traced.clear();
+    for (int cell = endCell; cell >= 0; cell = parents[cell]) {
+        traced.push_back(cell);
+        int parent = parents[cell];
+        if (cell == startCell || parent < 0) {
+            break;
+        }
+        // Runs between jump points are straight or diagonal
+        int dx = parent / numberY - cell / numberY, dy = parent % numberY - cell % numberY;
+        int stepX = dx > 0 ? 1 : (dx < 0 ? -1 : 0), stepY = dy > 0 ? 1 : (dy < 0 ? -1 : 0);
+        int steps = dx * stepX > dy * stepY ? dx * stepX : dy * stepY;
+        for (int k = 1; k < steps; k++) {
+            traced.push_back(cell + k * (stepX * numberY + stepY));
+        }
+    }
+    reverse(traced.begin(), traced.end());
+    cellsToPath(traced, path);
+}
+
+/**
+ * @brief Returns the path cost of a cell from the start of the last search.
+ * @param x Column.
+ * @param y Row.
+ * @return The cost in meters, or a negative value if the cell was not reached.
+ */
+double GridPlanner::getCost(int x, int y) const {
+    if (x < 0 || x >= numberX || y < 0 || y >= numberY) {
+        return UNREACHED;
+    }
+    size_t cell = static_cast<size_t>(x) * numberY + y;
+    return visits[cell] == searchId && startCell >= 0 ? costs[cell] * cellSize : UNREACHED;
+}
+
+/**
+ * @brief Follows the shortest path of the last search from the start to a cell.
+ * @param x Column of the end cell.
+ * @param y Row of the end cell.
+ * @param path Receives the cell centres in meters, from the start to the end cell.
+ * @return False if the cell was not reached.
+ */
+bool GridPlanner::extractPath(int x, int y, vector<Pose>& path) const {
+    path.clear();
+    if (getCost(x, y) < 0.0) {
+        return false;
+    }
+    vector<int> cells;
+    for (int cell = x * numberY + y; cell >= 0; cell = parents[cell]) {
+        cells.push_back(cell);
+        if (cell == startCell) {
+            break;
+        }
+    }
+    reverse(cells.begin(), cells.end());
+    cellsToPath(cells, path);
+    return true;
+}
+
+/**
+ * @brief Converts a sequence of cells to poses at the cell centres.
+ * @param cells Indices of the cells, x * getNumberY() + y, each next to the previous one.
+ * @param path Receives the cell centres in meters; each heading (radians) points along the
+ *        following step, the last along the step before it.
+ */
+void GridPlanner::cellsToPath(const vector<int>& cells, vector<Pose>& path) const {
+    path.clear();
+    path.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+        path.push_back(Pose((cells[i] / numberY + 0.5) * cellSize, (cells[i] % numberY + 0.5) * cellSize, 0.0));
+    }
+    for (size_t i = 0; i < path.size(); i++) {
+        const Pose& from = path[i > 0 && i + 1 == path.size() ? i - 1 : i];
+        const Pose& to = path[i + 1 < path.size() ? i + 1 : i];
+        path[i].setTh(atan2(to.getY() - from.getY(), to.getX() - from.getX()));
+    }
+}
+
+/**
+ * @brief Returns the number of columns.
+ * @return The number of columns.
+ */
+int GridPlanner::getNumberX() const {
+    return numberX;
+}
+
+/**
+ * @brief Returns the number of rows.
+ * @return The number of rows.
+ */
+int GridPlanner::getNumberY() const {
+    return numberY;
+}
+
+/**
+ * @brief Returns the edge of a cell.
+ * @return The edge of a cell in meters.
+ */
+double GridPlanner::getCellSize() const {
+    return cellSize;
+}
+
+/**
+ * @brief Returns the counters of the last search and update.
+ * @return The counters.
+ */
+GridSearchStats GridPlanner::getStats() const {
+    return stats;
+}
@@ -0,0 +1,263 @@
+/**
+ * @file GridPlanner.h
+ * @brief Declaration of the GridPlanner class, shortest paths on the occupancy grid of a Map.
+ * @date October 2026
+ */
+
+#ifndef GRIDPLANNER_H
+#define GRIDPLANNER_H
+
+#include "Map.h"
+#include "Pose.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct GridSearchStats
+ * @brief Counters of the last search of a GridPlanner.
+ */
+struct GridSearchStats {
+    unsigned long expanded;  /**< Cells taken from the open list. */
+    unsigned long scanned;   /**< Cells stepped over by the jumps of the last jump point search. */
+    double lastUs;           /**< Duration of the search, in microseconds. */
+    double lastUpdateUs;     /**< Duration of the last update() call, in microseconds. */
+};
+
+/**
+ * @class GridPlanner
+ * @brief Finds shortest 8-connected paths for a round robot through the free cells of a Map.
+ *
+ * The planner keeps its own grid of passable cells: a cell is passable if the map knows it is
+ * free and no occupied cell lies within the robot radius. Unknown cells are not passable, so
+ * paths stay in explored space. update() with a region only recomputes the cells the region can
+ * affect, by stamping the robot footprint around each occupied cell nearby, so the grid follows
+ * the map at the cost of the changed area rather than of the whole map.
+ *
+ * Diagonal steps cost sqrt(2) cells and may not cut the corner of a blocked cell. Besides the
+ * Dijkstra search from one cell to all, findPath() runs A* to one goal and findJumpPath() runs
+ * Jump Point Search, which returns the same path costs as A* but on open floors expands only the
+ * cells where the shortest paths can turn; its straight scans test 64 cells at a time on bit
+ * copies of the grid, kept per row and per column. The search buffers are kept between searches and are
+ * invalidated by a stamp rather than cleared, so a search does not allocate once they have grown
+ * and costs the cells it touches rather than the size of the map.
+ */
+class GridPlanner {
+private:
+    /**
+     * @struct OpenEntry
+     * @brief A cell on the open list with its priority.
+     */
+    struct OpenEntry {
+        float priority;   /**< Cost so far, plus the heuristic for a goal-directed search. */
+        int cell;         /**< Index of the cell. */
+    };
+
+    int numberX;                         /**< Number of columns. */
+    int numberY;                         /**< Number of rows. */
+    double cellSize;                     /**< Edge of a cell in meters. */
+    double robotRadius;                  /**< Radius of the robot in meters. */
+    std::vector<int> footprint;          /**< Half-height of the robot footprint per column offset. */
+    std::vector<unsigned char> blocked;  /**< 1 for a cell the robot cannot occupy, indexed x * numberY + y. */
+    std::vector<uint64_t> rowBits;       /**< Blocked cells as bits, a line per row plus a blocked line and bit on each side. */
+    std::vector<uint64_t> columnBits;    /**< Blocked cells as bits, a line per column, padded alike. */
+    int rowWords;                        /**< Words per line of rowBits. */
+    int columnWords;                     /**< Words per line of columnBits. */
+    std::vector<float> costs;            /**< Path cost of each cell from the start of the last search, in cells. */
+    std::vector<int> parents;            /**< Predecessor of each cell on its shortest path, or -1. */
+    std::vector<unsigned int> visits;    /**< Search that last reached each cell; costs and parents are valid if it is the current one. */
+    unsigned int searchId;               /**< Stamp of the current search. */
+    std::vector<OpenEntry> open;         /**< Binary heap of the open list. */
+    std::vector<int> traced;             /**< Cells of the path being traced. */
+    int startCell;                       /**< Start of the last search. */
+    GridSearchStats stats;               /**< Counters. */
+
+    /**
+     * @brief Orders open entries so that the heap yields the lowest priority first.
+     * @param a First entry.
+     * @param b Second entry.
+     * @return True if a comes after b.
+     */
+    static bool later(const OpenEntry& a, const OpenEntry& b);
+
+    /**
+     * @brief Starts a search: invalidates the costs of the last one and puts the start on the open list.
+     * @param startX Column of the start.
+     * @param startY Row of the start.
+     * @return False if the start is outside the grid.
+     */
+    bool beginSearch(int startX, int startY);
+
+    /**
+     * @brief Tells whether a step from a cell to a neighbour is allowed.
+     * @param x Column of the cell.
+     * @param y Row of the cell.
+     * @param dx Column step (-1, 0 or 1).
+     * @param dy Row step (-1, 0 or 1).
+     * @return True if the neighbour is passable and a diagonal step does not cut a blocked corner.
+     */
+    bool canStep(int x, int y, int dx, int dy) const;
+
+    /**
+     * @brief Lowers the cost of a cell if a cheaper way to it was found, and queues it.
+     * @param cell Index of the cell.
+     * @param parent Index of the cell it is reached from.
+     * @param cost Cost of the cell through the parent, in cells.
+     * @param estimate Estimated remaining cost to the goal, in cells (0 for Dijkstra).
+     */
+    void relax(int cell, int parent, float cost, float estimate);
+
+    /**
+     * @brief Scans a row or column of bits for the next jump point of a straight jump.
+     * @param bits rowBits for a scan along a row, columnBits for a scan along a column.
+     * @param words Words per line of bits.
+     * @param line Row or column of the scan.
+     * @param position Column or row the scan starts from (excluded).
+     * @param direction 1 or -1.
+     * @param goalPosition Position of the goal if it lies on the line, else -1.
+     * @param hitBlocked Set to true if the scan ends at a blocked cell rather than a jump point.
+     * @return Position of the jump point or the goal, or of the blocked cell that ends the scan.
+     */
+    int scanLine(const std::vector<uint64_t>& bits, int words, int line, int position, int direction,
+        int goalPosition, bool& hitBlocked) const;
+
+    /**
+     * @brief Scans from a cell in one direction for the next jump point.
+     * @param x Column of the cell.
+     * @param y Row of the cell.
+     * @param dx Column step (-1, 0 or 1).
+     * @param dy Row step (-1, 0 or 1).
+     * @param goalCell Index of the goal cell.
+     * @return Index of the jump point, or -1 if the scan runs into a blocked cell.
+     */
+    int jump(int x, int y, int dx, int dy, int goalCell);
+
+    /**
+     * @brief Follows the parents from a cell back to the start, filling in the cells between jump points.
+     * @param endCell Index of the end cell.
+     * @param path Receives the cell centres from the start to the end cell.
+     */
+    void tracePath(int endCell, std::vector<Pose>& path);
+
+public:
+    /** @brief Cost of a cell the last search did not reach. */
+    static const float UNREACHED;
+
+    /**
+     * @brief Constructor for the GridPlanner class. The planner has no cells until update() is called.
+     * @param radius Radius of the robot in meters.
+     */
+    explicit GridPlanner(double radius = 0.25);
+
+    /**
+     * @brief Rebuilds the passable cells from the whole map.
+     * @param map The map.
+     */
+    void update(const Map& map);
+
+    /**
+     * @brief Recomputes the passable cells a change of the map can affect.
+     * @param map The map; if its size differs from the last update, the whole map is rebuilt.
+     * @param region The cells that changed, e.g. from Mapper::takeChangedRegion().
+     * @return The cells whose passability was recomputed: the region grown by the robot radius,
+     *         the whole grid after a rebuild, or an empty region.
+     */
+    MapRegion update(const Map& map, const MapRegion& region);
+
+    /**
+     * @brief Tells whether the robot can occupy a cell.
+     * @param x Column.
+     * @param y Row.
+     * @return True if the cell is inside the grid and passable.
+     */
+    bool isPassable(int x, int y) const;
+
+    /**
+     * @brief Computes the path cost of every reachable cell from a start cell (Dijkstra).
+     * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+     * @param startY Row of the start.
+     * @param maxCost Cells beyond this cost in meters are left unreached; 0 or less for no limit.
+     * @return The number of cells reached.
+     */
+    size_t computeCosts(int startX, int startY, double maxCost = 0.0);
+
+    /**
+     * @brief Finds a shortest path from a start cell to a goal cell (A* with the octile distance).
+     * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+     * @param startY Row of the start.
+     * @param goalX Column of the goal.
+     * @param goalY Row of the goal.
+     * @param path Receives the cell centres in meters, from the start to the goal; each heading
+     *        (radians) points along the following step.
+     * @return False if the goal is not passable or cannot be reached.
+     */
+    bool findPath(int startX, int startY, int goalX, int goalY, std::vector<Pose>& path);
+
+    /**
+     * @brief Finds a shortest path from a start cell to a goal cell with Jump Point Search.
+     *
+     * Only the jump points, the cells where a shortest path may have to turn because of a nearby
+     * obstacle, are put on the open list; the straight and diagonal runs between them are scanned
+     * without queueing. The path has the same cost as the one of findPath().
+     *
+     * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+     * @param startY Row of the start.
+     * @param goalX Column of the goal.
+     * @param goalY Row of the goal.
+     * @param path Receives the cell centres in meters, every cell of the path included.
+     * @return False if the goal is not passable or cannot be reached.
+     */
+    bool findJumpPath(int startX, int startY, int goalX, int goalY, std::vector<Pose>& path);
+
+    /**
+     * @brief Returns the path cost of a cell from the start of the last search.
+     * After findPath() or findJumpPath() the cost is only final for the cells of the path.
+     * @param x Column.
+     * @param y Row.
+     * @return The cost in meters, or a negative value if the cell was not reached.
+     */
+    double getCost(int x, int y) const;
+
+    /**
+     * @brief Follows the shortest path of the last search from the start to a cell.
+     * @param x Column of the end cell.
+     * @param y Row of the end cell.
+     * @param path Receives the cell centres in meters, from the start to the end cell; each
+     *        heading (radians) points along the following step.
+     * @return False if the cell was not reached.
+     */
+    bool extractPath(int x, int y, std::vector<Pose>& path) const;
+
+    /**
+     * @brief Converts a sequence of cells to poses at the cell centres.
+     * @param cells Indices of the cells, x * getNumberY() + y, each next to the previous one.
+     * @param path Receives the cell centres in meters; each heading (radians) points along the
+     *        following step, the last along the step before it.
+     */
+    void cellsToPath(const std::vector<int>& cells, std::vector<Pose>& path) const;
+
+    /**
+     * @brief Returns the number of columns.
+     * @return The number of columns.
+     */
+    int getNumberX() const;
+
+    /**
+     * @brief Returns the number of rows.
+     * @return The number of rows.
+     */
+    int getNumberY() const;
+
+    /**
+     * @brief Returns the edge of a cell.
+     * @return The edge of a cell in meters.
+     */
+    double getCellSize() const;
+
+    /**
+     * @brief Returns the counters of the last search and update.
+     * @return The counters.
+     */
+    GridSearchStats getStats() const;
+};
+
+#endif // GRIDPLANNER_H
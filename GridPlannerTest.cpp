@@ -0,0 +1,245 @@
+/**
+ * @file GridPlannerTest.cpp
+ * @brief Test and benchmark application for the GridPlanner class.
+ * @details Checks path costs in free space, the robot footprint around obstacles, paths through a
+ * doorway, that incremental updates give the same passable cells as a rebuild, that A* and Jump
+ * Point Search find paths as short as Dijkstra's, and measures the searches over large maps.
+ * @date October, 2026
+ */
+
+#include "GridPlanner.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Sets every cell of a map.
+ * @param map The map.
+ * @param value The cell value.
+ */
+void fillMap(Map& map, int value) {
+    for (int x = 0; x < map.getNumberX(); x++) {
+        for (int y = 0; y < map.getNumberY(); y++) {
+            map.setGrid(x, y, value);
+        }
+    }
+}
+
+/**
+ * @brief Checks that a path steps between neighbouring passable cells without cutting corners.
+ * @param planner The planner that found the path.
+ * @param path The path.
+ * @param cellSize Edge of a cell in meters.
+ * @return The length of the path in cells, or -1 if a step is not allowed.
+ */
+double checkPath(const GridPlanner& planner, const vector<Pose>& path, double cellSize) {
+    double length = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        int x0 = static_cast<int>(floor(path[i - 1].getX() / cellSize)), y0 = static_cast<int>(floor(path[i - 1].getY() / cellSize));
+        int x1 = static_cast<int>(floor(path[i].getX() / cellSize)), y1 = static_cast<int>(floor(path[i].getY() / cellSize));
+        int dx = x1 - x0, dy = y1 - y0;
+        if (dx < -1 || dx > 1 || dy < -1 || dy > 1 || (dx == 0 && dy == 0) || !planner.isPassable(x1, y1)) {
+            return -1.0;
+        }
+        if (dx != 0 && dy != 0 && (!planner.isPassable(x0 + dx, y0) || !planner.isPassable(x0, y0 + dy))) {
+            return -1.0;
+        }
+        length += dx != 0 && dy != 0 ? sqrt(2.0) : 1.0;
+    }
+    return length;
+}
+
+/**
+ * @brief Main function for testing the grid planner.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: In free space straight and diagonal costs are exact, and unknown cells and
+     * cells outside the map are not reached.
+     */
+    Map map(50, 50, 0.1);
+    fillMap(map, Map::CELL_FREE);
+    for (int y = 0; y < 50; y++) {
+        map.setGrid(40, y, Map::CELL_UNKNOWN);
+    }
+    GridPlanner point(0.0);
+    point.update(map);
+    point.computeCosts(0, 0);
+    assert(fabs(point.getCost(10, 0) - 1.0) < 1e-5);
+    assert(fabs(point.getCost(10, 10) - 10 * sqrt(2.0) * 0.1) < 1e-4);
+    assert(point.getCost(45, 0) < 0.0 && point.getCost(-1, 0) < 0.0);
+    vector<Pose> path;
+    assert(point.extractPath(10, 10, path) && path.size() == 11);
+    assert(fabs(path[0].getX() - 0.05) < 1e-9 && fabs(path[10].getY() - 1.05) < 1e-9);
+    assert(fabs(path[0].getTh() - atan2(1.0, 1.0)) < 1e-9);
+    assert(!point.extractPath(45, 0, path) && path.empty());
+
+    /**
+     * @test Test 2: An occupied cell blocks the cells within the robot radius of it, and only those.
+     */
+    fillMap(map, Map::CELL_FREE);
+    map.setGrid(25, 25, Map::CELL_OCCUPIED);
+    GridPlanner robot(0.25);
+    robot.update(map);
+    for (int x = 15; x < 35; x++) {
+        for (int y = 15; y < 35; y++) {
+            double d = hypot(x - 25.0, y - 25.0) * 0.1;
+            assert(robot.isPassable(x, y) == (d > 0.25 + 1e-9));
+        }
+    }
+
+    /**
+     * @test Test 3: A wall with a doorway is passed through the doorway; a doorway narrower than
+     * the robot is not.
+     */
+    for (int y = 0; y < 50; y++) {
+        if (y < 20 || y >= 30) {
+            map.setGrid(25, y, Map::CELL_OCCUPIED);
+        }
+    }
+    robot.update(map);
+    robot.computeCosts(5, 5);
+    assert(robot.extractPath(45, 5, path));
+    bool throughDoor = false;
+    for (size_t i = 0; i < path.size(); i++) {
+        int x = static_cast<int>(floor(path[i].getX() / 0.1)), y = static_cast<int>(floor(path[i].getY() / 0.1));
+        assert(i == 0 || robot.isPassable(x, y));
+        throughDoor = throughDoor || (x == 25 && y >= 20 && y < 30);
+    }
+    assert(throughDoor);
+    assert(robot.getCost(45, 5) > 4.0);
+    for (int y = 20; y < 30; y++) {
+        map.setGrid(25, y, y == 24 || y == 25 ? Map::CELL_FREE : Map::CELL_OCCUPIED);
+    }
+    robot.update(map);
+    robot.computeCosts(5, 5);
+    assert(robot.getCost(45, 5) < 0.0);
+
+    /**
+     * @test Test 4: Updating only the changed regions gives the same passable cells as rebuilding
+     * from the whole map, and Jump Point Search on them the same paths.
+     */
+    mt19937 rng(5);
+    uniform_int_distribution<int> coordinate(0, 49);
+    uniform_int_distribution<int> value(0, 2);
+    Map changing(50, 50, 0.1);
+    fillMap(changing, Map::CELL_FREE);
+    GridPlanner incremental(0.3);
+    incremental.update(changing);
+    for (int round = 0; round < 200; round++) {
+        MapRegion region;
+        region.xMin = coordinate(rng);
+        region.yMin = coordinate(rng);
+        region.xMax = region.xMin + 1 + coordinate(rng) % 6;
+        region.yMax = region.yMin + 1 + coordinate(rng) % 6;
+        region.xMax = region.xMax < 50 ? region.xMax : 50;
+        region.yMax = region.yMax < 50 ? region.yMax : 50;
+        for (int x = region.xMin; x < region.xMax; x++) {
+            for (int y = region.yMin; y < region.yMax; y++) {
+                changing.setGrid(x, y, value(rng) == 0 ? Map::CELL_OCCUPIED : Map::CELL_FREE);
+            }
+        }
+        incremental.update(changing, region);
+    }
+    GridPlanner rebuilt(0.3);
+    rebuilt.update(changing);
+    for (int x = 0; x < 50; x++) {
+        for (int y = 0; y < 50; y++) {
+            assert(incremental.isPassable(x, y) == rebuilt.isPassable(x, y));
+        }
+    }
+    for (int query = 0; query < 50; query++) {
+        int sx = coordinate(rng), sy = coordinate(rng), gx = coordinate(rng), gy = coordinate(rng);
+        bool found = rebuilt.findPath(sx, sy, gx, gy, path);
+        double length = found ? checkPath(rebuilt, path, 0.1) : -1.0;
+        assert(incremental.findJumpPath(sx, sy, gx, gy, path) == found);
+        assert(!found || fabs(checkPath(incremental, path, 0.1) - length) < 1e-3);
+    }
+
+    /**
+     * @test Test 5: A search over a 400 x 400 map with scattered obstacles.
+     */
+    Map large(400, 400, 0.05);
+    fillMap(large, Map::CELL_FREE);
+    uniform_int_distribution<int> largeCell(0, 399);
+    for (int k = 0; k < 3000; k++) {
+        large.setGrid(largeCell(rng), largeCell(rng), Map::CELL_OCCUPIED);
+    }
+    GridPlanner planner(0.1);
+    planner.update(large);
+    double updateUs = planner.getStats().lastUpdateUs;
+    size_t reached = planner.computeCosts(200, 200);
+    assert(reached > 100000 && planner.getStats().expanded == reached);
+    cout << "Rebuild of 400 x 400 cells: " << updateUs << " us, search reaching " << reached << " cells: "
+         << planner.getStats().lastUs << " us" << endl;
+
+    /**
+     * @test Test 6: On cluttered maps A* and Jump Point Search find valid paths exactly as short
+     * as Dijkstra's, and agree with it on which goals are unreachable.
+     */
+    uniform_int_distribution<int> clutterCell(0, 59);
+    for (int round = 0; round < 20; round++) {
+        Map clutter(60, 60, 0.1);
+        fillMap(clutter, Map::CELL_FREE);
+        for (int k = 0; k < 200 + 40 * round; k++) {
+            clutter.setGrid(clutterCell(rng), clutterCell(rng), Map::CELL_OCCUPIED);
+        }
+        GridPlanner searches(0.0);
+        searches.update(clutter);
+        for (int query = 0; query < 20; query++) {
+            int sx = clutterCell(rng), sy = clutterCell(rng), gx = clutterCell(rng), gy = clutterCell(rng);
+            if (!searches.isPassable(sx, sy) || !searches.isPassable(gx, gy)) {
+                continue;
+            }
+            searches.computeCosts(sx, sy);
+            double best = searches.getCost(gx, gy) / 0.1;
+            bool aStar = searches.findPath(sx, sy, gx, gy, path);
+            assert(aStar == (best >= 0.0));
+            assert(!aStar || fabs(checkPath(searches, path, 0.1) - best) < 1e-3);
+            bool jumps = searches.findJumpPath(sx, sy, gx, gy, path);
+            assert(jumps == (best >= 0.0));
+            assert(!jumps || fabs(checkPath(searches, path, 0.1) - best) < 1e-3);
+        }
+    }
+
+    /**
+     * @test Test 7: A long query across a 1000 x 1000 open floor with scattered pillars and
+     * partition walls, with A* and with Jump Point Search.
+     */
+    Map floorMap(1000, 1000, 0.05);
+    fillMap(floorMap, Map::CELL_FREE);
+    for (int px = 50; px < 1000; px += 100) {
+        for (int py = 50; py < 1000; py += 100) {
+            for (int x = px; x < px + 6; x++) {
+                for (int y = py; y < py + 6; y++) {
+                    floorMap.setGrid(x, y, Map::CELL_OCCUPIED); // A pillar
+                }
+            }
+        }
+    }
+    for (int wall = 1; wall < 5; wall++) {
+        for (int y = (wall % 2) * 100; y < 900 + (wall % 2) * 100; y++) {
+            floorMap.setGrid(wall * 200, y, Map::CELL_OCCUPIED); // Partitions open at alternate ends
+        }
+    }
+    GridPlanner facility(0.2);
+    facility.update(floorMap);
+    assert(facility.findPath(20, 20, 980, 980, path));
+    double aStarLength = checkPath(facility, path, 0.05);
+    GridSearchStats aStarStats = facility.getStats();
+    assert(facility.findJumpPath(20, 20, 980, 980, path));
+    double jumpLength = checkPath(facility, path, 0.05);
+    GridSearchStats jumpStats = facility.getStats();
+    assert(aStarLength > 0.0 && fabs(jumpLength - aStarLength) < 1e-3);
+    assert(jumpStats.expanded * 10 < aStarStats.expanded);
+    cout << "Across 1000 x 1000 cells (" << aStarLength * 0.05 << " m): A* expanded " << aStarStats.expanded << " cells in "
+         << aStarStats.lastUs << " us, JPS expanded " << jumpStats.expanded << " jump points (" << jumpStats.scanned
+         << " cells scanned) in " << jumpStats.lastUs << " us" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
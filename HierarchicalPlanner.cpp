@@ -0,0 +1,504 @@
+/**
+ * @file HierarchicalPlanner.cpp
+ * @brief Implementation of the HierarchicalPlanner class.
+ * @date October 2026
+ */
+
+#include "HierarchicalPlanner.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+
+using namespace std;
+
+/**
+ * @brief Cost of a diagonal step in cells.
+ */
+static const float DIAGONAL = 1.41421356f;
+
+/**
+ * @brief Runs of passable border cells at least this long get an entrance at each end rather than one in the middle.
+ */
+static const int LONG_RUN = 6;
+
+/**
+ * @brief Octile distance, the cost of the shortest path between two cells in free space.
+ * @param dx Column difference.
+ * @param dy Row difference.
+ * @return The cost in cells.
+ */
+static float octile(int dx, int dy) {
+    dx = dx < 0 ? -dx : dx;
+    dy = dy < 0 ? -dy : dy;
+    return dx < dy ? DIAGONAL * dx + (dy - dx) : DIAGONAL * dy + (dx - dy);
+}
+
+/**
+ * @brief Constructor for the HierarchicalPlanner class. The planner has no graph until update() is called.
+ * @param radius Radius of the robot in meters.
+ * @param size Edge of a cluster in cells (at least 4).
+ */
+HierarchicalPlanner::HierarchicalPlanner(double radius, int size)
+    : grid(radius), clusterSize(size > 4 ? size : 4), numberX(0), numberY(0), clustersX(0), clustersY(0), stats() {
+    startSearch.cluster = -1;
+    goalSearch.cluster = -1;
+}
+
+/**
+ * @brief Orders open entries so that the heap yields the lowest priority first.
+ * @param a First entry.
+ * @param b Second entry.
+ * @return True if a comes after b.
+ */
+bool HierarchicalPlanner::later(const OpenEntry& a, const OpenEntry& b) {
+    return a.priority > b.priority;
+}
+
+/**
+ * @brief Returns the cluster a cell lies in.
+ * @param cell Index of the cell.
+ * @return Index of the cluster.
+ */
+int HierarchicalPlanner::clusterOf(int cell) const {
+    return (cell / numberY / clusterSize) * clustersY + (cell % numberY) / clusterSize;
+}
+
+/**
+ * @brief Rebuilds the passable cells and the whole graph from the map.
+ * @param map The map.
+ */
+void HierarchicalPlanner::update(const Map& map) {
+    MapRegion all = { 0, 0, map.getNumberX(), map.getNumberY() };
+    numberX = 0; // Forces the rebuild
+    update(map, all);
+}
+
+/**
+ * @brief Updates the passable cells and the parts of the graph a change of the map can affect.
+ *
+ * The borders of every cluster the recomputed passable cells overlap are searched for
+ * entrances again. Those clusters are rebuilt, and so is any neighbour whose entrances on a
+ * shared border changed; the paths inside the other clusters are still valid, since a path
+ * inside a cluster only depends on the cells of that cluster.
+ *
+ * @param map The map; if its size differs from the last update, everything is rebuilt.
+ * @param region The cells that changed, e.g. from Mapper::takeChangedRegion().
+ */
+void HierarchicalPlanner::update(const Map& map, const MapRegion& region) {
+    auto start = chrono::steady_clock::now();
+    stats.clustersRebuilt = 0;
+    if (map.getNumberX() != numberX || map.getNumberY() != numberY) {
+        grid.update(map);
+        numberX = map.getNumberX();
+        numberY = map.getNumberY();
+        clustersX = (numberX + clusterSize - 1) / clusterSize;
+        clustersY = (numberY + clusterSize - 1) / clusterSize;
+        clusters.assign(static_cast<size_t>(clustersX) * clustersY, Cluster());
+        eastBorders.assign(clusters.size(), vector<int>());
+        northBorders.assign(clusters.size(), vector<int>());
+        entranceSlot.assign(static_cast<size_t>(numberX) * numberY, -1);
+        for (int cx = 0; cx < clustersX; cx++) {
+            for (int cy = 0; cy < clustersY; cy++) {
+                findEntrances(cx, cy, true, eastBorders[cx * clustersY + cy]);
+                findEntrances(cx, cy, false, northBorders[cx * clustersY + cy]);
+            }
+        }
+        for (size_t index = 0; index < clusters.size(); index++) {
+            buildCluster(static_cast<int>(index));
+        }
+    }
+    else {
+        MapRegion area = grid.update(map, region);
+        if (area.xMin < area.xMax && area.yMin < area.yMax) {
+            int cxMin = area.xMin / clusterSize, cxMax = (area.xMax - 1) / clusterSize;
+            int cyMin = area.yMin / clusterSize, cyMax = (area.yMax - 1) / clusterSize;
+            vector<unsigned char> dirty(clusters.size(), 0);
+            vector<int> pairs;
+            for (int cx = cxMin - 1; cx <= cxMax; cx++) {
+                for (int cy = cyMin - 1; cy <= cyMax; cy++) {
+                    if (cx < 0 || cy < 0 || cx >= clustersX || cy >= clustersY) {
+                        continue;
+                    }
+                    int index = cx * clustersY + cy;
+                    bool inside = cx >= cxMin && cy >= cyMin;
+                    if (cy >= cyMin) { // East border, between index and its east neighbour
+                        findEntrances(cx, cy, true, pairs);
+                        if (pairs != eastBorders[index]) {
+                            eastBorders[index].swap(pairs);
+                            dirty[index] = 1;
+                            dirty[cx + 1 < clustersX ? index + clustersY : index] = 1;
+                        }
+                    }
+                    if (cx >= cxMin) { // North border, between index and its north neighbour
+                        findEntrances(cx, cy, false, pairs);
+                        if (pairs != northBorders[index]) {
+                            northBorders[index].swap(pairs);
+                            dirty[index] = 1;
+                            dirty[cy + 1 < clustersY ? index + 1 : index] = 1;
+                        }
+                    }
+                    dirty[index] = dirty[index] || inside;
+                }
+            }
+            for (size_t index = 0; index < clusters.size(); index++) {
+                if (dirty[index]) {
+                    buildCluster(static_cast<int>(index));
+                }
+            }
+        }
+    }
+    stats.clusters = clusters.size();
+    stats.entrances = 0;
+    stats.edges = 0;
+    for (size_t index = 0; index < clusters.size(); index++) {
+        const Cluster& cluster = clusters[index];
+        stats.entrances += cluster.entrances.size();
+        for (size_t k = 0; k < cluster.distances.size(); k++) {
+            stats.edges += cluster.distances[k] > 0.0f ? 1 : 0;
+        }
+    }
+    stats.edges /= 2;
+    stats.lastUpdateUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Finds the entrances on the border east or north of a cluster.
+ *
+ * The border is walked along the two lines of cells that face each other. Every maximal run of
+ * positions where both cells are passable gets one entrance pair in its middle, or, from
+ * LONG_RUN cells on, one at each end so that paths need not detour to the middle.
+ *
+ * @param cx Cluster column.
+ * @param cy Cluster row.
+ * @param east True for the east border, false for the north border.
+ * @param pairs Receives the entrance pairs.
+ */
+void HierarchicalPlanner::findEntrances(int cx, int cy, bool east, vector<int>& pairs) const {
+    pairs.clear();
+    int line = east ? (cx + 1) * clusterSize - 1 : (cy + 1) * clusterSize - 1; // Last line inside the cluster
+    if (line + 1 >= (east ? numberX : numberY)) {
+        return; // The border of the grid
+    }
+    int first = east ? cy * clusterSize : cx * clusterSize;
+    int end = first + clusterSize < (east ? numberY : numberX) ? first + clusterSize : (east ? numberY : numberX);
+    int runStart = -1;
+    for (int p = first; p <= end; p++) {
+        bool passable = p < end && (east ? grid.isPassable(line, p) && grid.isPassable(line + 1, p)
+                                     : grid.isPassable(p, line) && grid.isPassable(p, line + 1));
+        if (passable && runStart < 0) {
+            runStart = p;
+        }
+        else if (!passable && runStart >= 0) {
+            int last = p - 1;
+            int positions[2] = { (runStart + last) / 2, last };
+            int count = 1;
+            if (last - runStart + 1 >= LONG_RUN) {
+                positions[0] = runStart;
+                count = 2;
+            }
+            for (int k = 0; k < count; k++) {
+                int q = positions[k];
+                pairs.push_back(east ? line * numberY + q : q * numberY + line);
+                pairs.push_back(east ? (line + 1) * numberY + q : q * numberY + line + 1);
+            }
+            runStart = -1;
+        }
+    }
+}
+
+/**
+ * @brief Collects the entrances of a cluster from its four borders and stores the paths between them.
+ * @param index Index of the cluster.
+ */
+void HierarchicalPlanner::buildCluster(int index) {
+    Cluster& cluster = clusters[index];
+    for (size_t k = 0; k < cluster.entrances.size(); k++) {
+        entranceSlot[cluster.entrances[k]] = -1;
+    }
+    cluster.entrances.clear();
+    int cx = index / clustersY, cy = index % clustersY;
+    const vector<int>* borders[4] = { &eastBorders[index], &northBorders[index],
+        cx > 0 ? &eastBorders[index - clustersY] : nullptr, cy > 0 ? &northBorders[index - 1] : nullptr };
+    for (int b = 0; b < 4; b++) {
+        if (borders[b] == nullptr) {
+            continue;
+        }
+        // The own east and north borders hold this cluster's cells first in each pair, the others second
+        for (size_t k = b < 2 ? 0 : 1; k < borders[b]->size(); k += 2) {
+            int cell = (*borders[b])[k];
+            if (entranceSlot[cell] < 0) { // A corner cell can be an entrance of two borders
+                entranceSlot[cell] = static_cast<int>(cluster.entrances.size());
+                cluster.entrances.push_back(cell);
+            }
+        }
+    }
+
+    const int count = static_cast<int>(cluster.entrances.size());
+    cluster.distances.assign(static_cast<size_t>(count) * count, -1.0f);
+    cluster.routeStart.assign(static_cast<size_t>(count) * count, -1);
+    cluster.routeLength.assign(static_cast<size_t>(count) * count, 0);
+    cluster.routes.clear();
+    for (int a = 0; a < count; a++) {
+        cluster.distances[a * count + a] = 0.0f;
+        if (a + 1 == count) {
+            break;
+        }
+        searchCluster(index, cluster.entrances[a], startSearch);
+        for (int b = a + 1; b < count; b++) {
+            float cost = localCost(startSearch, cluster.entrances[b]);
+            if (cost < 0.0f) {
+                continue;
+            }
+            cluster.distances[a * count + b] = cost;
+            cluster.distances[b * count + a] = cost;
+            size_t begin = cluster.routes.size();
+            appendLocalPath(startSearch, cluster.entrances[b], cluster.routes);
+            reverse(cluster.routes.begin() + begin, cluster.routes.end());
+            cluster.routeStart[a * count + b] = static_cast<int>(begin);
+            cluster.routeLength[a * count + b] = static_cast<int>(cluster.routes.size() - begin);
+        }
+    }
+    stats.clustersRebuilt++;
+}
+
+/**
+ * @brief Runs a Dijkstra search confined to a cluster.
+ * @param cluster Index of the cluster.
+ * @param source Cell the search starts from; it counts as passable.
+ * @param search Receives the costs and parents.
+ */
+void HierarchicalPlanner::searchCluster(int cluster, int source, LocalSearch& search) {
+    const int x0 = (cluster / clustersY) * clusterSize, y0 = (cluster % clustersY) * clusterSize;
+    const int x1 = x0 + clusterSize < numberX ? x0 + clusterSize : numberX;
+    const int y1 = y0 + clusterSize < numberY ? y0 + clusterSize : numberY;
+    search.cluster = cluster;
+    search.costs.assign(static_cast<size_t>(clusterSize) * clusterSize, FLT_MAX);
+    search.parents.assign(static_cast<size_t>(clusterSize) * clusterSize, -1);
+    int sx = source / numberY, sy = source % numberY;
+    search.costs[(sx - x0) * clusterSize + (sy - y0)] = 0.0f;
+    open.clear();
+    OpenEntry first = { 0.0f, source };
+    open.push_back(first);
+    while (!open.empty()) {
+        pop_heap(open.begin(), open.end(), later);
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int x = entry.cell / numberY, y = entry.cell % numberY;
+        if (entry.priority > search.costs[(x - x0) * clusterSize + (y - y0)]) {
+            continue; // A cheaper entry of this cell was expanded already
+        }
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                int nx = x + dx, ny = y + dy;
+                if ((dx == 0 && dy == 0) || nx < x0 || nx >= x1 || ny < y0 || ny >= y1 || !grid.isPassable(nx, ny)) {
+                    continue;
+                }
+                if (dx != 0 && dy != 0 && (!grid.isPassable(nx, y) || !grid.isPassable(x, ny))) {
+                    continue; // No cutting corners
+                }
+                float cost = entry.priority + (dx != 0 && dy != 0 ? DIAGONAL : 1.0f);
+                int local = (nx - x0) * clusterSize + (ny - y0);
+                if (cost < search.costs[local]) {
+                    search.costs[local] = cost;
+                    search.parents[local] = entry.cell;
+                    OpenEntry item = { cost, nx * numberY + ny };
+                    open.push_back(item);
+                    push_heap(open.begin(), open.end(), later);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the cost of a cell in a confined search.
+ * @param search The search.
+ * @param cell Index of a cell of the searched cluster.
+ * @return The cost in cells, or a negative value if the cell was not reached.
+ */
+float HierarchicalPlanner::localCost(const LocalSearch& search, int cell) const {
+    const int x0 = (search.cluster / clustersY) * clusterSize, y0 = (search.cluster % clustersY) * clusterSize;
+    float cost = search.costs[(cell / numberY - x0) * clusterSize + (cell % numberY - y0)];
+    return cost < FLT_MAX ? cost : -1.0f;
+}
+
+/**
+ * @brief Appends the cells of a confined search's path, from the cell back to the source.
+ * @param search The search.
+ * @param cell The cell to start from.
+ * @param path Receives the cells, the cell itself first and the source last.
+ */
+void HierarchicalPlanner::appendLocalPath(const LocalSearch& search, int cell, vector<int>& path) const {
+    const int x0 = (search.cluster / clustersY) * clusterSize, y0 = (search.cluster % clustersY) * clusterSize;
+    for (; cell >= 0; cell = search.parents[(cell / numberY - x0) * clusterSize + (cell % numberY - y0)]) {
+        path.push_back(cell);
+    }
+}
+
+/**
+ * @brief Finds a path from a start cell to a goal cell through the graph of entrances.
+ *
+ * Confined searches from the start and from the goal give their costs to the entrances of their
+ * clusters. A* then runs over the entrances: inside a cluster along the stored costs, across a
+ * border with a single step to the facing entrance. It stops once no open entrance can improve
+ * on the best total, which includes the path inside the cluster when start and goal share one.
+ *
+ * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+ * @param startY Row of the start.
+ * @param goalX Column of the goal.
+ * @param goalY Row of the goal.
+ * @param path Receives the cell centres in meters, from the start to the goal.
+ * @return False if the goal is not passable or cannot be reached.
+ */
+bool HierarchicalPlanner::findPath(int startX, int startY, int goalX, int goalY, vector<Pose>& path) {
+    auto start = chrono::steady_clock::now();
+    path.clear();
+    stats.expanded = 0;
+    stats.lastCost = -1.0;
+    if (startX < 0 || startX >= numberX || startY < 0 || startY >= numberY ||
+        (!grid.isPassable(goalX, goalY) && (startX != goalX || startY != goalY))) {
+        stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        return false;
+    }
+    const int startCell = startX * numberY + startY, goalCell = goalX * numberY + goalY;
+    const int startCluster = clusterOf(startCell), goalCluster = clusterOf(goalCell);
+    searchCluster(startCluster, startCell, startSearch);
+    searchCluster(goalCluster, goalCell, goalSearch);
+
+    float best = FLT_MAX;
+    int bestEntrance = -1; // -1 while the best path stays inside the start cluster
+    if (startCluster == goalCluster && localCost(startSearch, goalCell) >= 0.0f) {
+        best = localCost(startSearch, goalCell);
+    }
+    states.clear();
+    open.clear();
+    const Cluster& first = clusters[startCluster];
+    for (size_t k = 0; k < first.entrances.size(); k++) {
+        int cell = first.entrances[k];
+        float cost = localCost(startSearch, cell);
+        if (cost >= 0.0f) {
+            NodeState state = { cost, -1, false };
+            states[cell] = state;
+            OpenEntry entry = { cost + octile(goalX - cell / numberY, goalY - cell % numberY), cell };
+            open.push_back(entry);
+            push_heap(open.begin(), open.end(), later);
+        }
+    }
+    while (!open.empty() && open.front().priority < best) {
+        pop_heap(open.begin(), open.end(), later);
+        OpenEntry entry = open.back();
+        open.pop_back();
+        NodeState& state = states[entry.cell];
+        if (state.closed) {
+            continue;
+        }
+        state.closed = true;
+        stats.expanded++;
+        const float cost = state.cost;
+        const int index = clusterOf(entry.cell);
+        const Cluster& cluster = clusters[index];
+        if (index == goalCluster) {
+            float toGoal = localCost(goalSearch, entry.cell);
+            if (toGoal >= 0.0f && cost + toGoal < best) {
+                best = cost + toGoal;
+                bestEntrance = entry.cell;
+            }
+        }
+        // Entrances of the same cluster, then the facing entrances across the borders
+        const int count = static_cast<int>(cluster.entrances.size());
+        const int slot = entranceSlot[entry.cell];
+        int x = entry.cell / numberY, y = entry.cell % numberY;
+        for (int k = 0; k < count + 4; k++) {
+            int next;
+            float step;
+            if (k < count) {
+                step = cluster.distances[slot * count + k];
+                next = cluster.entrances[k];
+                if (k == slot || step < 0.0f) {
+                    continue;
+                }
+            }
+            else {
+                static const int STEPS[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+                int nx = x + STEPS[k - count][0], ny = y + STEPS[k - count][1];
+                if (nx < 0 || nx >= numberX || ny < 0 || ny >= numberY) {
+                    continue;
+                }
+                next = nx * numberY + ny;
+                if (entranceSlot[next] < 0 || clusterOf(next) == index) {
+                    continue;
+                }
+                step = 1.0f;
+            }
+            float total = cost + step;
+            auto found = states.find(next);
+            if (found != states.end() && (found->second.closed || found->second.cost <= total)) {
+                continue;
+            }
+            NodeState reached = { total, entry.cell, false };
+            states[next] = reached;
+            OpenEntry item = { total + octile(goalX - next / numberY, goalY - next % numberY), next };
+            open.push_back(item);
+            push_heap(open.begin(), open.end(), later);
+        }
+    }
+    if (best == FLT_MAX) {
+        stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        return false;
+    }
+
+    // Splice the cells: start to the first entrance, stored paths and border steps, last entrance to the goal
+    cells.clear();
+    if (bestEntrance < 0) {
+        appendLocalPath(startSearch, goalCell, cells);
+        reverse(cells.begin(), cells.end());
+    }
+    else {
+        vector<int> chain;
+        for (int cell = bestEntrance; cell >= 0; cell = states[cell].parent) {
+            chain.push_back(cell);
+        }
+        reverse(chain.begin(), chain.end());
+        appendLocalPath(startSearch, chain[0], cells);
+        reverse(cells.begin(), cells.end());
+        for (size_t i = 1; i < chain.size(); i++) {
+            int from = chain[i - 1], to = chain[i];
+            int index = clusterOf(from);
+            if (index != clusterOf(to)) {
+                cells.push_back(to);
+                continue;
+            }
+            const Cluster& cluster = clusters[index];
+            int a = entranceSlot[from], b = entranceSlot[to];
+            int key = a < b ? a * static_cast<int>(cluster.entrances.size()) + b : b * static_cast<int>(cluster.entrances.size()) + a;
+            const int* route = &cluster.routes[cluster.routeStart[key]];
+            int length = cluster.routeLength[key];
+            for (int k = 1; k < length; k++) {
+                cells.push_back(a < b ? route[k] : route[length - 1 - k]);
+            }
+        }
+        size_t end = cells.size();
+        appendLocalPath(goalSearch, bestEntrance, cells);
+        cells.erase(cells.begin() + end); // The last entrance is in the path already
+    }
+    grid.cellsToPath(cells, path);
+    stats.lastCost = best * grid.getCellSize();
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+/**
+ * @brief Returns the grid planner holding the passable cells, e.g. to search them directly.
+ * @return The grid planner.
+ */
+const GridPlanner& HierarchicalPlanner::getGrid() const {
+    return grid;
+}
+
+/**
+ * @brief Returns the counters.
+ * @return The counters.
+ */
+HierarchyStats HierarchicalPlanner::getStats() const {
+    return stats;
+}
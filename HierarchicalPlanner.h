@@ -0,0 +1,205 @@
+/**
+ * @file HierarchicalPlanner.h
+ * @brief Declaration of the HierarchicalPlanner class, hierarchical path planning (HPA*) on the grid of a Map.
+ * @date October 2026
+ */
+
+#ifndef HIERARCHICALPLANNER_H
+#define HIERARCHICALPLANNER_H
+
+#include "GridPlanner.h"
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct HierarchyStats
+ * @brief Counters of a HierarchicalPlanner.
+ */
+struct HierarchyStats {
+    size_t clusters;                /**< Number of clusters. */
+    size_t entrances;               /**< Entrance cells, the nodes of the abstract graph. */
+    size_t edges;                   /**< Connected entrance pairs inside clusters, each with a stored path. */
+    unsigned long clustersRebuilt;  /**< Clusters whose entrances and paths the last update recomputed. */
+    double lastUpdateUs;            /**< Duration of the last update(), in microseconds. */
+    unsigned long expanded;         /**< Entrances expanded by the last findPath(). */
+    double lastCost;                /**< Cost of the last path found, in meters. */
+    double lastUs;                  /**< Duration of the last findPath(), in microseconds. */
+};
+
+/**
+ * @class HierarchicalPlanner
+ * @brief Plans long paths over a coarse graph of square clusters of grid cells (HPA*).
+ *
+ * The passable cells come from a GridPlanner. The grid is cut into clusters; wherever two
+ * neighbouring clusters share a run of passable cells along their border, one pair of
+ * entrance cells (two for a long run, at its ends) connects them. Inside every cluster the
+ * shortest paths between its entrances are searched once and stored with their cost. A query
+ * connects the start and the goal to the entrances of their clusters, searches the graph of
+ * entrances with A*, and splices the stored paths, so it costs in the number of entrances
+ * rather than of cells. The paths stay within a few percent of the shortest ones.
+ *
+ * update() with a region only recomputes the borders and clusters the change of the passable
+ * cells touches, plus neighbours whose entrances moved, so the graph follows the map at the
+ * cost of a few clusters.
+ */
+class HierarchicalPlanner {
+private:
+    /**
+     * @struct Cluster
+     * @brief The entrances of a cluster and the stored paths between them.
+     */
+    struct Cluster {
+        std::vector<int> entrances;    /**< Entrance cells, x * numberY + y. */
+        std::vector<float> distances;  /**< Cost from entrance a to b at a * count + b, in cells; negative if not connected. */
+        std::vector<int> routeStart;   /**< First entry in routes of the path from a to b (a < b) at a * count + b. */
+        std::vector<int> routeLength;  /**< Number of cells of that path. */
+        std::vector<int> routes;       /**< Cells of the stored paths, from the lower to the higher entrance, ends included. */
+    };
+
+    /**
+     * @struct LocalSearch
+     * @brief Buffers of a Dijkstra search confined to one cluster.
+     */
+    struct LocalSearch {
+        int cluster;                   /**< Cluster searched. */
+        std::vector<float> costs;      /**< Cost of each cell of the cluster from the source, in cells. */
+        std::vector<int> parents;      /**< Predecessor cell of each cell of the cluster, or -1. */
+    };
+
+    /**
+     * @struct OpenEntry
+     * @brief An entrance or cluster cell on an open list with its priority.
+     */
+    struct OpenEntry {
+        float priority;   /**< Cost so far plus the heuristic. */
+        int cell;         /**< Index of the cell. */
+    };
+
+    /**
+     * @struct NodeState
+     * @brief Search state of an entrance during a query.
+     */
+    struct NodeState {
+        float cost;       /**< Cost from the start, in cells. */
+        int parent;       /**< Previous entrance, or -1 if connected to the start directly. */
+        bool closed;      /**< True once expanded. */
+    };
+
+    GridPlanner grid;                          /**< Passable cells. */
+    int clusterSize;                           /**< Edge of a cluster in cells. */
+    int numberX;                               /**< Number of columns of the grid. */
+    int numberY;                               /**< Number of rows of the grid. */
+    int clustersX;                             /**< Number of cluster columns. */
+    int clustersY;                             /**< Number of cluster rows. */
+    std::vector<Cluster> clusters;             /**< Clusters, indexed cx * clustersY + cy. */
+    std::vector<std::vector<int> > eastBorders;  /**< Entrance pairs (west cell, east cell) on the east border of each cluster. */
+    std::vector<std::vector<int> > northBorders; /**< Entrance pairs (south cell, north cell) on the north border of each cluster. */
+    std::vector<int> entranceSlot;             /**< Index of each cell among its cluster's entrances, or -1. */
+    std::vector<OpenEntry> open;               /**< Binary heap of the open list. */
+    std::unordered_map<int, NodeState> states; /**< Search state of the entrances reached by the query. */
+    LocalSearch startSearch;                   /**< Search from the start of a query, or from an entrance while building. */
+    LocalSearch goalSearch;                    /**< Search from the goal of a query. */
+    std::vector<int> cells;                    /**< Cells of the path being assembled. */
+    HierarchyStats stats;                      /**< Counters. */
+
+    /**
+     * @brief Orders open entries so that the heap yields the lowest priority first.
+     * @param a First entry.
+     * @param b Second entry.
+     * @return True if a comes after b.
+     */
+    static bool later(const OpenEntry& a, const OpenEntry& b);
+
+    /**
+     * @brief Returns the cluster a cell lies in.
+     * @param cell Index of the cell.
+     * @return Index of the cluster.
+     */
+    int clusterOf(int cell) const;
+
+    /**
+     * @brief Finds the entrances on the border east or north of a cluster.
+     * @param cx Cluster column.
+     * @param cy Cluster row.
+     * @param east True for the east border, false for the north border.
+     * @param pairs Receives the entrance pairs.
+     */
+    void findEntrances(int cx, int cy, bool east, std::vector<int>& pairs) const;
+
+    /**
+     * @brief Collects the entrances of a cluster from its four borders and stores the paths between them.
+     * @param index Index of the cluster.
+     */
+    void buildCluster(int index);
+
+    /**
+     * @brief Runs a Dijkstra search confined to a cluster.
+     * @param cluster Index of the cluster.
+     * @param source Cell the search starts from; it counts as passable.
+     * @param search Receives the costs and parents.
+     */
+    void searchCluster(int cluster, int source, LocalSearch& search);
+
+    /**
+     * @brief Returns the cost of a cell in a confined search.
+     * @param search The search.
+     * @param cell Index of a cell of the searched cluster.
+     * @return The cost in cells, or a negative value if the cell was not reached.
+     */
+    float localCost(const LocalSearch& search, int cell) const;
+
+    /**
+     * @brief Appends the cells of a confined search's path, from the cell back to the source.
+     * @param search The search.
+     * @param cell The cell to start from.
+     * @param path Receives the cells, the cell itself first and the source last.
+     */
+    void appendLocalPath(const LocalSearch& search, int cell, std::vector<int>& path) const;
+
+public:
+    /**
+     * @brief Constructor for the HierarchicalPlanner class. The planner has no graph until update() is called.
+     * @param radius Radius of the robot in meters.
+     * @param size Edge of a cluster in cells (at least 4).
+     */
+    explicit HierarchicalPlanner(double radius = 0.25, int size = 16);
+
+    /**
+     * @brief Rebuilds the passable cells and the whole graph from the map.
+     * @param map The map.
+     */
+    void update(const Map& map);
+
+    /**
+     * @brief Updates the passable cells and the parts of the graph a change of the map can affect.
+     * @param map The map; if its size differs from the last update, everything is rebuilt.
+     * @param region The cells that changed, e.g. from Mapper::takeChangedRegion().
+     */
+    void update(const Map& map, const MapRegion& region);
+
+    /**
+     * @brief Finds a path from a start cell to a goal cell through the graph of entrances.
+     * @param startX Column of the start; it counts as passable even if the footprint touches an obstacle.
+     * @param startY Row of the start.
+     * @param goalX Column of the goal.
+     * @param goalY Row of the goal.
+     * @param path Receives the cell centres in meters, from the start to the goal; each heading
+     *        (radians) points along the following step.
+     * @return False if the goal is not passable or cannot be reached.
+     */
+    bool findPath(int startX, int startY, int goalX, int goalY, std::vector<Pose>& path);
+
+    /**
+     * @brief Returns the grid planner holding the passable cells, e.g. to search them directly.
+     * @return The grid planner.
+     */
+    const GridPlanner& getGrid() const;
+
+    /**
+     * @brief Returns the counters.
+     * @return The counters.
+     */
+    HierarchyStats getStats() const;
+};
+
+#endif // HIERARCHICALPLANNER_H
@@ -0,0 +1,234 @@
+/**
+ * @file HierarchicalPlannerTest.cpp
+ * @brief Test and benchmark application for the HierarchicalPlanner class.
+ * @details Checks that the paths through the graph of entrances are valid and close to the
+ * shortest ones, that incremental updates give the same graph as a rebuild, and compares long
+ * queries on a large floor with A* and Jump Point Search on the same grid.
+ * @date October, 2026
+ */
+
+#include "HierarchicalPlanner.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Marks a rectangle of cells.
+ * @param map The map.
+ * @param x0 First column.
+ * @param y0 First row.
+ * @param x1 Last column.
+ * @param y1 Last row.
+ * @param value The cell value.
+ */
+void fill(Map& map, int x0, int y0, int x1, int y1, int value) {
+    for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+            map.setGrid(x, y, value);
+        }
+    }
+}
+
+/**
+ * @brief Checks that a path steps between neighbouring passable cells without cutting corners.
+ * @param grid The passable cells.
+ * @param path The path.
+ * @return The length of the path in cells, or -1 if a step is not allowed.
+ */
+double checkPath(const GridPlanner& grid, const vector<Pose>& path) {
+    double length = 0.0;
+    const double cellSize = grid.getCellSize();
+    for (size_t i = 1; i < path.size(); i++) {
+        int x0 = static_cast<int>(floor(path[i - 1].getX() / cellSize)), y0 = static_cast<int>(floor(path[i - 1].getY() / cellSize));
+        int x1 = static_cast<int>(floor(path[i].getX() / cellSize)), y1 = static_cast<int>(floor(path[i].getY() / cellSize));
+        int dx = x1 - x0, dy = y1 - y0;
+        if (dx < -1 || dx > 1 || dy < -1 || dy > 1 || (dx == 0 && dy == 0) || !grid.isPassable(x1, y1)) {
+            return -1.0;
+        }
+        if (dx != 0 && dy != 0 && (!grid.isPassable(x0 + dx, y0) || !grid.isPassable(x0, y0 + dy))) {
+            return -1.0;
+        }
+        length += dx != 0 && dy != 0 ? sqrt(2.0) : 1.0;
+    }
+    return length;
+}
+
+/**
+ * @brief Builds a floor of rooms: outer walls, a grid of walls with doorways a fifth of a room wide and some clutter.
+ * @param map The map.
+ * @param room Edge of a room in cells.
+ * @param rng Random generator for the clutter.
+ */
+void buildFloor(Map& map, int room, mt19937& rng) {
+    const int nx = map.getNumberX(), ny = map.getNumberY();
+    fill(map, 0, 0, nx - 1, ny - 1, Map::CELL_FREE);
+    for (int x = 0; x < nx; x += room) {
+        fill(map, x, 0, x, ny - 1, Map::CELL_OCCUPIED);
+    }
+    for (int y = 0; y < ny; y += room) {
+        fill(map, 0, y, nx - 1, y, Map::CELL_OCCUPIED);
+    }
+    fill(map, nx - 1, 0, nx - 1, ny - 1, Map::CELL_OCCUPIED);
+    fill(map, 0, ny - 1, nx - 1, ny - 1, Map::CELL_OCCUPIED);
+    const int width = room / 5;
+    uniform_int_distribution<int> offset(room / 4, room - room / 4 - width);
+    for (int x = room; x < nx - 1; x += room) {
+        for (int y = 0; y + room / 2 < ny; y += room) {
+            int door = y + offset(rng);
+            fill(map, x, door, x, door + width - 1, Map::CELL_FREE); // A doorway to the east neighbour
+        }
+    }
+    for (int y = room; y < ny - 1; y += room) {
+        for (int x = 0; x + room / 2 < nx; x += room) {
+            int door = x + offset(rng);
+            fill(map, door, y, door + width - 1, y, Map::CELL_FREE); // A doorway to the north neighbour
+        }
+    }
+    uniform_int_distribution<int> cellX(1, nx - 2), cellY(1, ny - 2);
+    for (int k = 0; k < nx * ny / 400; k++) {
+        int x = cellX(rng), y = cellY(rng);
+        fill(map, x, y, x + 1 < nx - 1 ? x + 1 : x, y + 1 < ny - 1 ? y + 1 : y, Map::CELL_OCCUPIED);
+    }
+}
+
+/**
+ * @brief Main function for testing the hierarchical planner.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    mt19937 rng(11);
+
+    /**
+     * @test Test 1: On a floor of rooms every query the grid can answer is answered with a valid
+     * path close to the shortest one, and the others are refused.
+     */
+    Map floor1(200, 200, 0.05);
+    buildFloor(floor1, 40, rng);
+    HierarchicalPlanner planner(0.1, 16);
+    planner.update(floor1);
+    GridPlanner reference(0.1);
+    reference.update(floor1);
+    uniform_int_distribution<int> cell(0, 199);
+    vector<Pose> path;
+    int answered = 0;
+    double worst = 1.0, total = 0.0, totalShortest = 0.0;
+    for (int query = 0; query < 300; query++) {
+        int sx = cell(rng), sy = cell(rng), gx = cell(rng), gy = cell(rng);
+        if (!reference.isPassable(sx, sy)) {
+            continue;
+        }
+        bool exists = reference.findPath(sx, sy, gx, gy, path);
+        double shortest = exists ? checkPath(reference, path) : -1.0;
+        bool found = planner.findPath(sx, sy, gx, gy, path);
+        assert(found == exists);
+        if (found) {
+            double length = checkPath(planner.getGrid(), path);
+            assert(length >= shortest - 1e-3 && length <= shortest * 1.5 + 1e-3);
+            assert(fabs(planner.getStats().lastCost - length * 0.05) < 1e-3);
+            assert(floor(path.front().getX() / 0.05) == sx && floor(path.back().getY() / 0.05) == gy);
+            worst = shortest > 0.0 && length / shortest > worst ? length / shortest : worst;
+            total += length;
+            totalShortest += shortest;
+            answered++;
+        }
+    }
+    assert(answered > 100 && total < totalShortest * 1.1);
+    cout << answered << " queries answered, " << (total / totalShortest - 1.0) * 100.0 << " % longer than the shortest paths in total, "
+         << (worst - 1.0) * 100.0 << " % at most" << endl;
+
+    /**
+     * @test Test 2: When start and goal share a cluster but a wall separates them inside it, the
+     * path leaves the cluster and comes back.
+     */
+    Map hook(64, 64, 0.05);
+    fill(hook, 0, 0, 63, 63, Map::CELL_FREE);
+    fill(hook, 8, 0, 8, 15, Map::CELL_OCCUPIED); // Splits the corner cluster
+    HierarchicalPlanner around(0.0, 16);
+    around.update(hook);
+    assert(around.findPath(4, 2, 12, 2, path));
+    bool left = false;
+    for (size_t i = 0; i < path.size(); i++) {
+        left = left || path[i].getY() / 0.05 >= 16.0;
+    }
+    assert(left && checkPath(around.getGrid(), path) > 0.0);
+    fill(hook, 8, 0, 8, 63, Map::CELL_OCCUPIED);
+    around.update(hook);
+    assert(!around.findPath(4, 2, 12, 2, path) && path.empty());
+
+    /**
+     * @test Test 3: Updating only the changed regions gives the same entrances and paths as
+     * rebuilding the whole graph.
+     */
+    Map changing(160, 160, 0.05);
+    buildFloor(changing, 40, rng);
+    HierarchicalPlanner incremental(0.1, 16);
+    incremental.update(changing);
+    uniform_int_distribution<int> spot(0, 150), value(0, 3);
+    unsigned long rebuiltClusters = 0;
+    for (int round = 0; round < 100; round++) {
+        MapRegion region;
+        region.xMin = spot(rng);
+        region.yMin = spot(rng);
+        region.xMax = region.xMin + 1 + value(rng) * 3;
+        region.yMax = region.yMin + 1 + value(rng) * 3;
+        fill(changing, region.xMin, region.yMin, region.xMax - 1, region.yMax - 1,
+            value(rng) == 0 ? Map::CELL_OCCUPIED : Map::CELL_FREE);
+        incremental.update(changing, region);
+        rebuiltClusters += incremental.getStats().clustersRebuilt;
+    }
+    HierarchicalPlanner rebuilt(0.1, 16);
+    rebuilt.update(changing);
+    assert(incremental.getStats().entrances == rebuilt.getStats().entrances);
+    assert(incremental.getStats().edges == rebuilt.getStats().edges);
+    assert(rebuiltClusters < 100 * rebuilt.getStats().clusters / 4);
+    for (int query = 0; query < 100; query++) {
+        int sx = spot(rng), sy = spot(rng), gx = spot(rng), gy = spot(rng);
+        bool found = rebuilt.findPath(sx, sy, gx, gy, path);
+        double cost = rebuilt.getStats().lastCost;
+        assert(incremental.findPath(sx, sy, gx, gy, path) == found);
+        assert(!found || fabs(incremental.getStats().lastCost - cost) < 1e-4);
+    }
+
+    /**
+     * @test Test 4: A query across a 50 m by 50 m floor (1000 x 1000 cells) of rooms, compared
+     * with A* and Jump Point Search, and the update after a doorway closes.
+     */
+    Map facility(1000, 1000, 0.05);
+    buildFloor(facility, 100, rng);
+    HierarchicalPlanner large(0.2, 20);
+    large.update(facility);
+    HierarchyStats built = large.getStats();
+    GridPlanner flat(0.2);
+    flat.update(facility);
+    assert(flat.findPath(10, 10, 985, 985, path));
+    double shortest = checkPath(flat, path);
+    GridSearchStats aStar = flat.getStats();
+    assert(flat.findJumpPath(10, 10, 985, 985, path));
+    GridSearchStats jumps = flat.getStats();
+    assert(large.findPath(10, 10, 985, 985, path));
+    HierarchyStats query = large.getStats();
+    double length = checkPath(large.getGrid(), path);
+    assert(length > 0.0 && length <= shortest * 1.15);
+    assert(query.expanded * 20 < aStar.expanded);
+    cout << "Graph of " << built.clusters << " clusters, " << built.entrances << " entrances, " << built.edges
+         << " paths built in " << built.lastUpdateUs << " us" << endl;
+    cout << "Across the floor (" << shortest * 0.05 << " m): A* " << aStar.expanded << " cells in " << aStar.lastUs
+         << " us, JPS " << jumps.expanded << " jump points in " << jumps.lastUs << " us, HPA* " << query.expanded
+         << " entrances in " << query.lastUs << " us, " << (length / shortest - 1.0) * 100.0 << " % longer" << endl;
+
+    fill(facility, 500, 0, 500, 999, Map::CELL_OCCUPIED); // Closes the doorways of one wall
+    MapRegion wall = { 500, 0, 501, 1000 };
+    large.update(facility, wall);
+    HierarchyStats updated = large.getStats();
+    assert(updated.clustersRebuilt < built.clusters / 10);
+    assert(!large.findPath(10, 10, 985, 985, path));
+    assert(large.findPath(10, 10, 480, 985, path) && checkPath(large.getGrid(), path) > 0.0);
+    cout << "Closing a wall of doorways: " << updated.clustersRebuilt << " clusters rebuilt in " << updated.lastUpdateUs
+         << " us" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
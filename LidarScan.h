@@ -0,0 +1,41 @@
+/**
+ * @file LidarScan.h
+ * @brief Declaration of the LidarScan and TimedCommand structures passed between pipeline stages.
+ * @date October 2026
+ */
+
+#ifndef LIDARSCAN_H
+#define LIDARSCAN_H
+
+#include "Pose.h"
+#include "CommandStreamer.h"
+
+/**
+ * @struct LidarScan
+ * @brief A self-contained lidar scan with the pose it was taken at.
+ *
+ * The range buffer has a fixed size so that scans can be preallocated in an ObjectPool and
+ * moved between threads by index.
+ */
+struct LidarScan {
+    enum { MAX_BEAMS = 1024 /**< Capacity of the range buffer. */ };
+
+    double timestamp;         /**< Acquisition time in seconds. */
+    Pose pose;                /**< Robot pose at acquisition (th in radians). */
+    double angleMin;          /**< Angle of the first beam in degrees. */
+    double angleIncrement;    /**< Angle between neighbouring beams in degrees. */
+    int rangeNumber;          /**< Number of valid entries in ranges. */
+    float ranges[MAX_BEAMS];  /**< Measured ranges in meters. */
+};
+
+/**
+ * @struct TimedCommand
+ * @brief A velocity command submitted to the pipeline by one of several producers.
+ */
+struct TimedCommand {
+    double timestamp;         /**< Submission time in seconds. */
+    VelocityCommand command;  /**< Requested body-frame velocity. */
+    int source;               /**< Identifier of the producer (planner, safety, teleoperation, ...). */
+};
+
+#endif // LIDARSCAN_H
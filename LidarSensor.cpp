@@ -21,7 +21,7 @@ using namespace std;
  *
  * @param robotAPI Pointer to the FestoRobotAPI object.
  */
-LidarSensor::LidarSensor(FestoRobotAPI* robotAPI) : robotAPI(robotAPI), ranges(nullptr), rangeNumber(0) {}
+LidarSensor::LidarSensor(FestoRobotAPI* robotAPI) : ranges(nullptr), robotAPI(robotAPI), rangeNumber(0) {}
 
 /**
  * @brief Destructor for the LidarSensor class.
@@ -47,6 +47,21 @@ double LidarSensor::getRange(int index) const {
     return -1;
 }
 
+/**
+ * @brief Returns the range at the specified index as read from the robot, before filtering.
+ *
+ * If the index is invalid, returns -1.
+ *
+ * @param index Index of the range to retrieve.
+ * @return The unfiltered range value at the specified index, or -1 if the index is invalid.
+ */
+double LidarSensor::getRawRange(int index) const {
+    if (index >= 0 && index < rangeNumber) {
+        return rawRanges[index];
+    }
+    return -1;
+}
+
 /**
  * @brief Returns the number of ranges available from the Lidar sensor.
  *
@@ -57,19 +72,37 @@ int LidarSensor::getRangeNum() const {
 }
 
 /**
- * @brief Finds and returns the maximum range value and its index.
+ * @brief Copies the current range data into a caller-provided buffer.
+ *
+ * Used to hand a scan to another thread without sharing the sensor's own buffer,
+ * which is overwritten on every update.
+ *
+ * @param out Destination buffer.
+ * @param capacity Number of elements the buffer can hold.
+ * @return The number of ranges copied.
+ */
+int LidarSensor::copyRanges(float* out, int capacity) const {
+    int count = rangeNumber < capacity ? rangeNumber : capacity;
+    for (int i = 0; i < count; i++) {
+        out[i] = ranges[i];
+    }
+    return count;
+}
+
+/**
+ * @brief Finds and returns the maximum valid range value and its index.
  *
+ * Beams without a valid return, which the scan filter sets to 0, are skipped.
  * If no valid ranges are available, returns -1.
  *
  * @param index Reference to store the index of the maximum range.
  * @return The maximum range value, or -1 if no valid ranges exist.
  */
 double LidarSensor::getMax(int& index) const {
-    if (rangeNumber == 0) return -1;
-    double max1 = ranges[0];
-    index = 0;
+    double max1 = -1;
+    index = -1;
     for (int i = 0; i < rangeNumber; i++) {
-        if (ranges[i] > max1) {
+        if (ranges[i] > 0 && ranges[i] > max1) {
             max1 = ranges[i];
             index = i;
         }
@@ -78,19 +111,19 @@ double LidarSensor::getMax(int& index) const {
 }
 
 /**
- * @brief Finds and returns the minimum range value and its index.
+ * @brief Finds and returns the minimum valid range value and its index.
  *
+ * Beams without a valid return, which the scan filter sets to 0, are skipped.
  * If no valid ranges are available, returns -1.
  *
  * @param index Reference to store the index of the minimum range.
  * @return The minimum range value, or -1 if no valid ranges exist.
  */
 double LidarSensor::getMin(int& index) const {
-    if (rangeNumber == 0) return -1;
-    double min1 = ranges[0];
-    index = 0;
+    double min1 = -1;
+    index = -1;
     for (int i = 0; i < rangeNumber; i++) {
-        if (ranges[i] < min1) {
+        if (ranges[i] > 0 && (index < 0 || ranges[i] < min1)) {
             min1 = ranges[i];
             index = i;
         }
@@ -101,16 +134,21 @@ double LidarSensor::getMin(int& index) const {
 /**
  * @brief Updates the range data from the Lidar sensor.
  *
- * Retrieves the latest range data from the robot API and updates the internal state.
+ * Retrieves the latest range data from the robot API and passes it through the scan filter.
+ * The buffers are only reallocated when the number of ranges changes.
  * If the API fails or the pointer is null, displays an error message.
  */
 void LidarSensor::update() {
     if (robotAPI) {
         rangeNumber = robotAPI->getLidarRangeNumber();
         if (rangeNumber > 0) {
-            delete[] ranges; // Free old range data
-            ranges = new float[rangeNumber];
-            robotAPI->getLidarRange(ranges);
+            if (static_cast<int>(rawRanges.size()) != rangeNumber) {
+                delete[] ranges; // Free old range data
+                ranges = new float[rangeNumber];
+                rawRanges.resize(rangeNumber);
+            }
+            robotAPI->getLidarRange(&rawRanges[0]);
+            filter.apply(&rawRanges[0], ranges, rangeNumber);
         }
         else {
             cout << "Failed to retrieve Lidar sensor data!" << endl;
@@ -121,6 +159,25 @@ void LidarSensor::update() {
     }
 }
 
+/**
+ * @brief Configures the scan filter applied on every update.
+ *
+ * @param config The filter settings; a value-initialized config only rejects invalid ranges.
+ * @return True if the settings were accepted.
+ */
+bool LidarSensor::setFilter(const ScanFilterConfig& config) {
+    return filter.configure(config);
+}
+
+/**
+ * @brief Returns the scan filter, e.g. to read its statistics.
+ *
+ * @return The scan filter.
+ */
+const ScanFilter& LidarSensor::getFilter() const {
+    return filter;
+}
+
 /**
  * @brief Overloads the [] operator to access ranges by index.
  *
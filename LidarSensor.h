@@ -10,7 +10,9 @@
 #define LIDARSENSOR_H
 
 #include "FestoRobotAPI.h"
+#include "ScanFilter.h"
 #include <iostream>
+#include <vector>
 
 using namespace std;
 
@@ -23,6 +25,8 @@ private:
     float* ranges;  ///< Array to hold the range data
     FestoRobotAPI* robotAPI;  ///< Pointer to the robot API
     int rangeNumber;  ///< Number of range data points
+    std::vector<float> rawRanges;  ///< Range data as read from the robot, before filtering
+    ScanFilter filter;  ///< Outlier rejection applied to every update
 
 public:
     /**
@@ -45,25 +49,46 @@ public:
     double getRange(int index) const;
 
     /**
-     * @brief Finds and returns the maximum range and its index
+     * @brief Returns the range at the specified index as read from the robot, before filtering
+     * @param index The index of the range data
+     * @return The unfiltered range at the specified index
+     */
+    double getRawRange(int index) const;
+
+    /**
+     * @brief Finds and returns the maximum valid range and its index
      * @param index Reference to an integer to store the index of the maximum range
-     * @return The maximum range value
+     * @return The maximum range value, or -1 if no range is valid
      */
     double getMax(int& index) const;
 
     /**
-     * @brief Finds and returns the minimum range and its index
+     * @brief Finds and returns the minimum valid range and its index
      * @param index Reference to an integer to store the index of the minimum range
-     * @return The minimum range value
+     * @return The minimum range value, or -1 if no range is valid
      */
     double getMin(int& index) const;
 
     /**
      * @brief Updates the range data from the Lidar sensor
-     * This function retrieves the latest range data from the Lidar sensor using the robot API.
+     * This function retrieves the latest range data from the Lidar sensor using the robot API
+     * and passes it through the scan filter.
      */
     void update();
 
+    /**
+     * @brief Configures the scan filter applied on every update
+     * @param config The filter settings; a value-initialized config only rejects invalid ranges
+     * @return True if the settings were accepted
+     */
+    bool setFilter(const ScanFilterConfig& config);
+
+    /**
+     * @brief Returns the scan filter, e.g. to read its statistics
+     * @return The scan filter
+     */
+    const ScanFilter& getFilter() const;
+
     /**
      * @brief Overloads the [] operator to return the range at a specified index
      * @param i The index of the range data
@@ -78,6 +103,14 @@ public:
      */
     double getAngle(int i) const;
 
+    /**
+     * @brief Copies the current range data into a caller-provided buffer
+     * @param out Destination buffer
+     * @param capacity Number of elements the buffer can hold
+     * @return The number of ranges copied
+     */
+    int copyRanges(float* out, int capacity) const;
+
     /**
      * @brief Returns the number of ranges from the Lidar sensor
      * @return The number of range data points
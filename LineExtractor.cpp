@@ -0,0 +1,346 @@
+/**
+ * @file LineExtractor.cpp
+ * @brief Implementation of the LineExtractor class.
+ * @date October 2026
+ */
+
+#include "LineExtractor.h"
+#include <cmath>
+
+using namespace std;
+
+const float LineExtractor::CORNER_GAP = 0.2f;
+const float LineExtractor::CORNER_ANGLE = static_cast<float>(degToRad(30.0));
+
+/**
+ * @brief Constructor for the LineExtractor class.
+ * @param maxLines Number of lines a scan can produce; further ones are dropped.
+ * @param splitDistanceMeters Largest distance of a point from its line before the line is split.
+ * @param minimumPoints Lines with fewer beams are discarded.
+ * @param minimumLength Lines shorter than this are discarded, in meters.
+ * @param rangeSigma Range noise of the sensor, in meters.
+ */
+LineExtractor::LineExtractor(size_t maxLines, float splitDistanceMeters, int minimumPoints, float minimumLength,
+    float rangeSigma)
+    : segmenter(maxLines * 2, 10.0, rangeSigma, minimumPoints), lines(maxLines), corners(maxLines), lineCount(0),
+      cornerCount(0), droppedLines(0), splitDistance(splitDistanceMeters), minPoints(minimumPoints > 2 ? minimumPoints : 2),
+      minLength(minimumLength), sigma(rangeSigma) {}
+
+/**
+ * @brief Fits a line to a run of beams by total least squares.
+ *
+ * The normal direction minimizing the squared distances is 0.5 * atan2(-2 Sxy, Syy - Sxx) with
+ * the scatter sums taken about the centroid. The point noise s^2 along the normal is estimated
+ * from the residuals, since range noise reaches the normal only in part on oblique beams; a
+ * hundredth of the sensor's variance is the floor for noise-free fits. With t the
+ * coordinates of the points along the line, var(alpha) = s^2 / sum((t - tc)^2), and r, which is
+ * measured at the centroid (variance s^2 / n) and moves by tc per unit of alpha, gets
+ * var(r) = s^2 / n + tc^2 var(alpha) and cov(alpha, r) = tc var(alpha).
+ *
+ * @param first First beam.
+ * @param last Last beam.
+ * @param line Receives the line, its covariance and its end points.
+ * @return The largest distance of a point from the line.
+ */
+float LineExtractor::fit(int first, int last, LineFeature& line) const {
+    const float* xs = segmenter.getPointsX();
+    const float* ys = segmenter.getPointsY();
+    const int n = last - first + 1;
+    double meanX = 0.0, meanY = 0.0;
+    for (int i = first; i <= last; i++) {
+        meanX += xs[i];
+        meanY += ys[i];
+    }
+    meanX /= n;
+    meanY /= n;
+    double sxx = 0.0, syy = 0.0, sxy = 0.0;
+    for (int i = first; i <= last; i++) {
+        double dx = xs[i] - meanX;
+        double dy = ys[i] - meanY;
+        sxx += dx * dx;
+        syy += dy * dy;
+        sxy += dx * dy;
+    }
+    double alpha = 0.5 * atan2(-2.0 * sxy, syy - sxx);
+    double c = cos(alpha), s = sin(alpha);
+    double r = meanX * c + meanY * s;
+    if (r < 0.0) {
+        r = -r;
+        alpha += SE2_PI;
+        c = -c;
+        s = -s;
+    }
+    alpha = normalizeAngle(alpha);
+
+    double squares = 0.0, worst = 0.0;
+    for (int i = first; i <= last; i++) {
+        double d = xs[i] * c + ys[i] * s - r;
+        squares += d * d;
+        worst = fabs(d) > worst ? fabs(d) : worst;
+    }
+    double floor = 0.01 * sigma * sigma;
+    double noise = n > 2 ? squares / (n - 2) : 0.0;
+    noise = noise > floor ? noise : floor;
+    double spread = sxx * s * s + syy * c * c - 2.0 * sxy * s * c;
+    double tc = -meanX * s + meanY * c;
+    double varAlpha = spread > 0.0 ? noise / spread : SE2_PI * SE2_PI;
+
+    line.alpha = static_cast<float>(alpha);
+    line.r = static_cast<float>(r);
+    line.varAlpha = static_cast<float>(varAlpha);
+    line.varR = static_cast<float>(noise / n + tc * tc * varAlpha);
+    line.covAlphaR = static_cast<float>(tc * varAlpha);
+    double d0 = xs[first] * c + ys[first] * s - r;
+    double d1 = xs[last] * c + ys[last] * s - r;
+    line.x0 = static_cast<float>(xs[first] - d0 * c);
+    line.y0 = static_cast<float>(ys[first] - d0 * s);
+    line.x1 = static_cast<float>(xs[last] - d1 * c);
+    line.y1 = static_cast<float>(ys[last] - d1 * s);
+    line.length = static_cast<float>(hypot(line.x1 - line.x0, line.y1 - line.y0));
+    line.rms = static_cast<float>(sqrt(squares / n));
+    line.firstBeam = first;
+    line.lastBeam = last;
+    return static_cast<float>(worst);
+}
+
+/**
+ * @brief Splits, merges and fits the beams of one cluster.
+ *
+ * Pieces are split at their farthest point, which at first ends one piece and starts the next.
+ * The stack is worked left piece first, which leaves the pieces in beam order for the merge step.
+ * After merging, each split point is given to the neighbouring line it lies closer to, since a
+ * beam next to a corner hits only one of its walls.
+ *
+ * @param first First beam of the cluster.
+ * @param last Last beam of the cluster.
+ */
+void LineExtractor::extractCluster(int first, int last) {
+    const float* xs = segmenter.getPointsX();
+    const float* ys = segmenter.getPointsY();
+    stack.clear();
+    pieces.clear();
+    Piece whole = { first, last };
+    stack.push_back(whole);
+    while (!stack.empty()) {
+        Piece piece = stack.back();
+        stack.pop_back();
+        float ex = xs[piece.last] - xs[piece.first];
+        float ey = ys[piece.last] - ys[piece.first];
+        float chord = sqrt(ex * ex + ey * ey);
+        float worst = 0.0f;
+        int split = -1;
+        for (int i = piece.first + 1; i < piece.last; i++) {
+            float dx = xs[i] - xs[piece.first];
+            float dy = ys[i] - ys[piece.first];
+            float d = chord > 0.0f ? fabs(dx * ey - dy * ex) / chord : sqrt(dx * dx + dy * dy);
+            if (d > worst) {
+                worst = d;
+                split = i;
+            }
+        }
+        if (worst > splitDistance) {
+            Piece right = { split, piece.last };
+            Piece left = { piece.first, split };
+            stack.push_back(right);
+            stack.push_back(left);
+        }
+        else {
+            pieces.push_back(piece);
+        }
+    }
+
+    LineFeature line, before, after;
+    size_t merged = 0;
+    for (size_t k = 1; k < pieces.size(); k++) {
+        if (fit(pieces[merged].first, pieces[k].last, line) <= splitDistance) {
+            pieces[merged].last = pieces[k].last;
+        }
+        else {
+            pieces[++merged] = pieces[k];
+        }
+    }
+    pieces.resize(merged + 1);
+
+    for (size_t k = 0; k + 1 < pieces.size(); k++) {
+        int shared = pieces[k].last;
+        if (shared - pieces[k].first < 3 || pieces[k + 1].last - shared < 3) {
+            continue;
+        }
+        fit(pieces[k].first, shared - 1, before);
+        fit(shared + 1, pieces[k + 1].last, after);
+        float toBefore = fabs(xs[shared] * cos(before.alpha) + ys[shared] * sin(before.alpha) - before.r);
+        float toAfter = fabs(xs[shared] * cos(after.alpha) + ys[shared] * sin(after.alpha) - after.r);
+        if (toBefore <= toAfter) {
+            pieces[k + 1].first++;
+        }
+        else {
+            pieces[k].last--;
+        }
+    }
+
+    for (size_t k = 0; k < pieces.size(); k++) {
+        if (pieces[k].last - pieces[k].first + 1 < minPoints) {
+            continue;
+        }
+        fit(pieces[k].first, pieces[k].last, line);
+        if (line.length < minLength) {
+            continue;
+        }
+        if (lineCount < lines.size()) {
+            lines[lineCount++] = line;
+        }
+        else {
+            droppedLines++;
+        }
+    }
+}
+
+/**
+ * @brief Finds the corners between consecutive lines.
+ */
+void LineExtractor::findCorners() {
+    for (size_t i = 0; i + 1 < lineCount && cornerCount < corners.size(); i++) {
+        const LineFeature& a = lines[i];
+        const LineFeature& b = lines[i + 1];
+        if (hypot(b.x0 - a.x1, b.y0 - a.y1) > CORNER_GAP) {
+            continue;
+        }
+        double angle = fabs(angleDifference(b.alpha, a.alpha));
+        angle = angle > SE2_PI / 2 ? SE2_PI - angle : angle;
+        if (angle < CORNER_ANGLE) {
+            continue;
+        }
+        double det = sin(static_cast<double>(b.alpha) - a.alpha);
+        double x = (a.r * sin(b.alpha) - b.r * sin(a.alpha)) / det;
+        double y = (b.r * cos(a.alpha) - a.r * cos(b.alpha)) / det;
+        if (hypot(x - a.x1, y - a.y1) > 2.0 * CORNER_GAP || hypot(x - b.x0, y - b.y0) > 2.0 * CORNER_GAP) {
+            continue;
+        }
+        CornerFeature& corner = corners[cornerCount++];
+        corner.x = static_cast<float>(x);
+        corner.y = static_cast<float>(y);
+        corner.angle = static_cast<float>(angle);
+        corner.firstLine = static_cast<int>(i);
+        corner.secondLine = static_cast<int>(i + 1);
+    }
+}
+
+/**
+ * @brief Extracts the lines of every cluster the segmenter found, then the corners.
+ * @param clusterCount Number of clusters of the scan.
+ * @param rangeCount Number of ranges of the scan.
+ * @return The number of lines.
+ */
+size_t LineExtractor::extractClusters(size_t clusterCount, int rangeCount) {
+    lineCount = 0;
+    cornerCount = 0;
+    droppedLines = 0;
+    if (rangeCount > 0 && stack.capacity() < static_cast<size_t>(rangeCount)) {
+        stack.reserve(rangeCount);
+        pieces.reserve(rangeCount);
+    }
+    for (size_t i = 0; i < clusterCount; i++) {
+        extractCluster(segmenter.getCluster(i).firstBeam, segmenter.getCluster(i).lastBeam);
+    }
+    findCorners();
+    return lineCount;
+}
+
+/**
+ * @brief Extracts the lines and corners of a scan.
+ * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees.
+ * @param angleIncrement Angle between beams in degrees.
+ * @param frame Frame the features are given in.
+ * @return The number of lines.
+ */
+size_t LineExtractor::extract(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+    const Transform2D& frame) {
+    return extractClusters(segmenter.segment(ranges, rangeCount, angleMin, angleIncrement, frame), rangeCount);
+}
+
+/**
+ * @brief Extracts the lines and corners of a pooled scan in the world frame given by its pose.
+ * @param scan The scan.
+ * @return The number of lines.
+ */
+size_t LineExtractor::extract(const LidarScan& scan) {
+    return extract(scan.ranges, scan.rangeNumber, scan.angleMin, scan.angleIncrement, Transform2D(scan.pose));
+}
+
+/**
+ * @brief Extracts the lines and corners of the current scan of a Lidar sensor.
+ * @param lidar The sensor.
+ * @param frame Frame the features are given in.
+ * @return The number of lines.
+ */
+size_t LineExtractor::extract(const LidarSensor& lidar, const Transform2D& frame) {
+    return extractClusters(segmenter.segment(lidar, frame), lidar.getRangeNum());
+}
+
+/**
+ * @brief Returns the number of lines of the last scan.
+ * @return The number of lines.
+ */
+size_t LineExtractor::getLineCount() const {
+    return lineCount;
+}
+
+/**
+ * @brief Returns a line of the last scan.
+ * @param index Index of the line, less than getLineCount().
+ * @return The line.
+ */
+const LineFeature& LineExtractor::getLine(size_t index) const {
+    return lines[index];
+}
+
+/**
+ * @brief Returns the lines of the last scan.
+ * @return Pointer to getLineCount() lines.
+ */
+const LineFeature* LineExtractor::getLines() const {
+    return lines.empty() ? nullptr : &lines[0];
+}
+
+/**
+ * @brief Returns the number of corners of the last scan.
+ * @return The number of corners.
+ */
+size_t LineExtractor::getCornerCount() const {
+    return cornerCount;
+}
+
+/**
+ * @brief Returns a corner of the last scan.
+ * @param index Index of the corner, less than getCornerCount().
+ * @return The corner.
+ */
+const CornerFeature& LineExtractor::getCorner(size_t index) const {
+    return corners[index];
+}
+
+/**
+ * @brief Returns the corners of the last scan.
+ * @return Pointer to getCornerCount() corners.
+ */
+const CornerFeature* LineExtractor::getCorners() const {
+    return corners.empty() ? nullptr : &corners[0];
+}
+
+/**
+ * @brief Returns the number of lines of the last scan that did not fit in the array.
+ * @return The number of dropped lines.
+ */
+unsigned long LineExtractor::getDroppedLines() const {
+    return droppedLines;
+}
+
+/**
+ * @brief Returns the clusters the last scan was split into.
+ * @return The segmenter.
+ */
+const ScanSegmenter& LineExtractor::getSegmenter() const {
+    return segmenter;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file LineExtractor.h
+ * @brief Declaration of the LineExtractor class, which reduces Lidar scans to line and corner features.
+ * @date October 2026
+ */
+
+#ifndef LINEEXTRACTOR_H
+#define LINEEXTRACTOR_H
+
+#include "ScanSegmenter.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct LineFeature
+ * @brief A straight wall piece: the line x * cos(alpha) + y * sin(alpha) = r and the extent seen of it.
+ *
+ * Coordinates are in meters, in the frame given to LineExtractor::extract().
+ */
+struct LineFeature {
+    float alpha;         /**< Direction of the line normal, in radians in [-pi, pi). */
+    float r;             /**< Distance of the line from the frame origin, 0 or more. */
+    float varAlpha;      /**< Variance of alpha. */
+    float varR;          /**< Variance of r. */
+    float covAlphaR;     /**< Covariance of alpha and r. */
+    float x0, y0;        /**< First end point, the first beam's point projected onto the line. */
+    float x1, y1;        /**< Second end point, the last beam's point projected onto the line. */
+    float length;        /**< Distance between the end points. */
+    float rms;           /**< Root mean square distance of the points from the line. */
+    int firstBeam;       /**< Index of the first beam. */
+    int lastBeam;        /**< Index of the last beam. */
+};
+
+/**
+ * @struct CornerFeature
+ * @brief The meeting point of two consecutive lines.
+ */
+struct CornerFeature {
+    float x, y;          /**< Intersection of the two lines. */
+    float angle;         /**< Angle between the two lines, in radians in (0, pi/2]. */
+    int firstLine;       /**< Index of the line before the corner. */
+    int secondLine;      /**< Index of the line after the corner. */
+};
+
+/**
+ * @class LineExtractor
+ * @brief Reduces a scan to tens of line and corner features with split-and-merge.
+ *
+ * The scan is first split into clusters of neighbouring beams by a ScanSegmenter, so lines never
+ * bridge gaps or jumps in range. Each cluster is then split recursively at the point farthest
+ * from the chord between its ends while that distance exceeds the split distance, neighbouring
+ * pieces that still fit one line are merged back, and every piece is fitted by total least squares
+ * in (alpha, r) form. The covariance of (alpha, r) follows from the point noise, which is
+ * estimated from the residuals of the fit.
+ *
+ * Two consecutive lines whose end points lie close together and that meet at a clear angle give
+ * a corner at their intersection.
+ *
+ * Features are written to arrays allocated in the constructor; extract() does not allocate
+ * unless the beam layout changes.
+ */
+class LineExtractor {
+private:
+    /**
+     * @struct Piece
+     * @brief A run of beams that is being split or merged.
+     */
+    struct Piece {
+        int first;       /**< First beam. */
+        int last;        /**< Last beam. */
+    };
+
+    ScanSegmenter segmenter;          /**< Splits the scan into clusters. */
+    std::vector<LineFeature> lines;   /**< Lines of the last scan; only the first lineCount are valid. */
+    std::vector<CornerFeature> corners; /**< Corners of the last scan; only the first cornerCount are valid. */
+    size_t lineCount;                 /**< Number of lines of the last scan. */
+    size_t cornerCount;               /**< Number of corners of the last scan. */
+    unsigned long droppedLines;       /**< Lines of the last scan that did not fit in the array. */
+    std::vector<Piece> stack;         /**< Pieces still to be split. */
+    std::vector<Piece> pieces;        /**< Pieces of the current cluster, in beam order. */
+    float splitDistance;              /**< Largest distance of a point from its line before the line is split. */
+    int minPoints;                    /**< Lines with fewer beams are discarded. */
+    float minLength;                  /**< Lines shorter than this are discarded. */
+    float sigma;                      /**< Range noise of the sensor, in meters. */
+
+    /**
+     * @brief Fits a line to a run of beams by total least squares.
+     * @param first First beam.
+     * @param last Last beam.
+     * @param line Receives the line, its covariance and its end points.
+     * @return The largest distance of a point from the line.
+     */
+    float fit(int first, int last, LineFeature& line) const;
+
+    /**
+     * @brief Splits, merges and fits the beams of one cluster.
+     * @param first First beam of the cluster.
+     * @param last Last beam of the cluster.
+     */
+    void extractCluster(int first, int last);
+
+    /**
+     * @brief Finds the corners between consecutive lines.
+     */
+    void findCorners();
+
+    /**
+     * @brief Extracts the lines of every cluster the segmenter found, then the corners.
+     * @param clusterCount Number of clusters of the scan.
+     * @param rangeCount Number of ranges of the scan.
+     * @return The number of lines.
+     */
+    size_t extractClusters(size_t clusterCount, int rangeCount);
+
+public:
+    /** @brief Largest distance between the end points of two lines that meet in a corner, in meters. */
+    static const float CORNER_GAP;
+    /** @brief Smallest angle between two lines that meet in a corner, in radians. */
+    static const float CORNER_ANGLE;
+
+    /**
+     * @brief Constructor for the LineExtractor class.
+     * @param maxLines Number of lines a scan can produce; further ones are dropped.
+     * @param splitDistanceMeters Largest distance of a point from its line before the line is split.
+     * @param minimumPoints Lines with fewer beams are discarded.
+     * @param minimumLength Lines shorter than this are discarded, in meters.
+     * @param rangeSigma Range noise of the sensor, in meters.
+     */
+    explicit LineExtractor(size_t maxLines = 64, float splitDistanceMeters = 0.03f, int minimumPoints = 6,
+        float minimumLength = 0.2f, float rangeSigma = 0.01f);
+
+    /**
+     * @brief Extracts the lines and corners of a scan.
+     * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+     * @param rangeCount Number of ranges.
+     * @param angleMin Angle of the first beam in degrees.
+     * @param angleIncrement Angle between beams in degrees.
+     * @param frame Frame the features are given in: the sensor pose for world coordinates, or the
+     *        identity for sensor coordinates.
+     * @return The number of lines.
+     */
+    size_t extract(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+        const Transform2D& frame = Transform2D());
+
+    /**
+     * @brief Extracts the lines and corners of a pooled scan in the world frame given by its pose.
+     * @param scan The scan.
+     * @return The number of lines.
+     */
+    size_t extract(const LidarScan& scan);
+
+    /**
+     * @brief Extracts the lines and corners of the current scan of a Lidar sensor.
+     * @param lidar The sensor.
+     * @param frame Frame the features are given in.
+     * @return The number of lines.
+     */
+    size_t extract(const LidarSensor& lidar, const Transform2D& frame = Transform2D());
+
+    /**
+     * @brief Returns the number of lines of the last scan.
+     * @return The number of lines.
+     */
+    size_t getLineCount() const;
+
+    /**
+     * @brief Returns a line of the last scan.
+     * @param index Index of the line, less than getLineCount(); lines are ordered by beam.
+     * @return The line.
+     */
+    const LineFeature& getLine(size_t index) const;
+
+    /**
+     * @brief Returns the lines of the last scan.
+     * @return Pointer to getLineCount() lines.
+     */
+    const LineFeature* getLines() const;
+
+    /**
+     * @brief Returns the number of corners of the last scan.
+     * @return The number of corners.
+     */
+    size_t getCornerCount() const;
+
+    /**
+     * @brief Returns a corner of the last scan.
+     * @param index Index of the corner, less than getCornerCount().
+     * @return The corner.
+     */
+    const CornerFeature& getCorner(size_t index) const;
+
+    /**
+     * @brief Returns the corners of the last scan.
+     * @return Pointer to getCornerCount() corners.
+     */
+    const CornerFeature* getCorners() const;
+
+    /**
+     * @brief Returns the number of lines of the last scan that did not fit in the array.
+     * @return The number of dropped lines.
+     */
+    unsigned long getDroppedLines() const;
+
+    /**
+     * @brief Returns the clusters the last scan was split into.
+     * @return The segmenter.
+     */
+    const ScanSegmenter& getSegmenter() const;
+};
+
+#endif // LINEEXTRACTOR_H
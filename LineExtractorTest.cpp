@@ -0,0 +1,273 @@
+/**
+ * @file LineExtractorTest.cpp
+ * @brief Test and benchmark application for the LineExtractor class.
+ * @details Extracts the walls and corners of a simulated room, with and without range noise,
+ * compares the reported covariance with the spread over many noisy scans, checks the output
+ * frames, the feature capacity and that extraction does not allocate, and measures the time
+ * per scan.
+ * @date October, 2026
+ */
+
+#include "LineExtractor.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+using namespace std;
+
+const int BEAMS = 667;              /**< Beams per simulated scan. */
+const double ANGLE_MIN = -120.0;    /**< Angle of the first beam in degrees. */
+const double INCREMENT = 0.36;      /**< Angle between beams in degrees. */
+
+static unsigned long allocations = 0; /**< Calls of operator new, to check that extraction does not allocate. */
+
+/**
+ * @brief Counting replacement of the global operator new.
+ * @param size Bytes to allocate.
+ * @return The memory.
+ */
+void* operator new(size_t size) {
+    allocations++;
+    void* memory = malloc(size ? size : 1);
+    if (!memory) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief Replacement of the global operator delete that matches the counting operator new.
+ * @param memory The memory.
+ */
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+/**
+ * @brief Sized form of the replacement operator delete.
+ * @param memory The memory.
+ */
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+/**
+ * @struct Wall
+ * @brief A wall from (x0, y0) to (x1, y1), in the sensor frame.
+ */
+struct Wall {
+    double x0, y0, x1, y1;
+};
+
+/**
+ * @brief Simulates a scan of a rectangular room from a pose inside it.
+ * @param walls The walls of the room, in the sensor frame.
+ * @param noise Standard deviation of the range noise.
+ * @param rng Random generator for the noise.
+ * @return The ranges.
+ */
+vector<float> simulate(const vector<Wall>& walls, double noise, mt19937& rng) {
+    normal_distribution<double> error(0.0, noise > 0.0 ? noise : 1.0);
+    vector<float> ranges(BEAMS);
+    for (int i = 0; i < BEAMS; i++) {
+        double angle = degToRad(ANGLE_MIN + i * INCREMENT);
+        double dx = cos(angle), dy = sin(angle), best = 5.6;
+        for (const Wall& w : walls) {
+            double ex = w.x1 - w.x0, ey = w.y1 - w.y0;
+            double denominator = dx * ey - dy * ex;
+            if (fabs(denominator) > 1e-12) {
+                double t = (w.x0 * ey - w.y0 * ex) / denominator;
+                double u = (w.x0 * dy - w.y0 * dx) / denominator;
+                if (t > 0.0 && u >= 0.0 && u <= 1.0) {
+                    best = t < best ? t : best;
+                }
+            }
+        }
+        ranges[i] = best < 5.6 ? static_cast<float>(best + (noise > 0.0 ? error(rng) : 0.0)) : 0.0f;
+    }
+    return ranges;
+}
+
+/**
+ * @brief Finds the extracted line closest in (alpha, r) to a reference line.
+ * @param extractor The extractor after extract().
+ * @param alpha Normal direction of the reference line.
+ * @param r Distance of the reference line.
+ * @return The index of the line, or -1 if none is within 0.05 rad and 0.05 m.
+ */
+long findLine(const LineExtractor& extractor, double alpha, double r) {
+    for (size_t i = 0; i < extractor.getLineCount(); i++) {
+        const LineFeature& line = extractor.getLine(i);
+        if (fabs(angleDifference(line.alpha, alpha)) < 0.05 && fabs(line.r - r) < 0.05) {
+            return static_cast<long>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Main function for testing the line extractor.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    // The robot stands 0.5 m from the back wall of a 5 m by 3 m room, facing the front wall.
+    vector<Wall> room = { { 3.5, -1.5, 3.5, 1.5 }, { 3.5, 1.5, -0.5, 1.5 }, { -0.5, 1.5, -0.5, -1.5 },
+        { -0.5, -1.5, 3.5, -1.5 } };
+    mt19937 rng(17);
+
+    /**
+     * @test Test 1: A noise-free room gives its walls as lines and the corners between them.
+     */
+    vector<float> ranges = simulate(room, 0.0, rng);
+    LineExtractor extractor;
+    size_t lineCount = extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+    assert(lineCount == 5); // The back wall is seen in two pieces, left and right of the blind spot
+    long front = findLine(extractor, 0.0, 3.5);
+    long left = findLine(extractor, SE2_PI / 2, 1.5);
+    long right = findLine(extractor, -SE2_PI / 2, 1.5);
+    assert(front >= 0 && left >= 0 && right >= 0);
+    int backPieces = 0;
+    for (size_t i = 0; i < lineCount; i++) {
+        const LineFeature& line = extractor.getLine(i);
+        backPieces += fabs(angleDifference(line.alpha, -SE2_PI)) < 1e-4 && fabs(line.r - 0.5) < 1e-4 ? 1 : 0;
+    }
+    assert(backPieces == 2);
+    const LineFeature& frontLine = extractor.getLine(front);
+    assert(fabs(angleDifference(frontLine.alpha, 0.0)) < 1e-4 && fabs(frontLine.r - 3.5) < 1e-4);
+    assert(fabs(frontLine.length - 3.0) < 0.06 && frontLine.rms < 1e-4); // Ends at the last beam before each corner
+    assert(fabs(extractor.getLine(left).r - 1.5) < 1e-4 && fabs(extractor.getLine(right).r - 1.5) < 1e-4);
+    assert(extractor.getCornerCount() == 4);
+    double cornerX[] = { 3.5, 3.5, -0.5, -0.5 };
+    double cornerY[] = { 1.5, -1.5, 1.5, -1.5 };
+    for (int k = 0; k < 4; k++) {
+        bool found = false;
+        for (size_t i = 0; i < extractor.getCornerCount(); i++) {
+            const CornerFeature& corner = extractor.getCorner(i);
+            if (hypot(corner.x - cornerX[k], corner.y - cornerY[k]) < 0.005) {
+                found = true;
+                assert(fabs(corner.angle - SE2_PI / 2) < 1e-3 && corner.secondLine == corner.firstLine + 1);
+            }
+        }
+        assert(found);
+    }
+    cout << "Room: " << BEAMS << " ranges -> " << lineCount << " lines and " << extractor.getCornerCount()
+        << " corners" << endl;
+
+    /**
+     * @test Test 2: With range noise the lines stay close and the covariance matches their spread.
+     */
+    const int trials = 400;
+    double sumAlpha = 0.0, sumR = 0.0, sumSqAlpha = 0.0, sumSqR = 0.0, sumProduct = 0.0;
+    double reportedAlpha = 0.0, reportedR = 0.0, reportedCov = 0.0;
+    int seen = 0;
+    for (int t = 0; t < trials; t++) {
+        ranges = simulate(room, 0.01, rng);
+        extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+        long index = findLine(extractor, SE2_PI / 2, 1.5);
+        if (index < 0) {
+            continue;
+        }
+        const LineFeature& line = extractor.getLine(index);
+        double a = angleDifference(line.alpha, SE2_PI / 2);
+        sumAlpha += a;
+        sumR += line.r;
+        sumSqAlpha += a * a;
+        sumSqR += line.r * line.r;
+        sumProduct += a * line.r;
+        reportedAlpha += line.varAlpha;
+        reportedR += line.varR;
+        reportedCov += line.covAlphaR;
+        seen++;
+    }
+    assert(seen > trials * 9 / 10);
+    double meanAlpha = sumAlpha / seen, meanR = sumR / seen;
+    double varAlpha = sumSqAlpha / seen - meanAlpha * meanAlpha;
+    double varR = sumSqR / seen - meanR * meanR;
+    double covAlphaR = sumProduct / seen - meanAlpha * meanR;
+    reportedAlpha /= seen;
+    reportedR /= seen;
+    reportedCov /= seen;
+    assert(fabs(meanAlpha) < 2e-3 && fabs(meanR - 1.5) < 2e-3);
+    assert(varAlpha > 0.5 * reportedAlpha && varAlpha < 2.0 * reportedAlpha);
+    assert(varR > 0.5 * reportedR && varR < 2.0 * reportedR);
+    assert(covAlphaR * reportedCov > 0.0); // Same sign
+    cout << "Side wall: var(alpha) " << varAlpha << " measured, " << reportedAlpha << " reported; var(r) "
+        << varR << " measured, " << reportedR << " reported" << endl;
+
+    /**
+     * @test Test 3: Features in a given frame match the sensor-frame features moved into that frame.
+     */
+    ranges = simulate(room, 0.0, rng);
+    extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+    vector<LineFeature> local(extractor.getLines(), extractor.getLines() + extractor.getLineCount());
+    vector<CornerFeature> localCorners(extractor.getCorners(), extractor.getCorners() + extractor.getCornerCount());
+    Transform2D frame(10.0, 5.0, degToRad(-70.0));
+    LidarScan scan;
+    scan.pose = frame.toPose();
+    scan.angleMin = ANGLE_MIN;
+    scan.angleIncrement = INCREMENT;
+    scan.rangeNumber = BEAMS;
+    for (int i = 0; i < BEAMS; i++) {
+        scan.ranges[i] = ranges[i];
+    }
+    assert(extractor.extract(scan) == local.size() && extractor.getCornerCount() == localCorners.size());
+    for (size_t i = 0; i < local.size(); i++) {
+        // A beam that hits a corner may go to either wall, so the end points may move by one beam
+        const LineFeature& line = extractor.getLine(i);
+        double x0, y0, x1, y1;
+        frame.apply(local[i].x0, local[i].y0, x0, y0);
+        frame.apply(local[i].x1, local[i].y1, x1, y1);
+        assert(hypot(line.x0 - x0, line.y0 - y0) < 0.1 && hypot(line.x1 - x1, line.y1 - y1) < 0.1);
+        double alpha = normalizeAngle(local[i].alpha + frame.getTh());
+        double r = local[i].r + frame.getX() * cos(alpha) + frame.getY() * sin(alpha);
+        if (r < 0.0) { // The normal turns to keep r positive
+            r = -r;
+            alpha = normalizeAngle(alpha + SE2_PI);
+        }
+        assert(fabs(angleDifference(line.alpha, alpha)) < 1e-4 && fabs(line.r - r) < 1e-3);
+        assert(fabs(line.x0 * cos(line.alpha) + line.y0 * sin(line.alpha) - line.r) < 1e-3);
+    }
+    for (size_t i = 0; i < localCorners.size(); i++) {
+        double x, y;
+        frame.apply(localCorners[i].x, localCorners[i].y, x, y);
+        assert(fabs(extractor.getCorner(i).x - x) < 1e-3 && fabs(extractor.getCorner(i).y - y) < 1e-3);
+    }
+
+    /**
+     * @test Test 4: Lines beyond the capacity are counted as dropped, and short pieces are not lines.
+     */
+    LineExtractor small(2);
+    assert(small.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 2 && small.getDroppedLines() == 3);
+    assert(small.getCornerCount() == 1);
+    vector<Wall> stub = { { 1.0, -0.05, 1.0, 0.05 } }; // Ten centimeters of wall
+    ranges = simulate(stub, 0.0, rng);
+    assert(extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 0);
+    assert(extractor.getSegmenter().getClusterCount() == 1);
+
+    /**
+     * @test Test 5: Extraction does not allocate once the layout is known, and takes well under a millisecond.
+     */
+    ranges = simulate(room, 0.01, rng);
+    extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+    const int scans = 5000;
+    double checksum = 0.0;
+    unsigned long before = allocations;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        ranges[s % BEAMS] += 1e-4f;
+        checksum += extractor.extract(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) + extractor.getLine(0).r;
+    }
+    double perScanUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / scans;
+    assert(allocations == before);
+    assert(perScanUs < 1000.0);
+    cout << "Extraction, " << BEAMS << " beams: " << perScanUs << " us/scan" << endl;
+    volatile double sink = checksum; // Keeps the timed loop from being optimized away
+    (void)sink;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file LockFreeQueueTest.cpp
+ * @brief Test application for the SpscQueue, MpscQueue and ObjectPool classes.
+ * @details Checks the three backpressure policies, then streams indices through both queues
+ * from several threads and verifies that nothing is lost, duplicated or reordered.
+ * @date October, 2026
+ */
+
+#include "SpscQueue.h"
+#include "MpscQueue.h"
+#include "ObjectPool.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Main function for testing the lock-free queues.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    uint32_t index, evicted;
+
+    /**
+     * @test Test 1: Capacity is rounded up to a power of two and FIFO order is kept.
+     */
+    SpscQueue fifo(5, REJECT);
+    assert(fifo.capacity() == 8);
+    for (uint32_t i = 0; i < 8; i++) {
+        assert(fifo.push(i, nullptr) == PUSH_OK);
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+        assert(fifo.pop(index) && index == i);
+    }
+    assert(!fifo.pop(index));
+
+    /**
+     * @test Test 2: REJECT refuses new items and DROP_OLDEST hands back the evicted one.
+     */
+    SpscQueue rejecting(2, REJECT);
+    rejecting.push(1, nullptr);
+    rejecting.push(2, nullptr);
+    assert(rejecting.push(3, nullptr) == PUSH_REJECTED && rejecting.getRejected() == 1);
+
+    SpscQueue dropping(2, DROP_OLDEST);
+    dropping.push(1, nullptr);
+    dropping.push(2, nullptr);
+    assert(dropping.push(3, &evicted) == PUSH_EVICTED && evicted == 1);
+    assert(dropping.pop(index) && index == 2);
+    assert(dropping.pop(index) && index == 3);
+    assert(dropping.getDropped() == 1);
+
+    MpscQueue mpscDropping(2, DROP_OLDEST);
+    mpscDropping.push(1, nullptr);
+    mpscDropping.push(2, nullptr);
+    assert(mpscDropping.push(3, &evicted) == PUSH_EVICTED && evicted == 1);
+    assert(mpscDropping.pop(index) && index == 2);
+    assert(mpscDropping.getDropped() == 1);
+    cout << "Backpressure policies behave as expected." << endl;
+
+    /**
+     * @test Test 3: The object pool hands out every object exactly once.
+     */
+    ObjectPool<int> pool(4);
+    vector<uint32_t> taken;
+    while (pool.acquire(index)) {
+        taken.push_back(index);
+    }
+    assert(taken.size() == 4 && pool.available() == 0);
+    pool.release(taken[0]);
+    assert(pool.acquire(index) && index == taken[0]);
+
+    /**
+     * @test Test 4: A blocking SPSC queue delivers one million indices in order across threads.
+     */
+    const uint32_t count = 1000000;
+    SpscQueue blocking(64, BLOCK);
+    thread producer([&blocking, count]() {
+        for (uint32_t i = 0; i < count; i++) {
+            blocking.push(i, nullptr);
+        }
+    });
+    uint32_t expected = 0;
+    while (expected < count) {
+        if (blocking.pop(index)) {
+            assert(index == expected);
+            expected++;
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+    producer.join();
+    assert(blocking.getDropped() == 0 && blocking.getPopped() == count);
+    cout << "SPSC blocking stream: " << count << " items in order." << endl;
+
+    /**
+     * @test Test 5: Under DROP_OLDEST every index is either delivered or evicted, never both.
+     */
+    SpscQueue lossy(16, DROP_OLDEST);
+    vector<unsigned char> seen(count, 0);
+    thread lossyProducer([&lossy, &seen, count]() {
+        uint32_t victim;
+        for (uint32_t i = 0; i < count; i++) {
+            if (lossy.push(i, &victim) == PUSH_EVICTED) {
+                seen[victim] += 2;
+            }
+        }
+    });
+    uint32_t last = 0;
+    bool first = true;
+    unsigned long delivered = 0;
+    while (true) {
+        if (lossy.pop(index)) {
+            assert(first || index > last);
+            first = false;
+            last = index;
+            seen[index] += 1;
+            delivered++;
+            if (index == count - 1) {
+                break;
+            }
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+    lossyProducer.join();
+    while (lossy.pop(index)) {
+        seen[index] += 1;
+        delivered++;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        assert(seen[i] == 1 || seen[i] == 2);
+    }
+    assert(delivered + lossy.getDropped() == count);
+    cout << "SPSC drop-oldest stream: delivered=" << delivered << ", dropped=" << lossy.getDropped() << endl;
+
+    /**
+     * @test Test 6: Four producers feed one MPSC consumer without losing an item.
+     */
+    const int producers = 4;
+    const uint32_t perProducer = 250000;
+    MpscQueue shared(128, BLOCK);
+    vector<thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.push_back(thread([&shared, p, perProducer]() {
+            for (uint32_t i = 0; i < perProducer; i++) {
+                shared.push(p * perProducer + i, nullptr);
+            }
+        }));
+    }
+    vector<uint32_t> lastPerProducer(producers, 0);
+    vector<bool> started(producers, false);
+    uint32_t received = 0;
+    while (received < producers * perProducer) {
+        if (shared.pop(index)) {
+            uint32_t p = index / perProducer;
+            assert(!started[p] || index > lastPerProducer[p]); // Per-producer order is kept
+            started[p] = true;
+            lastPerProducer[p] = index;
+            received++;
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    assert(shared.getPushed() == producers * perProducer && shared.size() == 0);
+    cout << "MPSC stream: " << received << " items from " << producers << " producers." << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,409 @@
+/**
+ * @file LogArchiver.cpp
+ * @brief Implementation of the LogArchiver class.
+ * @date October 2026
+ */
+
+#include "LogArchiver.h"
+#include "LogCompression.h"
+#include "TelemetryIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+/** @brief Extension of compressed segments. */
+static const char* const COMPRESSED_SUFFIX = ".tlz";
+
+/**
+ * @brief Returns the size of a file.
+ * @param name Name of the file.
+ * @return The size in bytes, or -1 if the file cannot be opened.
+ */
+static long long fileSize(const string& name) {
+    ifstream in(name, ios::binary | ios::ate);
+    return in.is_open() ? static_cast<long long>(in.tellg()) : -1;
+}
+
+/**
+ * @brief Renames a file, replacing the target if it exists.
+ * @param from Current name.
+ * @param to New name.
+ * @return True on success.
+ */
+static bool replaceFile(const string& from, const string& to) {
+#ifdef _WIN32
+    remove(to.c_str()); // rename() does not replace an existing file on Windows
+#endif
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
+/**
+ * @brief Orders segments by sequence number.
+ * @param a First segment.
+ * @param b Second segment.
+ * @return True if a comes before b.
+ */
+static bool earlierSegment(const SegmentInfo& a, const SegmentInfo& b) {
+    return a.sequence < b.sequence;
+}
+
+/**
+ * @brief Returns the name of a closed segment of a log.
+ * @param logName Name of the active log.
+ * @param sequence Number of the segment.
+ * @return The segment name.
+ */
+string logSegmentName(const string& logName, unsigned long sequence) {
+    ostringstream name;
+    name << logName << '.' << setw(6) << setfill('0') << sequence;
+    return name.str();
+}
+
+/**
+ * @brief Constructor for the LogArchiver class.
+ */
+LogArchiver::LogArchiver() : activeBytes(0), running(false), busy(false), nextSequence(1), stats() {
+    policy = RotationPolicy();
+}
+
+/**
+ * @brief Destructor for the LogArchiver class. Finishes queued work.
+ */
+LogArchiver::~LogArchiver() {
+    stop();
+}
+
+/**
+ * @brief Starts managing the segments of a log.
+ * @param logName Name of the active log.
+ * @param rotation Rotation and retention limits.
+ * @return True on success.
+ */
+bool LogArchiver::start(const string& logName, const RotationPolicy& rotation) {
+    stop();
+    if (logName.empty()) {
+        cerr << "Error: The log name cannot be empty." << endl;
+        return false;
+    }
+    baseName = logName;
+    policy = rotation;
+    queue.clear();
+    segments.clear();
+    nextSequence = 1;
+    stats = ArchiveStats();
+    loadManifest();
+
+    long long size = fileSize(baseName);
+    activeBytes = size > 0 ? static_cast<uint64_t>(size) : 0;
+    activeStarted = chrono::steady_clock::now();
+
+    vector<SegmentInfo> expired;
+    vector<SegmentInfo> kept;
+    {
+        lock_guard<mutex> lock(stateMutex);
+        applyRetention(expired);
+        kept = segments;
+        running = true;
+        busy = false;
+    }
+    deleteSegments(expired);
+    saveManifest(kept);
+    worker = thread(&LogArchiver::run, this);
+    return true;
+}
+
+/**
+ * @brief Finishes queued work and stops the background thread.
+ */
+void LogArchiver::stop() {
+    {
+        lock_guard<mutex> lock(stateMutex);
+        running = false;
+    }
+    queueChanged.notify_all();
+    if (worker.joinable()) {
+        worker.join(); // The worker empties the queue before it exits
+    }
+}
+
+/**
+ * @brief Checks whether the archiver is running.
+ * @return True between start() and stop().
+ */
+bool LogArchiver::isRunning() const {
+    lock_guard<mutex> lock(stateMutex);
+    return running;
+}
+
+/**
+ * @brief Adds bytes written to the active segment.
+ * @param bytes Number of bytes just written.
+ * @return True if the writer should rotate now.
+ */
+bool LogArchiver::addBytes(uint64_t bytes) {
+    activeBytes += bytes;
+    if (activeBytes == 0) {
+        return false;
+    }
+    if (policy.segmentBytes > 0 && activeBytes >= policy.segmentBytes) {
+        return true;
+    }
+    return policy.segmentSeconds > 0.0
+        && chrono::duration<double>(chrono::steady_clock::now() - activeStarted).count() >= policy.segmentSeconds;
+}
+
+/**
+ * @brief Turns the closed active log into the next segment and queues it.
+ * @return True on success.
+ */
+bool LogArchiver::archive() {
+    auto started = chrono::steady_clock::now();
+    SegmentInfo segment;
+    {
+        lock_guard<mutex> lock(stateMutex);
+        if (!running) {
+            return false;
+        }
+        segment.sequence = nextSequence++;
+    }
+    segment.name = logSegmentName(baseName, segment.sequence);
+    if (!replaceFile(baseName, segment.name)) {
+        cerr << "Error: Failed to rotate log segment: " << baseName << endl;
+        return false;
+    }
+    replaceFile(telemetryIndexName(baseName), telemetryIndexName(segment.name)); // Text logs have no index
+    segment.closedTime = static_cast<long long>(time(nullptr));
+    segment.bytes = activeBytes;
+    segment.compressed = false;
+    activeBytes = 0;
+    activeStarted = chrono::steady_clock::now();
+
+    double elapsed = chrono::duration<double, micro>(activeStarted - started).count();
+    {
+        lock_guard<mutex> lock(stateMutex);
+        queue.push_back(segment);
+        stats.rotations++;
+        stats.longestRotationUs = elapsed > stats.longestRotationUs ? elapsed : stats.longestRotationUs;
+    }
+    queueChanged.notify_one();
+    return true;
+}
+
+/**
+ * @brief Blocks until every queued segment has been processed.
+ */
+void LogArchiver::waitIdle() {
+    unique_lock<mutex> lock(stateMutex);
+    queueDrained.wait(lock, [this]() { return (queue.empty() && !busy) || !worker.joinable(); });
+}
+
+/**
+ * @brief Returns the closed segments that have been processed, oldest first.
+ * @return The segments.
+ */
+vector<SegmentInfo> LogArchiver::getSegments() const {
+    lock_guard<mutex> lock(stateMutex);
+    return segments;
+}
+
+/**
+ * @brief Returns the counters since start().
+ * @return The counters.
+ */
+ArchiveStats LogArchiver::getStats() const {
+    lock_guard<mutex> lock(stateMutex);
+    return stats;
+}
+
+/**
+ * @brief Worker thread: processes queued segments until stopped and drained.
+ */
+void LogArchiver::run() {
+    unique_lock<mutex> lock(stateMutex);
+    while (true) {
+        queueChanged.wait(lock, [this]() { return !queue.empty() || !running; });
+        if (queue.empty()) {
+            break;
+        }
+        SegmentInfo segment = queue.front();
+        busy = true;
+        lock.unlock();
+        process(segment);
+        lock.lock();
+        queue.pop_front();
+        busy = false;
+        if (queue.empty()) {
+            queueDrained.notify_all();
+        }
+    }
+    queueDrained.notify_all();
+}
+
+/**
+ * @brief Compresses a closed segment if the policy says so and adds it to the archive.
+ * @param segment The segment.
+ */
+void LogArchiver::process(SegmentInfo segment) {
+    long long rawSize = fileSize(segment.name);
+    if (rawSize < 0) {
+        cerr << "Warning: Log segment disappeared: " << segment.name << endl;
+        return;
+    }
+    segment.bytes = static_cast<uint64_t>(rawSize);
+    bool packed = false;
+    if (policy.compress && !segment.compressed) {
+        // Compress to a temporary name so a crash never leaves a partial segment behind
+        string packedName = segment.name + COMPRESSED_SUFFIX;
+        string temporary = packedName + ".tmp";
+        if (compressLogFile(segment.name, temporary) && replaceFile(temporary, packedName)) {
+            remove(segment.name.c_str());
+            remove(telemetryIndexName(segment.name).c_str());
+            segment.name = packedName;
+            segment.compressed = true;
+            segment.bytes = static_cast<uint64_t>(fileSize(packedName));
+            packed = true;
+        }
+        else {
+            remove(temporary.c_str()); // Keep the segment uncompressed
+        }
+    }
+
+    vector<SegmentInfo> expired;
+    vector<SegmentInfo> kept;
+    {
+        lock_guard<mutex> lock(stateMutex);
+        if (packed) {
+            stats.compressed++;
+            stats.rawBytes += static_cast<uint64_t>(rawSize);
+            stats.storedBytes += segment.bytes;
+        }
+        segments.insert(upper_bound(segments.begin(), segments.end(), segment, earlierSegment), segment);
+        applyRetention(expired);
+        kept = segments;
+    }
+    deleteSegments(expired);
+    saveManifest(kept);
+}
+
+/**
+ * @brief Removes the oldest segments that the retention policy no longer allows from the list.
+ * @param expired Receives the removed segments.
+ */
+void LogArchiver::applyRetention(vector<SegmentInfo>& expired) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < segments.size(); i++) {
+        total += segments[i].bytes;
+    }
+    time_t now = time(nullptr);
+    size_t removed = 0;
+    while (segments.size() - removed > 1) {
+        const SegmentInfo& oldest = segments[removed];
+        bool tooOld = policy.keepSeconds > 0.0
+            && difftime(now, static_cast<time_t>(oldest.closedTime)) > policy.keepSeconds;
+        bool tooLarge = policy.keepBytes > 0 && total > policy.keepBytes;
+        if (!tooOld && !tooLarge) {
+            break;
+        }
+        total -= oldest.bytes;
+        expired.push_back(oldest);
+        removed++;
+    }
+    segments.erase(segments.begin(), segments.begin() + static_cast<ptrdiff_t>(removed));
+    stats.deleted += static_cast<unsigned long>(removed);
+}
+
+/**
+ * @brief Deletes the files of segments.
+ * @param expired The segments.
+ */
+void LogArchiver::deleteSegments(const vector<SegmentInfo>& expired) {
+    for (size_t i = 0; i < expired.size(); i++) {
+        if (remove(expired[i].name.c_str()) != 0) {
+            cerr << "Warning: Failed to delete log segment: " << expired[i].name << endl;
+        }
+        if (!expired[i].compressed) {
+            remove(telemetryIndexName(expired[i].name).c_str());
+        }
+    }
+}
+
+/**
+ * @brief Reads the manifest of an earlier run and adopts the segments that follow the last one it lists.
+ */
+void LogArchiver::loadManifest() {
+    ifstream manifest(baseName + ".segments");
+    string line;
+    while (getline(manifest, line)) {
+        istringstream fields(line);
+        SegmentInfo segment;
+        int compressed = 0;
+        if (!(fields >> segment.sequence >> segment.closedTime >> segment.bytes >> compressed)
+            || !getline(fields >> ws, segment.name)) {
+            continue;
+        }
+        segment.compressed = compressed != 0;
+        if (fileSize(segment.name) < 0) {
+            continue; // Deleted by hand
+        }
+        nextSequence = segment.sequence >= nextSequence ? segment.sequence + 1 : nextSequence;
+        if (policy.compress && !segment.compressed) {
+            queue.push_back(segment); // Closed but not compressed before the last run ended
+        }
+        else {
+            segments.push_back(segment);
+        }
+    }
+
+    // A run may have closed segments and stopped before recording them
+    while (true) {
+        SegmentInfo segment;
+        segment.sequence = nextSequence;
+        segment.name = logSegmentName(baseName, nextSequence);
+        segment.compressed = false;
+        long long size = fileSize(segment.name);
+        if (size < 0) {
+            segment.name += COMPRESSED_SUFFIX;
+            segment.compressed = true;
+            size = fileSize(segment.name);
+        }
+        if (size < 0) {
+            break;
+        }
+        segment.bytes = static_cast<uint64_t>(size);
+        segment.closedTime = static_cast<long long>(time(nullptr));
+        nextSequence++;
+        if (policy.compress && !segment.compressed) {
+            queue.push_back(segment);
+        }
+        else {
+            segments.push_back(segment);
+        }
+    }
+    sort(segments.begin(), segments.end(), earlierSegment);
+}
+
+/**
+ * @brief Replaces the manifest.
+ * @param list The segments to record.
+ * @return True on success.
+ */
+bool LogArchiver::saveManifest(const vector<SegmentInfo>& list) const {
+    string name = baseName + ".segments";
+    string temporary = name + ".tmp";
+    ofstream out(temporary, ios::trunc);
+    for (size_t i = 0; i < list.size(); i++) {
+        out << list[i].sequence << ' ' << list[i].closedTime << ' ' << list[i].bytes << ' '
+            << (list[i].compressed ? 1 : 0) << ' ' << list[i].name << '\n';
+    }
+    out.close();
+    if (out.fail() || !replaceFile(temporary, name)) {
+        cerr << "Error: Failed to write the segment manifest: " << name << endl;
+        remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file LogArchiver.h
+ * @brief Declaration of the LogArchiver class, which rotates, compresses and expires log segments.
+ * @date October 2026
+ */
+
+#ifndef LOGARCHIVER_H
+#define LOGARCHIVER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct RotationPolicy
+ * @brief When to close the active log segment and how long to keep closed ones. Zero disables a limit.
+ */
+struct RotationPolicy {
+    uint64_t segmentBytes;   /**< Rotate once the active segment reaches this size. */
+    double segmentSeconds;   /**< Rotate once the active segment has been open this long. */
+    bool compress;           /**< Compress closed segments (see LogCompression.h). */
+    uint64_t keepBytes;      /**< Delete the oldest segments while the archive is larger than this. */
+    double keepSeconds;      /**< Delete segments closed longer ago than this. */
+};
+
+/**
+ * @struct SegmentInfo
+ * @brief A closed log segment.
+ */
+struct SegmentInfo {
+    unsigned long sequence;  /**< Number of the segment; later segments have larger numbers. */
+    long long closedTime;    /**< When the segment was closed, in seconds since the epoch. */
+    uint64_t bytes;          /**< Size of the segment file. */
+    bool compressed;         /**< True if the file is compressed. */
+    std::string name;        /**< Name of the segment file. */
+};
+
+/**
+ * @struct ArchiveStats
+ * @brief Counters of a LogArchiver since start().
+ */
+struct ArchiveStats {
+    unsigned long rotations; /**< Segments closed. */
+    unsigned long compressed; /**< Segments compressed. */
+    unsigned long deleted;   /**< Segments deleted by the retention policy. */
+    uint64_t rawBytes;       /**< Size of the compressed segments before compression. */
+    uint64_t storedBytes;    /**< Size of the compressed segments after compression. */
+    double longestRotationUs; /**< Longest archive() call, in microseconds. */
+};
+
+/**
+ * @brief Returns the name of a closed segment of a log.
+ * @param logName Name of the active log.
+ * @param sequence Number of the segment.
+ * @return logName followed by the zero-padded sequence number, e.g. "run.tlog.000042".
+ */
+std::string logSegmentName(const std::string& logName, unsigned long sequence);
+
+/**
+ * @class LogArchiver
+ * @brief Closes the active segment of a log when it grows too large or too old, and manages closed segments.
+ *
+ * The writer of the log stays in charge of its file: it reports the bytes it writes with
+ * addBytes() and, when told to rotate, closes the file, calls archive() and opens the log
+ * name again. archive() only renames the file (and its time index) to the next segment name
+ * and queues it, so rotation costs the writer a close, two renames and an open. A background
+ * thread compresses queued segments, applies the retention policy and keeps a manifest of the
+ * closed segments next to the log (logName + ".segments"), from which start() picks up the
+ * archive of an earlier run. The newest closed segment is never deleted by retention.
+ */
+class LogArchiver {
+private:
+    std::string baseName;                /**< Name of the active log. */
+    RotationPolicy policy;               /**< Rotation and retention limits. */
+    uint64_t activeBytes;                /**< Size of the active segment (writer thread only). */
+    std::chrono::steady_clock::time_point activeStarted; /**< When the active segment was opened (writer thread only). */
+
+    std::thread worker;                  /**< Compresses and expires closed segments. */
+    mutable std::mutex stateMutex;       /**< Guards everything below. */
+    std::condition_variable queueChanged; /**< Signals new work or stop(). */
+    std::condition_variable queueDrained; /**< Signals that the queue became empty. */
+    bool running;                        /**< True between start() and stop(). */
+    bool busy;                           /**< True while the worker processes a segment. */
+    std::deque<SegmentInfo> queue;       /**< Closed segments not yet processed. */
+    std::vector<SegmentInfo> segments;   /**< Processed segments, oldest first. */
+    unsigned long nextSequence;          /**< Number of the next segment. */
+    ArchiveStats stats;                  /**< Counters. */
+
+    /**
+     * @brief Worker thread: processes queued segments until stopped and drained.
+     */
+    void run();
+
+    /**
+     * @brief Compresses a closed segment if the policy says so and adds it to the archive.
+     * @param segment The segment.
+     */
+    void process(SegmentInfo segment);
+
+    /**
+     * @brief Removes the oldest segments that the retention policy no longer allows from the list.
+     * Caller holds stateMutex and deletes the files after releasing it.
+     * @param expired Receives the removed segments.
+     */
+    void applyRetention(std::vector<SegmentInfo>& expired);
+
+    /**
+     * @brief Deletes the files of segments.
+     * @param expired The segments.
+     */
+    static void deleteSegments(const std::vector<SegmentInfo>& expired);
+
+    /**
+     * @brief Reads the manifest of an earlier run and adopts the segments that follow the last one it lists.
+     */
+    void loadManifest();
+
+    /**
+     * @brief Replaces the manifest (worker thread or start() only).
+     * @param list The segments to record.
+     * @return True on success.
+     */
+    bool saveManifest(const std::vector<SegmentInfo>& list) const;
+
+public:
+    /**
+     * @brief Constructor for the LogArchiver class.
+     */
+    LogArchiver();
+
+    /**
+     * @brief Destructor for the LogArchiver class. Finishes queued work.
+     */
+    ~LogArchiver();
+
+    LogArchiver(const LogArchiver&) = delete;
+    LogArchiver& operator=(const LogArchiver&) = delete;
+
+    /**
+     * @brief Starts managing the segments of a log. Call before the writer opens the log.
+     * @param logName Name of the active log.
+     * @param rotation Rotation and retention limits.
+     * @return True on success.
+     */
+    bool start(const std::string& logName, const RotationPolicy& rotation);
+
+    /**
+     * @brief Finishes queued work and stops the background thread.
+     */
+    void stop();
+
+    /**
+     * @brief Checks whether the archiver is running.
+     * @return True between start() and stop().
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Adds bytes written to the active segment. Called by the thread that writes the log.
+     * @param bytes Number of bytes just written.
+     * @return True if the writer should rotate now.
+     */
+    bool addBytes(uint64_t bytes);
+
+    /**
+     * @brief Turns the closed active log into the next segment and queues it for the background thread.
+     * The writer must have closed the log and opens it again afterwards.
+     * @return True on success; on failure the writer keeps appending to the same file.
+     */
+    bool archive();
+
+    /**
+     * @brief Blocks until every queued segment has been processed.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Returns the closed segments that have been processed, oldest first.
+     * @return The segments.
+     */
+    std::vector<SegmentInfo> getSegments() const;
+
+    /**
+     * @brief Returns the counters since start().
+     * @return The counters.
+     */
+    ArchiveStats getStats() const;
+};
+
+#endif // LOGARCHIVER_H
@@ -0,0 +1,296 @@
+/**
+ * @file LogArchiverTest.cpp
+ * @brief Test application for the LogArchiver class and log rotation in the writers and Record.
+ * @details Rotates logs by size and by age with the synchronous and the asynchronous writer,
+ * checks that no record is lost across segments, compresses closed segments, applies both
+ * retention limits, continues the archive of an earlier run and rotates a text log.
+ * @date October, 2026
+ */
+
+#include "LogArchiver.h"
+#include "LogCompression.h"
+#include "TelemetryWriter.h"
+#include "TelemetryReader.h"
+#include "AsyncLogWriter.h"
+#include "Record.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Removes a log, its index, its manifest and its first segments.
+ * @param logName Name of the log.
+ */
+void removeLog(const string& logName) {
+    remove(logName.c_str());
+    remove(telemetryIndexName(logName).c_str());
+    remove((logName + ".segments").c_str());
+    for (unsigned long i = 1; i <= 200; i++) {
+        string segment = logSegmentName(logName, i);
+        remove(segment.c_str());
+        remove(telemetryIndexName(segment).c_str());
+        remove((segment + ".tlz").c_str());
+    }
+}
+
+/**
+ * @brief Reads the pose records of a log, decompressing it first if needed.
+ * @param name Name of the log or compressed segment.
+ * @param compressed True if the file is compressed.
+ * @param xs Receives the x values of the poses in file order.
+ */
+void readPoses(const string& name, bool compressed, vector<double>& xs) {
+    string plain = name;
+    if (compressed) {
+        plain = name + ".restored";
+        assert(decompressLogFile(name, plain));
+    }
+    TelemetryReader reader;
+    assert(reader.open(plain));
+    RecordView view;
+    while (reader.next(view)) {
+        if (view.type == RECORD_POSE) {
+            xs.push_back(view.as<PoseRecord>()->x);
+        }
+    }
+    reader.close();
+    if (compressed) {
+        remove(plain.c_str());
+    }
+}
+
+/**
+ * @brief Reads the poses of every closed segment and then of the active log.
+ * @param archiver The archiver of the log.
+ * @param logName Name of the active log.
+ * @return The x values of all poses in order.
+ */
+vector<double> readAllPoses(const LogArchiver& archiver, const string& logName) {
+    vector<double> xs;
+    vector<SegmentInfo> segments = archiver.getSegments();
+    for (size_t i = 0; i < segments.size(); i++) {
+        readPoses(segments[i].name, segments[i].compressed, xs);
+    }
+    readPoses(logName, false, xs);
+    return xs;
+}
+
+/**
+ * @brief Writes poses with scans in between, so a segment holds a realistic mix.
+ * @param writer The open writer.
+ * @param first Number of the first pose.
+ * @param count Number of poses.
+ */
+void writePoses(TelemetryWriter& writer, int first, int count) {
+    LidarScanRecord fixed = { 0.0, 0.0, 0.0, -120.0f, 0.36f, 667, 0 };
+    float ranges[667];
+    for (int i = 0; i < 667; i++) {
+        ranges[i] = 2.0f + (i % 50) * 0.01f;
+    }
+    for (int p = first; p < first + count; p++) {
+        PoseRecord pose = { static_cast<double>(p), 0.0, 0.0 };
+        assert(writer.append(RECORD_POSE, p * 0.1, &pose, sizeof(pose)));
+        assert(writer.append(RECORD_LIDAR_SCAN, p * 0.1, &fixed, sizeof(fixed), ranges, sizeof(ranges)));
+    }
+}
+
+/**
+ * @brief Checks that a list holds 0, 1, ..., count - 1.
+ * @param xs The list.
+ * @param count Expected length.
+ */
+void assertSequence(const vector<double>& xs, int count) {
+    assert(static_cast<int>(xs.size()) == count);
+    for (int i = 0; i < count; i++) {
+        assert(xs[i] == i);
+    }
+}
+
+/**
+ * @brief Main function for testing log rotation.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const string logName = "archiver_test.tlog";
+    removeLog(logName);
+
+    /**
+     * @test Test 1: Size-based rotation splits the log into segments without losing a record.
+     */
+    RotationPolicy policy = { 256 * 1024, 0.0, false, 0, 0.0 };
+    LogArchiver archiver;
+    assert(archiver.start(logName, policy));
+    TelemetryWriter writer;
+    writer.setArchiver(&archiver);
+    assert(writer.setFlushThresholds(32 * 1024, 10.0));
+    assert(writer.open(logName));
+    writePoses(writer, 0, 1000);
+    assert(writer.close());
+    archiver.waitIdle();
+    vector<SegmentInfo> segments = archiver.getSegments();
+    ArchiveStats stats = archiver.getStats();
+    assert(segments.size() >= 9 && stats.rotations == segments.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        assert(segments[i].sequence == i + 1 && segments[i].name == logSegmentName(logName, i + 1));
+        assert(!segments[i].compressed && segments[i].bytes >= 256 * 1024 && segments[i].bytes < 300 * 1024);
+    }
+    assertSequence(readAllPoses(archiver, logName), 1000);
+    TelemetryReader reader;
+    TelemetryIndex index;
+    assert(reader.open(segments[3].name));
+    assert(index.load(reader, segments[3].name) && !index.wasRebuilt()); // The index moved with the segment
+    reader.close();
+    cout << "Rotated into " << segments.size() << " segments, longest rotation " << stats.longestRotationUs
+        << " us" << endl;
+
+    /**
+     * @test Test 2: A restarted archiver continues the numbering and compresses what it is given.
+     */
+    archiver.stop();
+    policy.compress = true;
+    assert(archiver.start(logName, policy));
+    archiver.waitIdle(); // Segments of the first run are compressed now
+    segments = archiver.getSegments();
+    assert(archiver.getStats().compressed == segments.size());
+    assert(writer.open(logName));
+    writePoses(writer, 1000, 500);
+    assert(writer.close());
+    archiver.waitIdle();
+    segments = archiver.getSegments();
+    stats = archiver.getStats();
+    assert(segments.back().sequence == segments.size() && segments.size() >= 13);
+    for (size_t i = 0; i < segments.size(); i++) {
+        assert(segments[i].compressed && segments[i].name == logSegmentName(logName, i + 1) + ".tlz");
+        ifstream raw(logSegmentName(logName, i + 1));
+        assert(!raw.is_open());
+    }
+    assertSequence(readAllPoses(archiver, logName), 1500);
+    cout << "Compressed " << stats.compressed << " segments from " << stats.rawBytes << " to " << stats.storedBytes
+        << " bytes" << endl;
+
+    /**
+     * @test Test 3: Size retention deletes the oldest segments and keeps the manifest in step.
+     */
+    archiver.stop();
+    uint64_t total = 0;
+    for (size_t i = 0; i < segments.size(); i++) {
+        total += segments[i].bytes;
+    }
+    policy.keepBytes = total / 2;
+    assert(archiver.start(logName, policy));
+    vector<SegmentInfo> kept = archiver.getSegments();
+    total = 0;
+    for (size_t i = 0; i < kept.size(); i++) {
+        total += kept[i].bytes;
+    }
+    assert(total <= policy.keepBytes && kept.size() < segments.size() && kept.back().sequence == segments.back().sequence);
+    assert(archiver.getStats().deleted == segments.size() - kept.size());
+    ifstream oldest(segments[0].name);
+    assert(!oldest.is_open());
+    archiver.stop();
+    assert(archiver.start(logName, policy) && archiver.getSegments().size() == kept.size());
+
+    /**
+     * @test Test 4: Age retention deletes segments closed too long ago, except the newest.
+     */
+    archiver.stop();
+    policy.keepBytes = 0;
+    policy.keepSeconds = 1.0;
+    this_thread::sleep_for(chrono::milliseconds(2100));
+    assert(archiver.start(logName, policy));
+    assert(archiver.getSegments().size() == 1);
+    assert(writer.open(logName));
+    writePoses(writer, 1500, 200); // Closes new segments; the old newest one expires now
+    assert(writer.close());
+    archiver.waitIdle();
+    segments = archiver.getSegments();
+    assert(segments.front().sequence > kept.back().sequence);
+    archiver.stop();
+    removeLog(logName);
+
+    /**
+     * @test Test 5: Time-based rotation in the asynchronous writer never makes producers wait.
+     */
+    policy = { 0, 0.15, true, 0, 0.0 };
+    assert(archiver.start(logName, policy));
+    AsyncLogWriter asyncWriter;
+    asyncWriter.configure(1 << 20, 16 * 1024, 0.01);
+    asyncWriter.setArchiver(&archiver);
+    assert(asyncWriter.open(logName, false));
+    double slowestAppendUs = 0.0;
+    const int poses = 8000;
+    for (int p = 0; p < poses; p++) {
+        PoseRecord pose = { static_cast<double>(p), 0.0, 0.0 };
+        auto start = chrono::steady_clock::now();
+        while (!asyncWriter.append(RECORD_POSE, p * 0.0001, &pose, sizeof(pose))) {
+            this_thread::yield();
+        }
+        double us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        slowestAppendUs = us > slowestAppendUs ? us : slowestAppendUs;
+        if (p % 100 == 0) {
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+    }
+    assert(asyncWriter.close());
+    archiver.waitIdle();
+    stats = archiver.getStats();
+    assert(stats.rotations >= 3 && asyncWriter.getStats().droppedRecords == 0);
+    assertSequence(readAllPoses(archiver, logName), poses);
+    cout << "Async log rotated " << stats.rotations << " times, slowest append " << slowestAppendUs << " us"
+        << endl;
+    archiver.stop();
+    removeLog(logName);
+
+    /**
+     * @test Test 6: Record rotates text and binary files with its policy.
+     */
+    const string textName = "archiver_test.txt";
+    removeLog(textName);
+    Record record;
+    record.setFileName(textName);
+    RotationPolicy textPolicy = { 1000, 0.0, false, 0, 0.0 };
+    record.setRotation(textPolicy);
+    for (int i = 0; i < 300; i++) {
+        assert(record.writeLine("line " + to_string(i)));
+    }
+    assert(record.closeFile());
+    segments = record.getSegments();
+    assert(segments.size() >= 2);
+    int lines = 0;
+    for (size_t i = 0; i <= segments.size(); i++) {
+        ifstream in(i < segments.size() ? segments[i].name : textName);
+        string line;
+        while (getline(in, line)) {
+            assert(line == "line " + to_string(lines));
+            lines++;
+        }
+    }
+    assert(lines == 300);
+    removeLog(textName);
+
+    record.setFileName(logName);
+    policy = { 2 << 20, 0.0, true, 0, 0.0 }; // Rotates every third chunk of the default size
+    record.setRotation(policy);
+    assert(record.openBinary());
+    for (int p = 0; p < 3000; p++) {
+        assert(record.writePose(p * 0.1, Pose(p, 0.0, 0.0)));
+        LidarScan scan;
+        scan.rangeNumber = 667;
+        for (int i = 0; i < 667; i++) {
+            scan.ranges[i] = 3.0f;
+        }
+        assert(record.writeScan(scan));
+    }
+    assert(record.closeFile());
+    segments = record.getSegments();
+    assert(segments.size() == 2 && segments[0].compressed && segments[1].compressed);
+    removeLog(logName);
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
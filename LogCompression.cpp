@@ -0,0 +1,374 @@
+/**
+ * @file LogCompression.cpp
+ * @brief Implementation of the LZ block codec and the compressed file format.
+ * @date October 2026
+ */
+
+#include "LogCompression.h"
+#include "TelemetryLog.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+using namespace std;
+
+/** @brief Shortest match the codec encodes. */
+static const size_t MIN_MATCH = 4;
+
+/** @brief Bytes at the end of a block that are always literals. */
+static const size_t LAST_LITERALS = 5;
+
+/** @brief No match starts in this many bytes at the end of a block. */
+static const size_t MATCH_SEARCH_END = 12;
+
+/** @brief Largest match offset (2-byte field). */
+static const size_t MAX_OFFSET = 65535;
+
+/** @brief Bits of the match finder hash. */
+static const int HASH_BITS = 14;
+
+/**
+ * @brief Reads 4 bytes at any alignment.
+ * @param data The bytes.
+ * @return The value.
+ */
+static inline uint32_t read32(const uint8_t* data) {
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Hashes 4 bytes into the match finder table.
+ * @param value The bytes.
+ * @return The table slot.
+ */
+static inline uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief Writes the extra length bytes of a length that did not fit its nibble.
+ * @param out Output position.
+ * @param end End of the output buffer.
+ * @param length The length, at least 15.
+ * @return The new output position, or nullptr if the buffer is full.
+ */
+static uint8_t* writeLength(uint8_t* out, const uint8_t* end, size_t length) {
+    length -= 15;
+    while (length >= 255) {
+        if (out == end) {
+            return nullptr;
+        }
+        *out++ = 255;
+        length -= 255;
+    }
+    if (out == end) {
+        return nullptr;
+    }
+    *out++ = static_cast<uint8_t>(length);
+    return out;
+}
+
+/**
+ * @brief Writes one sequence: literals followed by a match.
+ * @param out Output position.
+ * @param end End of the output buffer.
+ * @param literals The literal bytes.
+ * @param literalCount Number of literal bytes.
+ * @param offset Distance back to the match.
+ * @param matchLength Length of the match, or 0 for the last sequence.
+ * @return The new output position, or nullptr if the buffer is full.
+ */
+static uint8_t* writeSequence(uint8_t* out, const uint8_t* end, const uint8_t* literals, size_t literalCount,
+    size_t offset, size_t matchLength) {
+    if (out == end) {
+        return nullptr;
+    }
+    uint8_t* token = out++;
+    *token = static_cast<uint8_t>((literalCount >= 15 ? 15 : literalCount) << 4);
+    if (literalCount >= 15 && !(out = writeLength(out, end, literalCount))) {
+        return nullptr;
+    }
+    if (static_cast<size_t>(end - out) < literalCount) {
+        return nullptr;
+    }
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+    if (matchLength == 0) {
+        return out;
+    }
+    if (end - out < 2) {
+        return nullptr;
+    }
+    *out++ = static_cast<uint8_t>(offset & 0xFF);
+    *out++ = static_cast<uint8_t>(offset >> 8);
+    size_t code = matchLength - MIN_MATCH;
+    *token |= static_cast<uint8_t>(code >= 15 ? 15 : code);
+    if (code >= 15 && !(out = writeLength(out, end, code))) {
+        return nullptr;
+    }
+    return out;
+}
+
+/**
+ * @brief Reads the extra length bytes of a length whose nibble was 15.
+ * @param in Input position, advanced past the bytes.
+ * @param end End of the input.
+ * @param length The length, increased by the bytes.
+ * @return False if the input ends early or the length is implausible.
+ */
+static bool readLength(const uint8_t*& in, const uint8_t* end, size_t& length) {
+    uint8_t byte;
+    do {
+        if (in == end) {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    } while (byte == 255 && length < (static_cast<size_t>(1) << 40));
+    return byte != 255;
+}
+
+/**
+ * @brief Compresses a block.
+ * @param source The bytes.
+ * @param size Number of bytes.
+ * @param target Receives the compressed block.
+ * @param capacity Size of target.
+ * @return The compressed size, or 0 if target is too small.
+ */
+size_t lzCompress(const uint8_t* source, size_t size, uint8_t* target, size_t capacity) {
+    uint8_t* out = target;
+    const uint8_t* end = target + capacity;
+    size_t anchor = 0;
+    if (size > MATCH_SEARCH_END) {
+        vector<uint32_t> table(static_cast<size_t>(1) << HASH_BITS, 0);
+        const size_t searchEnd = size - MATCH_SEARCH_END;
+        const size_t matchEnd = size - LAST_LITERALS;
+        size_t position = 0;
+        while (position < searchEnd) {
+            uint32_t value = read32(source + position);
+            uint32_t slot = hash32(value);
+            size_t candidate = table[slot];
+            table[slot] = static_cast<uint32_t>(position);
+            if (candidate < position && position - candidate <= MAX_OFFSET && read32(source + candidate) == value) {
+                size_t length = MIN_MATCH;
+                while (position + length < matchEnd && source[candidate + length] == source[position + length]) {
+                    length++;
+                }
+                while (position > anchor && candidate > 0 && source[position - 1] == source[candidate - 1]) {
+                    position--;
+                    candidate--;
+                    length++;
+                }
+                out = writeSequence(out, end, source + anchor, position - anchor, position - candidate, length);
+                if (!out) {
+                    return 0;
+                }
+                position += length;
+                anchor = position;
+                if (position - 2 < searchEnd) {
+                    table[hash32(read32(source + position - 2))] = static_cast<uint32_t>(position - 2);
+                }
+            }
+            else {
+                // Step faster through data that does not compress
+                position += 1 + ((position - anchor) >> 6);
+            }
+        }
+    }
+    out = writeSequence(out, end, source + anchor, size - anchor, 0, 0);
+    return out ? static_cast<size_t>(out - target) : 0;
+}
+
+/**
+ * @brief Decompresses a block.
+ * @param source The compressed block.
+ * @param size Size of the compressed block.
+ * @param target Receives the bytes.
+ * @param rawSize Exact uncompressed size.
+ * @return True if the block is valid and decompresses to exactly rawSize bytes.
+ */
+bool lzDecompress(const uint8_t* source, size_t size, uint8_t* target, size_t rawSize) {
+    const uint8_t* in = source;
+    const uint8_t* inEnd = source + size;
+    uint8_t* out = target;
+    uint8_t* outEnd = target + rawSize;
+    while (in < inEnd) {
+        unsigned token = *in++;
+        size_t literals = token >> 4;
+        if (literals == 15 && !readLength(in, inEnd, literals)) {
+            return false;
+        }
+        if (static_cast<size_t>(inEnd - in) < literals || static_cast<size_t>(outEnd - out) < literals) {
+            return false;
+        }
+        memcpy(out, in, literals);
+        in += literals;
+        out += literals;
+        if (in == inEnd) {
+            break; // The last sequence has no match
+        }
+
+        if (inEnd - in < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(out - target)) {
+            return false;
+        }
+        size_t length = token & 15;
+        if (length == 15 && !readLength(in, inEnd, length)) {
+            return false;
+        }
+        length += MIN_MATCH;
+        if (static_cast<size_t>(outEnd - out) < length) {
+            return false;
+        }
+        const uint8_t* match = out - offset;
+        if (offset >= length) {
+            memcpy(out, match, length);
+        }
+        else if (offset >= 8) {
+            // Each 8-byte step reads only bytes that are already written
+            size_t i = 0;
+            for (; i + 8 <= length; i += 8) {
+                memcpy(out + i, match + i, 8);
+            }
+            for (; i < length; i++) {
+                out[i] = match[i];
+            }
+        }
+        else {
+            for (size_t i = 0; i < length; i++) {
+                out[i] = match[i]; // Overlapping copy repeats the last offset bytes
+            }
+        }
+        out += length;
+    }
+    return out == outEnd;
+}
+
+/**
+ * @brief Compresses a file.
+ * @param sourceName Name of the file to compress.
+ * @param targetName Name of the compressed file to create.
+ * @param blockSize Uncompressed block size.
+ * @return True on success.
+ */
+bool compressLogFile(const string& sourceName, const string& targetName, uint32_t blockSize) {
+    if (blockSize == 0) {
+        cerr << "Error: Invalid compression block size." << endl;
+        return false;
+    }
+    ifstream in(sourceName, ios::binary);
+    if (!in.is_open()) {
+        cerr << "Failed to open log segment: " << sourceName << endl;
+        return false;
+    }
+    ofstream out(targetName, ios::binary | ios::trunc);
+    if (!out.is_open()) {
+        cerr << "Failed to create compressed segment: " << targetName << endl;
+        return false;
+    }
+
+    LzFileHeader header = { LZ_FILE_MAGIC, LZ_FILE_VERSION, 0, blockSize, 0, 0 };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    vector<uint8_t> raw(blockSize);
+    vector<uint8_t> packed(lzCompressBound(blockSize));
+    while (in) {
+        in.read(reinterpret_cast<char*>(&raw[0]), blockSize);
+        size_t count = static_cast<size_t>(in.gcount());
+        if (count == 0) {
+            break;
+        }
+        LzBlockHeader block;
+        block.rawSize = static_cast<uint32_t>(count);
+        block.crc = telemetryCrc32(&raw[0], count);
+        size_t packedSize = lzCompress(&raw[0], count, &packed[0], packed.size());
+        const uint8_t* data = &packed[0];
+        block.flags = 0;
+        if (packedSize == 0 || packedSize >= count) {
+            packedSize = count;
+            data = &raw[0];
+            block.flags = LZ_BLOCK_STORED;
+        }
+        block.storedSize = static_cast<uint32_t>(packedSize);
+        out.write(reinterpret_cast<const char*>(&block), sizeof(block));
+        out.write(reinterpret_cast<const char*>(data), static_cast<streamsize>(packedSize));
+        header.rawSize += count;
+    }
+    if (in.bad()) {
+        cerr << "Error: Failed to read log segment: " << sourceName << endl;
+        out.close();
+        remove(targetName.c_str());
+        return false;
+    }
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (out.fail()) {
+        cerr << "Error: Failed to write compressed segment: " << targetName << endl;
+        remove(targetName.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Restores a file compressed by compressLogFile.
+ * @param sourceName Name of the compressed file.
+ * @param targetName Name of the file to create.
+ * @return True on success.
+ */
+bool decompressLogFile(const string& sourceName, const string& targetName) {
+    ifstream in(sourceName, ios::binary);
+    if (!in.is_open()) {
+        cerr << "Failed to open compressed segment: " << sourceName << endl;
+        return false;
+    }
+    LzFileHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != LZ_FILE_MAGIC
+        || header.version != LZ_FILE_VERSION || header.blockSize == 0) {
+        cerr << "Error: Not a compressed log segment: " << sourceName << endl;
+        return false;
+    }
+    ofstream out(targetName, ios::binary | ios::trunc);
+    if (!out.is_open()) {
+        cerr << "Failed to create log segment: " << targetName << endl;
+        return false;
+    }
+
+    vector<uint8_t> raw(header.blockSize);
+    vector<uint8_t> packed(lzCompressBound(header.blockSize));
+    uint64_t restored = 0;
+    bool valid = true;
+    while (valid && restored < header.rawSize) {
+        LzBlockHeader block;
+        valid = in.read(reinterpret_cast<char*>(&block), sizeof(block)) && block.rawSize <= header.blockSize
+            && block.rawSize > 0 && block.storedSize <= packed.size()
+            && (block.flags != LZ_BLOCK_STORED || block.storedSize == block.rawSize);
+        valid = valid && in.read(reinterpret_cast<char*>(&packed[0]), block.storedSize);
+        if (valid && block.flags == LZ_BLOCK_STORED) {
+            memcpy(&raw[0], &packed[0], block.rawSize);
+        }
+        else if (valid) {
+            valid = lzDecompress(&packed[0], block.storedSize, &raw[0], block.rawSize);
+        }
+        valid = valid && telemetryCrc32(&raw[0], block.rawSize) == block.crc;
+        if (valid) {
+            out.write(reinterpret_cast<const char*>(&raw[0]), block.rawSize);
+            restored += block.rawSize;
+        }
+    }
+    out.close();
+    if (!valid || restored != header.rawSize || out.fail()) {
+        cerr << "Error: Compressed segment is damaged: " << sourceName << endl;
+        remove(targetName.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file LogCompression.h
+ * @brief Fast LZ compression of closed log segments (see LogArchiver.h).
+ * @date October 2026
+ *
+ * The block codec is a byte-oriented LZ77 in the style of LZ4: a sequence is a token byte
+ * (literal length in the high nibble, match length - 4 in the low nibble, 15 meaning "more
+ * bytes follow"), the literals, a 2-byte little-endian match offset and the extra length
+ * bytes. The last sequence has literals only. It favours speed over ratio so a segment is
+ * compressed well before the next one is closed.
+ *
+ * A compressed file is an LzFileHeader followed by blocks, each an LzBlockHeader and its
+ * data. Blocks that do not shrink are stored as they are.
+ */
+
+#ifndef LOGCOMPRESSION_H
+#define LOGCOMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** @brief File magic, "TLZ1" in a little-endian file. */
+const uint32_t LZ_FILE_MAGIC = 0x315A4C54;
+
+/** @brief Current compressed file version. */
+const uint16_t LZ_FILE_VERSION = 1;
+
+/** @brief Default uncompressed block size of a compressed file. */
+const uint32_t LZ_DEFAULT_BLOCK_BYTES = 1 << 20;
+
+/**
+ * @struct LzFileHeader
+ * @brief Header of a compressed file.
+ */
+struct LzFileHeader {
+    uint32_t magic;          /**< LZ_FILE_MAGIC. */
+    uint16_t version;        /**< LZ_FILE_VERSION. */
+    uint16_t reserved;       /**< Written as 0. */
+    uint32_t blockSize;      /**< Uncompressed size of every block but the last. */
+    uint32_t reserved2;      /**< Written as 0. */
+    uint64_t rawSize;        /**< Size of the uncompressed file. */
+};
+
+/**
+ * @struct LzBlockHeader
+ * @brief Header of one block of a compressed file.
+ */
+struct LzBlockHeader {
+    uint32_t rawSize;        /**< Uncompressed size of the block. */
+    uint32_t storedSize;     /**< Bytes of block data following the header. */
+    uint32_t crc;            /**< CRC-32 of the uncompressed block. */
+    uint32_t flags;          /**< LZ_BLOCK_STORED if the data is not compressed. */
+};
+
+/** @brief Block flag: the data is the uncompressed block. */
+const uint32_t LZ_BLOCK_STORED = 1;
+
+static_assert(sizeof(LzFileHeader) == 24, "LzFileHeader layout changed");
+static_assert(sizeof(LzBlockHeader) == 16, "LzBlockHeader layout changed");
+
+/**
+ * @brief Returns the largest compressed size of a block.
+ * @param size Uncompressed size in bytes.
+ * @return The size of the output buffer lzCompress needs.
+ */
+inline size_t lzCompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+/**
+ * @brief Compresses a block.
+ * @param source The bytes.
+ * @param size Number of bytes.
+ * @param target Receives the compressed block.
+ * @param capacity Size of target; lzCompressBound(size) always suffices.
+ * @return The compressed size, or 0 if target is too small.
+ */
+size_t lzCompress(const uint8_t* source, size_t size, uint8_t* target, size_t capacity);
+
+/**
+ * @brief Decompresses a block, checking every length and offset against the buffers.
+ * @param source The compressed block.
+ * @param size Size of the compressed block.
+ * @param target Receives the bytes.
+ * @param rawSize Exact uncompressed size.
+ * @return True if the block is valid and decompresses to exactly rawSize bytes.
+ */
+bool lzDecompress(const uint8_t* source, size_t size, uint8_t* target, size_t rawSize);
+
+/**
+ * @brief Compresses a file.
+ * @param sourceName Name of the file to compress.
+ * @param targetName Name of the compressed file to create (replaced if it exists).
+ * @param blockSize Uncompressed block size.
+ * @return True on success.
+ */
+bool compressLogFile(const std::string& sourceName, const std::string& targetName,
+    uint32_t blockSize = LZ_DEFAULT_BLOCK_BYTES);
+
+/**
+ * @brief Restores a file compressed by compressLogFile, verifying the CRC of every block.
+ * @param sourceName Name of the compressed file.
+ * @param targetName Name of the file to create (replaced if it exists).
+ * @return True on success.
+ */
+bool decompressLogFile(const std::string& sourceName, const std::string& targetName);
+
+#endif // LOGCOMPRESSION_H
@@ -0,0 +1,173 @@
+/**
+ * @file LogCompressionTest.cpp
+ * @brief Test application for the LZ codec and the compressed log file format.
+ * @details Round-trips blocks of different kinds, checks that damaged input is rejected without
+ * writing outside the output buffer, and compresses a recorded telemetry log, measuring the
+ * ratio and the speed.
+ * @date October, 2026
+ */
+
+#include "LogCompression.h"
+#include "TelemetryWriter.h"
+#include "TelemetryReader.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Compresses and decompresses a block and checks that it comes back unchanged.
+ * @param data The block.
+ * @return The compressed size.
+ */
+size_t roundTrip(const vector<uint8_t>& data) {
+    vector<uint8_t> packed(lzCompressBound(data.size()));
+    size_t packedSize = lzCompress(data.empty() ? nullptr : &data[0], data.size(), &packed[0], packed.size());
+    assert(packedSize > 0 && packedSize <= packed.size());
+    vector<uint8_t> restored(data.size() + 1);
+    assert(lzDecompress(&packed[0], packedSize, &restored[0], data.size()));
+    restored.resize(data.size());
+    assert(restored == data);
+    return packedSize;
+}
+
+/**
+ * @brief Returns the size of a file.
+ * @param name Name of the file.
+ * @return The size in bytes.
+ */
+long long fileSizeOf(const string& name) {
+    ifstream in(name, ios::binary | ios::ate);
+    return in.is_open() ? static_cast<long long>(in.tellg()) : -1;
+}
+
+/**
+ * @brief Main function for testing the codec.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: Blocks of every kind come back unchanged.
+     */
+    srand(7);
+    vector<uint8_t> empty;
+    roundTrip(empty);
+    vector<uint8_t> tiny = { 1, 2, 3 };
+    roundTrip(tiny);
+    vector<uint8_t> zeros(100000, 0);
+    assert(roundTrip(zeros) < 1000);
+    vector<uint8_t> noise(100000);
+    for (size_t i = 0; i < noise.size(); i++) {
+        noise[i] = static_cast<uint8_t>(rand());
+    }
+    assert(roundTrip(noise) <= lzCompressBound(noise.size()));
+    vector<uint8_t> pattern(300000);
+    for (size_t i = 0; i < pattern.size(); i++) {
+        pattern[i] = static_cast<uint8_t>((i % 7) * 31 + (i / 5000)); // Runs, short periods and long matches
+    }
+    assert(roundTrip(pattern) < pattern.size() / 10);
+    vector<uint8_t> farMatch(200000);
+    for (size_t i = 0; i < farMatch.size(); i++) {
+        farMatch[i] = i < 70000 ? static_cast<uint8_t>(rand()) : farMatch[i - 70000]; // Beyond the offset range
+    }
+    roundTrip(farMatch);
+
+    /**
+     * @test Test 2: Damaged blocks are rejected and never write past the output.
+     */
+    vector<uint8_t> packed(lzCompressBound(pattern.size()));
+    size_t packedSize = lzCompress(&pattern[0], pattern.size(), &packed[0], packed.size());
+    vector<uint8_t> restored(pattern.size() + 64, 0xAB);
+    assert(!lzDecompress(&packed[0], packedSize / 2, &restored[0], pattern.size()));
+    assert(!lzDecompress(&packed[0], packedSize, &restored[0], pattern.size() - 1));
+    for (int trial = 0; trial < 2000; trial++) {
+        vector<uint8_t> damaged(packed.begin(), packed.begin() + static_cast<ptrdiff_t>(packedSize));
+        damaged[rand() % damaged.size()] ^= static_cast<uint8_t>(1 + rand() % 255);
+        lzDecompress(&damaged[0], damaged.size(), &restored[0], pattern.size());
+        for (size_t i = pattern.size(); i < restored.size(); i++) {
+            assert(restored[i] == 0xAB);
+        }
+    }
+    uint8_t badOffset[] = { 0x10, 'a', 0x05, 0x00 }; // Match 5 bytes back after 1 byte of output
+    assert(!lzDecompress(badOffset, sizeof(badOffset), &restored[0], 5));
+    assert(lzCompress(&pattern[0], pattern.size(), &packed[0], 10) == 0);
+
+    /**
+     * @test Test 3: A telemetry log compresses to a file that restores byte for byte.
+     */
+    const string logName = "compression_test.tlog";
+    const string packedName = logName + ".tlz";
+    const string restoredName = logName + ".restored";
+    remove(logName.c_str());
+    remove(telemetryIndexName(logName).c_str());
+    TelemetryWriter writer;
+    assert(writer.open(logName));
+    LidarScanRecord fixed = { 0.0, 0.0, 0.0, -120.0f, 0.36f, 667, 0 };
+    float ranges[667];
+    for (int s = 0; s < 3000; s++) {
+        for (int i = 0; i < 667; i++) {
+            // A room seen from a slowly moving robot, in millimetre steps like a real Lidar
+            ranges[i] = static_cast<float>(static_cast<int>((2.0 + (i % 200) * 0.01 + s * 0.0005) * 1000.0) / 1000.0);
+        }
+        fixed.x = s * 0.01;
+        assert(writer.append(RECORD_LIDAR_SCAN, s * 0.1, &fixed, sizeof(fixed), ranges, sizeof(ranges)));
+        PoseRecord pose = { s * 0.01, 0.0, 0.0 };
+        assert(writer.append(RECORD_POSE, s * 0.1, &pose, sizeof(pose)));
+    }
+    assert(writer.close());
+
+    auto start = chrono::steady_clock::now();
+    assert(compressLogFile(logName, packedName));
+    double compressMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    assert(decompressLogFile(packedName, restoredName));
+    double decompressMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    long long rawBytes = fileSizeOf(logName);
+    long long packedBytes = fileSizeOf(packedName);
+    assert(fileSizeOf(restoredName) == rawBytes && packedBytes < rawBytes / 2);
+    {
+        ifstream a(logName, ios::binary);
+        ifstream b(restoredName, ios::binary);
+        vector<char> original((istreambuf_iterator<char>(a)), istreambuf_iterator<char>());
+        vector<char> copy((istreambuf_iterator<char>(b)), istreambuf_iterator<char>());
+        assert(original == copy);
+    }
+    TelemetryReader reader;
+    assert(reader.open(restoredName));
+    RecordView view;
+    unsigned long records = 0;
+    while (reader.next(view)) {
+        records++;
+    }
+    assert(records == 6000);
+    reader.close();
+    cout << "Compressed " << rawBytes << " bytes to " << packedBytes << " (" << 100.0 * packedBytes / rawBytes
+        << "%) at " << rawBytes / 1000.0 / compressMs << " MB/s, restored at " << rawBytes / 1000.0 / decompressMs
+        << " MB/s" << endl;
+
+    /**
+     * @test Test 4: A damaged compressed file is reported and leaves no output behind.
+     */
+    {
+        fstream damage(packedName, ios::in | ios::out | ios::binary);
+        damage.seekg(packedBytes / 2);
+        char byte = static_cast<char>(damage.get() ^ 0x5A);
+        damage.seekp(packedBytes / 2);
+        damage.put(byte);
+    }
+    remove(restoredName.c_str());
+    assert(!decompressLogFile(packedName, restoredName));
+    assert(fileSizeOf(restoredName) < 0);
+    assert(!decompressLogFile(logName, restoredName)); // Not a compressed file
+
+    remove(logName.c_str());
+    remove(telemetryIndexName(logName).c_str());
+    remove(packedName.c_str());
+    remove(restoredName.c_str());
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cmath>
 #include "Map.h"
 
 /**
@@ -38,28 +39,53 @@ Map::~Map() {
 }
 
 /**
- * @brief Inserts a point into the map by marking its corresponding grid cell.
+ * @brief Inserts a point into the map by marking its corresponding grid cell as occupied.
  * @param p A Point object to insert.
  */
 void Map::insertPoint(Point p) {
-    int gridX = static_cast<int>(p.getX() / gridSize);
-    int gridY = static_cast<int>(p.getY() / gridSize);
+    // floor keeps points just below zero out of cell 0
+    int gridX = static_cast<int>(std::floor(p.getX() / gridSize));
+    int gridY = static_cast<int>(std::floor(p.getY() / gridSize));
 
     if (gridX >= 0 && gridX < numberX && gridY >= 0 && gridY < numberY) {
-        grid[gridX][gridY] = 1;
+        grid[gridX][gridY] = CELL_OCCUPIED;
     }
     else {
         std::cout << "Error: Point is out of bounds!" << std::endl;
     }
 }
 
+/**
+ * @brief Marks the cells of all points of a cloud as occupied.
+ * Points outside the map are counted instead of reported one by one.
+ * @param cloud The points in map coordinates.
+ * @return The number of points that were out of bounds.
+ */
+int Map::insertPoints(const PointCloud2D& cloud) {
+    const float* xs = cloud.x();
+    const float* ys = cloud.y();
+    const size_t count = cloud.size();
+    int outOfBounds = 0;
+    for (size_t i = 0; i < count; i++) {
+        int gridX = static_cast<int>(std::floor(xs[i] / gridSize));
+        int gridY = static_cast<int>(std::floor(ys[i] / gridSize));
+        if (gridX >= 0 && gridX < numberX && gridY >= 0 && gridY < numberY) {
+            grid[gridX][gridY] = CELL_OCCUPIED;
+        }
+        else {
+            outOfBounds++;
+        }
+    }
+    return outOfBounds;
+}
+
 /**
  * @brief Retrieves the value of a specific grid cell.
  * @param indexX The X index of the grid cell.
  * @param indexY The Y index of the grid cell.
  * @return The value at the specified grid cell.
  */
-int Map::getGrid(int indexX, int indexY) {
+int Map::getGrid(int indexX, int indexY) const {
     return grid[indexX][indexY];
 }
 
@@ -95,17 +121,21 @@ void Map::printInfo() const {
 }
 
 /**
- * @brief Displays the map in the console, showing '.' for empty cells and 'x' for occupied cells.
+ * @brief Displays the map in the console, showing '.' for unknown cells, 'x' for occupied cells
+ * and blanks for cells observed to be free.
  */
 void Map::showMap() {
     for (int i = 0; i < numberX; i++) {
         for (int j = 0; j < numberY; j++) {
-            if (grid[i][j] == 0) {
+            if (grid[i][j] == CELL_UNKNOWN) {
                 std::cout << ".  ";
             }
-            else if (grid[i][j] == 1) {
+            else if (grid[i][j] == CELL_OCCUPIED) {
                 std::cout << "x  ";
             }
+            else if (grid[i][j] == CELL_FREE) {
+                std::cout << "   ";
+            }
         }
         std::cout << std::endl;
     }
@@ -127,6 +157,23 @@ int Map::getNumberY() const {
     return numberY;
 }
 
+/**
+ * @brief Gets the size of each grid.
+ * @return The grid size.
+ */
+double Map::getGridSize() const {
+    return gridSize;
+}
+
+/**
+ * @brief Gives direct access to the grid for bulk updates.
+ * @details Indexed as cells[indexX][indexY]. Threads may write to disjoint cells concurrently.
+ * @return The grid storage.
+ */
+int** Map::getCells() {
+    return grid;
+}
+
 /**
  * @brief Calculates the total number of grids in the map.
  * @return The total number of grids.
@@ -152,12 +199,15 @@ void Map::setGridSize(double size) {
 std::ostream& operator<<(std::ostream& os, const Map& map) {
     for (int i = 0; i < map.getNumberX(); i++) {
         for (int j = 0; j < map.getNumberY(); j++) {
-            if (map.grid[i][j] == 0) {
+            if (map.grid[i][j] == Map::CELL_UNKNOWN) {
                 os << ".  ";
             }
-            else if (map.grid[i][j] == 1) {
+            else if (map.grid[i][j] == Map::CELL_OCCUPIED) {
                 os << "x  ";
             }
+            else if (map.grid[i][j] == Map::CELL_FREE) {
+                os << "   ";
+            }
         }
         os << std::endl;
     }
@@ -9,17 +9,29 @@
 
 #include <iostream>
 #include "Point.h"
+#include "PointCloud2D.h"
 using namespace std;
 
+/**
+ * @struct MapRegion
+ * @brief A rectangle of map cells; empty if xMin >= xMax or yMin >= yMax.
+ */
+struct MapRegion {
+    int xMin, yMin; ///< First column and row.
+    int xMax, yMax; ///< One past the last column and row.
+};
+
 class Map {
     int** grid;
     int numberX;
     int numberY;
     double  gridSize;
 public:
+    enum { CELL_UNKNOWN = 0, CELL_OCCUPIED = 1, CELL_FREE = 2 };
     Map(int x, int y, double size);
     void insertPoint(Point);
-    int getGrid(int indexX, int indexY);
+    int insertPoints(const PointCloud2D& cloud);
+    int getGrid(int indexX, int indexY) const;
     void  setGrid(int indexX, int indexY, int value);
     void clearMap();
     void printInfo() const;
@@ -27,6 +39,8 @@ public:
     void showMap();
     int getNumberX() const;
     int getNumberY()const;
+    double getGridSize() const;
+    int** getCells();
     double addGridSize();
     void setGridSize(double size);
     ~Map();
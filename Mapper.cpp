@@ -10,13 +10,159 @@
 #include <iostream>
 #include <vector>
 #include <fstream>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+#include <chrono>
+#include <cstdlib>
 
 using namespace std;
 
+/**
+ * @brief Converts a beam to grid coordinates.
+ * @param robotPose Pose of the robot when the beam was measured.
+ * @param x X of the end point in map coordinates.
+ * @param y Y of the end point in map coordinates.
+ * @param cellSize Size of a grid cell.
+ * @param ray Receives the beam in grid coordinates.
+ */
+static void pointToRay(const Pose& robotPose, float x, float y, double cellSize, CellRay& ray) {
+    ray.x0 = static_cast<int>(floor(robotPose.getX() / cellSize));
+    ray.y0 = static_cast<int>(floor(robotPose.getY() / cellSize));
+    ray.x1 = static_cast<int>(floor(x / cellSize));
+    ray.y1 = static_cast<int>(floor(y / cellSize));
+}
+
+/**
+ * @brief Converts a scan to end points in map coordinates. Invalid readings (<= 0) are dropped.
+ * @param cloud Receives the end points.
+ * @param ranges The ranges in meters.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees.
+ * @param angleIncrement Angle between beams in degrees.
+ * @param robotPose Pose of the robot when the scan was measured.
+ */
+static void scanToCloud(PointCloud2D& cloud, const float* ranges, int rangeCount, double angleMin,
+    double angleIncrement, const Pose& robotPose) {
+    cloud.fromPolar(ranges, rangeCount, angleMin, angleIncrement);
+    cloud.transform(Transform2D(robotPose)); // Beam angles are degrees, the heading is radians
+}
+
+/**
+ * @brief Marks the cells a ray passes through as free, limited to a rectangle of the map.
+ *
+ * Cells follow Bresenham's line from the start to the end cell; the end cell itself is left to
+ * the caller. Step k of the line is computed in closed form, so the walk can start directly at
+ * the first step inside the rectangle and every rectangle sees exactly the cells a walk over the
+ * whole map would. Occupied cells are never cleared, which makes the result independent of the
+ * order in which beams are integrated.
+ *
+ * @param cells The grid storage.
+ * @param ray The ray in grid coordinates.
+ * @param xMin First column of the rectangle.
+ * @param yMin First row of the rectangle.
+ * @param xMax One past the last column of the rectangle.
+ * @param yMax One past the last row of the rectangle.
+ */
+static void clearRay(int** cells, const CellRay& ray, int xMin, int yMin, int xMax, int yMax) {
+    int dx = ray.x1 - ray.x0;
+    int dy = ray.y1 - ray.y0;
+    bool xMajor = abs(dx) >= abs(dy);
+    int steps = xMajor ? abs(dx) : abs(dy);
+    if (steps == 0) {
+        return;
+    }
+    int major0 = xMajor ? ray.x0 : ray.y0;
+    int minor0 = xMajor ? ray.y0 : ray.x0;
+    int majorStep = (xMajor ? dx : dy) > 0 ? 1 : -1;
+    int minorDelta = xMajor ? dy : dx;
+    int minorStep = minorDelta > 0 ? 1 : (minorDelta < 0 ? -1 : 0);
+    long long minorSpan = abs(minorDelta);
+    int majorMin = xMajor ? xMin : yMin, majorMax = xMajor ? xMax : yMax;
+    int minorMin = xMajor ? yMin : xMin, minorMax = xMajor ? yMax : xMax;
+
+    // Steps whose major coordinate lies inside the rectangle, excluding the end cell
+    long long first = majorStep > 0 ? majorMin - major0 : major0 - (majorMax - 1);
+    long long last = majorStep > 0 ? majorMax - 1 - major0 : major0 - majorMin;
+    if (first < 0) first = 0;
+    if (last > steps - 1) last = steps - 1;
+    if (first > last) {
+        return;
+    }
+
+    // minor(k) = minor0 + minorStep * floor((2 * k * minorSpan + steps) / (2 * steps))
+    long long twoSteps = 2LL * steps;
+    long long numerator = 2 * first * minorSpan + steps;
+    long long offset = numerator / twoSteps;
+    long long remainder = numerator % twoSteps;
+    for (long long k = first; k <= last; k++) {
+        int major = major0 + majorStep * static_cast<int>(k);
+        int minor = minor0 + minorStep * static_cast<int>(offset);
+        if (minor >= minorMin && minor < minorMax) {
+            int* cell = xMajor ? &cells[major][minor] : &cells[minor][major];
+            if (*cell != Map::CELL_OCCUPIED) {
+                *cell = Map::CELL_FREE;
+            }
+        }
+        else if (minorStep == 0 || (minorStep > 0) == (minor >= minorMax)) {
+            break; // The ray has left the rectangle for good
+        }
+        remainder += 2 * minorSpan;
+        if (remainder >= twoSteps) {
+            remainder -= twoSteps;
+            offset++;
+        }
+    }
+}
+
+/**
+ * @brief Calls visit(tileX, tileY) for every map tile a ray passes through, end cell included.
+ * @param ray The ray in grid coordinates.
+ * @param numberX Number of map cells in the X direction.
+ * @param numberY Number of map cells in the Y direction.
+ * @param tileSize Tile edge length in cells.
+ * @param visit Callback receiving the tile coordinates.
+ */
+template <typename Visit>
+static void forEachTile(const CellRay& ray, int numberX, int numberY, int tileSize, Visit visit) {
+    int dx = ray.x1 - ray.x0;
+    int dy = ray.y1 - ray.y0;
+    bool xMajor = abs(dx) >= abs(dy);
+    int steps = xMajor ? abs(dx) : abs(dy);
+    int major0 = xMajor ? ray.x0 : ray.y0;
+    int minor0 = xMajor ? ray.y0 : ray.x0;
+    int majorStep = (xMajor ? dx : dy) >= 0 ? 1 : -1;
+    int minorDelta = xMajor ? dy : dx;
+    int minorStep = minorDelta >= 0 ? 1 : -1;
+    long long minorSpan = abs(minorDelta);
+    int majorCount = xMajor ? numberX : numberY;
+    int minorCount = xMajor ? numberY : numberX;
+
+    // Major coordinates covered by the ray, clipped to the map
+    int majorLo = majorStep > 0 ? major0 : major0 - steps;
+    int majorHi = majorStep > 0 ? major0 + steps : major0;
+    if (majorLo < 0) majorLo = 0;
+    if (majorHi > majorCount - 1) majorHi = majorCount - 1;
+
+    for (int tile = majorLo / tileSize; majorLo <= majorHi && tile <= majorHi / tileSize; tile++) {
+        int lo = tile * tileSize > majorLo ? tile * tileSize : majorLo;
+        int hi = (tile + 1) * tileSize - 1 < majorHi ? (tile + 1) * tileSize - 1 : majorHi;
+        long long kA = static_cast<long long>(lo - major0) * majorStep;
+        long long kB = static_cast<long long>(hi - major0) * majorStep;
+        long long minorA = steps == 0 ? minor0 : minor0 + minorStep * ((2 * kA * minorSpan + steps) / (2LL * steps));
+        long long minorB = steps == 0 ? minor0 : minor0 + minorStep * ((2 * kB * minorSpan + steps) / (2LL * steps));
+        long long minorLo = minorA < minorB ? minorA : minorB;
+        long long minorHi = minorA < minorB ? minorB : minorA;
+        if (minorLo < 0) minorLo = 0;
+        if (minorHi > minorCount - 1) minorHi = minorCount - 1;
+        for (long long m = minorLo / tileSize; minorLo <= minorHi && m <= minorHi / tileSize; m++) {
+            if (xMajor) {
+                visit(tile, static_cast<int>(m));
+            }
+            else {
+                visit(static_cast<int>(m), tile);
+            }
+        }
+    }
+}
+
 /**
  * @brief Constructor for the Mapper class.
  * @param gridSizeX Number of grid cells in the X direction.
@@ -26,7 +172,8 @@ using namespace std;
  * @param lidar Pointer to the Lidar sensor.
  */
 Mapper::Mapper(int gridSizeX, int gridSizeY, double cellSize, RobotControler* controller, LidarSensor* lidar)
-    : map(gridSizeX, gridSizeY, cellSize), controller(controller), lidar(lidar) {}
+    : map(gridSizeX, gridSizeY, cellSize), controller(controller), lidar(lidar), tileSize(32), tracker(nullptr),
+      clearRays(false), changed() {}
 
 /**
  * @brief Updates the map using data from the Lidar sensor.
@@ -35,22 +182,276 @@ void Mapper::updateMap() {
     lidar->update();  ///< Updates the Lidar sensor data.
     const Pose& robotPose = controller->getPose(); ///< Retrieves the current pose of the robot.
 
-    // Iterate through Lidar data and calculate the position of obstacles
-    for (int i = 0; i < lidar->getRangeNum(); ++i) {
-        double distance = lidar->getRange(i);
+    int rangeCount = lidar->getRangeNum();
+    if (rangeCount <= 0) {
+        return;
+    }
+    lidarRanges.resize(rangeCount);
+    rangeCount = lidar->copyRanges(&lidarRanges[0], rangeCount);
+    double increment = rangeCount > 1 ? lidar->getAngle(1) - lidar->getAngle(0) : 0.0;
+    insertScan(&lidarRanges[0], rangeCount, lidar->getAngle(0), increment, robotPose);
+}
+
+/**
+ * @brief Updates the map from a scan captured elsewhere.
+ * @param scan The scan and the pose it was taken at; beam angles are in degrees, the heading in radians.
+ */
+void Mapper::updateMap(const LidarScan& scan) {
+    insertScan(scan.ranges, scan.rangeNumber, scan.angleMin, scan.angleIncrement, scan.pose);
+}
+
+/**
+ * @brief Integrates a scan: the end points become occupied, and with ray clearing the cells along every beam free.
+ *
+ * Occupied cells are never cleared, so clearing all rays before marking the end points gives
+ * the same map as integrating the beams one by one. End points on moving obstacles found by
+ * the tracker are left out.
+ *
+ * @param ranges The ranges in meters.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees.
+ * @param angleIncrement Angle between beams in degrees.
+ * @param robotPose Pose of the robot when the scan was measured (heading in radians).
+ */
+void Mapper::insertScan(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+    const Pose& robotPose) {
+    scanToCloud(cloud, ranges, rangeCount, angleMin, angleIncrement, robotPose);
+    const float* xs = cloud.x();
+    const float* ys = cloud.y();
+    const double cellSize = map.getGridSize();
+    int** cells = map.getCells();
+    CellRay ray;
+    pointToRay(robotPose, 0.0f, 0.0f, cellSize, ray);
+    int xMin = ray.x0, yMin = ray.y0, xMax = ray.x0, yMax = ray.y0;
+    for (size_t i = 0; i < cloud.size(); i++) {
+        pointToRay(robotPose, xs[i], ys[i], cellSize, ray);
+        if (clearRays) {
+            clearRay(cells, ray, 0, 0, map.getNumberX(), map.getNumberY());
+        }
+        xMin = ray.x1 < xMin ? ray.x1 : xMin;
+        xMax = ray.x1 > xMax ? ray.x1 : xMax;
+        yMin = ray.y1 < yMin ? ray.y1 : yMin;
+        yMax = ray.y1 > yMax ? ray.y1 : yMax;
+    }
+    markChanged(xMin, yMin, xMax + 1, yMax + 1);
+
+    // Leave moving obstacles out, so that they do not ghost into the map
+    if (tracker != nullptr && tracker->getDynamicCount() > 0) {
+        const ObstacleTracker* moving = tracker;
+        cloud.removeIf([moving](float x, float y) { return moving->isDynamic(x, y); });
+    }
+
+    // Insert the end points into the map
+    int outside = map.insertPoints(cloud);
+    if (outside > 0) {
+        cout << "Error: " << outside << " points are out of bounds!" << endl;
+    }
+}
+
+/**
+ * @brief Integrates many scans in parallel.
+ *
+ * Phase 1 (parallel over scans): every beam is converted to a ray and a reference to it is
+ * appended to the bin of each tile it crosses, or with ray clearing off only of the tile its
+ * end point falls in. Each worker has its own set of bins.
+ * Phase 2 (parallel over tiles): the worker that takes a tile clears all of its rays inside
+ * the tile if ray clearing is on, then marks the end points that fall in it. A tile is owned by one worker, so the
+ * grid is written without locks. Tiles near the robots hold far more rays than distant ones;
+ * work stealing evens this out.
+ *
+ * @param scans The scans and the poses they were taken at.
+ * @param threadCount Number of worker threads (0 = hardware concurrency).
+ * @return Statistics of the batch.
+ */
+BatchStats Mapper::updateMapBatch(const vector<LidarScan>& scans, int threadCount) {
+    BatchStats stats = {};
+    if (scans.size() >= UINT32_MAX / LidarScan::MAX_BEAMS) { // Beam indices must fit in 32 bits
+        cerr << "Error: Too many scans in one batch!" << endl;
+        return stats;
+    }
+    if (!pool || (threadCount > 0 && pool->getThreadCount() != threadCount)) {
+        pool.reset(new WorkStealingPool(threadCount));
+    }
+    const int workers = pool->getThreadCount();
+    const int numberX = map.getNumberX();
+    const int numberY = map.getNumberY();
+    const int tilesX = (numberX + tileSize - 1) / tileSize;
+    const int tilesY = (numberY + tileSize - 1) / tileSize;
+    const int tileCount = tilesX * tilesY;
+    const double cellSize = map.getGridSize();
+    const int tile = tileSize;
+    const bool clearing = clearRays;
+
+    bins.resize(static_cast<size_t>(workers) * tileCount);
+    for (size_t i = 0; i < bins.size(); i++) {
+        bins[i].clear();
+    }
+    // Rays are stored once per beam and referenced from the bins by their index
+    vector<uint32_t> firstBeam(scans.size() + 1, 0);
+    for (size_t s = 0; s < scans.size(); s++) {
+        firstBeam[s + 1] = firstBeam[s] + static_cast<uint32_t>(scans[s].rangeNumber);
+    }
+    rays.resize(firstBeam[scans.size()]);
+    workerClouds.resize(workers);
+    for (int w = 0; w < workers; w++) {
+        workerClouds[w].setChannels(false, true);
+    }
+    vector<unsigned long> beamCounts(workers, 0), outOfBounds(workers, 0);
+    unsigned long stealsBefore = pool->getSteals();
+
+    // Phase 1: bin every beam by the tiles it crosses
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    pool->parallelFor(static_cast<uint32_t>(scans.size()), [&](uint32_t s, int worker) {
+        const LidarScan& scan = scans[s];
+        vector<uint32_t>* workerBins = &bins[static_cast<size_t>(worker) * tileCount];
+        PointCloud2D& points = workerClouds[worker];
+        scanToCloud(points, scan.ranges, scan.rangeNumber, scan.angleMin, scan.angleIncrement, scan.pose);
+        const float* xs = points.x();
+        const float* ys = points.y();
+        const int32_t* beams = points.beam();
+        for (size_t k = 0; k < points.size(); k++) {
+            uint32_t reference = firstBeam[s] + static_cast<uint32_t>(beams[k]);
+            CellRay& ray = rays[reference];
+            pointToRay(scan.pose, xs[k], ys[k], cellSize, ray);
+            beamCounts[worker]++;
+            bool inside = ray.x1 >= 0 && ray.x1 < numberX && ray.y1 >= 0 && ray.y1 < numberY;
+            if (!inside) {
+                outOfBounds[worker]++;
+            }
+            if (clearing) {
+                forEachTile(ray, numberX, numberY, tile, [&](int tx, int ty) {
+                    workerBins[tx * tilesY + ty].push_back(reference);
+                });
+            }
+            else if (inside) { // Only the end point is written
+                workerBins[ray.x1 / tile * tilesY + ray.y1 / tile].push_back(reference);
+            }
+        }
+    });
+    chrono::steady_clock::time_point binned = chrono::steady_clock::now();
+
+    // Phase 2: integrate each tile on exactly one worker
+    int** cells = map.getCells();
+    vector<unsigned char> used(tileCount, 0);
+    pool->parallelFor(static_cast<uint32_t>(tileCount), [&](uint32_t t, int) {
+        int xMin = static_cast<int>(t) / tilesY * tile;
+        int yMin = static_cast<int>(t) % tilesY * tile;
+        int xMax = xMin + tile < numberX ? xMin + tile : numberX;
+        int yMax = yMin + tile < numberY ? yMin + tile : numberY;
+        for (int w = 0; w < workers; w++) {
+            const vector<uint32_t>& bin = bins[static_cast<size_t>(w) * tileCount + t];
+            for (size_t e = 0; clearing && e < bin.size(); e++) {
+                clearRay(cells, rays[bin[e]], xMin, yMin, xMax, yMax);
+            }
+            used[t] |= bin.empty() ? 0 : 1;
+        }
+        // End points last, so that they win over rays from any scan in the batch
+        for (int w = 0; w < workers; w++) {
+            const vector<uint32_t>& bin = bins[static_cast<size_t>(w) * tileCount + t];
+            for (size_t e = 0; e < bin.size(); e++) {
+                const CellRay& ray = rays[bin[e]];
+                if (ray.x1 >= xMin && ray.x1 < xMax && ray.y1 >= yMin && ray.y1 < yMax) {
+                    cells[ray.x1][ray.y1] = Map::CELL_OCCUPIED;
+                }
+            }
+        }
+    });
+    chrono::steady_clock::time_point integrated = chrono::steady_clock::now();
 
-        if (distance <= 0) {
-            continue; ///< Skip invalid distance readings.
+    for (int t = 0; t < tileCount; t++) {
+        if (used[t]) {
+            int xMin = t / tilesY * tile, yMin = t % tilesY * tile;
+            markChanged(xMin, yMin, xMin + tile, yMin + tile);
         }
+    }
+
+    stats.scans = static_cast<unsigned long>(scans.size());
+    for (int w = 0; w < workers; w++) {
+        stats.beams += beamCounts[w];
+        stats.outOfBounds += outOfBounds[w];
+    }
+    for (size_t i = 0; i < bins.size(); i++) {
+        stats.binEntries += static_cast<unsigned long>(bins[i].size());
+    }
+    for (int t = 0; t < tileCount; t++) {
+        stats.tileTasks += used[t];
+    }
+    stats.steals = pool->getSteals() - stealsBefore;
+    stats.binMs = chrono::duration<double, milli>(binned - start).count();
+    stats.integrateMs = chrono::duration<double, milli>(integrated - binned).count();
+    return stats;
+}
+
+/**
+ * @brief Sets the edge length of the tiles used by updateMapBatch.
+ * @param cells Tile edge length in cells.
+ */
+void Mapper::setTileSize(int cells) {
+    if (cells > 0) {
+        tileSize = cells;
+    }
+}
 
-        // Convert Lidar angle to radians and calculate global x and y coordinates
-        double angleInRadians = (robotPose.getTh() + lidar->getAngle(i)) * M_PI / 180.0;
-        double x = robotPose.getX() + distance * cos(angleInRadians);
-        double y = robotPose.getY() + distance * sin(angleInRadians);
+/**
+ * @brief Sets a tracker whose moving obstacles updateMap() leaves out of the map.
+ * @param obstacleTracker The tracker, or nullptr to integrate every end point.
+ */
+void Mapper::setObstacleTracker(const ObstacleTracker* obstacleTracker) {
+    tracker = obstacleTracker;
+}
+
+/**
+ * @brief Sets whether updateMap() and updateMapBatch() also mark the cells along each beam as free.
+ * @param enabled True to mark the cells along each beam as free.
+ */
+void Mapper::setRayClearing(bool enabled) {
+    clearRays = enabled;
+}
 
-        // Insert the calculated point into the map
-        map.insertPoint(Point(x, y));
+/**
+ * @brief Grows the changed region to include a rectangle, clipped to the map.
+ * @param xMin First column.
+ * @param yMin First row.
+ * @param xMax One past the last column.
+ * @param yMax One past the last row.
+ */
+void Mapper::markChanged(int xMin, int yMin, int xMax, int yMax) {
+    xMin = xMin > 0 ? xMin : 0;
+    yMin = yMin > 0 ? yMin : 0;
+    xMax = xMax < map.getNumberX() ? xMax : map.getNumberX();
+    yMax = yMax < map.getNumberY() ? yMax : map.getNumberY();
+    if (xMin >= xMax || yMin >= yMax) {
+        return;
+    }
+    if (changed.xMin >= changed.xMax || changed.yMin >= changed.yMax) {
+        changed.xMin = xMin;
+        changed.yMin = yMin;
+        changed.xMax = xMax;
+        changed.yMax = yMax;
+        return;
     }
+    changed.xMin = xMin < changed.xMin ? xMin : changed.xMin;
+    changed.yMin = yMin < changed.yMin ? yMin : changed.yMin;
+    changed.xMax = xMax > changed.xMax ? xMax : changed.xMax;
+    changed.yMax = yMax > changed.yMax ? yMax : changed.yMax;
+}
+
+/**
+ * @brief Returns the cells written since the last call and starts a new region.
+ * @return Bounding box of the cells written by updateMap() and updateMapBatch().
+ */
+MapRegion Mapper::takeChangedRegion() {
+    MapRegion region = changed;
+    changed = MapRegion();
+    return region;
+}
+
+/**
+ * @brief Returns the map.
+ * @return Const reference to the map.
+ */
+const Map& Mapper::getMap() const {
+    return map;
 }
 
 /**
@@ -10,12 +10,42 @@
 
 #include "Map.h"
 #include "LidarSensor.h"
+#include "LidarScan.h"
 #include "RobotControler.h"
+#include "WorkStealingPool.h"
+#include "PointCloud2D.h"
+#include "ObstacleTracker.h"
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 
 using namespace std;
 
+/**
+ * @struct CellRay
+ * @brief A beam in grid coordinates: from the robot's cell to the cell of the end point.
+ */
+struct CellRay {
+    int x0, y0; ///< Cell of the robot.
+    int x1, y1; ///< Cell of the end point.
+};
+
+/**
+ * @struct BatchStats
+ * @brief Summary of one Mapper::updateMapBatch call.
+ */
+struct BatchStats {
+    unsigned long scans;        ///< Scans integrated.
+    unsigned long beams;        ///< Valid beams integrated.
+    unsigned long outOfBounds;  ///< Beams whose end point fell outside the map.
+    unsigned long tileTasks;    ///< Tiles that received at least one beam.
+    unsigned long binEntries;   ///< (beam, tile) pairs produced by the binning phase.
+    unsigned long steals;       ///< Work-stealing events during the batch.
+    double binMs;               ///< Duration of the binning phase in milliseconds.
+    double integrateMs;         ///< Duration of the integration phase in milliseconds.
+};
+
 /**
  * @class Mapper
  * @brief Handles mapping functionality, including updates and saving map data.
@@ -25,6 +55,35 @@ private:
     Map map; ///< Represents the map of the environment.
     RobotControler* controller; ///< Pointer to the robot controller.
     LidarSensor* lidar; ///< Pointer to the Lidar sensor.
+    int tileSize; ///< Edge length of a batch integration tile in cells.
+    std::unique_ptr<WorkStealingPool> pool; ///< Worker threads for batch integration.
+    std::vector<std::vector<uint32_t> > bins; ///< Beam references per (worker, tile), reused between batches.
+    std::vector<CellRay> rays; ///< Rays of the current batch, indexed by beam.
+    PointCloud2D cloud; ///< End points of the scan being integrated, reused between scans.
+    std::vector<PointCloud2D> workerClouds; ///< End points per batch worker, reused between batches.
+    std::vector<float> lidarRanges; ///< Copy of the Lidar ranges for updateMap().
+    const ObstacleTracker* tracker; ///< Tracker whose moving obstacles updateMap() leaves out, or nullptr.
+    bool clearRays; ///< True if updateMap() and updateMapBatch() also mark the cells along each beam as free.
+    MapRegion changed; ///< Bounding box of the cells written since the last takeChangedRegion() call.
+
+    /**
+     * @brief Grows the changed region to include a rectangle, clipped to the map.
+     * @param xMin First column.
+     * @param yMin First row.
+     * @param xMax One past the last column.
+     * @param yMax One past the last row.
+     */
+    void markChanged(int xMin, int yMin, int xMax, int yMax);
+
+    /**
+     * @brief Integrates a scan: the end points become occupied, and with ray clearing the cells along every beam free.
+     * @param ranges The ranges in meters.
+     * @param rangeCount Number of ranges.
+     * @param angleMin Angle of the first beam in degrees.
+     * @param angleIncrement Angle between beams in degrees.
+     * @param robotPose Pose of the robot when the scan was measured (heading in radians).
+     */
+    void insertScan(const float* ranges, int rangeCount, double angleMin, double angleIncrement, const Pose& robotPose);
 
 public:
     /**
@@ -42,6 +101,71 @@ public:
      */
     void updateMap();
 
+    /**
+     * @brief Updates the map from a scan captured elsewhere (e.g. by another pipeline stage).
+     * Does not touch the Lidar sensor or the robot controller.
+     * @param scan The scan and the pose it was taken at; beam angles are in degrees, the heading in radians.
+     */
+    void updateMap(const LidarScan& scan);
+
+    /**
+     * @brief Integrates many scans in parallel.
+     *
+     * Beams are first binned by the map tiles they cross, then each tile is integrated by
+     * exactly one worker, so no two threads ever write the same cell. The result is identical to
+     * calling updateMap(scan) for every scan with the same ray clearing setting (see
+     * setRayClearing), in any order and with any thread count.
+     *
+     * @param scans The scans and the poses they were taken at.
+     * @param threadCount Number of worker threads (0 = hardware concurrency).
+     * @return Statistics of the batch.
+     */
+    BatchStats updateMapBatch(const std::vector<LidarScan>& scans, int threadCount = 0);
+
+    /**
+     * @brief Sets the edge length of the tiles used by updateMapBatch.
+     * @param cells Tile edge length in cells.
+     */
+    void setTileSize(int cells);
+
+    /**
+     * @brief Sets a tracker whose moving obstacles updateMap() leaves out of the map.
+     *
+     * End points on a dynamic track are not marked occupied; with ray clearing the free space
+     * along their beams is still cleared. The tracker should have processed the scan being integrated, or one
+     * shortly before it. updateMapBatch() integrates past scans and does not consult it.
+     *
+     * @param obstacleTracker The tracker, or nullptr to integrate every end point.
+     */
+    void setObstacleTracker(const ObstacleTracker* obstacleTracker);
+
+    /**
+     * @brief Sets whether updateMap() and updateMapBatch() also mark the cells along each beam as free.
+     *
+     * Off by default, so that the map holds only unknown (0) and occupied (1) cells, as
+     * showMap(), recordMap() and older consumers expect. Frontier exploration needs the free
+     * cells and turns it on.
+     *
+     * @param enabled True to mark the cells along each beam as free.
+     */
+    void setRayClearing(bool enabled);
+
+    /**
+     * @brief Returns the cells written since the last call and starts a new region.
+     *
+     * Consumers that keep state derived from the map, such as frontiers or planning grids,
+     * only need to revisit this rectangle (and its neighbourhood) after each update.
+     *
+     * @return Bounding box of the cells written by updateMap() and updateMapBatch().
+     */
+    MapRegion takeChangedRegion();
+
+    /**
+     * @brief Returns the map.
+     * @return Const reference to the map.
+     */
+    const Map& getMap() const;
+
     /**
      * @brief Records the current map to a file.
      * @param filename The name of the file where the map will be saved.
@@ -0,0 +1,221 @@
+/**
+ * @file MapperBatchTest.cpp
+ * @brief Test and benchmark application for Mapper::updateMapBatch.
+ * @details Generates synthetic scans in a walled room with pillars, checks that the parallel
+ * batch integration produces exactly the map of the sequential one, with and without ray
+ * clearing, and measures how it scales from 1 to 16 threads. The number of scans can be passed as the first argument (default 10000).
+ * @date October, 2026
+ */
+
+#include "Mapper.h"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Distance from (x, y) along direction a to the nearest wall or pillar of the test room.
+ * @param x Start x in meters.
+ * @param y Start y in meters.
+ * @param a Direction in radians.
+ * @return The distance in meters.
+ */
+double castRay(double x, double y, double a) {
+    const double wallMin = 0.5, wallMax = 19.5;
+    const double pillars[3][3] = { { 6.0, 6.0, 0.8 }, { 14.0, 7.0, 1.2 }, { 9.0, 14.0, 1.0 } };
+    double c = cos(a), s = sin(a);
+    double best = 1e9;
+    if (c > 1e-9) best = (wallMax - x) / c < best ? (wallMax - x) / c : best;
+    if (c < -1e-9) best = (wallMin - x) / c < best ? (wallMin - x) / c : best;
+    if (s > 1e-9) best = (wallMax - y) / s < best ? (wallMax - y) / s : best;
+    if (s < -1e-9) best = (wallMin - y) / s < best ? (wallMin - y) / s : best;
+    for (int i = 0; i < 3; i++) {
+        double fx = x - pillars[i][0], fy = y - pillars[i][1], r = pillars[i][2];
+        double b = fx * c + fy * s;
+        double disc = b * b - (fx * fx + fy * fy - r * r);
+        if (disc >= 0) {
+            double t = -b - sqrt(disc);
+            if (t > 0 && t < best) {
+                best = t;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Distance from (x, y) to the nearest wall or pillar surface of the test room.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @return The distance in meters.
+ */
+double surfaceDistance(double x, double y) {
+    const double pillars[3][3] = { { 6.0, 6.0, 0.8 }, { 14.0, 7.0, 1.2 }, { 9.0, 14.0, 1.0 } };
+    double best = fabs(x - 0.5);
+    best = fabs(x - 19.5) < best ? fabs(x - 19.5) : best;
+    best = fabs(y - 0.5) < best ? fabs(y - 0.5) : best;
+    best = fabs(y - 19.5) < best ? fabs(y - 19.5) : best;
+    for (int i = 0; i < 3; i++) {
+        double d = fabs(hypot(x - pillars[i][0], y - pillars[i][1]) - pillars[i][2]);
+        best = d < best ? d : best;
+    }
+    return best;
+}
+
+/**
+ * @brief Generates scans from random free positions and headings in the test room.
+ * @param count Number of scans.
+ * @param seed Random seed.
+ * @return The scans.
+ */
+vector<LidarScan> makeScans(int count, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_real_distribution<double> position(1.0, 19.0);
+    uniform_real_distribution<double> heading(-M_PI, M_PI);
+    vector<LidarScan> scans(count);
+    for (int s = 0; s < count; s++) {
+        LidarScan& scan = scans[s];
+        double x, y;
+        do {
+            x = position(rng);
+            y = position(rng);
+        } while (castRay(x, y, 0.0) < 0.3 || castRay(x, y, M_PI) < 0.3);
+        scan.timestamp = s * 0.1;
+        scan.pose = Pose(x, y, heading(rng));
+        scan.angleMin = -120.0;
+        scan.angleIncrement = 0.36;
+        scan.rangeNumber = 667;
+        for (int i = 0; i < scan.rangeNumber; i++) {
+            double angle = scan.pose.getTh() + degToRad(scan.angleMin + i * scan.angleIncrement);
+            scan.ranges[i] = static_cast<float>(castRay(x, y, angle));
+        }
+    }
+    return scans;
+}
+
+/**
+ * @brief Checks whether two maps hold the same cells.
+ * @param a First map.
+ * @param b Second map.
+ * @return True if every cell matches.
+ */
+bool sameMap(const Map& a, const Map& b) {
+    for (int i = 0; i < a.getNumberX(); i++) {
+        for (int j = 0; j < a.getNumberY(); j++) {
+            if (a.getGrid(i, j) != b.getGrid(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Main function for testing and benchmarking the batch map integration.
+ * @param argc Argument count.
+ * @param argv argv[1] optionally sets the number of benchmark scans.
+ * @return Returns 0 upon successful execution.
+ */
+int main(int argc, char* argv[]) {
+    const int cells = 400;
+    const double cellSize = 0.05;
+
+    /**
+     * @test Test 1: Batch integration matches scan-by-scan integration for any thread count.
+     */
+    vector<LidarScan> small = makeScans(200, 1);
+    Mapper sequential(cells, cells, cellSize, nullptr, nullptr);
+    sequential.setRayClearing(true);
+    for (size_t i = 0; i < small.size(); i++) {
+        sequential.updateMap(small[i]);
+    }
+    int threadCounts[] = { 1, 3, 8 };
+    for (int t = 0; t < 3; t++) {
+        Mapper batch(cells, cells, cellSize, nullptr, nullptr);
+        batch.setRayClearing(true);
+        batch.setTileSize(t == 1 ? 17 : 32);
+        BatchStats stats = batch.updateMapBatch(small, threadCounts[t]);
+        assert(stats.scans == 200 && stats.beams == 200 * 667 && stats.outOfBounds == 0);
+        assert(sameMap(sequential.getMap(), batch.getMap()));
+    }
+    int occupied = 0, freeCells = 0;
+    for (int i = 0; i < cells; i++) {
+        for (int j = 0; j < cells; j++) {
+            occupied += sequential.getMap().getGrid(i, j) == Map::CELL_OCCUPIED;
+            freeCells += sequential.getMap().getGrid(i, j) == Map::CELL_FREE;
+        }
+    }
+    for (int i = 0; i < cells; i++) {
+        for (int j = 0; j < cells; j++) {
+            if (sequential.getMap().getGrid(i, j) == Map::CELL_OCCUPIED) { // Headings in radians put hits on surfaces
+                assert(surfaceDistance((i + 0.5) * cellSize, (j + 0.5) * cellSize) < cellSize);
+            }
+        }
+    }
+    cout << "Reference map: " << occupied << " occupied, " << freeCells << " free cells." << endl;
+    assert(occupied > 0 && freeCells > occupied);
+    assert(sequential.getMap().getGrid(10, 10) == Map::CELL_OCCUPIED); // Corner of the walls
+
+    /**
+     * @test Test 2: With ray clearing off the batch only marks the end points, like updateMap().
+     */
+    Mapper pointsOnly(cells, cells, cellSize, nullptr, nullptr);
+    for (size_t i = 0; i < small.size(); i++) {
+        pointsOnly.updateMap(small[i]);
+    }
+    for (int t = 0; t < 3; t++) {
+        Mapper batch(cells, cells, cellSize, nullptr, nullptr);
+        batch.setTileSize(t == 1 ? 17 : 32);
+        BatchStats stats = batch.updateMapBatch(small, threadCounts[t]);
+        assert(stats.scans == 200 && stats.beams == 200 * 667 && stats.binEntries == 200 * 667);
+        assert(sameMap(pointsOnly.getMap(), batch.getMap()));
+    }
+    int pointCells = 0;
+    for (int i = 0; i < cells; i++) {
+        for (int j = 0; j < cells; j++) {
+            assert(pointsOnly.getMap().getGrid(i, j) != Map::CELL_FREE);
+            pointCells += pointsOnly.getMap().getGrid(i, j) == Map::CELL_OCCUPIED;
+        }
+    }
+    assert(pointCells == occupied);
+    cout << "Without ray clearing: " << pointCells << " occupied, no free cells." << endl;
+
+    /**
+     * @test Test 3: Scaling benchmark on a large batch with ray clearing.
+     */
+    int scanCount = argc > 1 ? atoi(argv[1]) : 10000;
+    vector<LidarScan> scans = makeScans(scanCount, 2);
+    cout << "\nIntegrating " << scanCount << " scans (" << thread::hardware_concurrency()
+        << " hardware threads available)" << endl;
+    cout << setw(8) << "threads" << setw(12) << "bin ms" << setw(14) << "integrate ms"
+        << setw(12) << "total ms" << setw(10) << "speedup" << setw(10) << "steals" << endl;
+
+    Mapper reference(cells, cells, cellSize, nullptr, nullptr);
+    double baseline = 0.0;
+    int benchmarkThreads[] = { 1, 2, 4, 8, 16 };
+    for (int t = 0; t < 5; t++) {
+        Mapper* mapper = t == 0 ? &reference : new Mapper(cells, cells, cellSize, nullptr, nullptr);
+        mapper->setRayClearing(true);
+        BatchStats stats = mapper->updateMapBatch(scans, benchmarkThreads[t]);
+        double total = stats.binMs + stats.integrateMs;
+        if (t == 0) {
+            baseline = total;
+        }
+        cout << fixed << setprecision(1) << setw(8) << benchmarkThreads[t] << setw(12) << stats.binMs
+            << setw(14) << stats.integrateMs << setw(12) << total << setw(9) << baseline / total << "x"
+            << setw(10) << stats.steals << endl;
+        if (t > 0) {
+            assert(sameMap(reference.getMap(), mapper->getMap()));
+            delete mapper;
+        }
+    }
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
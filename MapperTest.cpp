@@ -37,6 +37,11 @@ void testMapper() {
 
     cout << "Map:" << endl;
     mapper.showMap();
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            assert(mapper.getMap().getGrid(i, j) != Map::CELL_FREE && "Rays are only cleared on request!");
+        }
+    }
 
     /**
      * @test Test 2: Save the map to a file and verify success.
@@ -6,7 +6,14 @@
  */
 
 #include "MotionMenu.h"
+#include <cmath>
+#include <conio.h>
 #include <iostream>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 using namespace std;
 
 /**
@@ -46,6 +53,21 @@ void MotionMenu::showMenu() {
     } while (choice != 10);
 }
 
+/**
+ * @brief Waits for the running motion primitive, canceling it when a key is pressed.
+ * @return The result of the motion.
+ */
+MotionResult MotionMenu::waitOrCancel() {
+    cout << "Press any key to cancel." << endl;
+    while (!Control->waitForMotion(100)) {
+        if (_kbhit()) {
+            _getch();
+            Control->cancelMotion();
+        }
+    }
+    return Control->getMotionResult();
+}
+
 /**
  * @brief Executes the selected motion command based on the user's choice.
  */
@@ -88,28 +110,48 @@ void MotionMenu::ExecuteChoice() {
         SafeNav->moveBackwardSafe();
         cout << "Safe Move Robot activated!" << endl;
         break;
-    case 7:
-        Control->turnLeft();
-        cout << "Robot turned left!" << endl;
-        Sleep(1000);
-        Control->stop();
+    case 7: {
+        double heading = Control->getPose().getTh() + M_PI / 2.0;
+        Control->rotateToHeading(heading);
+        MotionResult result = waitOrCancel();
+        if (result.completed) {
+            cout << "Robot turned left! (error: " << result.error * 180.0 / M_PI << " deg, "
+                << result.elapsed << " s)" << endl;
+        }
+        else {
+            cout << "Turn canceled after " << result.elapsed << " s." << endl;
+        }
         break;
-    case 8:
-        Control->turnRight();
-        cout << "Robot turned right!" << endl;
-        Sleep(1000);
-        Control->stop();
+    }
+    case 8: {
+        double heading = Control->getPose().getTh() - M_PI / 2.0;
+        Control->rotateToHeading(heading);
+        MotionResult result = waitOrCancel();
+        if (result.completed) {
+            cout << "Robot turned right! (error: " << result.error * 180.0 / M_PI << " deg, "
+                << result.elapsed << " s)" << endl;
+        }
+        else {
+            cout << "Turn canceled after " << result.elapsed << " s." << endl;
+        }
         break;
+    }
     case 9: {
         double distance;
-        cout << "Enter the distance to move: ";
+        double direction;
+        cout << "Enter the distance to move (m): ";
         cin >> distance;
-        for (int i = 0; i < distance; ++i) {
-            Control->moveForward();
-            Sleep(2000);
-            Control->stop();
+        cout << "Enter the direction (degrees, 0 = forward, 90 = left): ";
+        cin >> direction;
+        Control->driveDistance(distance, direction * M_PI / 180.0);
+        MotionResult result = waitOrCancel();
+        if (result.completed) {
+            cout << "Robot moved " << distance << " m (error: " << result.error << " m, "
+                << result.elapsed << " s)." << endl;
+        }
+        else {
+            cout << "Move canceled after " << result.elapsed << " s (error: " << result.error << " m)." << endl;
         }
-        cout << "Robot moved " << distance << " units." << endl;
         break;
     }
     case 10:
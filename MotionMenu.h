@@ -21,6 +21,13 @@ private:
     int choice;                /**< Variable to store the user's menu choice. */
     SafeNavigation* SafeNav;   /**< Pointer to the SafeNavigation object for safe movement. */
 
+    /**
+     * @brief Waits for the running motion primitive, polling the keyboard every 100 ms so that
+     * a key press cancels it.
+     * @return The result of the motion.
+     */
+    MotionResult waitOrCancel();
+
 public:
     /**
      * @brief Constructor for the MotionMenu class.
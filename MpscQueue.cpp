@@ -0,0 +1,158 @@
+/**
+ * @file MpscQueue.cpp
+ * @brief Implementation of the MpscQueue class.
+ * @date October 2026
+ */
+
+#include "MpscQueue.h"
+#include <thread>
+using namespace std;
+
+/**
+ * @brief Constructor for the MpscQueue class. All storage is allocated here.
+ * @param capacity Minimum capacity; rounded up to a power of two.
+ * @param policy Behaviour when the queue is full.
+ */
+MpscQueue::MpscQueue(uint32_t capacity, BackpressurePolicy policy)
+    : policy(policy), head(0), tail(0), pushed(0), popped(0), dropped(0), rejected(0) {
+    uint64_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    cells.reset(new Cell[static_cast<size_t>(size)]);
+    for (uint64_t i = 0; i < size; i++) {
+        cells[i].sequence.store(i, memory_order_relaxed);
+        cells[i].value.store(0, memory_order_relaxed);
+    }
+    mask = size - 1;
+}
+
+/**
+ * @brief Queues an index. Safe from any number of producer threads.
+ * @param index The index to queue.
+ * @param evicted Receives the evicted index when the result is PUSH_EVICTED (may be nullptr).
+ * @return The outcome of the push.
+ */
+PushResult MpscQueue::push(uint32_t index, uint32_t* evicted) {
+    PushResult result = PUSH_OK;
+    uint64_t pos = tail.load(memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells[pos & mask];
+        uint64_t sequence = cell->sequence.load(memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // The cell still holds an item from the previous lap: the queue is full.
+            if (policy == REJECT) {
+                rejected.fetch_add(1, memory_order_relaxed);
+                return PUSH_REJECTED;
+            }
+            if (policy == DROP_OLDEST && result == PUSH_OK) {
+                uint32_t victim;
+                if (pop(victim)) {
+                    if (evicted) {
+                        *evicted = victim;
+                    }
+                    dropped.fetch_add(1, memory_order_relaxed);
+                    result = PUSH_EVICTED;
+                }
+            }
+            else {
+                this_thread::yield();
+            }
+            pos = tail.load(memory_order_relaxed);
+        }
+        else {
+            pos = tail.load(memory_order_relaxed);
+        }
+    }
+    cell->value.store(index, memory_order_relaxed);
+    cell->sequence.store(pos + 1, memory_order_release);
+    pushed.fetch_add(1, memory_order_relaxed);
+    return result;
+}
+
+/**
+ * @brief Removes the oldest index.
+ * @param index Receives the index.
+ * @return True if an index was removed, false if the queue was empty.
+ */
+bool MpscQueue::pop(uint32_t& index) {
+    uint64_t pos = head.load(memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells[pos & mask];
+        uint64_t sequence = cell->sequence.load(memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos + 1);
+        if (diff == 0) {
+            if (head.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            return false; // Empty (or the producer of this cell has not finished yet)
+        }
+        else {
+            pos = head.load(memory_order_relaxed);
+        }
+    }
+    index = cell->value.load(memory_order_relaxed);
+    cell->sequence.store(pos + mask + 1, memory_order_release);
+    popped.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Returns the number of queued items (approximate while threads are active).
+ * @return The queue depth.
+ */
+uint32_t MpscQueue::size() const {
+    uint64_t h = head.load(memory_order_acquire);
+    uint64_t t = tail.load(memory_order_acquire);
+    return t > h ? static_cast<uint32_t>(t - h) : 0;
+}
+
+/**
+ * @brief Returns the capacity of the queue.
+ * @return The capacity.
+ */
+uint32_t MpscQueue::capacity() const {
+    return static_cast<uint32_t>(mask + 1);
+}
+
+/**
+ * @brief Returns the number of items queued so far.
+ * @return The push count.
+ */
+unsigned long MpscQueue::getPushed() const {
+    return pushed.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items removed so far, including evictions.
+ * @return The pop count.
+ */
+unsigned long MpscQueue::getPopped() const {
+    return popped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items evicted by DROP_OLDEST.
+ * @return The drop count.
+ */
+unsigned long MpscQueue::getDropped() const {
+    return dropped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items refused by REJECT.
+ * @return The reject count.
+ */
+unsigned long MpscQueue::getRejected() const {
+    return rejected.load(memory_order_relaxed);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file MpscQueue.h
+ * @brief Declaration of the MpscQueue class, a bounded lock-free multi-producer queue of pool indices.
+ * @date October 2026
+ */
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include "SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @class MpscQueue
+ * @brief Bounded lock-free queue of 32-bit indices for several producers and one consumer.
+ *
+ * Each cell carries a sequence number that tells producers and consumers whether it is free
+ * or filled for the current lap, so producers only contend on a compare-and-swap of the tail.
+ * Popping is also safe from several threads; DROP_OLDEST relies on this, since a producer that
+ * finds the queue full pops the oldest item itself and hands the evicted index back.
+ */
+class MpscQueue {
+private:
+    /**
+     * @struct Cell
+     * @brief One slot of the ring with its sequence number.
+     */
+    struct Cell {
+        std::atomic<uint64_t> sequence; /**< Lap marker of the cell. */
+        std::atomic<uint32_t> value;    /**< Stored index. */
+    };
+
+    std::unique_ptr<Cell[]> cells;      /**< Ring storage. */
+    uint64_t mask;                      /**< Capacity - 1 (capacity is a power of two). */
+    BackpressurePolicy policy;          /**< Full-queue behaviour. */
+    char pad0[64];                      /**< Keeps head on its own cache line. */
+    std::atomic<uint64_t> head;         /**< Next position to pop. */
+    char pad1[64];                      /**< Keeps tail on its own cache line. */
+    std::atomic<uint64_t> tail;         /**< Next position to push. */
+    char pad2[64];                      /**< Separates the counters from tail. */
+    std::atomic<unsigned long> pushed;  /**< Items queued. */
+    std::atomic<unsigned long> popped;  /**< Items removed (including evictions). */
+    std::atomic<unsigned long> dropped; /**< Items evicted by DROP_OLDEST. */
+    std::atomic<unsigned long> rejected; /**< Items refused by REJECT. */
+
+public:
+    /**
+     * @brief Constructor for the MpscQueue class.
+     * @param capacity Minimum capacity; rounded up to a power of two.
+     * @param policy Behaviour when the queue is full.
+     */
+    MpscQueue(uint32_t capacity, BackpressurePolicy policy);
+
+    /**
+     * @brief Queues an index. Safe from any number of producer threads.
+     * @param index The index to queue.
+     * @param evicted Receives the evicted index when the result is PUSH_EVICTED (may be nullptr).
+     * @return The outcome of the push.
+     */
+    PushResult push(uint32_t index, uint32_t* evicted);
+
+    /**
+     * @brief Removes the oldest index.
+     * @param index Receives the index.
+     * @return True if an index was removed, false if the queue was empty.
+     */
+    bool pop(uint32_t& index);
+
+    /**
+     * @brief Returns the number of queued items (approximate while threads are active).
+     * @return The queue depth.
+     */
+    uint32_t size() const;
+
+    /**
+     * @brief Returns the capacity of the queue.
+     * @return The capacity.
+     */
+    uint32_t capacity() const;
+
+    /**
+     * @brief Returns the number of items queued so far.
+     * @return The push count.
+     */
+    unsigned long getPushed() const;
+
+    /**
+     * @brief Returns the number of items removed so far, including evictions.
+     * @return The pop count.
+     */
+    unsigned long getPopped() const;
+
+    /**
+     * @brief Returns the number of items evicted by DROP_OLDEST.
+     * @return The drop count.
+     */
+    unsigned long getDropped() const;
+
+    /**
+     * @brief Returns the number of items refused by REJECT.
+     * @return The reject count.
+     */
+    unsigned long getRejected() const;
+};
+
+#endif // MPSCQUEUE_H
@@ -0,0 +1,94 @@
+/**
+ * @file ObjectPool.h
+ * @brief Declaration and implementation of the ObjectPool class template, a fixed set of
+ *        preallocated objects handed out by index.
+ * @date October 2026
+ */
+
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include "MpscQueue.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class ObjectPool
+ * @brief Preallocates a fixed number of objects and hands them out by index.
+ *
+ * Free indices live in a lock-free MpscQueue, so any pipeline stage can acquire or release an
+ * object without locks and without allocating. Objects are reused as-is; the acquirer is
+ * responsible for overwriting the fields it uses.
+ *
+ * @tparam T Type of the pooled objects; must be default constructible.
+ */
+template <typename T>
+class ObjectPool {
+private:
+    std::vector<T> objects; /**< The preallocated objects. */
+    MpscQueue freeList;     /**< Indices of the objects not currently in use. */
+
+public:
+    /**
+     * @brief Constructor for the ObjectPool class. Allocates all objects up front.
+     * @param count Number of objects in the pool.
+     */
+    explicit ObjectPool(uint32_t count) : objects(count), freeList(count, REJECT) {
+        for (uint32_t i = 0; i < count; i++) {
+            freeList.push(i, nullptr);
+        }
+    }
+
+    /**
+     * @brief Takes an unused object out of the pool.
+     * @param index Receives the index of the object.
+     * @return True on success, false if every object is in use.
+     */
+    bool acquire(uint32_t& index) {
+        return freeList.pop(index);
+    }
+
+    /**
+     * @brief Returns an object to the pool.
+     * @param index Index of the object obtained from acquire().
+     */
+    void release(uint32_t index) {
+        freeList.push(index, nullptr);
+    }
+
+    /**
+     * @brief Accesses an object by index.
+     * @param index Index of the object.
+     * @return Reference to the object.
+     */
+    T& operator[](uint32_t index) {
+        return objects[index];
+    }
+
+    /**
+     * @brief Accesses an object by index.
+     * @param index Index of the object.
+     * @return Const reference to the object.
+     */
+    const T& operator[](uint32_t index) const {
+        return objects[index];
+    }
+
+    /**
+     * @brief Returns the number of objects currently available.
+     * @return The number of free objects.
+     */
+    uint32_t available() const {
+        return freeList.size();
+    }
+
+    /**
+     * @brief Returns the total number of objects in the pool.
+     * @return The pool size.
+     */
+    uint32_t size() const {
+        return static_cast<uint32_t>(objects.size());
+    }
+};
+
+#endif // OBJECTPOOL_H
@@ -0,0 +1,353 @@
+/**
+ * @file ObstacleTracker.cpp
+ * @brief Implementation of the ObstacleTracker class.
+ * @date October 2026
+ */
+
+#include "ObstacleTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+const float ObstacleTracker::GATE = 9.21f;
+const int ObstacleTracker::CONFIRM_HITS = 3;
+const int ObstacleTracker::MAX_MISSES = 5;
+const float ObstacleTracker::DYNAMIC_SPEED = 0.3f;
+const float ObstacleTracker::DYNAMIC_MARGIN = 0.1f;
+const float ObstacleTracker::INITIAL_SPEED_SIGMA = 2.0f;
+
+/**
+ * @brief Constructor for the ObstacleTracker class.
+ * @param maxTracks Number of tracks the pool holds; further clusters do not start tracks.
+ * @param maxObjectWidth Clusters wider than this are not tracked, in meters.
+ * @param measurementSigma Standard deviation of a cluster centroid, per axis, in meters.
+ * @param accelerationSigma Standard deviation of the acceleration of obstacles, in meters per second squared.
+ */
+ObstacleTracker::ObstacleTracker(size_t maxTracks, float maxObjectWidth, float measurementSigma, float accelerationSigma)
+    : segmenter(maxTracks * 2), tracks(maxTracks), trackCount(0), trackCluster(maxTracks, -1), nextId(1),
+      lastTime(0.0), started(false), maxWidth(maxObjectWidth),
+      measurementVariance(static_cast<double>(measurementSigma) * measurementSigma),
+      accelerationVariance(static_cast<double>(accelerationSigma) * accelerationSigma), dynamicCount(0),
+      dynamicMinX(0.0f), dynamicMinY(0.0f), dynamicMaxX(0.0f), dynamicMaxY(0.0f), stats() {}
+
+/**
+ * @brief Ends every track and clears the counters.
+ */
+void ObstacleTracker::reset() {
+    trackCount = 0;
+    started = false;
+    dynamicCount = 0;
+    stats = ObstacleTrackerStats();
+}
+
+/**
+ * @brief Moves every track forward to a time.
+ *
+ * Per axis, the state (p, v) moves by p += v * dt and the covariance by F P F^T + Q, with the
+ * white noise acceleration model Q = q * [dt^4 / 4, dt^3 / 2; dt^3 / 2, dt^2].
+ *
+ * @param dt Time since the last scan, in seconds.
+ */
+void ObstacleTracker::predict(double dt) {
+    if (dt <= 0.0) {
+        return;
+    }
+    const double dt2 = dt * dt;
+    const double q11 = accelerationVariance * dt2 * dt2 / 4.0;
+    const double q12 = accelerationVariance * dt2 * dt / 2.0;
+    const double q22 = accelerationVariance * dt2;
+    for (size_t i = 0; i < trackCount; i++) {
+        ObstacleTrack& t = tracks[i];
+        t.x += t.vx * dt;
+        t.y += t.vy * dt;
+        t.varX += 2.0 * dt * t.covXVx + dt2 * t.varVx + q11;
+        t.covXVx += dt * t.varVx + q12;
+        t.varVx += q22;
+        t.varY += 2.0 * dt * t.covYVy + dt2 * t.varVy + q11;
+        t.covYVy += dt * t.varVy + q12;
+        t.varVy += q22;
+    }
+}
+
+/**
+ * @brief Collects the gated pairs and assigns clusters to tracks, shortest distance first.
+ *
+ * Greedy assignment is not always the optimum of the Hungarian method, but the two only differ
+ * when gates overlap in a way where no choice is clearly right, and it keeps the cost at a sort
+ * of the gated pairs, which are few since each cluster passes the gate of few tracks.
+ *
+ * @param clusters The clusters.
+ * @param clusterCount Number of clusters.
+ */
+void ObstacleTracker::associate(const ScanCluster* clusters, size_t clusterCount) {
+    pairs.clear();
+    for (size_t t = 0; t < trackCount; t++) {
+        const ObstacleTrack& track = tracks[t];
+        trackCluster[t] = -1;
+        const double sx = track.varX + measurementVariance;
+        const double sy = track.varY + measurementVariance;
+        for (size_t c = 0; c < clusterCount; c++) {
+            if (!clusterUsed[c]) { // Only clusters that may be tracked take part
+                double ex = clusters[c].centroidX - track.x;
+                double ey = clusters[c].centroidY - track.y;
+                double distance = ex * ex / sx + ey * ey / sy;
+                if (distance <= GATE) {
+                    Pair pair = { static_cast<float>(distance), static_cast<int>(t), static_cast<int>(c) };
+                    pairs.push_back(pair);
+                }
+            }
+        }
+    }
+    sort(pairs.begin(), pairs.end(), [](const Pair& a, const Pair& b) { return a.distance < b.distance; });
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const Pair& pair = pairs[i];
+        if (trackCluster[pair.track] < 0 && clusterUsed[pair.cluster] == 0) {
+            trackCluster[pair.track] = pair.cluster;
+            clusterUsed[pair.cluster] = 2;
+        }
+    }
+}
+
+/**
+ * @brief Corrects a track with the centroid of a cluster.
+ *
+ * The measurement is the position, so per axis the innovation variance is S = P11 + R and the
+ * gain K = (P11, P12) / S.
+ *
+ * @param track The track.
+ * @param cluster The cluster.
+ * @param timestamp Time of the scan, in seconds.
+ */
+void ObstacleTracker::correct(ObstacleTrack& track, const ScanCluster& cluster, double timestamp) {
+    double s = track.varX + measurementVariance;
+    double k1 = track.varX / s, k2 = track.covXVx / s;
+    double e = cluster.centroidX - track.x;
+    track.x += k1 * e;
+    track.vx += k2 * e;
+    track.varVx -= k2 * track.covXVx;
+    track.varX *= 1.0 - k1;
+    track.covXVx *= 1.0 - k1;
+
+    s = track.varY + measurementVariance;
+    k1 = track.varY / s;
+    k2 = track.covYVy / s;
+    e = cluster.centroidY - track.y;
+    track.y += k1 * e;
+    track.vy += k2 * e;
+    track.varVy -= k2 * track.covYVy;
+    track.varY *= 1.0 - k1;
+    track.covYVy *= 1.0 - k1;
+
+    track.halfWidth = 0.5f * (cluster.maxX - cluster.minX);
+    track.halfHeight = 0.5f * (cluster.maxY - cluster.minY);
+    track.lastSeen = timestamp;
+    track.hits++;
+    track.misses = 0;
+    track.confirmed = track.confirmed || track.hits >= CONFIRM_HITS;
+}
+
+/**
+ * @brief Recomputes the dynamic flags and the box around the dynamic tracks.
+ *
+ * A track is dynamic if it is confirmed, faster than DYNAMIC_SPEED and its velocity differs from
+ * zero beyond the gate, so that noise on the velocity of a fresh track does not make it move.
+ */
+void ObstacleTracker::updateDynamic() {
+    dynamicCount = 0;
+    for (size_t i = 0; i < trackCount; i++) {
+        ObstacleTrack& t = tracks[i];
+        double speed2 = t.vx * t.vx + t.vy * t.vy;
+        double significance = t.vx * t.vx / t.varVx + t.vy * t.vy / t.varVy;
+        t.dynamic = t.confirmed && speed2 > DYNAMIC_SPEED * DYNAMIC_SPEED && significance > GATE;
+        if (!t.dynamic) {
+            continue;
+        }
+        float minX = static_cast<float>(t.x) - t.halfWidth - DYNAMIC_MARGIN;
+        float minY = static_cast<float>(t.y) - t.halfHeight - DYNAMIC_MARGIN;
+        float maxX = static_cast<float>(t.x) + t.halfWidth + DYNAMIC_MARGIN;
+        float maxY = static_cast<float>(t.y) + t.halfHeight + DYNAMIC_MARGIN;
+        if (dynamicCount++ == 0) {
+            dynamicMinX = minX;
+            dynamicMinY = minY;
+            dynamicMaxX = maxX;
+            dynamicMaxY = maxY;
+        }
+        else {
+            dynamicMinX = minX < dynamicMinX ? minX : dynamicMinX;
+            dynamicMinY = minY < dynamicMinY ? minY : dynamicMinY;
+            dynamicMaxX = maxX > dynamicMaxX ? maxX : dynamicMaxX;
+            dynamicMaxY = maxY > dynamicMaxY ? maxY : dynamicMaxY;
+        }
+    }
+}
+
+/**
+ * @brief Processes the clusters of one scan.
+ * @param clusters The clusters, in the world frame.
+ * @param clusterCount Number of clusters.
+ * @param timestamp Time of the scan, in seconds; not earlier than the previous one.
+ * @return The number of live tracks.
+ */
+size_t ObstacleTracker::update(const ScanCluster* clusters, size_t clusterCount, double timestamp) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    predict(started ? timestamp - lastTime : 0.0);
+    lastTime = timestamp;
+    started = true;
+
+    // Clusters too wide for an object are marked as used, so they neither match nor start tracks
+    if (clusterUsed.size() < clusterCount) {
+        clusterUsed.resize(clusterCount);
+    }
+    for (size_t c = 0; c < clusterCount; c++) {
+        float extent = clusters[c].maxX - clusters[c].minX;
+        float height = clusters[c].maxY - clusters[c].minY;
+        extent = height > extent ? height : extent;
+        clusterUsed[c] = extent > maxWidth ? 1 : 0;
+    }
+    associate(clusters, clusterCount);
+
+    for (size_t t = 0; t < trackCount; t++) {
+        if (trackCluster[t] >= 0) {
+            correct(tracks[t], clusters[trackCluster[t]], timestamp);
+        }
+        else {
+            tracks[t].hits = 0;
+            tracks[t].misses++;
+        }
+    }
+    // End lost tracks; the last track fills the gap, its assignment is no longer needed
+    for (size_t t = trackCount; t-- > 0;) {
+        const ObstacleTrack& track = tracks[t];
+        if (track.misses >= (track.confirmed ? MAX_MISSES : 1)) {
+            tracks[t] = tracks[--trackCount];
+            stats.deaths++;
+        }
+    }
+    for (size_t c = 0; c < clusterCount; c++) {
+        if (clusterUsed[c] != 0) {
+            continue;
+        }
+        if (trackCount == tracks.size()) {
+            stats.droppedBirths++;
+            continue;
+        }
+        const ScanCluster& cluster = clusters[c];
+        ObstacleTrack& t = tracks[trackCount++];
+        t.id = nextId++;
+        t.x = cluster.centroidX;
+        t.y = cluster.centroidY;
+        t.vx = t.vy = 0.0;
+        t.varX = t.varY = measurementVariance;
+        t.covXVx = t.covYVy = 0.0;
+        t.varVx = t.varVy = static_cast<double>(INITIAL_SPEED_SIGMA) * INITIAL_SPEED_SIGMA;
+        t.halfWidth = 0.5f * (cluster.maxX - cluster.minX);
+        t.halfHeight = 0.5f * (cluster.maxY - cluster.minY);
+        t.lastSeen = timestamp;
+        t.hits = 1;
+        t.misses = 0;
+        t.confirmed = CONFIRM_HITS <= 1;
+        stats.births++;
+    }
+    updateDynamic();
+
+    stats.frames++;
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+    stats.longestUs = stats.lastUs > stats.longestUs ? stats.lastUs : stats.longestUs;
+    return trackCount;
+}
+
+/**
+ * @brief Processes the clusters of a segmenter.
+ * @param segmenter The segmenter, after segmenting a scan in the world frame.
+ * @param timestamp Time of the scan, in seconds.
+ * @return The number of live tracks.
+ */
+size_t ObstacleTracker::update(const ScanSegmenter& segmenter, double timestamp) {
+    return update(segmenter.getClusters(), segmenter.getClusterCount(), timestamp);
+}
+
+/**
+ * @brief Segments a pooled scan in the world frame given by its pose and processes its clusters.
+ * @param scan The scan.
+ * @return The number of live tracks.
+ */
+size_t ObstacleTracker::update(const LidarScan& scan) {
+    segmenter.segment(scan);
+    return update(segmenter, scan.timestamp);
+}
+
+/**
+ * @brief Returns the number of live tracks.
+ * @return The number of tracks.
+ */
+size_t ObstacleTracker::getTrackCount() const {
+    return trackCount;
+}
+
+/**
+ * @brief Returns a live track.
+ * @param index Index of the track, less than getTrackCount().
+ * @return The track.
+ */
+const ObstacleTrack& ObstacleTracker::getTrack(size_t index) const {
+    return tracks[index];
+}
+
+/**
+ * @brief Returns the live tracks.
+ * @return Pointer to getTrackCount() tracks.
+ */
+const ObstacleTrack* ObstacleTracker::getTracks() const {
+    return tracks.empty() ? nullptr : &tracks[0];
+}
+
+/**
+ * @brief Finds a live track by identifier.
+ * @param id The identifier.
+ * @return The track, or nullptr if no live track has this identifier.
+ */
+const ObstacleTrack* ObstacleTracker::findTrack(unsigned long id) const {
+    for (size_t i = 0; i < trackCount; i++) {
+        if (tracks[i].id == id) {
+            return &tracks[i];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns the number of dynamic tracks.
+ * @return The number of dynamic tracks.
+ */
+int ObstacleTracker::getDynamicCount() const {
+    return dynamicCount;
+}
+
+/**
+ * @brief Tells whether a point lies on a dynamic track, within DYNAMIC_MARGIN of its extent.
+ * @param x X of the point in the world frame.
+ * @param y Y of the point in the world frame.
+ * @return True if the point belongs to a moving obstacle.
+ */
+bool ObstacleTracker::isDynamic(float x, float y) const {
+    if (dynamicCount == 0 || x < dynamicMinX || x > dynamicMaxX || y < dynamicMinY || y > dynamicMaxY) {
+        return false;
+    }
+    for (size_t i = 0; i < trackCount; i++) {
+        const ObstacleTrack& t = tracks[i];
+        if (t.dynamic && fabs(x - t.x) <= t.halfWidth + DYNAMIC_MARGIN && fabs(y - t.y) <= t.halfHeight + DYNAMIC_MARGIN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the counters.
+ * @return The counters.
+ */
+const ObstacleTrackerStats& ObstacleTracker::getStats() const {
+    return stats;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file ObstacleTracker.h
+ * @brief Declaration of the ObstacleTracker class, which follows moving obstacles across Lidar scans.
+ * @date October 2026
+ */
+
+#ifndef OBSTACLETRACKER_H
+#define OBSTACLETRACKER_H
+
+#include "ScanSegmenter.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct ObstacleTrack
+ * @brief An obstacle followed across scans with a constant velocity Kalman filter.
+ *
+ * The motion model and the measurement treat x and y alike and independently, so the 4x4
+ * covariance of (x, y, vx, vy) is two 2x2 blocks, one per axis, and only those are stored.
+ * Coordinates are in meters in the world frame, velocities in meters per second.
+ */
+struct ObstacleTrack {
+    unsigned long id;    /**< Identifier, unique over the lifetime of the tracker. */
+    double x, y;         /**< Estimated position of the obstacle's centre. */
+    double vx, vy;       /**< Estimated velocity. */
+    double varX;         /**< Variance of x. */
+    double covXVx;       /**< Covariance of x and vx. */
+    double varVx;        /**< Variance of vx. */
+    double varY;         /**< Variance of y. */
+    double covYVy;       /**< Covariance of y and vy. */
+    double varVy;        /**< Variance of vy. */
+    float halfWidth;     /**< Half the x extent of the last cluster assigned. */
+    float halfHeight;    /**< Half the y extent of the last cluster assigned. */
+    double lastSeen;     /**< Time of the last cluster assigned, in seconds. */
+    int hits;            /**< Scans in a row with a cluster assigned. */
+    int misses;          /**< Scans in a row without a cluster assigned. */
+    bool confirmed;      /**< True once the track had CONFIRM_HITS clusters in a row. */
+    bool dynamic;        /**< True if the track is confirmed and moves faster than DYNAMIC_SPEED. */
+};
+
+/**
+ * @struct ObstacleTrackerStats
+ * @brief Counters of an ObstacleTracker since construction or reset().
+ */
+struct ObstacleTrackerStats {
+    unsigned long frames;        /**< Scans processed. */
+    unsigned long births;        /**< Tracks started. */
+    unsigned long deaths;        /**< Tracks ended. */
+    unsigned long droppedBirths; /**< Tracks that were not started because the pool was full. */
+    double lastUs;               /**< Duration of the last update() call, in microseconds. */
+    double longestUs;            /**< Longest update() call, in microseconds. */
+};
+
+/**
+ * @class ObstacleTracker
+ * @brief Associates the clusters of successive scans with tracks and estimates their velocity.
+ *
+ * Each scan, every track is predicted to the scan time, then clusters are assigned to tracks
+ * greedily: all (track, cluster) pairs whose Mahalanobis distance passes the gate are sorted
+ * and taken shortest first, skipping tracks and clusters already assigned. Assigned tracks are
+ * corrected with the cluster centroid; clusters left over start tentative tracks, which are
+ * confirmed after CONFIRM_HITS scans in a row. A tentative track ends at its first miss, a
+ * confirmed one after MAX_MISSES misses in a row. Clusters wider than the largest object, such
+ * as walls, are never tracked.
+ *
+ * Tracks live in an array allocated in the constructor; update() does not allocate once the
+ * buffers have grown to the number of clusters seen. The work per scan is bounded by the number
+ * of tracks times the number of clusters.
+ *
+ * Confirmed tracks faster than DYNAMIC_SPEED are dynamic. isDynamic() tells whether a point
+ * lies on one of them, so that Mapper::updateMap can leave moving obstacles out of the map.
+ */
+class ObstacleTracker {
+private:
+    /**
+     * @struct Pair
+     * @brief A track and a cluster that may belong together.
+     */
+    struct Pair {
+        float distance;  /**< Squared Mahalanobis distance of the cluster from the track. */
+        int track;       /**< Index of the track. */
+        int cluster;     /**< Index of the cluster. */
+    };
+
+    ScanSegmenter segmenter;              /**< Splits scans into clusters for update(const LidarScan&). */
+    std::vector<ObstacleTrack> tracks;    /**< The tracks; only the first trackCount are valid. */
+    size_t trackCount;                    /**< Number of live tracks. */
+    std::vector<Pair> pairs;              /**< Gated pairs of the current scan. */
+    std::vector<int> trackCluster;        /**< Cluster assigned to each track in the current scan, or -1. */
+    std::vector<unsigned char> clusterUsed; /**< True for the clusters assigned in the current scan. */
+    unsigned long nextId;                 /**< Identifier of the next track. */
+    double lastTime;                      /**< Time of the last scan, in seconds. */
+    bool started;                         /**< True once a scan has been processed. */
+    float maxWidth;                       /**< Clusters wider than this are not tracked, in meters. */
+    double measurementVariance;           /**< Variance of a cluster centroid, per axis. */
+    double accelerationVariance;          /**< Variance of the white noise acceleration of obstacles. */
+    int dynamicCount;                     /**< Number of dynamic tracks. */
+    float dynamicMinX, dynamicMinY;       /**< Lower corner of the box around every dynamic track. */
+    float dynamicMaxX, dynamicMaxY;       /**< Upper corner of the box around every dynamic track. */
+    ObstacleTrackerStats stats;           /**< Counters. */
+
+    /**
+     * @brief Moves every track forward to a time.
+     * @param dt Time since the last scan, in seconds.
+     */
+    void predict(double dt);
+
+    /**
+     * @brief Collects the gated pairs and assigns clusters to tracks, shortest distance first.
+     * @param clusters The clusters.
+     * @param clusterCount Number of clusters.
+     */
+    void associate(const ScanCluster* clusters, size_t clusterCount);
+
+    /**
+     * @brief Corrects a track with the centroid of a cluster.
+     * @param track The track.
+     * @param cluster The cluster.
+     * @param timestamp Time of the scan, in seconds.
+     */
+    void correct(ObstacleTrack& track, const ScanCluster& cluster, double timestamp);
+
+    /**
+     * @brief Recomputes the dynamic flags and the box around the dynamic tracks.
+     */
+    void updateDynamic();
+
+public:
+    /** @brief Largest squared Mahalanobis distance of a cluster from a track it can be assigned to (99% for 2 degrees of freedom). */
+    static const float GATE;
+    /** @brief Clusters in a row that confirm a track. */
+    static const int CONFIRM_HITS;
+    /** @brief Misses in a row that end a confirmed track. */
+    static const int MAX_MISSES;
+    /** @brief Speed above which a confirmed track is dynamic, in meters per second. */
+    static const float DYNAMIC_SPEED;
+    /** @brief Margin added around dynamic tracks by isDynamic(), in meters. */
+    static const float DYNAMIC_MARGIN;
+    /** @brief Standard deviation of the velocity of a new track, in meters per second. */
+    static const float INITIAL_SPEED_SIGMA;
+
+    /**
+     * @brief Constructor for the ObstacleTracker class.
+     * @param maxTracks Number of tracks the pool holds; further clusters do not start tracks.
+     * @param maxObjectWidth Clusters wider than this are not tracked, in meters.
+     * @param measurementSigma Standard deviation of a cluster centroid, per axis, in meters.
+     * @param accelerationSigma Standard deviation of the acceleration of obstacles, in meters per second squared.
+     */
+    explicit ObstacleTracker(size_t maxTracks = 128, float maxObjectWidth = 1.5f, float measurementSigma = 0.05f,
+        float accelerationSigma = 2.0f);
+
+    /**
+     * @brief Ends every track and clears the counters.
+     */
+    void reset();
+
+    /**
+     * @brief Processes the clusters of one scan.
+     * @param clusters The clusters, in the world frame.
+     * @param clusterCount Number of clusters.
+     * @param timestamp Time of the scan, in seconds; not earlier than the previous one.
+     * @return The number of live tracks.
+     */
+    size_t update(const ScanCluster* clusters, size_t clusterCount, double timestamp);
+
+    /**
+     * @brief Processes the clusters of a segmenter.
+     * @param segmenter The segmenter, after segmenting a scan in the world frame.
+     * @param timestamp Time of the scan, in seconds.
+     * @return The number of live tracks.
+     */
+    size_t update(const ScanSegmenter& segmenter, double timestamp);
+
+    /**
+     * @brief Segments a pooled scan in the world frame given by its pose and processes its clusters.
+     * @param scan The scan.
+     * @return The number of live tracks.
+     */
+    size_t update(const LidarScan& scan);
+
+    /**
+     * @brief Returns the number of live tracks.
+     * @return The number of tracks.
+     */
+    size_t getTrackCount() const;
+
+    /**
+     * @brief Returns a live track.
+     * @param index Index of the track, less than getTrackCount(); indices change as tracks end.
+     * @return The track.
+     */
+    const ObstacleTrack& getTrack(size_t index) const;
+
+    /**
+     * @brief Returns the live tracks.
+     * @return Pointer to getTrackCount() tracks.
+     */
+    const ObstacleTrack* getTracks() const;
+
+    /**
+     * @brief Finds a live track by identifier.
+     * @param id The identifier.
+     * @return The track, or nullptr if no live track has this identifier.
+     */
+    const ObstacleTrack* findTrack(unsigned long id) const;
+
+    /**
+     * @brief Returns the number of dynamic tracks.
+     * @return The number of dynamic tracks.
+     */
+    int getDynamicCount() const;
+
+    /**
+     * @brief Tells whether a point lies on a dynamic track, within DYNAMIC_MARGIN of its extent.
+     * @param x X of the point in the world frame.
+     * @param y Y of the point in the world frame.
+     * @return True if the point belongs to a moving obstacle.
+     */
+    bool isDynamic(float x, float y) const;
+
+    /**
+     * @brief Returns the counters.
+     * @return The counters.
+     */
+    const ObstacleTrackerStats& getStats() const;
+};
+
+#endif // OBSTACLETRACKER_H
@@ -0,0 +1,289 @@
+/**
+ * @file ObstacleTrackerTest.cpp
+ * @brief Test and benchmark application for the ObstacleTracker class.
+ * @details Follows targets at constant velocity, through crossing paths and missed scans, checks
+ * the pool capacity and that the Mapper leaves a walking person out of the map, and measures
+ * the time per scan with 120 targets.
+ * @date October, 2026
+ */
+
+#include "ObstacleTracker.h"
+#include "Mapper.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+using namespace std;
+
+static unsigned long allocations = 0; /**< Calls of operator new, to check that tracking does not allocate. */
+
+/**
+ * @brief Counting replacement of the global operator new.
+ * @param size Bytes to allocate.
+ * @return The memory.
+ */
+void* operator new(size_t size) {
+    allocations++;
+    void* memory = malloc(size ? size : 1);
+    if (!memory) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief Replacement of the global operator delete that matches the counting operator new.
+ * @param memory The memory.
+ */
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+/**
+ * @brief Sized form of the replacement operator delete.
+ * @param memory The memory.
+ */
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+/**
+ * @brief Builds the cluster of a square object.
+ * @param x X of the centre.
+ * @param y Y of the centre.
+ * @param halfSize Half the edge of the square.
+ * @return The cluster.
+ */
+ScanCluster makeCluster(double x, double y, double halfSize) {
+    ScanCluster c = ScanCluster();
+    c.centroidX = static_cast<float>(x);
+    c.centroidY = static_cast<float>(y);
+    c.minX = static_cast<float>(x - halfSize);
+    c.minY = static_cast<float>(y - halfSize);
+    c.maxX = static_cast<float>(x + halfSize);
+    c.maxY = static_cast<float>(y + halfSize);
+    c.pointCount = 10;
+    return c;
+}
+
+/**
+ * @brief Simulates a scan of a 10 m square room with a round person in it.
+ * @param scan Receives the scan; the robot stands at (5, 5) facing +x.
+ * @param personX X of the person.
+ * @param personY Y of the person.
+ * @param timestamp Time of the scan.
+ */
+void simulate(LidarScan& scan, double personX, double personY, double timestamp) {
+    const double radius = 0.25;
+    scan.timestamp = timestamp;
+    scan.pose = Pose(5.0, 5.0, 0.0);
+    scan.angleMin = -120.0;
+    scan.angleIncrement = 0.36;
+    scan.rangeNumber = 667;
+    for (int i = 0; i < scan.rangeNumber; i++) {
+        double angle = degToRad(scan.angleMin + i * scan.angleIncrement);
+        double c = cos(angle), s = sin(angle), best = 1e9;
+        if (c > 1e-9) best = fmin(best, (9.95 - 5.0) / c);
+        if (c < -1e-9) best = fmin(best, (0.05 - 5.0) / c);
+        if (s > 1e-9) best = fmin(best, (9.95 - 5.0) / s);
+        if (s < -1e-9) best = fmin(best, (0.05 - 5.0) / s);
+        double fx = 5.0 - personX, fy = 5.0 - personY;
+        double b = fx * c + fy * s;
+        double d = b * b - (fx * fx + fy * fy - radius * radius);
+        if (d >= 0.0 && -b - sqrt(d) > 0.0) {
+            best = fmin(best, -b - sqrt(d));
+        }
+        scan.ranges[i] = static_cast<float>(best);
+    }
+}
+
+/**
+ * @brief Counts the occupied cells of a rectangle of the map.
+ * @param map The map.
+ * @param xMin Smallest x in meters.
+ * @param yMin Smallest y in meters.
+ * @param xMax Largest x in meters.
+ * @param yMax Largest y in meters.
+ * @return The number of occupied cells.
+ */
+int countOccupied(const Map& map, double xMin, double yMin, double xMax, double yMax) {
+    int count = 0;
+    for (int i = 0; i < map.getNumberX(); i++) {
+        for (int j = 0; j < map.getNumberY(); j++) {
+            double x = (i + 0.5) * map.getGridSize(), y = (j + 0.5) * map.getGridSize();
+            if (x >= xMin && x <= xMax && y >= yMin && y <= yMax && map.getGrid(i, j) == Map::CELL_OCCUPIED) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Main function for testing the obstacle tracker.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const double dt = 0.1;
+    mt19937 rng(5);
+    normal_distribution<double> noise(0.0, 0.03);
+
+    /**
+     * @test Test 1: A moving target is confirmed after three scans and its velocity converges;
+     * a target standing still never becomes dynamic.
+     */
+    ObstacleTracker tracker;
+    unsigned long movingId = 0, standingId = 0;
+    for (int k = 0; k < 50; k++) {
+        double t = k * dt;
+        ScanCluster clusters[2] = { makeCluster(1.0 * t + noise(rng), 0.5 * t + noise(rng), 0.2),
+            makeCluster(4.0 + noise(rng), 4.0 + noise(rng), 0.2) };
+        assert(tracker.update(clusters, 2, t) == 2);
+        if (k == 0) { // New tracks are started in the order of the clusters
+            movingId = tracker.getTrack(0).id;
+            standingId = tracker.getTrack(1).id;
+        }
+        const ObstacleTrack* moving = tracker.findTrack(movingId);
+        const ObstacleTrack* standing = tracker.findTrack(standingId);
+        assert(moving != nullptr && standing != nullptr);
+        assert(moving->confirmed == (k >= ObstacleTracker::CONFIRM_HITS - 1));
+        assert(!standing->dynamic);
+    }
+    const ObstacleTrack* moving = tracker.findTrack(movingId);
+    assert(moving != nullptr && moving->dynamic && tracker.getDynamicCount() == 1);
+    assert(fabs(moving->vx - 1.0) < 0.15 && fabs(moving->vy - 0.5) < 0.15);
+    assert(tracker.isDynamic(static_cast<float>(moving->x), static_cast<float>(moving->y)));
+    assert(!tracker.isDynamic(4.0f, 4.0f));
+    cout << "Velocity after 5 s: (" << moving->vx << ", " << moving->vy << ") m/s" << endl;
+
+    /**
+     * @test Test 2: Two targets on crossing paths keep their identifiers.
+     */
+    tracker.reset();
+    unsigned long firstId = 0, secondId = 0;
+    for (int k = 0; k <= 30; k++) {
+        double t = k * dt;
+        ScanCluster clusters[2] = { makeCluster(t + noise(rng), noise(rng), 0.15),
+            makeCluster(1.5 + noise(rng), t - 1.0 + noise(rng), 0.15) };
+        tracker.update(clusters, 2, t);
+        if (k == 0) {
+            firstId = tracker.getTrack(0).id;
+            secondId = tracker.getTrack(1).id;
+        }
+    }
+    const ObstacleTrack* first = tracker.findTrack(firstId);
+    const ObstacleTrack* second = tracker.findTrack(secondId);
+    assert(tracker.getTrackCount() == 2 && first != nullptr && second != nullptr);
+    assert(fabs(first->x - 3.0) < 0.1 && fabs(first->y) < 0.1);
+    assert(fabs(second->x - 1.5) < 0.1 && fabs(second->y - 2.0) < 0.1);
+    assert(tracker.getStats().births == 2 && tracker.getStats().deaths == 0);
+
+    /**
+     * @test Test 3: A confirmed track coasts through missed scans and ends after MAX_MISSES of
+     * them; a tentative track ends at its first miss; clusters wider than an object are ignored.
+     */
+    tracker.reset();
+    for (int k = 0; k < 10; k++) {
+        ScanCluster cluster = makeCluster(k * dt, 0.0, 0.2);
+        tracker.update(&cluster, 1, k * dt);
+    }
+    unsigned long coastingId = tracker.getTrack(0).id;
+    for (int k = 10; k < 10 + ObstacleTracker::MAX_MISSES - 1; k++) {
+        assert(tracker.update(nullptr, 0, k * dt) == 1);
+    }
+    assert(fabs(tracker.getTrack(0).x - (10 + ObstacleTracker::MAX_MISSES - 2) * dt) < 0.05);
+    ScanCluster reappearing = makeCluster((10 + ObstacleTracker::MAX_MISSES - 1) * dt, 0.0, 0.2);
+    assert(tracker.update(&reappearing, 1, (10 + ObstacleTracker::MAX_MISSES - 1) * dt) == 1);
+    assert(tracker.getTrack(0).id == coastingId && tracker.getTrack(0).misses == 0);
+    for (int k = 0; k < ObstacleTracker::MAX_MISSES; k++) {
+        tracker.update(nullptr, 0, 2.0 + k * dt);
+    }
+    assert(tracker.getTrackCount() == 0);
+
+    ScanCluster once = makeCluster(1.0, 1.0, 0.2);
+    tracker.update(&once, 1, 3.0);
+    assert(tracker.getTrackCount() == 1 && !tracker.getTrack(0).confirmed);
+    assert(tracker.update(nullptr, 0, 3.1) == 0);
+    ScanCluster wall = makeCluster(2.0, 2.0, 1.0);
+    assert(tracker.update(&wall, 1, 3.2) == 0 && tracker.getStats().births == 2);
+
+    /**
+     * @test Test 4: Clusters beyond the pool capacity do not start tracks and are counted.
+     */
+    ObstacleTracker small(4);
+    ScanCluster crowd[6];
+    for (int i = 0; i < 6; i++) {
+        crowd[i] = makeCluster(i * 1.0, 0.0, 0.2);
+    }
+    assert(small.update(crowd, 6, 0.0) == 4);
+    assert(small.getStats().droppedBirths == 2);
+    assert(small.update(crowd, 6, 0.1) == 4 && small.getStats().births == 4);
+
+    /**
+     * @test Test 5: With the tracker set, the Mapper leaves a walking person out of the map
+     * once the track is dynamic, while the walls are still mapped.
+     */
+    static LidarScan scan; // Too large for the stack of some platforms
+    ObstacleTracker roomTracker;
+    Mapper plain(100, 100, 0.1, nullptr, nullptr);
+    Mapper filtered(100, 100, 0.1, nullptr, nullptr);
+    filtered.setObstacleTracker(&roomTracker);
+    for (int k = 0; k <= 40; k++) {
+        simulate(scan, 7.0, 3.0 + k * dt, k * dt);
+        roomTracker.update(scan);
+        plain.updateMap(scan);
+        filtered.updateMap(scan);
+    }
+    assert(roomTracker.getDynamicCount() == 1);
+    int plainPerson = countOccupied(plain.getMap(), 6.5, 4.0, 7.5, 7.5);
+    int filteredPerson = countOccupied(filtered.getMap(), 6.5, 4.0, 7.5, 7.5);
+    int plainWalls = countOccupied(plain.getMap(), 9.8, 0.0, 10.0, 10.0);
+    int filteredWalls = countOccupied(filtered.getMap(), 9.8, 0.0, 10.0, 10.0);
+    assert(plainPerson > 20 && filteredPerson == 0);
+    assert(filteredWalls == plainWalls && filteredWalls > 50);
+    cout << "Person path: " << plainPerson << " occupied cells without the tracker, " << filteredPerson
+         << " with it" << endl;
+
+    /**
+     * @test Test 6: 120 targets are followed without losing one, without allocating once warmed
+     * up, and well within a scan period.
+     */
+    const int targets = 120;
+    const int frames = 500;
+    ObstacleTracker crowdTracker(128);
+    vector<ScanCluster> clusters(targets);
+    vector<double> phase(targets);
+    uniform_real_distribution<double> angle(0.0, 2.0 * SE2_PI);
+    for (int i = 0; i < targets; i++) {
+        phase[i] = angle(rng);
+    }
+    unsigned long before = 0;
+    double totalUs = 0.0;
+    for (int k = 0; k < frames; k++) {
+        double t = k * dt;
+        for (int i = 0; i < targets; i++) { // Each target circles inside its own square meter
+            double x = (i % 12) * 1.0 + 0.3 * cos(t + phase[i]) + 0.01 * noise(rng);
+            double y = (i / 12) * 1.0 + 0.3 * sin(t + phase[i]) + 0.01 * noise(rng);
+            clusters[i] = makeCluster(x, y, 0.1);
+        }
+        if (k == 10) {
+            before = allocations;
+            totalUs = 0.0;
+        }
+        assert(crowdTracker.update(&clusters[0], targets, t) == static_cast<size_t>(targets));
+        totalUs += crowdTracker.getStats().lastUs;
+    }
+    assert(allocations == before);
+    assert(crowdTracker.getStats().births == static_cast<unsigned long>(targets));
+    assert(crowdTracker.getStats().deaths == 0);
+    double meanUs = totalUs / (frames - 10);
+    assert(meanUs < 1000.0);
+    cout << "Tracking, " << targets << " targets: " << meanUs << " us/scan on average, "
+         << crowdTracker.getStats().longestUs << " us longest" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
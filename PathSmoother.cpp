@@ -0,0 +1,367 @@
+/**
+ * @file PathSmoother.cpp
+ * @brief Implementation of the PathSmoother class.
+ * @date October 2026
+ */
+
+#include "PathSmoother.h"
+#include "Transform2D.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Turns smaller than this, in radians, are treated as straight.
+ */
+static const double STRAIGHT_TURN = 1e-6;
+
+/**
+ * @brief Number of times an arc that crosses a blocked cell is halved before the corner is kept sharp.
+ */
+static const int ARC_ATTEMPTS = 4;
+
+/**
+ * @brief Returns the directions of the segments around a corner and the angle between them.
+ * @param fromX X of the corner before in meters.
+ * @param fromY Y of the corner before in meters.
+ * @param x X of the corner in meters.
+ * @param y Y of the corner in meters.
+ * @param toX X of the corner after in meters.
+ * @param toY Y of the corner after in meters.
+ * @param ux1 Receives the x of the unit direction into the corner.
+ * @param uy1 Receives the y of the unit direction into the corner.
+ * @param ux2 Receives the x of the unit direction out of the corner.
+ * @param uy2 Receives the y of the unit direction out of the corner.
+ * @return The turn in radians, positive to the left.
+ */
+static double turnAt(double fromX, double fromY, double x, double y, double toX, double toY,
+    double& ux1, double& uy1, double& ux2, double& uy2) {
+    double length1 = hypot(x - fromX, y - fromY), length2 = hypot(toX - x, toY - y);
+    ux1 = (x - fromX) / length1;
+    uy1 = (y - fromY) / length1;
+    ux2 = (toX - x) / length2;
+    uy2 = (toY - y) / length2;
+    return atan2(ux1 * uy2 - uy1 * ux2, ux1 * ux2 + uy1 * uy2);
+}
+
+/**
+ * @brief Constructor for the PathSmoother class, with the default limits of TrajectoryFollower.
+ */
+PathSmoother::PathSmoother()
+    : maxSpeed(0.2), maxAcceleration(0.3), maxLateralAcceleration(0.3), maxAngularSpeed(0.5), turnRadius(0.5),
+      spacing(0.05), stats() {}
+
+/**
+ * @brief Sets the motion limits used to time the path.
+ * @param speed Maximum translational speed in m/s.
+ * @param acceleration Maximum acceleration and deceleration along the path in m/s^2.
+ * @param lateralAcceleration Maximum acceleration across the path in m/s^2.
+ * @param angularSpeed Maximum turning rate of the heading in rad/s.
+ */
+void PathSmoother::setLimits(double speed, double acceleration, double lateralAcceleration, double angularSpeed) {
+    maxSpeed = speed > 0.0 ? speed : 0.2;
+    maxAcceleration = acceleration > 0.0 ? acceleration : 0.3;
+    maxLateralAcceleration = lateralAcceleration > 0.0 ? lateralAcceleration : 0.3;
+    maxAngularSpeed = angularSpeed > 0.0 ? angularSpeed : 0.5;
+}
+
+/**
+ * @brief Sets the shape of the smoothed path.
+ * @param radius Radius of the arcs that round the corners in meters; smaller arcs are used where these do not fit.
+ * @param step Longest distance between consecutive poses in meters.
+ */
+void PathSmoother::setShape(double radius, double step) {
+    turnRadius = radius > 0.0 ? radius : 0.0;
+    spacing = step > 0.0 ? step : 0.05;
+}
+
+/**
+ * @brief Tells whether every cell a segment crosses after its first cell is passable.
+ *
+ * The cells are visited in the order the segment enters them. Where it passes exactly through
+ * the corner of a cell, both cells beside the corner must be passable too, as for a diagonal
+ * step of the planner. The first cell is left out: it is a waypoint of the path, and the start
+ * of a grid path may touch an obstacle.
+ *
+ * @param grid The passable cells.
+ * @param x0 X of the first end in meters.
+ * @param y0 Y of the first end in meters.
+ * @param x1 X of the second end in meters.
+ * @param y1 Y of the second end in meters.
+ * @return True if the segment is clear.
+ */
+bool PathSmoother::isLineClear(const GridPlanner& grid, double x0, double y0, double x1, double y1) {
+    stats.lineChecks++;
+    const double cellSize = grid.getCellSize();
+    const double ax = x0 / cellSize, ay = y0 / cellSize, dx = x1 / cellSize - ax, dy = y1 / cellSize - ay;
+    int cx = static_cast<int>(floor(ax)), cy = static_cast<int>(floor(ay));
+    const int ex = static_cast<int>(floor(ax + dx)), ey = static_cast<int>(floor(ay + dy));
+    const int sx = dx > 0.0 ? 1 : -1, sy = dy > 0.0 ? 1 : -1;
+    // Fraction of the segment per cell along each axis, and to the next cell boundary
+    const double stepX = dx != 0.0 ? fabs(1.0 / dx) : HUGE_VAL, stepY = dy != 0.0 ? fabs(1.0 / dy) : HUGE_VAL;
+    double nextX = dx != 0.0 ? (sx > 0 ? cx + 1 - ax : ax - cx) * stepX : HUGE_VAL;
+    double nextY = dy != 0.0 ? (sy > 0 ? cy + 1 - ay : ay - cy) * stepY : HUGE_VAL;
+    int left = (ex > cx ? ex - cx : cx - ex) + (ey > cy ? ey - cy : cy - ey);
+    while (left > 0) {
+        if (fabs(nextX - nextY) < 1e-9 && left > 1) {
+            if (!grid.isPassable(cx + sx, cy) || !grid.isPassable(cx, cy + sy)) {
+                return false;
+            }
+            cx += sx;
+            cy += sy;
+            nextX += stepX;
+            nextY += stepY;
+            left -= 2;
+        }
+        else if (nextX < nextY) {
+            cx += sx;
+            nextX += stepX;
+            left--;
+        }
+        else {
+            cy += sy;
+            nextY += stepY;
+            left--;
+        }
+        if (!grid.isPassable(cx, cy)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Tells whether the arc that rounds a corner with a given trim crosses only passable cells.
+ *
+ * The arc is checked as chords about a cell long, which stray from it by a small fraction of a
+ * cell at the radii used here.
+ *
+ * @param grid The passable cells.
+ * @param corner Index of the corner.
+ * @param trim Distance from the corner to the ends of the arc, in meters.
+ * @return True if the arc is clear.
+ */
+bool PathSmoother::isArcClear(const GridPlanner& grid, size_t corner, double trim) {
+    const Corner& from = corners[corner - 1];
+    const Corner& at = corners[corner];
+    const Corner& to = corners[corner + 1];
+    double ux1, uy1, ux2, uy2;
+    double turn = turnAt(from.x, from.y, at.x, at.y, to.x, to.y, ux1, uy1, ux2, uy2);
+    double radius = trim / tan(fabs(turn) / 2.0);
+    double side = turn > 0.0 ? 1.0 : -1.0;
+    double startX = at.x - trim * ux1, startY = at.y - trim * uy1;
+    double centerX = startX - side * radius * uy1, centerY = startY + side * radius * ux1;
+    double angle = atan2(startY - centerY, startX - centerX);
+    int chords = static_cast<int>(ceil(radius * fabs(turn) / grid.getCellSize()));
+    chords = chords > 1 ? chords : 1;
+    double previousX = startX, previousY = startY;
+    for (int k = 1; k <= chords; k++) {
+        double a = angle + turn * k / chords;
+        double x = centerX + radius * cos(a), y = centerY + radius * sin(a);
+        if (!isLineClear(grid, previousX, previousY, x, y)) {
+            return false;
+        }
+        previousX = x;
+        previousY = y;
+    }
+    return true;
+}
+
+/**
+ * @brief Appends a pose to the smoothed path.
+ * @param path The smoothed path.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @param heading Heading in radians.
+ * @param curvature Curvature in 1/m; negative for a sharp corner.
+ */
+void PathSmoother::emit(vector<Pose>& path, double x, double y, double heading, double curvature) {
+    double along = path.empty() ? 0.0 : distances.back() + hypot(x - path.back().getX(), y - path.back().getY());
+    path.push_back(Pose(x, y, heading));
+    curvatures.push_back(curvature);
+    distances.push_back(along);
+}
+
+/**
+ * @brief Shortcuts, rounds and times a path.
+ * @param grid The passable cells the path was planned on, e.g. GridPlanner or HierarchicalPlanner::getGrid().
+ * @param waypoints The path, each waypoint in sight of the one before it (a grid path qualifies).
+ * @param path Receives the smoothed path; each heading (radians) is the direction of travel.
+ * @param speeds Receives the speed at each pose of the smoothed path in m/s, 0 at both ends.
+ * @return False if there are no waypoints or the grid has no map.
+ */
+bool PathSmoother::smooth(const GridPlanner& grid, const vector<Pose>& waypoints, vector<Pose>& path,
+    vector<double>& speeds) {
+    auto begin = chrono::steady_clock::now();
+    stats = SmoothingStats();
+    stats.inputPoints = waypoints.size();
+    path.clear();
+    speeds.clear();
+    corners.clear();
+    curvatures.clear();
+    distances.clear();
+    times.clear();
+    if (waypoints.empty()) {
+        cerr << "Error: There are no waypoints to smooth!" << endl;
+        return false;
+    }
+    if (grid.getCellSize() <= 0.0) {
+        cerr << "Error: The grid of the path smoother has no map!" << endl;
+        return false;
+    }
+
+    // Keep the farthest waypoint in sight of the last one kept: double the step, then bisect
+    const size_t last = waypoints.size() - 1;
+    size_t anchor = 0;
+    Corner first = { waypoints[0].getX(), waypoints[0].getY(), 0.0, 0.0, false };
+    corners.push_back(first);
+    while (anchor < last) {
+        const double x0 = waypoints[anchor].getX(), y0 = waypoints[anchor].getY();
+        size_t seen = anchor + 1, hidden = last + 1;
+        for (size_t step = 2; seen < last; step *= 2) {
+            size_t probe = anchor + step < last ? anchor + step : last;
+            if (!isLineClear(grid, x0, y0, waypoints[probe].getX(), waypoints[probe].getY())) {
+                hidden = probe;
+                break;
+            }
+            seen = probe;
+        }
+        while (hidden - seen > 1) {
+            size_t probe = seen + (hidden - seen) / 2;
+            if (isLineClear(grid, x0, y0, waypoints[probe].getX(), waypoints[probe].getY())) {
+                seen = probe;
+            }
+            else {
+                hidden = probe;
+            }
+        }
+        anchor = seen;
+        Corner next = { waypoints[anchor].getX(), waypoints[anchor].getY(), 0.0, 0.0, false };
+        if (hypot(next.x - corners.back().x, next.y - corners.back().y) > 1e-9) {
+            corners.push_back(next);
+        }
+    }
+    stats.cornerPoints = corners.size();
+
+    // Round each corner with the largest arc up to the turn radius that fits its segments and the grid
+    const size_t lastCorner = corners.size() - 1;
+    for (size_t i = 1; i < lastCorner; i++) {
+        double ux1, uy1, ux2, uy2;
+        double turn = fabs(turnAt(corners[i - 1].x, corners[i - 1].y, corners[i].x, corners[i].y,
+            corners[i + 1].x, corners[i + 1].y, ux1, uy1, ux2, uy2));
+        if (turn < STRAIGHT_TURN) {
+            continue;
+        }
+        double before = hypot(corners[i].x - corners[i - 1].x, corners[i].y - corners[i - 1].y);
+        double after = hypot(corners[i + 1].x - corners[i].x, corners[i + 1].y - corners[i].y);
+        before = i == 1 ? before : before / 2.0; // The segment is shared with the previous arc
+        after = i + 1 == lastCorner ? after : after / 2.0;
+        double trim = turnRadius * tan(turn / 2.0);
+        trim = trim < before ? trim : before;
+        trim = trim < after ? trim : after;
+        int attempt = 0;
+        while (trim > 0.0 && attempt < ARC_ATTEMPTS && !isArcClear(grid, i, trim)) {
+            trim /= 2.0;
+            attempt++;
+        }
+        corners[i].trim = attempt < ARC_ATTEMPTS ? trim : 0.0;
+        corners[i].radius = corners[i].trim / tan(turn / 2.0);
+        corners[i].sharp = corners[i].trim <= 0.0;
+        stats.sharpCorners += corners[i].sharp ? 1 : 0;
+    }
+
+    // Sample the segments and arcs
+    curvatures.reserve(waypoints.size());
+    distances.reserve(waypoints.size());
+    path.reserve(waypoints.size());
+    double heading = lastCorner > 0 ? atan2(corners[1].y - corners[0].y, corners[1].x - corners[0].x) : waypoints[0].getTh();
+    emit(path, corners[0].x, corners[0].y, heading, 0.0);
+    for (size_t i = 0; i < lastCorner; i++) {
+        const Corner& from = corners[i];
+        const Corner& to = corners[i + 1];
+        double length = hypot(to.x - from.x, to.y - from.y);
+        double ux = (to.x - from.x) / length, uy = (to.y - from.y) / length;
+        double startX = from.x + from.trim * ux, startY = from.y + from.trim * uy;
+        double endX = to.x - to.trim * ux, endY = to.y - to.trim * uy;
+        heading = atan2(uy, ux);
+        double endCurvature = to.sharp ? -1.0 : (to.trim > 0.0 ? 1.0 / to.radius : 0.0);
+        int count = static_cast<int>(ceil((length - from.trim - to.trim) / spacing - 1e-9));
+        count = count > 1 ? count : 1;
+        for (int k = 1; k <= count; k++) {
+            double f = static_cast<double>(k) / count;
+            emit(path, startX + f * (endX - startX), startY + f * (endY - startY), heading, k == count ? endCurvature : 0.0);
+        }
+        if (to.trim <= 0.0) {
+            continue;
+        }
+        const Corner& after = corners[i + 2];
+        double ux1, uy1, ux2, uy2;
+        double turn = turnAt(from.x, from.y, to.x, to.y, after.x, after.y, ux1, uy1, ux2, uy2);
+        double side = turn > 0.0 ? 1.0 : -1.0;
+        double centerX = endX - side * to.radius * uy1, centerY = endY + side * to.radius * ux1;
+        double angle = atan2(endY - centerY, endX - centerX);
+        int steps = static_cast<int>(ceil(to.radius * fabs(turn) / spacing - 1e-9));
+        steps = steps > 1 ? steps : 1;
+        for (int k = 1; k <= steps; k++) {
+            double a = angle + turn * k / steps;
+            emit(path, centerX + to.radius * cos(a), centerY + to.radius * sin(a),
+                normalizeAngle(a + side * SE2_PI / 2.0), 1.0 / to.radius);
+        }
+    }
+
+    // Speed limits of the curvature, then forward and backward passes of the acceleration limit
+    const size_t count = path.size();
+    speeds.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        double limit = maxSpeed;
+        if (curvatures[i] < 0.0) {
+            limit = 0.0; // A sharp corner: stop and turn on the spot
+        }
+        else if (curvatures[i] > 0.0) {
+            double lateral = sqrt(maxLateralAcceleration / curvatures[i]), turning = maxAngularSpeed / curvatures[i];
+            limit = lateral < limit ? lateral : limit;
+            limit = turning < limit ? turning : limit;
+        }
+        speeds[i] = limit;
+    }
+    speeds[0] = 0.0;
+    speeds[count - 1] = 0.0;
+    for (size_t i = 1; i < count; i++) {
+        double reachable = sqrt(speeds[i - 1] * speeds[i - 1] + 2.0 * maxAcceleration * (distances[i] - distances[i - 1]));
+        speeds[i] = reachable < speeds[i] ? reachable : speeds[i];
+    }
+    for (size_t i = count - 1; i > 0; i--) {
+        double reachable = sqrt(speeds[i] * speeds[i] + 2.0 * maxAcceleration * (distances[i] - distances[i - 1]));
+        speeds[i - 1] = reachable < speeds[i - 1] ? reachable : speeds[i - 1];
+    }
+    times.resize(count);
+    times[0] = 0.0;
+    for (size_t i = 1; i < count; i++) {
+        double mean = (speeds[i - 1] + speeds[i]) / 2.0;
+        times[i] = times[i - 1] + (mean > 0.0 ? (distances[i] - distances[i - 1]) / mean : 0.0);
+    }
+
+    stats.outputPoints = count;
+    stats.length = distances.back();
+    stats.duration = times.back();
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+    return true;
+}
+
+/**
+ * @brief Returns the time from the start to each pose of the last smoothed path.
+ * @return The times in seconds.
+ */
+const vector<double>& PathSmoother::getTimes() const {
+    return times;
+}
+
+/**
+ * @brief Returns the counters of the last smoothing.
+ * @return The counters.
+ */
+SmoothingStats PathSmoother::getStats() const {
+    return stats;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file PathSmoother.h
+ * @brief Declaration of the PathSmoother class, which turns planned waypoints into a smooth, timed path.
+ * @date October 2026
+ */
+
+#ifndef PATHSMOOTHER_H
+#define PATHSMOOTHER_H
+
+#include "GridPlanner.h"
+#include "Pose.h"
+#include <vector>
+
+/**
+ * @struct SmoothingStats
+ * @brief Counters of the last smooth() of a PathSmoother.
+ */
+struct SmoothingStats {
+    size_t inputPoints;         /**< Waypoints given. */
+    size_t cornerPoints;        /**< Waypoints left after shortcutting, ends included. */
+    size_t sharpCorners;        /**< Corners where no arc fit and the robot has to stop. */
+    size_t outputPoints;        /**< Poses of the smoothed path. */
+    unsigned long lineChecks;   /**< Line-of-sight checks on the grid. */
+    double length;              /**< Length of the smoothed path in meters. */
+    double duration;            /**< Time to drive the smoothed path at its speeds, in seconds. */
+    double lastUs;              /**< Duration of the smoothing, in microseconds. */
+};
+
+/**
+ * @class PathSmoother
+ * @brief Shortcuts, rounds and times the paths of the grid planners so the robot can drive them without stopping.
+ *
+ * Grid paths step from cell to cell, so they turn by 45 degrees every few cells. The smoother
+ * first keeps only the waypoints the robot cannot see past: from each kept waypoint the
+ * farthest visible one is found by doubling the step and then bisecting, with line-of-sight
+ * checks that walk the passable cells of the GridPlanner the path came from. Each remaining
+ * corner is then replaced by a circular arc tangent to both of its segments; the arc is
+ * shrunk while it crosses a blocked cell, and a corner without room for one is kept sharp.
+ *
+ * The path is sampled at a fixed spacing and each pose gets the speed allowed by the lateral
+ * acceleration and the angular speed on its arc, lowered by a forward and a backward pass so
+ * that the robot can reach it with the acceleration limit and stops at both ends. The poses
+ * and speeds are what TrajectoryFollower::setPath() takes; the work is linear in the number of
+ * waypoints and in the length of the path.
+ */
+class PathSmoother {
+private:
+    /**
+     * @struct Corner
+     * @brief A waypoint kept by the shortcutting, and the arc that rounds it.
+     */
+    struct Corner {
+        double x;        /**< X in meters. */
+        double y;        /**< Y in meters. */
+        double trim;     /**< Distance from the corner to the ends of its arc in meters; 0 without an arc. */
+        double radius;   /**< Radius of the arc in meters. */
+        bool sharp;      /**< True if the path turns here without an arc. */
+    };
+
+    double maxSpeed;                /**< Maximum translational speed in m/s. */
+    double maxAcceleration;         /**< Maximum acceleration and deceleration along the path in m/s^2. */
+    double maxLateralAcceleration;  /**< Maximum acceleration across the path in m/s^2. */
+    double maxAngularSpeed;         /**< Maximum turning rate of the heading in rad/s. */
+    double turnRadius;              /**< Radius of the arcs that round the corners, in meters. */
+    double spacing;                 /**< Longest distance between consecutive poses, in meters. */
+
+    std::vector<Corner> corners;    /**< Waypoints left after shortcutting. */
+    std::vector<double> curvatures; /**< Curvature at each pose in 1/m; negative at a sharp corner. */
+    std::vector<double> distances;  /**< Path length from the start to each pose, in meters. */
+    std::vector<double> times;      /**< Time from the start to each pose, in seconds. */
+    SmoothingStats stats;           /**< Counters. */
+
+    /**
+     * @brief Tells whether every cell a segment crosses after its first cell is passable.
+     * @param grid The passable cells.
+     * @param x0 X of the first end in meters.
+     * @param y0 Y of the first end in meters.
+     * @param x1 X of the second end in meters.
+     * @param y1 Y of the second end in meters.
+     * @return True if the segment is clear.
+     */
+    bool isLineClear(const GridPlanner& grid, double x0, double y0, double x1, double y1);
+
+    /**
+     * @brief Tells whether the arc that rounds a corner with a given trim crosses only passable cells.
+     * @param grid The passable cells.
+     * @param corner Index of the corner.
+     * @param trim Distance from the corner to the ends of the arc, in meters.
+     * @return True if the arc is clear.
+     */
+    bool isArcClear(const GridPlanner& grid, size_t corner, double trim);
+
+    /**
+     * @brief Appends a pose to the smoothed path.
+     * @param path The smoothed path.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @param heading Heading in radians.
+     * @param curvature Curvature in 1/m; negative for a sharp corner.
+     */
+    void emit(std::vector<Pose>& path, double x, double y, double heading, double curvature);
+
+public:
+    /**
+     * @brief Constructor for the PathSmoother class, with the default limits of TrajectoryFollower.
+     */
+    PathSmoother();
+
+    /**
+     * @brief Sets the motion limits used to time the path.
+     * @param speed Maximum translational speed in m/s.
+     * @param acceleration Maximum acceleration and deceleration along the path in m/s^2.
+     * @param lateralAcceleration Maximum acceleration across the path in m/s^2.
+     * @param angularSpeed Maximum turning rate of the heading in rad/s.
+     */
+    void setLimits(double speed, double acceleration, double lateralAcceleration, double angularSpeed);
+
+    /**
+     * @brief Sets the shape of the smoothed path.
+     * @param radius Radius of the arcs that round the corners in meters; smaller arcs are used where these do not fit.
+     * @param step Longest distance between consecutive poses in meters.
+     */
+    void setShape(double radius, double step);
+
+    /**
+     * @brief Shortcuts, rounds and times a path.
+     * @param grid The passable cells the path was planned on, e.g. GridPlanner or HierarchicalPlanner::getGrid().
+     * @param waypoints The path, each waypoint in sight of the one before it (a grid path qualifies).
+     * @param path Receives the smoothed path; each heading (radians) is the direction of travel.
+     * @param speeds Receives the speed at each pose of the smoothed path in m/s, 0 at both ends.
+     * @return False if there are no waypoints or the grid has no map.
+     */
+    bool smooth(const GridPlanner& grid, const std::vector<Pose>& waypoints, std::vector<Pose>& path,
+        std::vector<double>& speeds);
+
+    /**
+     * @brief Returns the time from the start to each pose of the last smoothed path.
+     * @return The times in seconds.
+     */
+    const std::vector<double>& getTimes() const;
+
+    /**
+     * @brief Returns the counters of the last smoothing.
+     * @return The counters.
+     */
+    SmoothingStats getStats() const;
+};
+
+#endif // PATHSMOOTHER_H
@@ -0,0 +1,192 @@
+/**
+ * @file PathSmootherTest.cpp
+ * @brief Test and benchmark application for the PathSmoother class.
+ * @details Checks that smoothed grid paths stay on passable cells, are shorter than the grid
+ * paths and respect the speed, acceleration and turning limits, and times the smoothing of a
+ * path of more than 10,000 waypoints.
+ * @date October, 2026
+ */
+
+#include "PathSmoother.h"
+#include "Transform2D.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Marks a rectangle of cells.
+ * @param map The map.
+ * @param x0 First column.
+ * @param y0 First row.
+ * @param x1 Last column.
+ * @param y1 Last row.
+ * @param value The cell value.
+ */
+void fill(Map& map, int x0, int y0, int x1, int y1, int value) {
+    for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+            map.setGrid(x, y, value);
+        }
+    }
+}
+
+/**
+ * @brief Returns the length of a path.
+ * @param path The path.
+ * @return The length in meters.
+ */
+double pathLength(const vector<Pose>& path) {
+    double length = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        length += hypot(path[i].getX() - path[i - 1].getX(), path[i].getY() - path[i - 1].getY());
+    }
+    return length;
+}
+
+/**
+ * @brief Checks a smoothed path against the grid and the limits it was timed with.
+ * @param grid The passable cells.
+ * @param path The smoothed path.
+ * @param speeds The speeds of the path.
+ * @param speed Maximum speed in m/s.
+ * @param acceleration Maximum acceleration along the path in m/s^2.
+ * @param angularSpeed Maximum turning rate of the heading in rad/s.
+ * @return True if every pose after the first is on a passable cell and every step keeps to the limits.
+ */
+bool checkPath(const GridPlanner& grid, const vector<Pose>& path, const vector<double>& speeds, double speed,
+    double acceleration, double angularSpeed) {
+    const double cellSize = grid.getCellSize();
+    if (path.size() != speeds.size() || speeds.front() != 0.0 || speeds.back() != 0.0) {
+        return false;
+    }
+    for (size_t i = 1; i < path.size(); i++) {
+        int x = static_cast<int>(floor(path[i].getX() / cellSize)), y = static_cast<int>(floor(path[i].getY() / cellSize));
+        double step = hypot(path[i].getX() - path[i - 1].getX(), path[i].getY() - path[i - 1].getY());
+        double turn = fabs(normalizeAngle(path[i].getTh() - path[i - 1].getTh()));
+        if (!grid.isPassable(x, y) || step > 0.05 + 1e-9 || speeds[i] > speed + 1e-9) {
+            return false;
+        }
+        double change = speeds[i] * speeds[i] - speeds[i - 1] * speeds[i - 1];
+        if (fabs(change) > 2.0 * acceleration * step + 1e-9) {
+            return false;
+        }
+        // Turning on an arc: the heading may not turn faster than the limit at the slower end
+        double slower = speeds[i] < speeds[i - 1] ? speeds[i] : speeds[i - 1];
+        double arc = turn > 1e-6 ? step * (turn / 2.0) / sin(turn / 2.0) : step;
+        if (step > 0.0 && turn > 1e-6 && slower * turn / arc > angularSpeed + 1e-6) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Main function for testing the path smoother.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: In an open room the staircase of a grid path becomes the straight line
+     * between its ends, timed to start and stop at rest.
+     */
+    Map room(100, 100, 0.05);
+    fill(room, 0, 0, 99, 99, Map::CELL_FREE);
+    GridPlanner grid(0.2);
+    grid.update(room);
+    vector<Pose> waypoints, path;
+    vector<double> speeds;
+    assert(grid.findPath(10, 10, 90, 40, waypoints));
+    PathSmoother smoother;
+    assert(smoother.smooth(grid, waypoints, path, speeds));
+    SmoothingStats stats = smoother.getStats();
+    double straight = hypot(80 * 0.05, 30 * 0.05);
+    assert(stats.cornerPoints == 2 && stats.sharpCorners == 0);
+    assert(fabs(stats.length - straight) < 1e-9 && fabs(pathLength(path) - straight) < 1e-9);
+    assert(checkPath(grid, path, speeds, 0.2, 0.3, 0.5));
+    // Accelerate to 0.2 m/s at 0.3 m/s^2, cruise, then brake the same way
+    double ramp = 0.2 * 0.2 / (2.0 * 0.3);
+    assert(fabs(stats.duration - (2.0 * (0.2 / 0.3) + (straight - 2.0 * ramp) / 0.2)) < 0.05);
+    const vector<double>& times = smoother.getTimes();
+    for (size_t i = 1; i < times.size(); i++) {
+        assert(times[i] > times[i - 1]);
+    }
+
+    /**
+     * @test Test 2: Around a wall the corners are rounded with arcs that stay on passable cells,
+     * and the path is shorter than the grid path.
+     */
+    fill(room, 50, 0, 51, 69, Map::CELL_OCCUPIED);
+    grid.update(room);
+    assert(grid.findPath(20, 20, 80, 20, waypoints));
+    smoother.setLimits(0.5, 0.5, 0.4, 1.0);
+    assert(smoother.smooth(grid, waypoints, path, speeds));
+    stats = smoother.getStats();
+    assert(stats.cornerPoints >= 3 && stats.cornerPoints <= 5 && stats.sharpCorners == 0);
+    assert(stats.length < pathLength(waypoints) && fabs(pathLength(path) - stats.length) < 1e-9);
+    assert(checkPath(grid, path, speeds, 0.5, 0.5, 1.0));
+    double slowest = 1.0;
+    for (size_t i = path.size() / 4; i < path.size() * 3 / 4; i++) {
+        slowest = speeds[i] < slowest ? speeds[i] : slowest;
+    }
+    assert(slowest > 0.1); // The robot does not stop on the way
+    cout << waypoints.size() << " grid waypoints (" << pathLength(waypoints) << " m) smoothed to " << stats.cornerPoints
+         << " corners, " << stats.length << " m, " << stats.duration << " s" << endl;
+
+    /**
+     * @test Test 3: Without arcs every corner is sharp and the robot stops on it.
+     */
+    smoother.setShape(0.0, 0.05);
+    assert(smoother.smooth(grid, waypoints, path, speeds));
+    stats = smoother.getStats();
+    assert(stats.sharpCorners == stats.cornerPoints - 2);
+    assert(checkPath(grid, path, speeds, 0.5, 0.5, 1e9));
+    size_t stops = 0;
+    for (size_t i = 1; i + 1 < path.size(); i++) {
+        stops += speeds[i] == 0.0 ? 1 : 0;
+    }
+    assert(stops == stats.sharpCorners);
+    assert(!smoother.smooth(grid, vector<Pose>(), path, speeds) && path.empty());
+
+    /**
+     * @test Test 4: A path of more than 10,000 waypoints through a 25 m by 20 m serpentine of
+     * 0.8 m wide lanes.
+     */
+    Map serpentine(500, 400, 0.05);
+    fill(serpentine, 0, 0, 499, 399, Map::CELL_FREE);
+    for (int y = 16; y < 400; y += 16) {
+        if ((y / 16) % 2 == 1) {
+            fill(serpentine, 0, y, 479, y, Map::CELL_OCCUPIED); // Open at the east end
+        }
+        else {
+            fill(serpentine, 20, y, 499, y, Map::CELL_OCCUPIED); // Open at the west end
+        }
+    }
+    GridPlanner lanes(0.2);
+    lanes.update(serpentine);
+    assert(lanes.findJumpPath(8, 8, 8, 392, waypoints));
+    vector<Pose> cells;
+    // Expand the jump points to one waypoint per cell, as A* returns them
+    cells.push_back(waypoints[0]);
+    for (size_t i = 1; i < waypoints.size(); i++) {
+        double dx = waypoints[i].getX() - waypoints[i - 1].getX(), dy = waypoints[i].getY() - waypoints[i - 1].getY();
+        int steps = static_cast<int>(round((fabs(dx) > fabs(dy) ? fabs(dx) : fabs(dy)) / 0.05));
+        for (int k = 1; k <= steps; k++) {
+            cells.push_back(Pose(waypoints[i - 1].getX() + dx * k / steps, waypoints[i - 1].getY() + dy * k / steps, 0.0));
+        }
+    }
+    assert(cells.size() > 10000);
+    smoother.setShape(0.5, 0.05);
+    smoother.setLimits(1.0, 0.5, 0.5, 1.5);
+    assert(smoother.smooth(lanes, cells, path, speeds));
+    stats = smoother.getStats();
+    assert(checkPath(lanes, path, speeds, 1.0, 0.5, 1.5));
+    assert(stats.length < pathLength(cells));
+    cout << stats.inputPoints << " waypoints (" << pathLength(cells) << " m) smoothed in " << stats.lastUs << " us: "
+         << stats.cornerPoints << " corners, " << stats.sharpCorners << " sharp, " << stats.lineChecks << " line checks, "
+         << stats.outputPoints << " poses, " << stats.length << " m in " << stats.duration << " s" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file PeriodicExecutor.cpp
+ * @brief Implementation of the PeriodicExecutor class for fixed-rate task execution.
+ * @date October 2026
+ */
+
+#include "PeriodicExecutor.h"
+#include <iomanip>
+#include <iostream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Constructor for the PeriodicExecutor class.
+ */
+PeriodicExecutor::PeriodicExecutor() : running(false) {}
+
+/**
+ * @brief Destructor; stops all task threads.
+ */
+PeriodicExecutor::~PeriodicExecutor() {
+    stop();
+}
+
+/**
+ * @brief Registers a task. Tasks can only be added while the executor is stopped.
+ * @param name Task name used in the statistics.
+ * @param rateHz Execution rate in Hz.
+ * @param body Function executed every period.
+ * @param cpu CPU to pin the task thread to, or -1 to leave it unpinned.
+ * @param priority Real-time priority (1-99), or 0 to keep normal priority.
+ * @return The task id, or -1 if the task could not be added.
+ */
+int PeriodicExecutor::addTask(const string& name, double rateHz, function<void()> body, int cpu, int priority) {
+    if (running || rateHz <= 0.0 || !body) {
+        cerr << "Error: Task " << name << " could not be added." << endl;
+        return -1;
+    }
+    unique_ptr<Task> task(new Task());
+    task->name = name;
+    task->rateHz = rateHz;
+    task->body = body;
+    task->cpu = cpu;
+    task->priority = priority;
+    task->stats = TaskStats();
+    task->stats.name = name;
+    task->stats.rateHz = rateHz;
+    tasks.push_back(std::move(task));
+    return static_cast<int>(tasks.size()) - 1;
+}
+
+/**
+ * @brief Starts one thread per registered task.
+ * @return True if the executor was started, false if it was already running.
+ */
+bool PeriodicExecutor::start() {
+    if (running) {
+        return false;
+    }
+    running = true;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        tasks[i]->worker = thread(&PeriodicExecutor::run, this, tasks[i].get());
+    }
+    return true;
+}
+
+/**
+ * @brief Stops all task threads and waits for them to finish their current period.
+ */
+void PeriodicExecutor::stop() {
+    running = false;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        {
+            lock_guard<mutex> lock(tasks[i]->wakeMutex); // A task between its check and its wait gets the notify
+        }
+        tasks[i]->wake.notify_one();
+    }
+    for (size_t i = 0; i < tasks.size(); i++) {
+        if (tasks[i]->worker.joinable()) {
+            tasks[i]->worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Returns whether the executor is running.
+ * @return True if running, false otherwise.
+ */
+bool PeriodicExecutor::isRunning() const {
+    return running;
+}
+
+/**
+ * @brief Returns the number of registered tasks.
+ * @return The number of tasks.
+ */
+int PeriodicExecutor::getTaskCount() const {
+    return static_cast<int>(tasks.size());
+}
+
+/**
+ * @brief Returns a snapshot of a task's statistics.
+ * @param id Task id returned by addTask().
+ * @return The statistics; an empty record if the id is invalid.
+ */
+TaskStats PeriodicExecutor::getStats(int id) {
+    if (id < 0 || id >= static_cast<int>(tasks.size())) {
+        return TaskStats();
+    }
+    lock_guard<mutex> lock(tasks[id]->statsMutex);
+    return tasks[id]->stats;
+}
+
+/**
+ * @brief Prints the statistics of all tasks to the console.
+ */
+void PeriodicExecutor::printStats() {
+    cout << left << setw(12) << "Task" << right << setw(8) << "Hz" << setw(8) << "Runs"
+        << setw(10) << "Overruns" << setw(8) << "Misses" << setw(12) << "Exec(us)" << setw(12) << "MaxExec"
+        << setw(12) << "Jitter(us)" << setw(12) << "MaxJitter" << "  RT" << endl;
+    for (int i = 0; i < getTaskCount(); i++) {
+        TaskStats s = getStats(i);
+        cout << left << setw(12) << s.name << right << fixed << setprecision(1) << setw(8) << s.rateHz
+            << setw(8) << s.runs << setw(10) << s.overruns << setw(8) << s.deadlineMisses << setw(12) << s.meanExecUs << setw(12) << s.maxExecUs << setw(12) << s.meanJitterUs << setw(12) << s.maxJitterUs
+            << "  " << (s.realtime ? "yes" : "no") << defaultfloat << endl;
+    }
+}
+
+/**
+ * @brief Thread body of one task.
+ *
+ * Releases are at start + n * period. After each execution the next release is advanced by one
+ * period; if the task already finished past it, the missed releases are skipped and counted.
+ *
+ * @param task The task to run.
+ */
+void PeriodicExecutor::run(Task* task) {
+    configureThread(task);
+    const chrono::steady_clock::duration period =
+        chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(1.0 / task->rateHz));
+    const double periodUs = 1e6 / task->rateHz;
+    chrono::steady_clock::time_point release = chrono::steady_clock::now();
+
+    while (true) {
+        {
+            // Each task sleeps on its own mutex, so a real-time task never waits for another one
+            unique_lock<mutex> lock(task->wakeMutex);
+            task->wake.wait_until(lock, release, [this] { return !running; });
+            if (!running) {
+                break;
+            }
+        }
+        chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+        task->body();
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        double jitterUs = chrono::duration<double, micro>(begin - release).count();
+        double execUs = chrono::duration<double, micro>(end - begin).count();
+        release += period;
+        unsigned long missed = 0;
+        if (end >= release) {
+            missed = static_cast<unsigned long>((end - release) / period) + 1;
+            release += period * static_cast<long>(missed);
+        }
+
+        lock_guard<mutex> lock(task->statsMutex);
+        TaskStats& s = task->stats;
+        s.runs++;
+        s.meanExecUs += (execUs - s.meanExecUs) / static_cast<double>(s.runs);
+        s.meanJitterUs += (jitterUs - s.meanJitterUs) / static_cast<double>(s.runs);
+        if (execUs > s.maxExecUs) s.maxExecUs = execUs;
+        if (jitterUs > s.maxJitterUs) s.maxJitterUs = jitterUs;
+        if (execUs > periodUs) s.overruns++;
+        s.deadlineMisses += missed;
+    }
+}
+
+/**
+ * @brief Applies CPU affinity and real-time priority to the calling thread.
+ * Failures (e.g. missing privileges) are recorded in the task statistics and otherwise ignored.
+ * @param task The task whose settings are applied.
+ */
+void PeriodicExecutor::configureThread(Task* task) {
+    bool pinned = false;
+    bool realtime = false;
+#if defined(_WIN32)
+    if (task->cpu >= 0 && task->cpu < 64) {
+        pinned = SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << task->cpu) != 0;
+    }
+    if (task->priority > 0) {
+        realtime = SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+    }
+#elif defined(__linux__)
+    if (task->cpu >= 0 && task->cpu < CPU_SETSIZE) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(task->cpu, &set);
+        pinned = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+    if (task->priority > 0) {
+        sched_param param;
+        param.sched_priority = task->priority;
+        realtime = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+#endif
+    lock_guard<mutex> lock(task->statsMutex);
+    task->stats.pinned = pinned;
+    task->stats.realtime = realtime;
+}
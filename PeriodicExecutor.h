@@ -0,0 +1,140 @@
+/**
+ * @file PeriodicExecutor.h
+ * @brief Declaration of the PeriodicExecutor class, a fixed-rate control loop executor.
+ * @date October 2026
+ */
+
+#ifndef PERIODICEXECUTOR_H
+#define PERIODICEXECUTOR_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct TaskStats
+ * @brief Timing statistics of one periodic task.
+ */
+struct TaskStats {
+    std::string name;             /**< Task name. */
+    double rateHz;                /**< Configured rate in Hz. */
+    unsigned long runs;           /**< Number of executions. */
+    unsigned long overruns;       /**< Executions that took longer than one period. */
+    unsigned long deadlineMisses; /**< Release times skipped because the task was late. */
+    double meanExecUs;            /**< Mean execution time in microseconds. */
+    double maxExecUs;             /**< Largest execution time in microseconds. */
+    double meanJitterUs;          /**< Mean release lateness in microseconds. */
+    double maxJitterUs;           /**< Largest release lateness in microseconds. */
+    bool realtime;                /**< True if real-time priority was granted. */
+    bool pinned;                  /**< True if the thread was pinned to its CPU. */
+};
+
+/**
+ * @class PeriodicExecutor
+ * @brief Runs registered tasks at individually configured rates, each on its own thread.
+ *
+ * Every task sleeps until an absolute release time (start + n * period), so the schedule does
+ * not drift with execution time. When a task finishes after its next release time the missed
+ * releases are skipped and counted instead of being run back to back. Threads can optionally
+ * be pinned to a CPU and given real-time priority (SCHED_FIFO on Linux, time-critical priority
+ * on Windows); if the OS refuses, the task keeps running at normal priority.
+ */
+class PeriodicExecutor {
+private:
+    /**
+     * @struct Task
+     * @brief A registered task and its statistics.
+     */
+    struct Task {
+        std::string name;               /**< Task name. */
+        double rateHz;                  /**< Rate in Hz. */
+        std::function<void()> body;     /**< Function executed every period. */
+        int cpu;                        /**< CPU to pin to, or -1. */
+        int priority;                   /**< Real-time priority (1-99), or 0 for normal priority. */
+        std::thread worker;             /**< Thread running the task. */
+        std::mutex wakeMutex;           /**< Mutex paired with wake; only this task and stop() take it. */
+        std::condition_variable wake;   /**< Wakes the sleeping task when the executor stops. */
+        std::mutex statsMutex;          /**< Protects stats. */
+        TaskStats stats;                /**< Timing statistics. */
+    };
+
+    std::vector<std::unique_ptr<Task> > tasks; /**< Registered tasks. */
+    std::atomic<bool> running;                 /**< True while the task threads run. */
+
+    /**
+     * @brief Thread body of one task.
+     * @param task The task to run.
+     */
+    void run(Task* task);
+
+    /**
+     * @brief Applies CPU affinity and real-time priority to the calling thread.
+     * @param task The task whose settings are applied; its stats record the outcome.
+     */
+    static void configureThread(Task* task);
+
+public:
+    /**
+     * @brief Constructor for the PeriodicExecutor class.
+     */
+    PeriodicExecutor();
+
+    /**
+     * @brief Destructor; stops all task threads.
+     */
+    ~PeriodicExecutor();
+
+    /**
+     * @brief Registers a task. Tasks can only be added while the executor is stopped.
+     * @param name Task name used in the statistics.
+     * @param rateHz Execution rate in Hz.
+     * @param body Function executed every period.
+     * @param cpu CPU to pin the task thread to, or -1 to leave it unpinned.
+     * @param priority Real-time priority (1-99), or 0 to keep normal priority.
+     * @return The task id, or -1 if the task could not be added.
+     */
+    int addTask(const std::string& name, double rateHz, std::function<void()> body, int cpu = -1, int priority = 0);
+
+    /**
+     * @brief Starts one thread per registered task.
+     * @return True if the executor was started, false if it was already running.
+     */
+    bool start();
+
+    /**
+     * @brief Stops all task threads and waits for them to finish their current period.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether the executor is running.
+     * @return True if running, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Returns the number of registered tasks.
+     * @return The number of tasks.
+     */
+    int getTaskCount() const;
+
+    /**
+     * @brief Returns a snapshot of a task's statistics.
+     * @param id Task id returned by addTask().
+     * @return The statistics; an empty record if the id is invalid.
+     */
+    TaskStats getStats(int id);
+
+    /**
+     * @brief Prints the statistics of all tasks to the console.
+     */
+    void printStats();
+};
+
+#endif // PERIODICEXECUTOR_H
@@ -0,0 +1,75 @@
+/**
+ * @file PeriodicExecutorTest.cpp
+ * @brief Test application for the PeriodicExecutor class.
+ * @details Runs the safety check, the mapper and a control task at their own rates,
+ * adds a task that deliberately overruns its period, and prints the timing statistics.
+ * @date October, 2026
+ */
+
+#include "PeriodicExecutor.h"
+#include "RobotControler.h"
+#include "SafeNavigation.h"
+#include "Mapper.h"
+#include "LidarSensor.h"
+#include "IRSensor.h"
+#include "FestoRobotAPI.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <thread>
+using namespace std;
+
+/**
+ * @brief Main function for testing the PeriodicExecutor class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    FestoRobotAPI* robotAPI = new FestoRobotAPI();
+    Pose* initialPose = new Pose(0.0, 0.0, 0.0);
+    RobotControler controller(initialPose, robotAPI); // Takes ownership of the pose and the API
+    IRSensor irSensor(robotAPI);
+    LidarSensor lidar(robotAPI);
+    SafeNavigation safeNav(&controller, &irSensor);
+    Mapper mapper(40, 40, 0.25, &controller, &lidar);
+
+    controller.connectRobot();
+
+    PeriodicExecutor executor;
+    int safety = executor.addTask("safety", 20.0, [&safeNav]() { safeNav.checkSafety(); });
+    int mapping = executor.addTask("mapping", 1.0, [&mapper]() { mapper.updateMap(); });
+    int control = executor.addTask("control", 100.0, [&controller]() { controller.getPose(); }, 0, 50);
+    int slow = executor.addTask("overrun", 50.0, []() { this_thread::sleep_for(chrono::milliseconds(30)); });
+
+    /**
+     * @test Test 1: Tasks cannot be added with an invalid rate.
+     */
+    assert(executor.addTask("invalid", 0.0, []() {}) == -1);
+    assert(executor.getTaskCount() == 4);
+
+    /**
+     * @test Test 2: Every task runs at its own rate without drifting.
+     */
+    executor.start();
+    this_thread::sleep_for(chrono::seconds(2));
+    executor.stop();
+    executor.printStats();
+
+    TaskStats controlStats = executor.getStats(control);
+    cout << "Control task runs: " << controlStats.runs << " (expected about 200)" << endl;
+    assert(controlStats.runs >= 150 && controlStats.runs <= 205);
+    assert(executor.getStats(safety).runs >= 30);
+    assert(executor.getStats(mapping).runs >= 2);
+
+    /**
+     * @test Test 3: A task that takes longer than its period is reported, not run back to back.
+     */
+    TaskStats slowStats = executor.getStats(slow);
+    cout << "Overrun task: runs=" << slowStats.runs << ", overruns=" << slowStats.overruns
+        << ", misses=" << slowStats.deadlineMisses << endl;
+    assert(slowStats.overruns > 0 && slowStats.deadlineMisses > 0);
+    assert(slowStats.runs <= 70);
+
+    controller.disconnectRobot();
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
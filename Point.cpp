@@ -69,7 +69,7 @@ void Point::setPoint(double _x, double _y) {
  * @param pos Another point to calculate the distance to.
  * @return The Euclidean distance between the two points.
  */
-double Point::findDistanceTo(Point pos) {
+double Point::findDistanceTo(const Point& pos) const {
     double sum = (x - pos.x) * (x - pos.x) + (y - pos.y) * (y - pos.y);
     double distance = sqrt(sum);
     return distance;
@@ -80,7 +80,7 @@ double Point::findDistanceTo(Point pos) {
  * @param pos Another point to calculate the angle to.
  * @return The angle in degrees between the two points (0 to 360).
  */
-double Point::findAngleTo(Point pos) {
+double Point::findAngleTo(const Point& pos) const {
     double dx = pos.getX() - this->x;
     double dy = pos.getY() - this->y;
 
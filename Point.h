@@ -22,8 +22,8 @@ public:
 	bool operator==(const Pose& other);
 	void getPoint(double &_x, double &_y);
 	void setPoint(double _x, double _y);
-	double findDistanceTo(Point pos);
-	double findAngleTo(Point pos);
+	double findDistanceTo(const Point& pos) const;
+	double findAngleTo(const Point& pos) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,449 @@
+/**
+ * @file PointCloud2D.cpp
+ * @brief Implementation of the PointCloud2D class.
+ * @date October 2026
+ */
+
+#include "PointCloud2D.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+/** @brief Alignment of the arrays: one AVX register. */
+static const size_t ARRAY_ALIGNMENT = 32;
+
+/**
+ * @brief Allocates an aligned array.
+ * @param bytes Size in bytes (0 allocates nothing).
+ * @return The memory, or nullptr for 0 bytes. Throws std::bad_alloc on failure like new[].
+ */
+static void* alignedAlloc(size_t bytes) {
+    if (bytes == 0) {
+        return nullptr;
+    }
+#ifdef _WIN32
+    void* memory = _aligned_malloc(bytes, ARRAY_ALIGNMENT);
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, ARRAY_ALIGNMENT, bytes) != 0) {
+        memory = nullptr;
+    }
+#endif
+    if (!memory) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief Releases an array from alignedAlloc.
+ * @param memory The memory (may be nullptr).
+ */
+static void alignedFree(void* memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+/**
+ * @brief Constructor for the PointCloud2D class.
+ * @param reserveCount Number of points to make room for.
+ */
+PointCloud2D::PointCloud2D(size_t reserveCount)
+    : xs(nullptr), ys(nullptr), intensities(nullptr), beams(nullptr), count(0), capacity(0),
+    withIntensity(false), withBeam(false), layoutAngleMin(0.0), layoutIncrement(0.0) {
+    reserve(reserveCount);
+}
+
+/**
+ * @brief Copy constructor.
+ * @param other The cloud to copy.
+ */
+PointCloud2D::PointCloud2D(const PointCloud2D& other) : PointCloud2D() {
+    *this = other;
+}
+
+/**
+ * @brief Move constructor.
+ * @param other The cloud to take the arrays of.
+ */
+PointCloud2D::PointCloud2D(PointCloud2D&& other) noexcept
+    : xs(other.xs), ys(other.ys), intensities(other.intensities), beams(other.beams), count(other.count),
+    capacity(other.capacity), withIntensity(other.withIntensity), withBeam(other.withBeam),
+    beamCos(std::move(other.beamCos)), beamSin(std::move(other.beamSin)), layoutAngleMin(other.layoutAngleMin),
+    layoutIncrement(other.layoutIncrement) {
+    other.xs = nullptr;
+    other.ys = nullptr;
+    other.intensities = nullptr;
+    other.beams = nullptr;
+    other.count = 0;
+    other.capacity = 0;
+}
+
+/**
+ * @brief Copy assignment operator.
+ * @param other The cloud to copy.
+ * @return This cloud.
+ */
+PointCloud2D& PointCloud2D::operator=(const PointCloud2D& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    setChannels(other.withIntensity, other.withBeam);
+    reserve(other.count);
+    if (other.count > 0) {
+        memcpy(xs, other.xs, other.count * sizeof(float));
+        memcpy(ys, other.ys, other.count * sizeof(float));
+        if (withIntensity) {
+            memcpy(intensities, other.intensities, other.count * sizeof(float));
+        }
+        if (withBeam) {
+            memcpy(beams, other.beams, other.count * sizeof(int32_t));
+        }
+    }
+    count = other.count;
+    return *this;
+}
+
+/**
+ * @brief Move assignment operator.
+ * @param other The cloud to take the arrays of.
+ * @return This cloud.
+ */
+PointCloud2D& PointCloud2D::operator=(PointCloud2D&& other) noexcept {
+    if (this != &other) {
+        alignedFree(xs);
+        alignedFree(ys);
+        alignedFree(intensities);
+        alignedFree(beams);
+        xs = other.xs;
+        ys = other.ys;
+        intensities = other.intensities;
+        beams = other.beams;
+        count = other.count;
+        capacity = other.capacity;
+        withIntensity = other.withIntensity;
+        withBeam = other.withBeam;
+        beamCos = std::move(other.beamCos);
+        beamSin = std::move(other.beamSin);
+        layoutAngleMin = other.layoutAngleMin;
+        layoutIncrement = other.layoutIncrement;
+        other.xs = nullptr;
+        other.ys = nullptr;
+        other.intensities = nullptr;
+        other.beams = nullptr;
+        other.count = 0;
+        other.capacity = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor for the PointCloud2D class.
+ */
+PointCloud2D::~PointCloud2D() {
+    alignedFree(xs);
+    alignedFree(ys);
+    alignedFree(intensities);
+    alignedFree(beams);
+}
+
+/**
+ * @brief Moves the points into arrays of a new capacity.
+ * @param newCapacity The capacity, at least count.
+ */
+void PointCloud2D::reallocate(size_t newCapacity) {
+    float* newXs = static_cast<float*>(alignedAlloc(newCapacity * sizeof(float)));
+    float* newYs = static_cast<float*>(alignedAlloc(newCapacity * sizeof(float)));
+    float* newIntensities = withIntensity ? static_cast<float*>(alignedAlloc(newCapacity * sizeof(float))) : nullptr;
+    int32_t* newBeams = withBeam ? static_cast<int32_t*>(alignedAlloc(newCapacity * sizeof(int32_t))) : nullptr;
+    if (count > 0) {
+        memcpy(newXs, xs, count * sizeof(float));
+        memcpy(newYs, ys, count * sizeof(float));
+        if (withIntensity) {
+            memcpy(newIntensities, intensities, count * sizeof(float));
+        }
+        if (withBeam) {
+            memcpy(newBeams, beams, count * sizeof(int32_t));
+        }
+    }
+    alignedFree(xs);
+    alignedFree(ys);
+    alignedFree(intensities);
+    alignedFree(beams);
+    xs = newXs;
+    ys = newYs;
+    intensities = newIntensities;
+    beams = newBeams;
+    capacity = newCapacity;
+}
+
+/**
+ * @brief Turns the optional channels on or off.
+ * @param intensity True to keep an intensity per point.
+ * @param beamIndex True to keep the index of the beam each point came from.
+ */
+void PointCloud2D::setChannels(bool intensity, bool beamIndex) {
+    if (intensity && !withIntensity && capacity > 0) {
+        intensities = static_cast<float*>(alignedAlloc(capacity * sizeof(float)));
+        for (size_t i = 0; i < count; i++) {
+            intensities[i] = 0.0f;
+        }
+    }
+    else if (!intensity) {
+        alignedFree(intensities);
+        intensities = nullptr;
+    }
+    if (beamIndex && !withBeam && capacity > 0) {
+        beams = static_cast<int32_t*>(alignedAlloc(capacity * sizeof(int32_t)));
+        for (size_t i = 0; i < count; i++) {
+            beams[i] = -1;
+        }
+    }
+    else if (!beamIndex) {
+        alignedFree(beams);
+        beams = nullptr;
+    }
+    withIntensity = intensity;
+    withBeam = beamIndex;
+}
+
+/**
+ * @brief Makes room for a number of points.
+ * @param reserveCount The number of points.
+ */
+void PointCloud2D::reserve(size_t reserveCount) {
+    if (reserveCount > capacity) {
+        reallocate(reserveCount);
+    }
+}
+
+/**
+ * @brief Removes all points and keeps the memory.
+ */
+void PointCloud2D::clear() {
+    count = 0;
+}
+
+/**
+ * @brief Returns the number of points.
+ * @return The point count.
+ */
+size_t PointCloud2D::size() const {
+    return count;
+}
+
+/**
+ * @brief Checks whether the cloud has no points.
+ * @return True if empty.
+ */
+bool PointCloud2D::empty() const {
+    return count == 0;
+}
+
+/**
+ * @brief Appends a point.
+ * @param x X coordinate.
+ * @param y Y coordinate.
+ * @param intensity Intensity, kept if the channel is on.
+ * @param beam Beam index, kept if the channel is on.
+ */
+void PointCloud2D::push(float x, float y, float intensity, int32_t beam) {
+    if (count == capacity) {
+        reallocate(capacity < 32 ? 64 : 2 * capacity);
+    }
+    xs[count] = x;
+    ys[count] = y;
+    if (withIntensity) {
+        intensities[count] = intensity;
+    }
+    if (withBeam) {
+        beams[count] = beam;
+    }
+    count++;
+}
+
+/**
+ * @brief Appends a Point.
+ * @param point The point.
+ */
+void PointCloud2D::push(const Point& point) {
+    push(static_cast<float>(point.getX()), static_cast<float>(point.getY()));
+}
+
+/**
+ * @brief Appends Point objects.
+ * @param points The points.
+ */
+void PointCloud2D::append(const vector<Point>& points) {
+    reserve(count + points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        push(points[i]);
+    }
+}
+
+/**
+ * @brief Returns a point as a Point object.
+ * @param index Index of the point.
+ * @return The point.
+ */
+Point PointCloud2D::getPoint(size_t index) const {
+    return Point(xs[index], ys[index]);
+}
+
+/**
+ * @brief Copies the points into Point objects.
+ * @param points Receives the points.
+ */
+void PointCloud2D::toPoints(vector<Point>& points) const {
+    points.clear();
+    points.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        points.push_back(Point(xs[i], ys[i]));
+    }
+}
+
+/**
+ * @brief Replaces the points by the end points of a scan in the sensor frame.
+ * @param ranges The ranges in meters.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees.
+ * @param angleIncrement Angle between beams in degrees.
+ * @param minRange Ranges at or below this are skipped.
+ * @param maxRange Ranges above this are skipped.
+ * @return The number of points.
+ */
+size_t PointCloud2D::fromPolar(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+    float minRange, float maxRange) {
+    count = 0;
+    if (rangeCount <= 0) {
+        return 0;
+    }
+    reserve(static_cast<size_t>(rangeCount));
+    if (beamCos.size() < static_cast<size_t>(rangeCount) || angleMin != layoutAngleMin
+        || angleIncrement != layoutIncrement) {
+        beamCos.resize(rangeCount);
+        beamSin.resize(rangeCount);
+        for (int i = 0; i < rangeCount; i++) {
+            double angle = (angleMin + i * angleIncrement) * M_PI / 180.0;
+            beamCos[i] = static_cast<float>(cos(angle));
+            beamSin[i] = static_cast<float>(sin(angle));
+        }
+        layoutAngleMin = angleMin;
+        layoutIncrement = angleIncrement;
+    }
+    const float* c = &beamCos[0];
+    const float* s = &beamSin[0];
+    for (int i = 0; i < rangeCount; i++) {
+        float range = ranges[i];
+        if (!(range > minRange && range <= maxRange)) {
+            continue; // Also skips NaN
+        }
+        xs[count] = range * c[i];
+        ys[count] = range * s[i];
+        if (withIntensity) {
+            intensities[count] = 0.0f;
+        }
+        if (withBeam) {
+            beams[count] = i;
+        }
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Moves every point from a frame into the frame that contains it.
+ * @param x X of the frame origin.
+ * @param y Y of the frame origin.
+ * @param th Heading of the frame in radians.
+ */
+void PointCloud2D::transform(double x, double y, double th) {
+    transform(Transform2D(x, y, th));
+}
+
+/**
+ * @brief Moves every point from the frame of a pose into the frame the pose is given in.
+ * @param pose The pose (th in radians).
+ */
+void PointCloud2D::transform(const Pose& pose) {
+    transform(Transform2D(pose));
+}
+
+/**
+ * @brief Moves every point from the child to the parent frame of a transform.
+ * @param frame The transform; its cached sine and cosine are used.
+ */
+void PointCloud2D::transform(const Transform2D& frame) {
+    frame.apply(xs, ys, count, xs, ys);
+}
+
+/**
+ * @brief Copies a point with its channels over another one.
+ * @param from Index of the point to copy.
+ * @param to Index to copy it to.
+ */
+void PointCloud2D::movePoint(size_t from, size_t to) {
+    xs[to] = xs[from];
+    ys[to] = ys[from];
+    if (withIntensity) {
+        intensities[to] = intensities[from];
+    }
+    if (withBeam) {
+        beams[to] = beams[from];
+    }
+}
+
+/**
+ * @brief Keeps the points whose distance from the origin is inside [minRange, maxRange].
+ * @param minRange Smallest distance kept.
+ * @param maxRange Largest distance kept.
+ * @return The number of points removed.
+ */
+size_t PointCloud2D::filterRange(float minRange, float maxRange) {
+    const float minSquared = minRange * minRange;
+    const float maxSquared = maxRange * maxRange;
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+        float squared = xs[i] * xs[i] + ys[i] * ys[i];
+        if (squared >= minSquared && squared <= maxSquared) {
+            movePoint(i, kept++);
+        }
+    }
+    size_t removed = count - kept;
+    count = kept;
+    return removed;
+}
+
+/**
+ * @brief Keeps the points inside an axis-aligned box, borders included.
+ * @param xMin Smallest x kept.
+ * @param yMin Smallest y kept.
+ * @param xMax Largest x kept.
+ * @param yMax Largest y kept.
+ * @return The number of points removed.
+ */
+size_t PointCloud2D::filterBox(float xMin, float yMin, float xMax, float yMax) {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (xs[i] >= xMin && xs[i] <= xMax && ys[i] >= yMin && ys[i] <= yMax) {
+            movePoint(i, kept++);
+        }
+    }
+    size_t removed = count - kept;
+    count = kept;
+    return removed;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file PointCloud2D.h
+ * @brief Declaration of the PointCloud2D class, a structure-of-arrays container for scan points.
+ * @date October 2026
+ */
+
+#ifndef POINTCLOUD2D_H
+#define POINTCLOUD2D_H
+
+#include "Point.h"
+#include "Pose.h"
+#include "Transform2D.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class PointCloud2D
+ * @brief 2D points stored as separate, 32-byte aligned float arrays.
+ *
+ * The x and y coordinates live in their own contiguous arrays, so transforms and filters are
+ * plain loops over floats that the compiler vectorizes, instead of one Point object per beam.
+ * Two optional channels travel with the points through every filter: an intensity and the
+ * index of the beam a point came from. Point is supported at the edges: points can be
+ * appended from and read back as Point objects.
+ */
+class PointCloud2D {
+private:
+    float* xs;               /**< X coordinates. */
+    float* ys;               /**< Y coordinates. */
+    float* intensities;      /**< Intensities, or nullptr if the channel is off. */
+    int32_t* beams;          /**< Beam indices, or nullptr if the channel is off. */
+    size_t count;            /**< Number of points. */
+    size_t capacity;         /**< Number of points the arrays can hold. */
+    bool withIntensity;      /**< True if the intensity channel is on. */
+    bool withBeam;           /**< True if the beam index channel is on. */
+    std::vector<float> beamCos;  /**< Cosine of each beam angle of the last scan layout. */
+    std::vector<float> beamSin;  /**< Sine of each beam angle of the last scan layout. */
+    double layoutAngleMin;       /**< First beam angle the tables were built for, in degrees. */
+    double layoutIncrement;      /**< Beam increment the tables were built for, in degrees. */
+
+    /**
+     * @brief Moves the points into arrays of a new capacity.
+     * @param newCapacity The capacity, at least count.
+     */
+    void reallocate(size_t newCapacity);
+
+    /**
+     * @brief Copies a point with its channels over another one, for in-place filtering.
+     * @param from Index of the point to copy.
+     * @param to Index to copy it to.
+     */
+    void movePoint(size_t from, size_t to);
+
+public:
+    /**
+     * @brief Constructor for the PointCloud2D class.
+     * @param reserveCount Number of points to make room for.
+     */
+    explicit PointCloud2D(size_t reserveCount = 0);
+
+    /**
+     * @brief Copy constructor.
+     * @param other The cloud to copy.
+     */
+    PointCloud2D(const PointCloud2D& other);
+
+    /**
+     * @brief Move constructor.
+     * @param other The cloud to take the arrays of.
+     */
+    PointCloud2D(PointCloud2D&& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The cloud to copy.
+     * @return This cloud.
+     */
+    PointCloud2D& operator=(const PointCloud2D& other);
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The cloud to take the arrays of.
+     * @return This cloud.
+     */
+    PointCloud2D& operator=(PointCloud2D&& other) noexcept;
+
+    /**
+     * @brief Destructor for the PointCloud2D class.
+     */
+    ~PointCloud2D();
+
+    /**
+     * @brief Turns the optional channels on or off. Channels that are turned on start at 0 and -1.
+     * @param intensity True to keep an intensity per point.
+     * @param beamIndex True to keep the index of the beam each point came from.
+     */
+    void setChannels(bool intensity, bool beamIndex);
+
+    /**
+     * @brief Makes room for a number of points.
+     * @param reserveCount The number of points.
+     */
+    void reserve(size_t reserveCount);
+
+    /**
+     * @brief Removes all points and keeps the memory.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of points.
+     * @return The point count.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Checks whether the cloud has no points.
+     * @return True if empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Appends a point.
+     * @param x X coordinate.
+     * @param y Y coordinate.
+     * @param intensity Intensity, kept if the channel is on.
+     * @param beam Beam index, kept if the channel is on.
+     */
+    void push(float x, float y, float intensity = 0.0f, int32_t beam = -1);
+
+    /**
+     * @brief Appends a Point.
+     * @param point The point.
+     */
+    void push(const Point& point);
+
+    /**
+     * @brief Appends Point objects.
+     * @param points The points.
+     */
+    void append(const std::vector<Point>& points);
+
+    /**
+     * @brief Returns a point as a Point object.
+     * @param index Index of the point.
+     * @return The point.
+     */
+    Point getPoint(size_t index) const;
+
+    /**
+     * @brief Copies the points into Point objects.
+     * @param points Receives the points (replaced).
+     */
+    void toPoints(std::vector<Point>& points) const;
+
+    /** @brief Returns the x array. @return The array, aligned to 32 bytes. */
+    const float* x() const { return xs; }
+    /** @brief Returns the y array. @return The array, aligned to 32 bytes. */
+    const float* y() const { return ys; }
+    /** @brief Returns the intensity array. @return The array, or nullptr if the channel is off. */
+    const float* intensity() const { return intensities; }
+    /** @brief Returns the beam index array. @return The array, or nullptr if the channel is off. */
+    const int32_t* beam() const { return beams; }
+    /** @brief Returns the x array for writing. @return The array. */
+    float* x() { return xs; }
+    /** @brief Returns the y array for writing. @return The array. */
+    float* y() { return ys; }
+
+    /**
+     * @brief Replaces the points by the end points of a scan in the sensor frame.
+     * Beams whose range is not inside (minRange, maxRange] are skipped; with the beam index
+     * channel on, each point keeps the index of its beam. The beam directions are kept between
+     * calls, so scans with the same layout need no trigonometry.
+     * @param ranges The ranges in meters.
+     * @param rangeCount Number of ranges.
+     * @param angleMin Angle of the first beam in degrees.
+     * @param angleIncrement Angle between beams in degrees.
+     * @param minRange Ranges at or below this are skipped.
+     * @param maxRange Ranges above this are skipped.
+     * @return The number of points.
+     */
+    size_t fromPolar(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+        float minRange = 0.0f, float maxRange = 1.0e30f);
+
+    /**
+     * @brief Moves every point from a frame into the frame that contains it: rotates by th, then translates.
+     * @param x X of the frame origin.
+     * @param y Y of the frame origin.
+     * @param th Heading of the frame in radians.
+     */
+    void transform(double x, double y, double th);
+
+    /**
+     * @brief Moves every point from the frame of a pose into the frame the pose is given in.
+     * @param pose The pose (th in radians).
+     */
+    void transform(const Pose& pose);
+
+    /**
+     * @brief Moves every point from the child to the parent frame of a transform.
+     * @param frame The transform; its cached sine and cosine are used.
+     */
+    void transform(const Transform2D& frame);
+
+    /**
+     * @brief Keeps the points whose distance from the origin is inside [minRange, maxRange].
+     * @param minRange Smallest distance kept.
+     * @param maxRange Largest distance kept.
+     * @return The number of points removed.
+     */
+    size_t filterRange(float minRange, float maxRange);
+
+    /**
+     * @brief Keeps the points inside an axis-aligned box, borders included.
+     * @param xMin Smallest x kept.
+     * @param yMin Smallest y kept.
+     * @param xMax Largest x kept.
+     * @param yMax Largest y kept.
+     * @return The number of points removed.
+     */
+    size_t filterBox(float xMin, float yMin, float xMax, float yMax);
+
+    /**
+     * @brief Removes the points a predicate selects.
+     * @tparam Predicate Callable as remove(x, y) returning true for points to remove.
+     * @param remove The predicate.
+     * @return The number of points removed.
+     */
+    template <typename Predicate>
+    size_t removeIf(Predicate remove);
+};
+
+template <typename Predicate>
+size_t PointCloud2D::removeIf(Predicate remove) {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!remove(xs[i], ys[i])) {
+            movePoint(i, kept++);
+        }
+    }
+    size_t removed = count - kept;
+    count = kept;
+    return removed;
+}
+
+#endif // POINTCLOUD2D_H
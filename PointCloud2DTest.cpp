@@ -0,0 +1,188 @@
+/**
+ * @file PointCloud2DTest.cpp
+ * @brief Test and benchmark application for the PointCloud2D class.
+ * @details Converts scans to clouds, checks transforms and filters against the same math done
+ * with Point objects, checks that the optional channels follow the points, inserts a cloud into
+ * a Map in bulk and compares the speed of the cloud pipeline with one Point object per beam.
+ * @date October, 2026
+ */
+
+#include "PointCloud2D.h"
+#include "Map.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/**
+ * @brief Checks whether two values are within a tolerance of each other.
+ * @param a First value.
+ * @param b Second value.
+ * @param tolerance Largest difference allowed.
+ * @return True if close.
+ */
+bool near(double a, double b, double tolerance) {
+    return fabs(a - b) <= tolerance;
+}
+
+/**
+ * @brief Main function for testing the PointCloud2D class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: A scan becomes points in the sensor frame; invalid ranges are skipped.
+     */
+    const int beams = 667;
+    float ranges[beams];
+    for (int i = 0; i < beams; i++) {
+        ranges[i] = 1.0f + (i % 40) * 0.05f;
+    }
+    ranges[0] = 0.0f;
+    ranges[10] = -1.0f;
+    ranges[20] = NAN;
+    ranges[30] = 50.0f;
+    PointCloud2D cloud;
+    cloud.setChannels(false, true);
+    assert(cloud.fromPolar(ranges, beams, -120.0, 0.36, 0.0f, 30.0f) == beams - 4);
+    assert(cloud.size() == beams - 4 && cloud.beam() && !cloud.intensity());
+    for (size_t k = 0; k < cloud.size(); k++) {
+        int i = cloud.beam()[k];
+        double angle = (-120.0 + i * 0.36) * M_PI / 180.0;
+        assert(i != 0 && i != 10 && i != 20 && i != 30);
+        assert(near(cloud.x()[k], ranges[i] * cos(angle), 1e-5) && near(cloud.y()[k], ranges[i] * sin(angle), 1e-5));
+    }
+    assert(reinterpret_cast<uintptr_t>(cloud.x()) % 32 == 0 && reinterpret_cast<uintptr_t>(cloud.y()) % 32 == 0);
+
+    /**
+     * @test Test 2: A transform by a pose matches rotating and translating each Point.
+     */
+    vector<Point> points;
+    cloud.toPoints(points);
+    Pose pose(3.0, -2.0, 0.7);
+    cloud.transform(pose);
+    for (size_t k = 0; k < points.size(); k++) {
+        double c = cos(pose.getTh()), s = sin(pose.getTh());
+        double x = pose.getX() + c * points[k].getX() - s * points[k].getY();
+        double y = pose.getY() + s * points[k].getX() + c * points[k].getY();
+        assert(near(cloud.x()[k], x, 1e-4) && near(cloud.y()[k], y, 1e-4));
+        Point origin(pose.getX(), pose.getY());
+        Point moved = cloud.getPoint(k);
+        assert(near(origin.findDistanceTo(moved), ranges[cloud.beam()[k]], 1e-4));
+    }
+
+    /**
+     * @test Test 3: Filters remove points in place and keep the channels in step.
+     */
+    PointCloud2D grid;
+    grid.setChannels(true, true);
+    for (int i = 0; i < 100; i++) {
+        grid.push(static_cast<float>(i % 10), static_cast<float>(i / 10), i * 0.5f, i);
+    }
+    assert(grid.filterBox(2.0f, 3.0f, 5.0f, 6.0f) == 84 && grid.size() == 16);
+    for (size_t k = 0; k < grid.size(); k++) {
+        int i = grid.beam()[k];
+        assert(grid.x()[k] == i % 10 && grid.y()[k] == i / 10 && grid.intensity()[k] == i * 0.5f);
+    }
+    size_t before = grid.size();
+    size_t removed = grid.filterRange(5.0f, 6.5f);
+    assert(grid.size() == before - removed && removed > 0 && grid.size() > 0);
+    for (size_t k = 0; k < grid.size(); k++) {
+        double range = sqrt(grid.x()[k] * grid.x()[k] + grid.y()[k] * grid.y()[k]);
+        assert(range >= 5.0 && range <= 6.5 && grid.intensity()[k] == grid.beam()[k] * 0.5f);
+    }
+
+    /**
+     * @test Test 4: Point objects go in and come out unchanged; copies and moves keep everything.
+     */
+    vector<Point> input;
+    for (int i = 0; i < 1000; i++) {
+        input.push_back(Point(i * 0.25, -i * 0.125));
+    }
+    PointCloud2D fromPoints;
+    fromPoints.append(input);
+    vector<Point> output;
+    fromPoints.toPoints(output);
+    assert(output.size() == input.size());
+    for (size_t k = 0; k < input.size(); k++) {
+        assert(output[k].getX() == input[k].getX() && output[k].getY() == input[k].getY());
+    }
+    PointCloud2D copy(grid);
+    assert(copy.size() == grid.size() && copy.x() != grid.x() && copy.beam()[0] == grid.beam()[0]);
+    PointCloud2D moved(std::move(copy));
+    assert(copy.empty() && moved.size() == grid.size() && moved.intensity()[0] == grid.intensity()[0]);
+    moved.setChannels(false, true);
+    assert(!moved.intensity() && moved.beam()[0] == grid.beam()[0]);
+    moved.clear();
+    assert(moved.empty());
+
+    /**
+     * @test Test 5: Bulk insertion into a Map marks the same cells as inserting each Point.
+     */
+    Map bulk(60, 60, 0.1);
+    Map single(60, 60, 0.1);
+    PointCloud2D scan;
+    scan.fromPolar(ranges, beams, -120.0, 0.36, 0.0f, 30.0f);
+    scan.transform(5.0, 5.0, 0.3);
+    int outside = bulk.insertPoints(scan);
+    int expectedOutside = 0;
+    for (size_t k = 0; k < scan.size(); k++) {
+        Point p = scan.getPoint(k);
+        if (p.getX() < 0.0 || p.getX() >= 6.0 || p.getY() < 0.0 || p.getY() >= 6.0) {
+            expectedOutside++;
+        }
+        else {
+            single.insertPoint(p);
+        }
+    }
+    assert(outside == expectedOutside && outside > 0);
+    for (int x = 0; x < 60; x++) {
+        for (int y = 0; y < 60; y++) {
+            assert(bulk.getGrid(x, y) == single.getGrid(x, y));
+        }
+    }
+
+    /**
+     * @test Test 6: Benchmark of the cloud pipeline against one Point object per beam.
+     */
+    const int scans = 20000;
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        scan.fromPolar(ranges, beams, -120.0, 0.36, 0.0f, 30.0f);
+        scan.transform((s % 1000) * 0.001, 2.0, s * 0.0001);
+        scan.filterBox(-10.0f, -10.0f, 10.0f, 10.0f);
+        checksum += scan.x()[0];
+    }
+    double cloudMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        vector<Point> list;
+        double th = s * 0.0001;
+        for (int i = 0; i < beams; i++) {
+            if (!(ranges[i] > 0.0f && ranges[i] <= 30.0f)) {
+                continue;
+            }
+            double angle = (-120.0 + i * 0.36) * M_PI / 180.0 + th;
+            Point p((s % 1000) * 0.001 + ranges[i] * cos(angle), 2.0 + ranges[i] * sin(angle));
+            if (p.getX() >= -10.0 && p.getX() <= 10.0 && p.getY() >= -10.0 && p.getY() <= 10.0) {
+                list.push_back(p);
+            }
+        }
+        checksum -= list[0].getX();
+    }
+    double pointMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    assert(fabs(checksum) < 1e-2 * scans);
+    cout << "Cloud pipeline: " << cloudMs * 1000.0 / scans << " us/scan, Point pipeline: " << pointMs * 1000.0 / scans
+        << " us/scan" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -6,6 +6,7 @@
  */
 
 #include "Pose.h"
+#include "Transform2D.h"
 #include <cmath>
 
  // Tanml deilse M_PI sabiti tanmlanr
@@ -171,4 +172,38 @@ double Pose::findAngleTo(const Pose& other) const {
         angle += 360.0;
     }
     return angle;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Composes a pose given in this pose's frame onto this pose.
+ * @param local The pose relative to this one (e.g. an odometry increment).
+ * @return The pose of local in the frame this pose is given in, heading wrapped to [-pi, pi).
+ */
+Pose Pose::compose(const Pose& local) const {
+    return (Transform2D(*this) * Transform2D(local)).toPose();
+}
+
+/**
+ * @brief Gets the inverse of this pose: the pose of the parent frame seen from this one.
+ * @return The inverse pose, heading wrapped to [-pi, pi).
+ */
+Pose Pose::inverse() const {
+    return Transform2D(*this).inverse().toPose();
+}
+
+/**
+ * @brief Gets this pose expressed in the frame of another pose, so that reference.compose(result) == *this.
+ * @param reference The pose whose frame is used.
+ * @return The relative pose, heading wrapped to [-pi, pi).
+ */
+Pose Pose::relativeTo(const Pose& reference) const {
+    return Transform2D(reference).relative(Transform2D(*this)).toPose();
+}
+
+/**
+ * @brief Gets the pose with its heading wrapped to [-pi, pi).
+ * @return The normalized pose.
+ */
+Pose Pose::normalized() const {
+    return Pose(x, y, normalizeAngle(th));
+}
@@ -52,10 +52,10 @@ public:
     //! Checks if two poses are equal
     bool operator==(const Pose& other) const;
 
-    //! Adds two poses
+    //! Adds two poses component-wise (not composition, see compose())
     Pose operator+(const Pose& other) const;
 
-    //! Subtracts one pose from another
+    //! Subtracts one pose from another component-wise (not composition, see relativeTo())
     Pose operator-(const Pose& other) const;
 
     //! Adds another pose to the current pose
@@ -78,6 +78,18 @@ public:
 
     //! Calculates the angle to another pose
     double findAngleTo(const Pose& other) const;
+
+    //! Composes a pose given in this pose's frame onto this pose (SE(2))
+    Pose compose(const Pose& local) const;
+
+    //! Gets the inverse of this pose (SE(2))
+    Pose inverse() const;
+
+    //! Gets this pose expressed in the frame of another pose (SE(2))
+    Pose relativeTo(const Pose& reference) const;
+
+    //! Gets the pose with its heading wrapped to [-pi, pi)
+    Pose normalized() const;
 };
 
 #endif // POSE_H
@@ -25,6 +25,7 @@ bool Record::openFile() {
         return false;
     }
 
+    startRotation();
     return true;
 }
 
@@ -33,8 +34,21 @@ bool Record::openFile() {
  * @return True if the file is successfully closed, false otherwise.
  */
 bool Record::closeFile() {
+    if (writer.isOpen() || asyncWriter.isOpen() || reader.isOpen()) {
+        bool closed = (!writer.isOpen() || writer.close()) && (!asyncWriter.isOpen() || asyncWriter.close());
+        archiver.stop();
+        reader.close();
+        index.clear();
+        indexLoaded = false;
+        if (!closed) {
+            cerr << "Error: Failed to close the file: " << fileName << std::endl;
+        }
+        return closed;
+    }
     if (file.is_open()) {
+        file.clear(); // Reading to the end of the file sets failbit; only the close itself matters here
         file.close();
+        archiver.stop();
         if (file.fail()) {
             cerr << "Error: Failed to close the file: " << fileName << std::endl;
             return false;
@@ -58,6 +72,33 @@ void Record::setFileName(const string& name) {
     }
 }
 
+/**
+ * @brief Sets when the file is rotated and how long closed segments are kept.
+ * @param policy The limits; all zero appends to one file forever.
+ */
+void Record::setRotation(const RotationPolicy& policy) {
+    rotation = policy;
+}
+
+/**
+ * @brief Returns the closed segments of the file, oldest first.
+ * @return The segments.
+ */
+vector<SegmentInfo> Record::getSegments() const {
+    return archiver.getSegments();
+}
+
+/**
+ * @brief Starts the archiver if rotation is enabled and it is not running yet.
+ * @return True if the file is rotated.
+ */
+bool Record::startRotation() {
+    if (rotation.segmentBytes == 0 && rotation.segmentSeconds <= 0.0) {
+        return false;
+    }
+    return archiver.isRunning() || archiver.start(fileName, rotation);
+}
+
 /**
  * @brief Reads a line from the file.
  * @return The read line as a string. Returns an empty string on error or end of file.
@@ -89,12 +130,216 @@ bool Record::writeLine(const string& str) {
         if (!file.is_open()) {
             return false;
         }
+        startRotation();
     }
 
     file << str << endl;
+    if (archiver.isRunning() && archiver.addBytes(str.size() + 1)) {
+        file.close();
+        archiver.archive(); // On failure the same file is opened again
+        file.open(fileName, ios::in | ios::out | ios::app);
+        return file.is_open();
+    }
     return true;
 }
 
+/**
+ * @brief Opens the file as a binary telemetry log for appending.
+ * @param async True to write from a background thread (see AsyncLogWriter).
+ * @return True if the log is successfully opened, false otherwise.
+ */
+bool Record::openBinary(bool async) {
+    if (fileName.empty()) {
+        cerr << "File name not specified!" << std::endl;
+        return false;
+    }
+    LogArchiver* segmentArchiver = startRotation() ? &archiver : nullptr;
+    if (async) {
+        asyncWriter.setArchiver(segmentArchiver);
+        return asyncWriter.open(fileName);
+    }
+    writer.setArchiver(segmentArchiver);
+    return writer.open(fileName);
+}
+
+/**
+ * @brief Sends a record to the open binary writer, opening a synchronous one if none is open.
+ * @param type One of TelemetryRecordType.
+ * @param timestamp Time of the record in seconds.
+ * @param head The fixed part of the payload.
+ * @param headSize Size of the fixed part.
+ * @param body The array part of the payload (may be nullptr).
+ * @param bodySize Size of the array part.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::appendRecord(uint16_t type, double timestamp, const void* head, uint32_t headSize,
+    const void* body, uint32_t bodySize) {
+    if (asyncWriter.isOpen()) {
+        return asyncWriter.append(type, timestamp, head, headSize, body, bodySize);
+    }
+    if (!writer.isOpen() && !openBinary()) {
+        return false;
+    }
+    return writer.append(type, timestamp, head, headSize, body, bodySize);
+}
+
+/**
+ * @brief Appends a record to the binary log.
+ * @param type One of TelemetryRecordType.
+ * @param timestamp Time of the record in seconds.
+ * @param payload The payload.
+ * @param size Payload size in bytes.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writeRecord(uint16_t type, double timestamp, const void* payload, uint32_t size) {
+    return appendRecord(type, timestamp, payload, size, nullptr, 0);
+}
+
+/**
+ * @brief Appends a Lidar scan and the pose it was taken at to the binary log.
+ * @param scan The scan.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writeScan(const LidarScan& scan) {
+    LidarScanRecord fixed;
+    scan.pose.getPose(fixed.x, fixed.y, fixed.th);
+    fixed.angleMin = static_cast<float>(scan.angleMin);
+    fixed.angleIncrement = static_cast<float>(scan.angleIncrement);
+    fixed.count = static_cast<uint32_t>(scan.rangeNumber);
+    fixed.reserved = 0;
+    return appendRecord(RECORD_LIDAR_SCAN, scan.timestamp, &fixed, sizeof(fixed),
+        scan.ranges, fixed.count * sizeof(float));
+}
+
+/**
+ * @brief Appends the readings of the IR sensors to the binary log.
+ * @param timestamp Time of the readings in seconds.
+ * @param ranges The readings.
+ * @param count Number of readings.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writeIRFrame(double timestamp, const double* ranges, uint32_t count) {
+    IRFrameRecord fixed = { count, 0 };
+    return appendRecord(RECORD_IR_FRAME, timestamp, &fixed, sizeof(fixed), ranges, count * sizeof(double));
+}
+
+/**
+ * @brief Appends a pose to the binary log.
+ * @param timestamp Time of the pose in seconds.
+ * @param pose The pose.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writePose(double timestamp, const Pose& pose) {
+    PoseRecord record;
+    pose.getPose(record.x, record.y, record.th);
+    return writeRecord(RECORD_POSE, timestamp, &record, sizeof(record));
+}
+
+/**
+ * @brief Appends a velocity command to the binary log.
+ * @param command The command.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writeCommand(const TimedCommand& command) {
+    CommandRecord record;
+    record.vx = command.command.vx;
+    record.vy = command.command.vy;
+    record.omega = command.command.omega;
+    record.source = command.source;
+    record.reserved = 0;
+    return writeRecord(RECORD_COMMAND, command.timestamp, &record, sizeof(record));
+}
+
+/**
+ * @brief Appends a set of changed map cells to the binary log.
+ * @param timestamp Time of the change in seconds.
+ * @param cells The changed cells.
+ * @param count Number of cells.
+ * @return True if the record is accepted, false otherwise.
+ */
+bool Record::writeMapDelta(double timestamp, const MapCellRecord* cells, uint32_t count) {
+    MapDeltaRecord fixed = { count, 0 };
+    return appendRecord(RECORD_MAP_DELTA, timestamp, &fixed, sizeof(fixed), cells, count * sizeof(MapCellRecord));
+}
+
+/**
+ * @brief Writes the buffered binary records to the file.
+ * @return True if successful, false otherwise.
+ */
+bool Record::flush() {
+    if (asyncWriter.isOpen()) {
+        return asyncWriter.flush();
+    }
+    if (!writer.isOpen()) {
+        return false;
+    }
+    return writer.flush();
+}
+
+/**
+ * @brief Returns the counters of the asynchronous binary log.
+ * @return The counters (all zero unless the log was opened with async = true).
+ */
+LogStats Record::getLogStats() {
+    return asyncWriter.getStats();
+}
+
+/**
+ * @brief Reads the next record of the binary log. The file is mapped on the first call.
+ * @param view Receives the record.
+ * @return True if a record was read, false at the end of the log or on error.
+ */
+bool Record::readRecord(RecordView& view) {
+    if (!reader.isOpen()) {
+        flush(); // Make records written through this Record visible
+        if (!reader.open(fileName)) {
+            return false;
+        }
+    }
+    return reader.next(view);
+}
+
+/**
+ * @brief Maps the binary log and loads its time index if not done yet.
+ * @return True if the index is ready, false otherwise.
+ */
+bool Record::prepareIndex() {
+    if (!reader.isOpen()) {
+        flush();
+        if (!reader.open(fileName)) {
+            return false;
+        }
+    }
+    if (!indexLoaded) {
+        // While this Record is writing, the writer owns the sidecar; only repair it otherwise
+        indexLoaded = index.load(reader, fileName, !writer.isOpen() && !asyncWriter.isOpen());
+    }
+    return indexLoaded;
+}
+
+/**
+ * @brief Jumps to the first record of a type at or after a time.
+ * @param type One of TelemetryRecordType.
+ * @param time Time in seconds.
+ * @param view Receives the record.
+ * @return True if such a record exists, false otherwise.
+ */
+bool Record::seekTime(uint16_t type, double time, RecordView& view) {
+    return prepareIndex() && index.seek(reader, type, time, view);
+}
+
+/**
+ * @brief Reads the records of a type in a time window.
+ * @param type One of TelemetryRecordType.
+ * @param from Start of the window in seconds (inclusive).
+ * @param to End of the window in seconds (inclusive).
+ * @param callback Called for each record in file order.
+ * @return The number of records read.
+ */
+unsigned long Record::readWindow(uint16_t type, double from, double to, const TelemetryIndex::WindowCallback& callback) {
+    return prepareIndex() ? index.readWindow(reader, type, from, to, callback) : 0;
+}
+
 /**
  * @brief Outputs all lines of the record to the stream.
  * @param os The output stream.
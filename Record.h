@@ -8,6 +8,12 @@
 #ifndef RECORD_H
 #define RECORD_H
 
+#include "TelemetryWriter.h"
+#include "AsyncLogWriter.h"
+#include "TelemetryReader.h"
+#include "TelemetryIndex.h"
+#include "LogArchiver.h"
+#include "LidarScan.h"
 #include <fstream>
 #include <string>
 
@@ -16,11 +22,49 @@ using namespace std;
 /**
  * @class Record
  * @brief Provides file handling functionalities, including read and write operations.
+ *
+ * Besides the line-based text interface, a Record can write and read a binary telemetry log
+ * (see TelemetryLog.h) for data produced at sensor rate. A file is used either as text or as a
+ * binary log, not both. With a RotationPolicy the file is closed into numbered segments as it
+ * grows or ages, and closed segments are compressed and expired in the background (see
+ * LogArchiver.h). The read methods only see the active segment.
  */
 class Record {
 private:
     string fileName; ///< Name of the file to be managed.
     fstream file;    ///< File stream object for file operations.
+    TelemetryWriter writer; ///< Binary log writer, open after openBinary().
+    AsyncLogWriter asyncWriter; ///< Background binary log writer, open after openBinary(true).
+    TelemetryReader reader; ///< Binary log reader, opened by the first readRecord().
+    TelemetryIndex index; ///< Time index of the binary log, loaded by the first seekTime() or readWindow().
+    bool indexLoaded = false; ///< True once index holds the index of the mapped log.
+    RotationPolicy rotation = RotationPolicy(); ///< Segment rotation and retention limits; all zero disables rotation.
+    LogArchiver archiver; ///< Rotates, compresses and expires segments while the file is written.
+
+    /**
+     * @brief Starts the archiver if rotation is enabled and it is not running yet.
+     * @return True if the file is rotated.
+     */
+    bool startRotation();
+
+    /**
+     * @brief Maps the binary log and loads its time index if not done yet.
+     * @return True if the index is ready, false otherwise.
+     */
+    bool prepareIndex();
+
+    /**
+     * @brief Sends a record to the open binary writer, opening a synchronous one if none is open.
+     * @param type One of TelemetryRecordType.
+     * @param timestamp Time of the record in seconds.
+     * @param head The fixed part of the payload.
+     * @param headSize Size of the fixed part.
+     * @param body The array part of the payload (may be nullptr).
+     * @param bodySize Size of the array part.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool appendRecord(uint16_t type, double timestamp, const void* head, uint32_t headSize,
+        const void* body, uint32_t bodySize);
 
 public:
     /**
@@ -41,6 +85,19 @@ public:
      */
     void setFileName(const string& name);
 
+    /**
+     * @brief Sets when the file is rotated and how long closed segments are kept. Takes effect
+     * the next time the file is opened.
+     * @param policy The limits; all zero appends to one file forever.
+     */
+    void setRotation(const RotationPolicy& policy);
+
+    /**
+     * @brief Returns the closed segments of the file that the archiver has processed, oldest first.
+     * @return The segments.
+     */
+    vector<SegmentInfo> getSegments() const;
+
     /**
      * @brief Reads a single line from the file.
      * @return The line read from the file as a string.
@@ -54,6 +111,107 @@ public:
      */
     bool writeLine(const string& str);
 
+    /**
+     * @brief Opens the file as a binary telemetry log for appending.
+     *
+     * In async mode the write methods only copy the record into a per-thread buffer and
+     * return; a background thread writes the file. Records are dropped (and counted) rather
+     * than blocking the caller when the disk falls behind.
+     *
+     * @param async True to write from a background thread.
+     * @return True if the log is opened successfully, false otherwise.
+     */
+    bool openBinary(bool async = false);
+
+    /**
+     * @brief Appends a record to the binary log.
+     * @param type One of TelemetryRecordType.
+     * @param timestamp Time of the record in seconds.
+     * @param payload The payload.
+     * @param size Payload size in bytes.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writeRecord(uint16_t type, double timestamp, const void* payload, uint32_t size);
+
+    /**
+     * @brief Appends a Lidar scan and the pose it was taken at to the binary log.
+     * @param scan The scan.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writeScan(const LidarScan& scan);
+
+    /**
+     * @brief Appends the readings of the IR sensors to the binary log.
+     * @param timestamp Time of the readings in seconds.
+     * @param ranges The readings.
+     * @param count Number of readings.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writeIRFrame(double timestamp, const double* ranges, uint32_t count);
+
+    /**
+     * @brief Appends a pose to the binary log.
+     * @param timestamp Time of the pose in seconds.
+     * @param pose The pose.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writePose(double timestamp, const Pose& pose);
+
+    /**
+     * @brief Appends a velocity command to the binary log.
+     * @param command The command.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writeCommand(const TimedCommand& command);
+
+    /**
+     * @brief Appends a set of changed map cells to the binary log.
+     * @param timestamp Time of the change in seconds.
+     * @param cells The changed cells.
+     * @param count Number of cells.
+     * @return True if the record is accepted, false otherwise.
+     */
+    bool writeMapDelta(double timestamp, const MapCellRecord* cells, uint32_t count);
+
+    /**
+     * @brief Writes the buffered binary records to the file.
+     * @return True if successful, false otherwise.
+     */
+    bool flush();
+
+    /**
+     * @brief Returns the queue depth, bytes written and dropped records of an async binary log.
+     * @return The counters.
+     */
+    LogStats getLogStats();
+
+    /**
+     * @brief Reads the next record of the binary log. The file is mapped on the first call.
+     * @param view Receives the record, which points into the mapped file until closeFile().
+     * @return True if a record was read, false at the end of the log or on error.
+     */
+    bool readRecord(RecordView& view);
+
+    /**
+     * @brief Jumps to the first record of a type at or after a time, using the sidecar time index.
+     * Following readRecord() calls continue from that record.
+     * @param type One of TelemetryRecordType.
+     * @param time Time in seconds.
+     * @param view Receives the record.
+     * @return True if such a record exists, false otherwise.
+     */
+    bool seekTime(uint16_t type, double time, RecordView& view);
+
+    /**
+     * @brief Reads the records of a type in a time window, touching only the chunks that hold them.
+     * @param type One of TelemetryRecordType.
+     * @param from Start of the window in seconds (inclusive).
+     * @param to End of the window in seconds (inclusive).
+     * @param callback Called for each record in file order.
+     * @return The number of records read.
+     */
+    unsigned long readWindow(uint16_t type, double from, double to, const TelemetryIndex::WindowCallback& callback);
+
     /**
      * @brief Overloads the output stream operator for the Record class.
      * @param os Output stream reference.
@@ -85,9 +85,75 @@ int main() {
     assert(closeSuccess1 == true);
     assert(closeSuccess2 == true);
 
+    // Test writing and reading binary telemetry records
+    Record binaryRecord;
+    binaryRecord.setFileName("test_log.tlog");
+    remove("test_log.tlog");
+    assert(binaryRecord.openBinary() == true);
+
+    LidarScan scan;
+    scan.timestamp = 1.0;
+    scan.pose = Pose(1.0, 2.0, 0.5);
+    scan.angleMin = -120.0;
+    scan.angleIncrement = 0.36;
+    scan.rangeNumber = 667;
+    for (int i = 0; i < scan.rangeNumber; i++) {
+        scan.ranges[i] = 0.01f * i;
+    }
+    TimedCommand command = { 1.5, { 0.1, 0.0, 0.2 }, 3 };
+    double irRanges[9] = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9 };
+    MapCellRecord cells[2] = { { 1, 2, 1 }, { 3, 4, 2 } };
+    assert(binaryRecord.writeScan(scan) == true);
+    assert(binaryRecord.writePose(1.1, Pose(1.1, 2.1, 0.6)) == true);
+    assert(binaryRecord.writeIRFrame(1.2, irRanges, 9) == true);
+    assert(binaryRecord.writeCommand(command) == true);
+    assert(binaryRecord.writeMapDelta(1.6, cells, 2) == true);
+
+    RecordView view;
+    LidarScan readScan;
+    assert(binaryRecord.readRecord(view) && view.toLidarScan(readScan));
+    assert(readScan.rangeNumber == 667 && readScan.ranges[100] == scan.ranges[100]);
+    assert(readScan.pose.getY() == 2.0);
+    assert(binaryRecord.readRecord(view) && view.type == RECORD_POSE && view.as<PoseRecord>()->x == 1.1);
+    assert(binaryRecord.readRecord(view) && view.type == RECORD_IR_FRAME);
+    const double* readRanges = view.array<IRFrameRecord, double>(9);
+    assert(readRanges[8] == 0.9);
+    assert(binaryRecord.readRecord(view) && view.as<CommandRecord>()->source == 3);
+    assert(binaryRecord.readRecord(view) && view.type == RECORD_MAP_DELTA);
+    const MapCellRecord* readCells = view.array<MapDeltaRecord, MapCellRecord>(2);
+    assert(readCells[1].value == 2);
+    assert(binaryRecord.readRecord(view) == false);
+    assert(binaryRecord.closeFile() == true);
+
+    // Test the asynchronous binary mode
+    remove("test_log.tlog");
+    assert(binaryRecord.openBinary(true) == true);
+    for (int i = 0; i < 100; i++) {
+        assert(binaryRecord.writePose(i * 0.1, Pose(i, 0.0, 0.0)) == true);
+    }
+    assert(binaryRecord.flush() == true);
+    LogStats stats = binaryRecord.getLogStats();
+    assert(stats.recordsWritten == 100 && stats.droppedRecords == 0 && stats.queueDepth == 0);
+    int poses = 0;
+    while (binaryRecord.readRecord(view)) {
+        assert(view.type == RECORD_POSE && view.as<PoseRecord>()->x == poses);
+        poses++;
+    }
+    assert(poses == 100);
+
+    // Test seeking by time
+    assert(binaryRecord.seekTime(RECORD_POSE, 4.25, view) && view.as<PoseRecord>()->x == 43);
+    assert(binaryRecord.readRecord(view) && view.as<PoseRecord>()->x == 44);
+    unsigned long inWindow = binaryRecord.readWindow(RECORD_POSE, 2.0, 2.95, [](const RecordView&) {});
+    assert(inWindow == 10);
+    assert(binaryRecord.seekTime(RECORD_LIDAR_SCAN, 0.0, view) == false);
+    assert(binaryRecord.closeFile() == true);
+
     // Clean up test files
     remove(testFileName.c_str());
     remove("another_test_file.txt");
+    remove("test_log.tlog");
+    remove("test_log.tlog.idx");
 
     cout << "All test cases passed!" << endl;
     return 0;
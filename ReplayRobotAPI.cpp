@@ -0,0 +1,91 @@
+/**
+ * @file ReplayRobotAPI.cpp
+ * @brief Implementation of FestoRobotAPI that plays back a recorded session from ReplaySession.
+ * @date October 2026
+ *
+ * Link this file instead of FestoRobotAPILib to run the robot code against a recorded log,
+ * e.g. for offline tests and benchmarks on Linux. It is excluded from the Windows project
+ * build, which links the real library. Open the log with ReplaySession::instance().open()
+ * before the sensors are first updated.
+ */
+
+#include "FestoRobotAPI.h"
+#include "ReplaySession.h"
+
+/**
+ * @brief Constructor. All state lives in ReplaySession.
+ */
+FestoRobotAPI::FestoRobotAPI() {}
+
+/**
+ * @brief Does nothing; there is no robot to connect to.
+ */
+void FestoRobotAPI::connect() {}
+
+/**
+ * @brief Does nothing; there is no robot to disconnect from.
+ */
+void FestoRobotAPI::disconnect() {}
+
+/**
+ * @brief Captures a move command.
+ * @param direction FORWARD, BACKWARD, LEFT or RIGHT.
+ */
+void FestoRobotAPI::move(DIRECTION direction) {
+    switch (direction) {
+    case FORWARD:  ReplaySession::instance().capture(ACTION_FORWARD); break;
+    case BACKWARD: ReplaySession::instance().capture(ACTION_BACKWARD); break;
+    case LEFT:     ReplaySession::instance().capture(ACTION_LEFT); break;
+    default:       ReplaySession::instance().capture(ACTION_RIGHT); break;
+    }
+}
+
+/**
+ * @brief Captures a rotate command.
+ * @param direction LEFT or RIGHT.
+ */
+void FestoRobotAPI::rotate(DIRECTION direction) {
+    ReplaySession::instance().capture(direction == LEFT ? ACTION_ROTATE_LEFT : ACTION_ROTATE_RIGHT);
+}
+
+/**
+ * @brief Captures a stop command.
+ */
+void FestoRobotAPI::stop() {
+    ReplaySession::instance().capture(ACTION_STOP);
+}
+
+/**
+ * @brief Returns the recorded IR reading of a sensor.
+ * @param i Sensor index (0-8).
+ * @return The range in meters.
+ */
+double FestoRobotAPI::getIRRange(int i) {
+    return ReplaySession::instance().getIRRange(i);
+}
+
+/**
+ * @brief Returns the recorded pose.
+ * @param X Receives the x position.
+ * @param Y Receives the y position.
+ * @param TH Receives the heading in radians.
+ */
+void FestoRobotAPI::getXYTh(double& X, double& Y, double& TH) {
+    ReplaySession::instance().getPose(X, Y, TH);
+}
+
+/**
+ * @brief Copies the recorded scan announced by getLidarRangeNumber().
+ * @param ranges Receives the ranges.
+ */
+void FestoRobotAPI::getLidarRange(float* ranges) {
+    ReplaySession::instance().getLidarRange(ranges);
+}
+
+/**
+ * @brief Returns the number of ranges of the next recorded scan.
+ * @return The range count, or 0 at the end of the log.
+ */
+int FestoRobotAPI::getLidarRangeNumber() {
+    return ReplaySession::instance().getLidarRangeNumber();
+}
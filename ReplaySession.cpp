@@ -0,0 +1,395 @@
+/**
+ * @file ReplaySession.cpp
+ * @brief Implementation of the ReplaySession class.
+ * @date October 2026
+ */
+
+#include "ReplaySession.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+/**
+ * @brief Constructor for the ReplaySession class.
+ */
+ReplaySession::ReplaySession()
+    : hasPending(false), mode(REPLAY_AS_FAST_AS_POSSIBLE), speed(1.0), startTime(0.0), clock(0.0),
+    nominalLinearSpeed(0.2), nominalAngularSpeed(0.5), pose(0.0, 0.0, 0.0), scanHeld(false),
+    irRanges{ 0.0 }, scansDelivered(0) {}
+
+/**
+ * @brief Returns the session used by all FestoRobotAPI objects.
+ * @return The session.
+ */
+ReplaySession& ReplaySession::instance() {
+    static ReplaySession session;
+    return session;
+}
+
+/**
+ * @brief Opens a log and starts the replay at its first record.
+ * @param logName Name of the binary telemetry log.
+ * @param replayMode How the clock advances.
+ * @param scale Recorded seconds per wall-clock second in REPLAY_SCALED mode.
+ * @return True on success.
+ */
+bool ReplaySession::open(const string& logName, ReplayMode replayMode, double scale) {
+    lock_guard<mutex> lock(stateMutex);
+    if (!reader.open(logName)) {
+        return false;
+    }
+    if (replayMode == REPLAY_SCALED && !(scale > 0.0)) {
+        cerr << "Error: Replay speed must be positive; using real time." << endl;
+        scale = 1.0;
+    }
+    mode = replayMode;
+    speed = replayMode == REPLAY_SCALED ? scale : 1.0;
+    pose = Pose(0.0, 0.0, 0.0);
+    scan.clear();
+    scanHeld = false;
+    for (int i = 0; i < 9; i++) {
+        irRanges[i] = 0.0;
+    }
+    scansDelivered = 0;
+    recordedCommands.clear();
+    capturedCommands.clear();
+
+    hasPending = reader.next(pending);
+    startTime = hasPending ? pending.timestamp : 0.0;
+    clock = startTime;
+    applyUntil(startTime);
+    wallStart = chrono::steady_clock::now();
+    return true;
+}
+
+/**
+ * @brief Closes the log. The captured commands are kept until the next open().
+ */
+void ReplaySession::close() {
+    lock_guard<mutex> lock(stateMutex);
+    reader.close();
+    hasPending = false;
+    scanHeld = false;
+}
+
+/**
+ * @brief Checks whether a log is open.
+ * @return True if open.
+ */
+bool ReplaySession::isOpen() const {
+    return reader.isOpen();
+}
+
+/**
+ * @brief Checks whether every record has been played.
+ * @return True at the end of the log.
+ */
+bool ReplaySession::isFinished() {
+    lock_guard<mutex> lock(stateMutex);
+    syncClock();
+    return !hasPending;
+}
+
+/**
+ * @brief Plays the log up to a time, in any mode.
+ * @param time Session time in seconds.
+ */
+void ReplaySession::advanceTo(double time) {
+    lock_guard<mutex> lock(stateMutex);
+    applyUntil(time);
+}
+
+/**
+ * @brief Returns the replay clock.
+ * @return Session time in seconds.
+ */
+double ReplaySession::getTime() {
+    lock_guard<mutex> lock(stateMutex);
+    syncClock();
+    return clock;
+}
+
+/**
+ * @brief Sets the speeds a move() and a rotate() stand for.
+ * @param linear Linear speed in m/s.
+ * @param angular Angular speed in rad/s.
+ */
+void ReplaySession::setNominalSpeeds(double linear, double angular) {
+    lock_guard<mutex> lock(stateMutex);
+    nominalLinearSpeed = linear;
+    nominalAngularSpeed = angular;
+}
+
+/**
+ * @brief Returns the latest recorded pose.
+ * @param x Receives x.
+ * @param y Receives y.
+ * @param th Receives the heading in radians.
+ */
+void ReplaySession::getPose(double& x, double& y, double& th) {
+    lock_guard<mutex> lock(stateMutex);
+    syncClock();
+    pose.getPose(x, y, th);
+}
+
+/**
+ * @brief Returns the latest recorded IR reading.
+ * @param index Sensor index (0-8).
+ * @return The range in meters, or 0 for an invalid index.
+ */
+double ReplaySession::getIRRange(int index) {
+    lock_guard<mutex> lock(stateMutex);
+    syncClock();
+    return (index >= 0 && index < 9) ? irRanges[index] : 0.0;
+}
+
+/**
+ * @brief Announces the scan the next getLidarRange() returns.
+ * @return The number of ranges, or 0 if there is no scan.
+ */
+int ReplaySession::getLidarRangeNumber() {
+    lock_guard<mutex> lock(stateMutex);
+    return holdScan() ? static_cast<int>(heldScan.size()) : 0;
+}
+
+/**
+ * @brief Copies a recorded scan.
+ * @param ranges Receives the ranges; must hold getLidarRangeNumber() values.
+ */
+void ReplaySession::getLidarRange(float* ranges) {
+    lock_guard<mutex> lock(stateMutex);
+    if (!holdScan()) {
+        return;
+    }
+    for (size_t i = 0; i < heldScan.size(); i++) {
+        ranges[i] = heldScan[i];
+    }
+    scanHeld = false;
+    scansDelivered++;
+}
+
+/**
+ * @brief Records a command issued through FestoRobotAPI.
+ * @param action The command.
+ */
+void ReplaySession::capture(ReplayAction action) {
+    lock_guard<mutex> lock(stateMutex);
+    syncClock();
+    ReplayCommand command = { clock, action };
+    capturedCommands.push_back(command);
+}
+
+/**
+ * @brief Returns the commands issued during the replay.
+ * @return The commands with the replay clock at the time of the call.
+ */
+vector<ReplayCommand> ReplaySession::getCapturedCommands() {
+    lock_guard<mutex> lock(stateMutex);
+    return capturedCommands;
+}
+
+/**
+ * @brief Returns the commands of the original run played so far.
+ * @return The recorded commands.
+ */
+vector<ReplayCommand> ReplaySession::getRecordedCommands() {
+    lock_guard<mutex> lock(stateMutex);
+    return recordedCommands;
+}
+
+/**
+ * @brief Returns the command of a run in force at a time.
+ * @param commands The commands of the run, in time order.
+ * @param time Session time in seconds.
+ * @return The latest command at or before the time; ACTION_STOP before the first one.
+ */
+static ReplayAction commandInForce(const vector<ReplayCommand>& commands, double time) {
+    vector<ReplayCommand>::const_iterator after = upper_bound(commands.begin(), commands.end(), time,
+        [](double t, const ReplayCommand& command) { return t < command.timestamp; });
+    return after == commands.begin() ? ACTION_STOP : (after - 1)->action;
+}
+
+/**
+ * @brief Compares the captured and the recorded commands, each against the other run's command in force.
+ *
+ * A command the replay issues that the original run did not have counts against matching;
+ * a command of the original run the replay never issued counts as diverging.
+ *
+ * @param tolerance Delay in seconds by which one run may lag the other.
+ * @return The comparison.
+ */
+ReplayComparison ReplaySession::compare(double tolerance) {
+    lock_guard<mutex> lock(stateMutex);
+    ReplayComparison result = { capturedCommands.size(), recordedCommands.size(), 0, 0, -1.0 };
+    for (size_t i = 0; i < capturedCommands.size(); i++) {
+        const ReplayCommand& captured = capturedCommands[i];
+        if (captured.action == commandInForce(recordedCommands, captured.timestamp + tolerance)) {
+            result.matching++;
+        }
+        else if (result.firstMismatch < 0.0 || captured.timestamp < result.firstMismatch) {
+            result.firstMismatch = captured.timestamp;
+        }
+    }
+    for (size_t i = 0; i < recordedCommands.size(); i++) {
+        const ReplayCommand& recorded = recordedCommands[i];
+        if (recorded.action != commandInForce(capturedCommands, recorded.timestamp + tolerance)) {
+            result.diverging++;
+            if (result.firstMismatch < 0.0 || recorded.timestamp < result.firstMismatch) {
+                result.firstMismatch = recorded.timestamp;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the number of scans delivered since open().
+ * @return The scan count.
+ */
+unsigned long ReplaySession::getScansDelivered() {
+    lock_guard<mutex> lock(stateMutex);
+    return scansDelivered;
+}
+
+/**
+ * @brief Applies the pending record and reads the next one.
+ * @return The type of the applied record.
+ */
+uint16_t ReplaySession::applyPending() {
+    uint16_t type = pending.type;
+    if (type == RECORD_LIDAR_SCAN) {
+        const LidarScanRecord* fixed = pending.as<LidarScanRecord>();
+        const float* ranges = fixed ? pending.array<LidarScanRecord, float>(fixed->count) : nullptr;
+        if (ranges) {
+            scan.assign(ranges, ranges + fixed->count);
+            pose = Pose(fixed->x, fixed->y, fixed->th);
+        }
+    }
+    else if (type == RECORD_IR_FRAME) {
+        const IRFrameRecord* fixed = pending.as<IRFrameRecord>();
+        const double* ranges = fixed ? pending.array<IRFrameRecord, double>(fixed->count) : nullptr;
+        for (uint32_t i = 0; ranges && i < fixed->count && i < 9; i++) {
+            irRanges[i] = ranges[i];
+        }
+    }
+    else if (type == RECORD_POSE) {
+        const PoseRecord* recorded = pending.as<PoseRecord>();
+        if (recorded) {
+            pose = Pose(recorded->x, recorded->y, recorded->th);
+        }
+    }
+    else if (type == RECORD_COMMAND) {
+        const CommandRecord* recorded = pending.as<CommandRecord>();
+        if (recorded) {
+            VelocityCommand velocity = { recorded->vx, recorded->vy, recorded->omega };
+            ReplayCommand command = { pending.timestamp, classify(velocity) };
+            recordedCommands.push_back(command);
+        }
+    }
+    hasPending = reader.next(pending);
+    return type;
+}
+
+/**
+ * @brief Applies every record up to a time.
+ * @param time Session time in seconds.
+ */
+void ReplaySession::applyUntil(double time) {
+    while (hasPending && pending.timestamp <= time) {
+        applyPending();
+    }
+    if (time > clock) {
+        clock = time;
+    }
+}
+
+/**
+ * @brief Moves the clock to wall-clock time in the timed modes. Does nothing otherwise.
+ */
+void ReplaySession::syncClock() {
+    if (mode == REPLAY_AS_FAST_AS_POSSIBLE || !reader.isOpen()) {
+        return;
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - wallStart).count();
+    applyUntil(startTime + elapsed * speed);
+}
+
+/**
+ * @brief Applies records up to and including the next scan and moves the clock to it.
+ * @return False if the log has no more scans.
+ */
+bool ReplaySession::stepToNextScan() {
+    while (hasPending) {
+        double timestamp = pending.timestamp;
+        uint16_t type = applyPending();
+        if (timestamp > clock) {
+            clock = timestamp;
+        }
+        if (type == RECORD_LIDAR_SCAN) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Sets aside the scan the next getLidarRange() returns, unless one is already set aside.
+ *
+ * Stepping happens here rather than in getLidarRange() because LidarSensor asks for the
+ * range count first and sizes its buffer from it; both calls must see the same scan.
+ *
+ * @return False if there is no scan to return.
+ */
+bool ReplaySession::holdScan() {
+    if (scanHeld) {
+        return true;
+    }
+    if (mode == REPLAY_AS_FAST_AS_POSSIBLE) {
+        // The first scan may already have been applied by open() if it is the first record
+        bool fresh = scansDelivered == 0 && !scan.empty();
+        if (!fresh && !stepToNextScan()) {
+            return false;
+        }
+    }
+    else {
+        syncClock();
+    }
+    if (scan.empty()) {
+        return false;
+    }
+    heldScan = scan;
+    scanHeld = true;
+    if (mode == REPLAY_AS_FAST_AS_POSSIBLE) {
+        applyUntil(clock); // Records stamped with the scan's time (IR, pose) belong to the same step
+    }
+    return true;
+}
+
+/**
+ * @brief Converts a recorded velocity command to the FestoRobotAPI command it stands for.
+ * @param command The velocity command.
+ * @return The dominant motion, weighted by the nominal speeds.
+ */
+ReplayAction ReplaySession::classify(const VelocityCommand& command) const {
+    double duty[3];
+    duty[0] = nominalLinearSpeed > 0.0 ? fabs(command.vx) / nominalLinearSpeed : 0.0;
+    duty[1] = nominalLinearSpeed > 0.0 ? fabs(command.vy) / nominalLinearSpeed : 0.0;
+    duty[2] = nominalAngularSpeed > 0.0 ? fabs(command.omega) / nominalAngularSpeed : 0.0;
+    int best = 0;
+    for (int i = 1; i < 3; i++) {
+        if (duty[i] > duty[best]) {
+            best = i;
+        }
+    }
+    if (duty[best] == 0.0) {
+        return ACTION_STOP;
+    }
+    if (best == 0) {
+        return command.vx > 0.0 ? ACTION_FORWARD : ACTION_BACKWARD;
+    }
+    if (best == 1) {
+        return command.vy > 0.0 ? ACTION_LEFT : ACTION_RIGHT;
+    }
+    return command.omega > 0.0 ? ACTION_ROTATE_LEFT : ACTION_ROTATE_RIGHT;
+}
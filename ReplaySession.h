@@ -0,0 +1,253 @@
+/**
+ * @file ReplaySession.h
+ * @brief Declaration of the ReplaySession class, which plays a recorded telemetry log back
+ *        through the FestoRobotAPI calls (see ReplayRobotAPI.cpp).
+ * @date October 2026
+ */
+
+#ifndef REPLAYSESSION_H
+#define REPLAYSESSION_H
+
+#include "TelemetryReader.h"
+#include "CommandStreamer.h"
+#include "Pose.h"
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief How the replay clock advances.
+ */
+enum ReplayMode {
+    REPLAY_REAL_TIME,           /**< Recorded time passes at wall-clock speed. */
+    REPLAY_SCALED,              /**< Recorded time passes at a multiple of wall-clock speed. */
+    REPLAY_AS_FAST_AS_POSSIBLE  /**< Every getLidarRange() call steps to the next recorded scan. */
+};
+
+/**
+ * @brief Robot commands as seen through FestoRobotAPI.
+ */
+enum ReplayAction {
+    ACTION_STOP,          /**< stop(), or a zero velocity command. */
+    ACTION_FORWARD,       /**< move(FORWARD). */
+    ACTION_BACKWARD,      /**< move(BACKWARD). */
+    ACTION_LEFT,          /**< move(LEFT). */
+    ACTION_RIGHT,         /**< move(RIGHT). */
+    ACTION_ROTATE_LEFT,   /**< rotate(LEFT). */
+    ACTION_ROTATE_RIGHT   /**< rotate(RIGHT). */
+};
+
+/**
+ * @struct ReplayCommand
+ * @brief A robot command with the recorded time it applies at.
+ */
+struct ReplayCommand {
+    double timestamp;     /**< Session time in seconds. */
+    ReplayAction action;  /**< The command. */
+};
+
+/**
+ * @struct ReplayComparison
+ * @brief Agreement between the commands of a replay and those of the original run.
+ */
+struct ReplayComparison {
+    unsigned long captured;    /**< Commands issued during the replay. */
+    unsigned long recorded;    /**< Commands recorded in the original run up to the replay clock. */
+    unsigned long matching;    /**< Captured commands equal to the recorded command in force at their time. */
+    unsigned long diverging;   /**< Recorded commands that differ from the replay's command in force at their time. */
+    double firstMismatch;      /**< Earliest time at which the two runs disagree, or -1. */
+};
+
+/**
+ * @class ReplaySession
+ * @brief Plays a binary telemetry log back as if it came from the robot.
+ *
+ * The session is a process-wide singleton because FestoRobotAPI has no way to be told where
+ * its data comes from: linking ReplayRobotAPI.cpp instead of FestoRobotAPILib makes every
+ * FestoRobotAPI object read from this session, so Mapper, SafeNavigation and the sensors run
+ * unchanged. Sensor calls return the latest recorded values at the replay clock. Command
+ * calls do not move anything; they are captured so a run can be compared with the recorded
+ * one. In REPLAY_AS_FAST_AS_POSSIBLE mode the clock only moves when a scan is read (or on
+ * advanceTo()), so a replay gives the same results every time regardless of machine speed.
+ */
+class ReplaySession {
+private:
+    std::mutex stateMutex;        /**< Guards everything below; API calls may come from several threads. */
+    TelemetryReader reader;       /**< The log. */
+    RecordView pending;           /**< Next record of the log, not yet applied. */
+    bool hasPending;              /**< False once the log is exhausted. */
+    ReplayMode mode;              /**< How the clock advances. */
+    double speed;                 /**< Recorded seconds per wall-clock second. */
+    double startTime;             /**< Timestamp of the first record. */
+    double clock;                 /**< Current session time. */
+    std::chrono::steady_clock::time_point wallStart; /**< Wall-clock time of open(). */
+    double nominalLinearSpeed;    /**< Speed of a move() in m/s, for classifying recorded commands. */
+    double nominalAngularSpeed;   /**< Speed of a rotate() in rad/s, for classifying recorded commands. */
+
+    Pose pose;                    /**< Latest recorded pose (th in radians). */
+    std::vector<float> scan;      /**< Latest recorded scan. */
+    std::vector<float> heldScan;  /**< Scan announced by getLidarRangeNumber() and not yet read. */
+    bool scanHeld;                /**< True between getLidarRangeNumber() and getLidarRange(). */
+    double irRanges[9];           /**< Latest recorded IR readings. */
+    unsigned long scansDelivered; /**< Scans returned by getLidarRange(). */
+    std::vector<ReplayCommand> recordedCommands; /**< Commands of the original run, applied so far. */
+    std::vector<ReplayCommand> capturedCommands; /**< Commands issued during the replay. */
+
+    /**
+     * @brief Constructor for the ReplaySession class.
+     */
+    ReplaySession();
+
+    /**
+     * @brief Applies the pending record and reads the next one.
+     * @return The type of the applied record.
+     */
+    uint16_t applyPending();
+
+    /**
+     * @brief Applies every record up to a time.
+     * @param time Session time in seconds.
+     */
+    void applyUntil(double time);
+
+    /**
+     * @brief Moves the clock to wall-clock time in the timed modes. Does nothing otherwise.
+     */
+    void syncClock();
+
+    /**
+     * @brief Applies records up to and including the next scan and moves the clock to it.
+     * @return False if the log has no more scans.
+     */
+    bool stepToNextScan();
+
+    /**
+     * @brief Sets aside the scan the next getLidarRange() returns, unless one is already set aside.
+     * @return False if there is no scan to return.
+     */
+    bool holdScan();
+
+    /**
+     * @brief Converts a recorded velocity command to the FestoRobotAPI command it stands for.
+     * @param command The velocity command.
+     * @return The dominant motion, weighted by the nominal speeds.
+     */
+    ReplayAction classify(const VelocityCommand& command) const;
+
+public:
+    ReplaySession(const ReplaySession&) = delete;
+    ReplaySession& operator=(const ReplaySession&) = delete;
+
+    /**
+     * @brief Returns the session used by all FestoRobotAPI objects.
+     * @return The session.
+     */
+    static ReplaySession& instance();
+
+    /**
+     * @brief Opens a log and starts the replay at its first record.
+     * @param logName Name of the binary telemetry log.
+     * @param replayMode How the clock advances.
+     * @param scale Recorded seconds per wall-clock second in REPLAY_SCALED mode.
+     * @return True on success.
+     */
+    bool open(const std::string& logName, ReplayMode replayMode = REPLAY_AS_FAST_AS_POSSIBLE, double scale = 1.0);
+
+    /**
+     * @brief Closes the log. The captured commands are kept until the next open().
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a log is open.
+     * @return True if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Checks whether every record has been played.
+     * @return True at the end of the log.
+     */
+    bool isFinished();
+
+    /**
+     * @brief Plays the log up to a time, in any mode.
+     * @param time Session time in seconds.
+     */
+    void advanceTo(double time);
+
+    /**
+     * @brief Returns the replay clock.
+     * @return Session time in seconds.
+     */
+    double getTime();
+
+    /**
+     * @brief Sets the speeds a move() and a rotate() stand for, used to compare against recorded velocities.
+     * @param linear Linear speed in m/s.
+     * @param angular Angular speed in rad/s.
+     */
+    void setNominalSpeeds(double linear, double angular);
+
+    /**
+     * @brief Returns the latest recorded pose (FestoRobotAPI::getXYTh()).
+     * @param x Receives x.
+     * @param y Receives y.
+     * @param th Receives the heading in radians.
+     */
+    void getPose(double& x, double& y, double& th);
+
+    /**
+     * @brief Returns the latest recorded IR reading (FestoRobotAPI::getIRRange()).
+     * @param index Sensor index (0-8).
+     * @return The range in meters, or 0 for an invalid index.
+     */
+    double getIRRange(int index);
+
+    /**
+     * @brief Announces the scan the next getLidarRange() returns (FestoRobotAPI::getLidarRangeNumber()).
+     * @return The number of ranges, or 0 if there is no scan.
+     */
+    int getLidarRangeNumber();
+
+    /**
+     * @brief Copies a recorded scan (FestoRobotAPI::getLidarRange()).
+     * @param ranges Receives the ranges; must hold getLidarRangeNumber() values.
+     */
+    void getLidarRange(float* ranges);
+
+    /**
+     * @brief Records a command issued through FestoRobotAPI.
+     * @param action The command.
+     */
+    void capture(ReplayAction action);
+
+    /**
+     * @brief Returns the commands issued during the replay.
+     * @return The commands with the replay clock at the time of the call.
+     */
+    std::vector<ReplayCommand> getCapturedCommands();
+
+    /**
+     * @brief Returns the commands of the original run played so far.
+     * @return The recorded commands.
+     */
+    std::vector<ReplayCommand> getRecordedCommands();
+
+    /**
+     * @brief Compares the captured and the recorded commands, each against the other run's command in force.
+     * @param tolerance Delay in seconds by which one run may lag the other.
+     * @return The comparison.
+     */
+    ReplayComparison compare(double tolerance = 0.0);
+
+    /**
+     * @brief Returns the number of scans delivered since open().
+     * @return The scan count.
+     */
+    unsigned long getScansDelivered();
+};
+
+#endif // REPLAYSESSION_H
@@ -0,0 +1,212 @@
+/**
+ * @file ReplaySessionTest.cpp
+ * @brief Test application for the ReplaySession class and the replay FestoRobotAPI backend.
+ * @details Records a session with an obstacle, replays it through LidarSensor, RobotControler
+ * and Mapper as fast as possible, checks that the replay is deterministic and that its commands
+ * match the recorded ones, and checks the timing of the scaled and real-time modes. Link with
+ * ReplayRobotAPI.cpp instead of FestoRobotAPILib.
+ * @date October, 2026
+ */
+
+#include "ReplaySession.h"
+#include "FestoRobotAPI.h"
+#include "RobotControler.h"
+#include "LidarSensor.h"
+#include "Mapper.h"
+#include "Record.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Records 20 s of driving: 10 Hz scans, poses and IR frames, with an obstacle in
+ * front from 10 s to 12 s. The robot stops while the obstacle is there.
+ * @param fileName Name of the log.
+ */
+void recordSession(const string& fileName) {
+    Record record;
+    record.setFileName(fileName);
+    assert(record.openBinary());
+    LidarScan scan;
+    scan.angleMin = -120.0;
+    scan.angleIncrement = 0.36;
+    scan.rangeNumber = 667;
+    TimedCommand forward = { 0.0, { 0.2, 0.0, 0.0 }, 0 };
+    TimedCommand halt = { 10.0, { 0.0, 0.0, 0.0 }, 0 };
+    assert(record.writeCommand(forward));
+    double x = 0.0;
+    for (int s = 0; s < 200; s++) {
+        double t = s * 0.1;
+        bool blocked = t >= 10.0 && t < 12.0;
+        if (s > 0 && !(t >= 10.0 && t < 12.1)) {
+            x += 0.02;
+        }
+        scan.timestamp = t;
+        scan.pose = Pose(x, 0.0, 0.0);
+        for (int i = 0; i < scan.rangeNumber; i++) {
+            scan.ranges[i] = static_cast<float>(1.0 + 0.5 * ((s + i) % 7));
+        }
+        assert(record.writeScan(scan));
+        double ir[9] = { 1.0, 1.0, 1.0, 1.0, blocked ? 0.3 : 1.0, 1.0, 1.0, 1.0, 1.0 };
+        assert(record.writeIRFrame(t, ir, 9));
+        if (s == 100) {
+            assert(record.writeCommand(halt));
+        }
+        if (s == 120) {
+            forward.timestamp = t;
+            assert(record.writeCommand(forward));
+        }
+    }
+    assert(record.closeFile());
+}
+
+/**
+ * @brief Replays the open session through the robot classes: maps every scan and stops in
+ * front of obstacles like SafeNavigation does.
+ * @param threshold IR distance below which the robot stops.
+ * @param cells Receives the map cells.
+ * @return The number of scans processed.
+ */
+int runPipeline(double threshold, vector<int>& cells) {
+    FestoRobotAPI* api = new FestoRobotAPI();
+    RobotControler controller(new Pose(), api);
+    assert(controller.connectRobot());
+    LidarSensor lidar(api);
+    Mapper mapper(200, 200, 0.05, &controller, &lidar);
+    bool moving = false;
+    int scans = 0;
+    while (api->getLidarRangeNumber() > 0) {
+        mapper.updateMap();
+        scans++;
+        bool obstacle = false;
+        for (int i = 0; i < 9; i++) {
+            obstacle = obstacle || api->getIRRange(i) < threshold;
+        }
+        if (obstacle && moving) {
+            controller.stop();
+            moving = false;
+        }
+        else if (!obstacle && !moving) {
+            controller.moveForward();
+            moving = true;
+        }
+    }
+    const Map& map = mapper.getMap();
+    cells.clear();
+    for (int ix = 0; ix < map.getNumberX(); ix++) {
+        for (int iy = 0; iy < map.getNumberY(); iy++) {
+            cells.push_back(map.getGrid(ix, iy));
+        }
+    }
+    return scans;
+}
+
+/**
+ * @brief Main function for testing the replay backend.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const string fileName = "replay_test.tlog";
+    remove(fileName.c_str());
+    remove(telemetryIndexName(fileName).c_str());
+    recordSession(fileName);
+    ReplaySession& session = ReplaySession::instance();
+
+    /**
+     * @test Test 1: The sensor calls return the recorded data, one scan per getLidarRange().
+     */
+    assert(session.open(fileName));
+    FestoRobotAPI api;
+    assert(api.getLidarRangeNumber() == 667);
+    vector<float> ranges(667);
+    api.getLidarRange(&ranges[0]);
+    assert(ranges[0] == 1.0f && ranges[1] == 1.5f && session.getTime() == 0.0);
+    assert(api.getLidarRangeNumber() == 667);
+    api.getLidarRange(&ranges[0]);
+    assert(ranges[0] == 1.5f && session.getTime() == 0.1);
+    double x = 0.0;
+    double y = 0.0;
+    double th = 0.0;
+    api.getXYTh(x, y, th);
+    assert(x == 0.02 && y == 0.0);
+    session.advanceTo(10.0);
+    assert(api.getIRRange(4) == 0.3 && api.getIRRange(3) == 1.0);
+    session.close();
+
+    /**
+     * @test Test 2: The pipeline issues the recorded commands at the recorded times.
+     */
+    assert(session.open(fileName));
+    vector<int> firstMap;
+    auto start = chrono::steady_clock::now();
+    int scans = runPipeline(0.5, firstMap);
+    double replayMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    assert(scans == 200 && session.getScansDelivered() == 200 && session.isFinished());
+    vector<ReplayCommand> captured = session.getCapturedCommands();
+    assert(captured.size() == 3);
+    assert(captured[0].action == ACTION_FORWARD && captured[0].timestamp == 0.0);
+    assert(captured[1].action == ACTION_STOP && captured[1].timestamp == 10.0);
+    assert(captured[2].action == ACTION_FORWARD && captured[2].timestamp == 120 * 0.1);
+    ReplayComparison comparison = session.compare();
+    assert(comparison.recorded == 3 && comparison.matching == 3 && comparison.diverging == 0);
+    assert(comparison.firstMismatch < 0.0);
+    cout << "Replayed 20 s (" << scans << " scans) in " << replayMs << " ms" << endl;
+
+    /**
+     * @test Test 3: Replaying again gives exactly the same map.
+     */
+    assert(session.open(fileName));
+    vector<int> secondMap;
+    assert(runPipeline(0.5, secondMap) == 200);
+    assert(secondMap == firstMap);
+    int occupied = 0;
+    for (size_t i = 0; i < firstMap.size(); i++) {
+        occupied += firstMap[i] == Map::CELL_OCCUPIED ? 1 : 0;
+    }
+    assert(occupied > 0);
+
+    /**
+     * @test Test 4: A changed controller is reported where it departs from the recording.
+     */
+    assert(session.open(fileName));
+    assert(runPipeline(0.2, secondMap) == 200); // Ignores the obstacle
+    comparison = session.compare();
+    assert(comparison.captured == 1 && comparison.matching == 1 && comparison.diverging == 1);
+    assert(comparison.firstMismatch == 10.0);
+
+    /**
+     * @test Test 5: Scaled replay plays 20 s of recording in about 0.4 s at 50x.
+     */
+    assert(session.open(fileName, REPLAY_SCALED, 50.0));
+    start = chrono::steady_clock::now();
+    while (!session.isFinished()) {
+        this_thread::sleep_for(chrono::milliseconds(5));
+    }
+    double scaledMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    api.getXYTh(x, y, th);
+    assert(scaledMs > 350.0 && scaledMs < 1500.0 && x > 3.5);
+    cout << "Scaled replay at 50x took " << scaledMs << " ms" << endl;
+
+    /**
+     * @test Test 6: Real-time replay follows the wall clock.
+     */
+    assert(session.open(fileName, REPLAY_REAL_TIME));
+    this_thread::sleep_for(chrono::milliseconds(300));
+    double clock = session.getTime();
+    assert(clock >= 0.29 && clock < 1.0);
+    assert(api.getLidarRangeNumber() == 667);
+    api.getLidarRange(&ranges[0]);
+    int s = static_cast<int>(clock * 10.0 + 1e-9);
+    // The clock may pass one more scan between the two calls
+    assert(ranges[0] == static_cast<float>(1.0 + 0.5 * (s % 7)) || ranges[0] == static_cast<float>(1.0 + 0.5 * ((s + 1) % 7)));
+    session.close();
+
+    remove(fileName.c_str());
+    remove(telemetryIndexName(fileName).c_str());
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
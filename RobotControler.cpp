@@ -6,7 +6,15 @@
  */
 
 #include "RobotControler.h"
+#include "Transform2D.h"
+#include <chrono>
+#include <cmath>
 #include <iostream>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 using namespace std;
 
 /**
@@ -15,13 +23,18 @@ using namespace std;
  * @param robotAPI Pointer to the FestoRobotAPI object for controlling the robot.
  */
 RobotControler::RobotControler(Pose* position, FestoRobotAPI* robotAPI)
-    : position(position), robotAPI(robotAPI), connectionStatus(false) {}
+    : position(position), robotAPI(robotAPI), connectionStatus(false), streamer(robotAPI, &apiMutex),
+      motionActive(false), motionCancel(false), motionResult{ false, false, 0.0, 0.0 }, motionPollMs(10),
+      linearTolerance(0.02), angularTolerance(0.02), primitiveSpeed(0.2), primitiveAngularSpeed(0.5),
+      primitiveDecel(0.3), primitiveAngularDecel(1.0) {}
 
 /**
  * @brief Destructor for the RobotControler class.
- * Deletes the dynamically allocated Pose and FestoRobotAPI objects.
+ * Stops the velocity stream and deletes the dynamically allocated Pose and FestoRobotAPI objects.
  */
 RobotControler::~RobotControler() {
+    cancelMotion();
+    streamer.stop();
     delete position;
     delete robotAPI;
 }
@@ -40,6 +53,9 @@ bool RobotControler::Status() {
  */
 void RobotControler::turnLeft() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->rotate(DIRECTION::LEFT);
     }
 }
@@ -50,6 +66,9 @@ void RobotControler::turnLeft() {
  */
 void RobotControler::turnRight() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->rotate(DIRECTION::RIGHT);
     }
 }
@@ -60,6 +79,9 @@ void RobotControler::turnRight() {
  */
 void RobotControler::moveForward() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->move(DIRECTION::FORWARD);
     }
 }
@@ -70,6 +92,9 @@ void RobotControler::moveForward() {
  */
 void RobotControler::moveBackward() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->move(DIRECTION::BACKWARD);
     }
 }
@@ -80,6 +105,9 @@ void RobotControler::moveBackward() {
  */
 void RobotControler::moveLeft() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->move(DIRECTION::LEFT);
     }
 }
@@ -90,6 +118,9 @@ void RobotControler::moveLeft() {
  */
 void RobotControler::moveRight() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->move(DIRECTION::RIGHT);
     }
 }
@@ -100,22 +131,277 @@ void RobotControler::moveRight() {
  */
 void RobotControler::stop() {
     if (robotAPI && connectionStatus) {
+        cancelMotion();
+        streamer.halt();
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->stop();
     }
 }
 
+/**
+ * @brief Sets a continuous body-frame velocity.
+ * Starts the streaming thread on first use. Executes the operation only if the robot is connected.
+ * @param vx Forward velocity in m/s.
+ * @param vy Lateral velocity in m/s (positive = left).
+ * @param omega Angular velocity in rad/s (positive = counter-clockwise).
+ */
+void RobotControler::setVelocity(double vx, double vy, double omega) {
+    if (robotAPI && connectionStatus) {
+        streamer.setTarget(vx, vy, omega);
+        streamer.start();
+    }
+}
+
+/**
+ * @brief Configures the velocity command stream.
+ * @param controlPeriodMs Control period in milliseconds.
+ * @param deadmanTimeoutMs Time without a new command after which the robot stops (0 disables).
+ * @param maxLinearAccel Maximum linear acceleration in m/s^2.
+ * @param maxAngularAccel Maximum angular acceleration in rad/s^2.
+ */
+void RobotControler::configureStreaming(int controlPeriodMs, int deadmanTimeoutMs, double maxLinearAccel, double maxAngularAccel) {
+    streamer.setControlPeriod(controlPeriodMs);
+    streamer.setDeadmanTimeout(deadmanTimeoutMs);
+    streamer.setAccelerationLimits(maxLinearAccel, maxAngularAccel);
+}
+
+/**
+ * @brief Returns the velocity command stream for inspection and fine tuning.
+ * @return Reference to the CommandStreamer.
+ */
+CommandStreamer& RobotControler::getStreamer() {
+    return streamer;
+}
+
+/**
+ * @brief Starts driving a distance in any direction with closed-loop odometry feedback.
+ * @param distance Distance to travel in meters (negative drives the opposite way).
+ * @param direction Direction of travel relative to the current heading in radians.
+ * @return True if the motion was started, false if the robot is not connected.
+ */
+bool RobotControler::driveDistance(double distance, double direction) {
+    if (!(robotAPI && connectionStatus)) {
+        return false;
+    }
+    lock_guard<mutex> lock(motionMutex);
+    joinMotion();
+    motionCancel = false;
+    motionActive = true;
+    motionThread = thread(&RobotControler::runDrive, this, distance, direction);
+    return true;
+}
+
+/**
+ * @brief Starts rotating in place to an absolute heading with closed-loop odometry feedback.
+ * @param heading Absolute target heading in radians.
+ * @return True if the motion was started, false if the robot is not connected.
+ */
+bool RobotControler::rotateToHeading(double heading) {
+    if (!(robotAPI && connectionStatus)) {
+        return false;
+    }
+    lock_guard<mutex> lock(motionMutex);
+    joinMotion();
+    motionCancel = false;
+    motionActive = true;
+    motionThread = thread(&RobotControler::runRotate, this, heading);
+    return true;
+}
+
+/**
+ * @brief Cancels the running motion primitive, if any, and waits for it to stop.
+ */
+void RobotControler::cancelMotion() {
+    lock_guard<mutex> lock(motionMutex);
+    joinMotion();
+}
+
+/**
+ * @brief Cancels the running motion primitive, if any, and waits for it to stop.
+ * The caller holds motionMutex, so no other thread joins or replaces motionThread meanwhile.
+ */
+void RobotControler::joinMotion() {
+    motionCancel = true;
+    if (motionThread.joinable()) {
+        motionThread.join();
+    }
+}
+
+/**
+ * @brief Returns whether a motion primitive is running.
+ * @return True if a primitive is running, false otherwise.
+ */
+bool RobotControler::isMotionActive() const {
+    return motionActive;
+}
+
+/**
+ * @brief Waits for the running motion primitive to finish.
+ * @param timeoutMs Maximum time to wait in milliseconds; negative waits indefinitely.
+ * @return True if no primitive is running anymore, false on timeout.
+ */
+bool RobotControler::waitForMotion(int timeoutMs) {
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+    while (motionActive) {
+        if (timeoutMs >= 0 && chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        this_thread::sleep_for(chrono::milliseconds(motionPollMs));
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the result of the last finished motion primitive.
+ * @return The motion result.
+ */
+MotionResult RobotControler::getMotionResult() {
+    lock_guard<mutex> lock(resultMutex);
+    return motionResult;
+}
+
+/**
+ * @brief Sets the completion tolerances of the motion primitives.
+ * @param linear Position tolerance in meters.
+ * @param angular Heading tolerance in radians.
+ */
+void RobotControler::setMotionTolerances(double linear, double angular) {
+    linearTolerance = linear;
+    angularTolerance = angular;
+}
+
+/**
+ * @brief Sets the speed limits and approach decelerations of the motion primitives.
+ * @param linearSpeed Maximum linear speed in m/s.
+ * @param angularSpeed Maximum angular speed in rad/s.
+ * @param linearDecel Linear deceleration in m/s^2.
+ * @param angularDecel Angular deceleration in rad/s^2.
+ */
+void RobotControler::setMotionLimits(double linearSpeed, double angularSpeed, double linearDecel, double angularDecel) {
+    primitiveSpeed = linearSpeed;
+    primitiveAngularSpeed = angularSpeed;
+    primitiveDecel = linearDecel;
+    primitiveAngularDecel = angularDecel;
+}
+
+/**
+ * @brief Body of the driveDistance primitive.
+ *
+ * Polls odometry every motionPollMs, measures the progress along the requested direction in
+ * the start frame, corrects cross-track drift, and scales the speed with sqrt(2 * a * d) so the
+ * robot decelerates on approach. Gives up after a timeout derived from the distance.
+ *
+ * @param distance Distance to travel in meters.
+ * @param direction Direction of travel relative to the initial heading in radians.
+ */
+void RobotControler::runDrive(double distance, double direction) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    Pose start = getPose();
+    double worldDirection = start.getTh() + direction;
+    if (distance < 0.0) {
+        distance = -distance;
+        worldDirection += M_PI;
+    }
+    double ux = cos(worldDirection);
+    double uy = sin(worldDirection);
+    double timeout = 5.0 + 3.0 * distance / (primitiveSpeed > 0.0 ? primitiveSpeed : 0.1);
+
+    MotionResult result = { false, false, distance, 0.0 };
+    while (true) {
+        Pose current = getPose();
+        double dx = current.getX() - start.getX();
+        double dy = current.getY() - start.getY();
+        double remaining = distance - (dx * ux + dy * uy);
+        double crossTrack = -dx * uy + dy * ux;
+        result.error = sqrt(remaining * remaining + crossTrack * crossTrack);
+        result.elapsed = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+        if (fabs(remaining) < linearTolerance) {
+            result.completed = true;
+            break;
+        }
+        if (motionCancel || result.elapsed > timeout) {
+            result.canceled = true;
+            break;
+        }
+
+        double speed = sqrt(2.0 * primitiveDecel * fabs(remaining));
+        if (speed > primitiveSpeed) speed = primitiveSpeed;
+        if (remaining < 0.0) speed = -speed; // Overshot: come back
+        double wx = speed * ux + 2.0 * crossTrack * uy;
+        double wy = speed * uy - 2.0 * crossTrack * ux;
+        double c = cos(current.getTh());
+        double s = sin(current.getTh());
+        setVelocity(c * wx + s * wy, -s * wx + c * wy, 0.0);
+        this_thread::sleep_for(chrono::milliseconds(motionPollMs));
+    }
+    finishMotion(result);
+}
+
+/**
+ * @brief Body of the rotateToHeading primitive.
+ * @param heading Absolute target heading in radians.
+ */
+void RobotControler::runRotate(double heading) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    double timeout = 5.0 + 3.0 * M_PI / (primitiveAngularSpeed > 0.0 ? primitiveAngularSpeed : 0.1);
+
+    MotionResult result = { false, false, 0.0, 0.0 };
+    while (true) {
+        double error = normalizeAngle(heading - getPose().getTh());
+        result.error = fabs(error);
+        result.elapsed = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+        if (result.error < angularTolerance) {
+            result.completed = true;
+            break;
+        }
+        if (motionCancel || result.elapsed > timeout) {
+            result.canceled = true;
+            break;
+        }
+
+        double omega = sqrt(2.0 * primitiveAngularDecel * result.error);
+        if (omega > primitiveAngularSpeed) omega = primitiveAngularSpeed;
+        setVelocity(0.0, 0.0, error > 0.0 ? omega : -omega);
+        this_thread::sleep_for(chrono::milliseconds(motionPollMs));
+    }
+    finishMotion(result);
+}
+
+/**
+ * @brief Stops the robot, publishes the result of a motion primitive and marks it as finished.
+ * @param result The result to publish.
+ */
+void RobotControler::finishMotion(const MotionResult& result) {
+    streamer.halt();
+    {
+        lock_guard<mutex> lock(apiMutex);
+        if (robotAPI) {
+            robotAPI->stop();
+        }
+    }
+    {
+        lock_guard<mutex> lock(resultMutex);
+        motionResult = result;
+    }
+    motionActive = false;
+}
+
 /**
  * @brief Retrieves the current pose of the robot (x, y, and theta).
  * @return The current pose of the robot as a Pose object.
  */
 Pose RobotControler::getPose() {
     if (robotAPI) {
+        lock_guard<mutex> lock(apiMutex); // Also called from the motion thread and TrajectoryFollower
         double x = position->getX();
         double y = position->getY();
         double th = position->getTh();
         robotAPI->getXYTh(x, y, th);
         position->setPose(x, y, th);
-        return *position;
+        Pose pose = *position;
+        return pose;
     }
     return Pose();
 }
@@ -148,6 +434,7 @@ void RobotControler::print() {
  */
 bool RobotControler::connectRobot() {
     if (robotAPI) {
+        lock_guard<mutex> lock(apiMutex);
         robotAPI->connect();
         connectionStatus = true;
     }
@@ -161,6 +448,9 @@ bool RobotControler::connectRobot() {
  */
 bool RobotControler::disconnectRobot() {
     if (robotAPI) {
+        cancelMotion();
+        streamer.stop();
+        streamer.attach(nullptr);
         robotAPI->disconnect();
         connectionStatus = false;
         delete robotAPI; // Free the allocated memory
@@ -10,6 +10,21 @@
 
 #include "Pose.h"
 #include "FestoRobotAPI.h"
+#include "CommandStreamer.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+/**
+ * @struct MotionResult
+ * @brief Outcome of a closed-loop motion primitive.
+ */
+struct MotionResult {
+    bool completed;     /**< True if the target was reached within tolerance. */
+    bool canceled;      /**< True if the motion was canceled or timed out. */
+    double error;       /**< Achieved error (meters for driveDistance, radians for rotateToHeading). */
+    double elapsed;     /**< Elapsed time in seconds. */
+};
 
  /**
   * @class RobotControler
@@ -20,6 +35,46 @@ private:
     Pose* position;           /**< Pointer to the Pose object representing the robot's position. */
     FestoRobotAPI* robotAPI;  /**< Pointer to the FestoRobotAPI object for robot control. */
     bool connectionStatus;    /**< Status of the connection to the robot. */
+    std::mutex apiMutex;      /**< Serializes calls into robotAPI from the caller and the streaming thread. */
+    CommandStreamer streamer; /**< Rate-limited velocity command stream. */
+
+    std::thread motionThread;          /**< Thread running the active motion primitive. */
+    std::atomic<bool> motionActive;    /**< True while a motion primitive runs. */
+    std::atomic<bool> motionCancel;    /**< Set to request cancellation of the motion primitive. */
+    std::mutex motionMutex;            /**< Serializes starting and cancelling primitives (motionThread). */
+    std::mutex resultMutex;            /**< Protects motionResult. */
+    MotionResult motionResult;         /**< Result of the last motion primitive. */
+    int motionPollMs;                  /**< Odometry polling period of the primitives in milliseconds. */
+    double linearTolerance;            /**< Position tolerance of driveDistance in meters. */
+    double angularTolerance;           /**< Heading tolerance of rotateToHeading in radians. */
+    double primitiveSpeed;             /**< Maximum linear speed of the primitives in m/s. */
+    double primitiveAngularSpeed;      /**< Maximum angular speed of the primitives in rad/s. */
+    double primitiveDecel;             /**< Linear deceleration used on approach in m/s^2. */
+    double primitiveAngularDecel;      /**< Angular deceleration used on approach in rad/s^2. */
+
+    /**
+     * @brief Body of the driveDistance primitive.
+     * @param distance Distance to travel in meters.
+     * @param direction Direction of travel relative to the initial heading in radians.
+     */
+    void runDrive(double distance, double direction);
+
+    /**
+     * @brief Body of the rotateToHeading primitive.
+     * @param heading Absolute target heading in radians.
+     */
+    void runRotate(double heading);
+
+    /**
+     * @brief Cancels the running motion primitive, if any, and waits for it to stop. The caller holds motionMutex.
+     */
+    void joinMotion();
+
+    /**
+     * @brief Publishes the result of a motion primitive and marks it as finished.
+     * @param result The result to publish.
+     */
+    void finishMotion(const MotionResult& result);
 
 public:
     /**
@@ -76,6 +131,91 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Sets a continuous body-frame velocity.
+     * The command is non-blocking; it is streamed to the robot at the control period with
+     * latest-wins coalescing, acceleration limiting and a deadman timeout.
+     * @param vx Forward velocity in m/s.
+     * @param vy Lateral velocity in m/s (positive = left).
+     * @param omega Angular velocity in rad/s (positive = counter-clockwise).
+     */
+    void setVelocity(double vx, double vy, double omega);
+
+    /**
+     * @brief Configures the velocity command stream.
+     * @param controlPeriodMs Control period in milliseconds.
+     * @param deadmanTimeoutMs Time without a new command after which the robot stops (0 disables).
+     * @param maxLinearAccel Maximum linear acceleration in m/s^2.
+     * @param maxAngularAccel Maximum angular acceleration in rad/s^2.
+     */
+    void configureStreaming(int controlPeriodMs, int deadmanTimeoutMs, double maxLinearAccel, double maxAngularAccel);
+
+    /**
+     * @brief Returns the velocity command stream for inspection and fine tuning.
+     * @return Reference to the CommandStreamer.
+     */
+    CommandStreamer& getStreamer();
+
+    /**
+     * @brief Starts driving a distance in any direction with closed-loop odometry feedback.
+     * Returns immediately; the motion runs in the background and decelerates on approach.
+     * Any running primitive is canceled first.
+     * @param distance Distance to travel in meters (negative drives the opposite way).
+     * @param direction Direction of travel relative to the current heading in radians
+     *        (0 = forward, pi/2 = left).
+     * @return True if the motion was started, false if the robot is not connected.
+     */
+    bool driveDistance(double distance, double direction);
+
+    /**
+     * @brief Starts rotating in place to an absolute heading with closed-loop odometry feedback.
+     * Returns immediately; the motion runs in the background and decelerates on approach.
+     * Any running primitive is canceled first.
+     * @param heading Absolute target heading in radians.
+     * @return True if the motion was started, false if the robot is not connected.
+     */
+    bool rotateToHeading(double heading);
+
+    /**
+     * @brief Cancels the running motion primitive, if any, and waits for it to stop.
+     */
+    void cancelMotion();
+
+    /**
+     * @brief Returns whether a motion primitive is running.
+     * @return True if a primitive is running, false otherwise.
+     */
+    bool isMotionActive() const;
+
+    /**
+     * @brief Waits for the running motion primitive to finish.
+     * @param timeoutMs Maximum time to wait in milliseconds; negative waits indefinitely.
+     * @return True if no primitive is running anymore, false on timeout.
+     */
+    bool waitForMotion(int timeoutMs);
+
+    /**
+     * @brief Returns the result of the last finished motion primitive.
+     * @return The motion result.
+     */
+    MotionResult getMotionResult();
+
+    /**
+     * @brief Sets the completion tolerances of the motion primitives.
+     * @param linear Position tolerance in meters.
+     * @param angular Heading tolerance in radians.
+     */
+    void setMotionTolerances(double linear, double angular);
+
+    /**
+     * @brief Sets the speed limits and approach decelerations of the motion primitives.
+     * @param linearSpeed Maximum linear speed in m/s.
+     * @param angularSpeed Maximum angular speed in rad/s.
+     * @param linearDecel Linear deceleration in m/s^2.
+     * @param angularDecel Angular deceleration in rad/s^2.
+     */
+    void setMotionLimits(double linearSpeed, double angularSpeed, double linearDecel, double angularDecel);
+
     /**
      * @brief Retrieves the current position of the robot.
      * @return The current position of the robot as a Pose object.
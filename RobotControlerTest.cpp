@@ -52,6 +52,36 @@ int main() {
 
     cout << "----------------------------------------------------------------------" << endl;
 
+    // Test the closed-loop motion primitives
+    cout << "Testing driveDistance() and rotateToHeading()..." << endl;
+    control.setMotionTolerances(0.02, 0.02);
+    if (control.driveDistance(0.5, 0.0)) {
+        control.waitForMotion(-1);
+        MotionResult drive = control.getMotionResult();
+        cout << "Drive 0.5 m forward: " << (drive.completed ? "completed" : "canceled")
+            << ", error=" << drive.error << " m, time=" << drive.elapsed << " s" << endl;
+    }
+    if (control.driveDistance(0.3, 1.5708)) {
+        control.waitForMotion(-1);
+        MotionResult drive = control.getMotionResult();
+        cout << "Drive 0.3 m left: " << (drive.completed ? "completed" : "canceled")
+            << ", error=" << drive.error << " m, time=" << drive.elapsed << " s" << endl;
+    }
+    if (control.rotateToHeading(1.5708)) {
+        control.waitForMotion(-1);
+        MotionResult rotate = control.getMotionResult();
+        cout << "Rotate to 90 deg: " << (rotate.completed ? "completed" : "canceled")
+            << ", error=" << rotate.error << " rad, time=" << rotate.elapsed << " s" << endl;
+    }
+
+    // A primitive is canceled by the caller without blocking on it
+    control.driveDistance(2.0, 0.0);
+    Sleep(500);
+    control.cancelMotion();
+    cout << "Canceled drive: " << (control.getMotionResult().canceled ? "yes" : "no") << endl;
+
+    cout << "----------------------------------------------------------------------" << endl;
+
     // Test the getPose() method
     cout << "Testing getPose()..." << endl;
     Pose currentPose = control.getPose();
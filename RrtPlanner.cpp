@@ -0,0 +1,471 @@
+/**
+ * @file RrtPlanner.cpp
+ * @brief Implementation of the RrtPlanner class.
+ * @date October 2026
+ */
+
+#include "RrtPlanner.h"
+#include "Transform2D.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Clearance stored beyond the robot radius, in meters; longer segment steps are not needed.
+ */
+static const float CLEARANCE_MARGIN = 2.0f;
+
+/**
+ * @brief Constructor for the RrtPlanner class. The planner has no map until update() is called.
+ * @param radius Radius of the robot in meters.
+ * @param threadCount Workers for the collision checks, including the caller (0 = hardware concurrency, 1 = none).
+ */
+RrtPlanner::RrtPlanner(double radius, int threadCount)
+    : robotRadius(radius > 0.0 ? radius : 0.0), cellSize(0.0), width(0.0), height(0.0), freeArea(0.0),
+      stepSize(0.5), goalBias(0.05), batchSize(64), informed(true),
+      pool(threadCount != 1 ? new WorkStealingPool(threadCount) : nullptr), rng(5489u), bucketsX(0), bucketsY(0),
+      stats() {}
+
+/**
+ * @brief Takes the obstacles from a map: occupied and unknown cells are not entered.
+ * @param map The map.
+ */
+void RrtPlanner::update(const Map& map) {
+    if (!obstacles || obstacles->getNumberX() != map.getNumberX() || obstacles->getNumberY() != map.getNumberY() ||
+        obstacles->getGridSize() != map.getGridSize()) {
+        obstacles.reset(new Map(map.getNumberX(), map.getNumberY(), map.getGridSize()));
+    }
+    for (int x = 0; x < map.getNumberX(); x++) {
+        for (int y = 0; y < map.getNumberY(); y++) {
+            obstacles->setGrid(x, y, map.getGrid(x, y) == Map::CELL_FREE ? Map::CELL_FREE : Map::CELL_OCCUPIED);
+        }
+    }
+    field.compute(*obstacles, 0.0, 0.0, 0.0, static_cast<float>(robotRadius) + CLEARANCE_MARGIN);
+    cellSize = map.getGridSize();
+    width = map.getNumberX() * cellSize;
+    height = map.getNumberY() * cellSize;
+    int freeCells = 0;
+    for (int x = 0; x < field.getWidth(); x++) {
+        for (int y = 0; y < field.getHeight(); y++) {
+            freeCells += field.getCellDistance(x, y) > robotRadius ? 1 : 0;
+        }
+    }
+    freeArea = freeCells * cellSize * cellSize;
+}
+
+/**
+ * @brief Sets the growth parameters.
+ * @param step Longest edge of the tree in meters; also the largest rewiring radius.
+ * @param bias Probability of sampling the goal, 0 to 1.
+ * @param batch Samples whose collisions are checked together (at least 1).
+ * @param useInformed True to sample the informed ellipse once a path exists.
+ */
+void RrtPlanner::setParameters(double step, double bias, int batch, bool useInformed) {
+    stepSize = step > 0.0 ? step : 0.5;
+    goalBias = bias < 0.0 ? 0.0 : (bias > 1.0 ? 1.0 : bias);
+    batchSize = batch > 1 ? batch : 1;
+    informed = useInformed;
+}
+
+/**
+ * @brief Reseeds the random generator, e.g. to repeat a plan.
+ * @param seed The seed.
+ */
+void RrtPlanner::setSeed(unsigned int seed) {
+    rng.seed(seed);
+}
+
+/**
+ * @brief Tells whether the robot fits at a point.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @return True if the clearance of the point exceeds the robot radius.
+ */
+bool RrtPlanner::isFree(double x, double y) const {
+    return field.getDistance(x, y) > robotRadius;
+}
+
+/**
+ * @brief Tells whether the robot can move along a segment.
+ *
+ * The segment is walked from the first end: at each point the clearance beyond the robot radius,
+ * less a cell and a half for the quantization of the field, is a distance the robot can move
+ * without touching anything, so the next point checked is that far on, or half a cell on
+ * close to obstacles.
+ *
+ * @param x0 X of the first end in meters.
+ * @param y0 Y of the first end in meters.
+ * @param x1 X of the second end in meters.
+ * @param y1 Y of the second end in meters.
+ * @return True if every point checked along the segment is free.
+ */
+bool RrtPlanner::isSegmentFree(double x0, double y0, double x1, double y1) const {
+    const double length = hypot(x1 - x0, y1 - y0);
+    const double minimumStep = 0.5 * cellSize;
+    double t = 0.0;
+    while (true) {
+        double f = length > 0.0 ? t / length : 0.0;
+        double clearance = field.getDistance(x0 + f * (x1 - x0), y0 + f * (y1 - y0));
+        if (clearance <= robotRadius) {
+            return false;
+        }
+        if (t >= length) {
+            return true;
+        }
+        double advance = clearance - robotRadius - 1.5 * cellSize;
+        t += advance > minimumStep ? advance : minimumStep;
+        t = t < length ? t : length;
+    }
+}
+
+/**
+ * @brief Returns the hash bucket of a point.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @return Index of the bucket, bx * bucketsY + by.
+ */
+int RrtPlanner::bucketOf(double x, double y) const {
+    int bx = static_cast<int>(x / stepSize), by = static_cast<int>(y / stepSize);
+    bx = bx < 0 ? 0 : (bx >= bucketsX ? bucketsX - 1 : bx);
+    by = by < 0 ? 0 : (by >= bucketsY ? bucketsY - 1 : by);
+    return bx * bucketsY + by;
+}
+
+/**
+ * @brief Finds the node closest to a point.
+ *
+ * Rings of buckets are searched outward from the point's bucket; a node in ring k is at least
+ * (k - 1) bucket widths away, so the search stops one ring after that bound exceeds the best
+ * distance found.
+ *
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @return Index of the node.
+ */
+int RrtPlanner::findNearest(double x, double y) const {
+    const int bucket = bucketOf(x, y);
+    const int cx = bucket / bucketsY, cy = bucket % bucketsY;
+    const int rings = bucketsX > bucketsY ? bucketsX : bucketsY;
+    int best = -1;
+    double bestSquared = 0.0;
+    for (int ring = 0; ring <= rings; ring++) {
+        if (best >= 0 && (ring - 1) * stepSize > sqrt(bestSquared)) {
+            break;
+        }
+        for (int bx = cx - ring; bx <= cx + ring; bx++) {
+            if (bx < 0 || bx >= bucketsX) {
+                continue;
+            }
+            // Only the border of the ring: all rows on its first and last column, two rows elsewhere
+            bool edge = bx == cx - ring || bx == cx + ring;
+            for (int by = cy - ring; by <= cy + ring; by += edge || ring == 0 ? 1 : 2 * ring) {
+                if (by < 0 || by >= bucketsY) {
+                    continue;
+                }
+                for (int n = buckets[bx * bucketsY + by]; n >= 0; n = nodes[n].nextInBucket) {
+                    double dx = nodes[n].x - x, dy = nodes[n].y - y;
+                    double squared = dx * dx + dy * dy;
+                    if (best < 0 || squared < bestSquared) {
+                        best = n;
+                        bestSquared = squared;
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Appends the nodes within a radius of a point to nearNodes.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @param radius The radius in meters.
+ */
+void RrtPlanner::collectNear(double x, double y, double radius) {
+    const int first = bucketOf(x - radius, y - radius), last = bucketOf(x + radius, y + radius);
+    const double squaredRadius = radius * radius;
+    for (int bx = first / bucketsY; bx <= last / bucketsY; bx++) {
+        for (int by = first % bucketsY; by <= last % bucketsY; by++) {
+            for (int n = buckets[bx * bucketsY + by]; n >= 0; n = nodes[n].nextInBucket) {
+                double dx = nodes[n].x - x, dy = nodes[n].y - y;
+                if (dx * dx + dy * dy <= squaredRadius) {
+                    nearNodes.push_back(n);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Adds a node to the tree.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @param parent Parent node, or -1 for the root.
+ * @param cost Cost of the node in meters.
+ * @return Index of the node.
+ */
+int RrtPlanner::addNode(float x, float y, int parent, float cost) {
+    int index = static_cast<int>(nodes.size());
+    int bucket = bucketOf(x, y);
+    Node node = { x, y, cost, parent, -1, parent >= 0 ? nodes[parent].firstChild : -1, buckets[bucket] };
+    nodes.push_back(node);
+    buckets[bucket] = index;
+    if (parent >= 0) {
+        nodes[parent].firstChild = index;
+    }
+    return index;
+}
+
+/**
+ * @brief Moves a node under a new parent and updates the costs of its subtree.
+ * @param node The node.
+ * @param parent The new parent.
+ * @param cost The new cost of the node in meters.
+ */
+void RrtPlanner::reparent(int node, int parent, float cost) {
+    int old = nodes[node].parent;
+    if (nodes[old].firstChild == node) {
+        nodes[old].firstChild = nodes[node].nextSibling;
+    }
+    else {
+        int sibling = nodes[old].firstChild;
+        while (nodes[sibling].nextSibling != node) {
+            sibling = nodes[sibling].nextSibling;
+        }
+        nodes[sibling].nextSibling = nodes[node].nextSibling;
+    }
+    nodes[node].parent = parent;
+    nodes[node].nextSibling = nodes[parent].firstChild;
+    nodes[parent].firstChild = node;
+
+    const float delta = cost - nodes[node].cost;
+    stack.clear();
+    stack.push_back(node);
+    while (!stack.empty()) {
+        int n = stack.back();
+        stack.pop_back();
+        nodes[n].cost += delta;
+        for (int child = nodes[n].firstChild; child >= 0; child = nodes[child].nextSibling) {
+            stack.push_back(child);
+        }
+    }
+}
+
+/**
+ * @brief Draws a sample point.
+ *
+ * Without a path, or with informed sampling off, the sample is uniform over the map, or the goal
+ * with probability goalBias. With a path of length c, only points whose distances to start and
+ * goal sum to less than c can shorten it; they fill an ellipse with the start and goal as foci,
+ * which is sampled uniformly by stretching and rotating a uniform sample of the unit disc.
+ *
+ * @param start The start.
+ * @param goal The goal.
+ * @param bestCost Length of the best path so far in meters, or a negative value if none.
+ * @param x Receives the x of the sample.
+ * @param y Receives the y of the sample.
+ */
+void RrtPlanner::sample(const Pose& start, const Pose& goal, double bestCost, double& x, double& y) {
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    const double straight = hypot(goal.getX() - start.getX(), goal.getY() - start.getY());
+    if (informed && bestCost > 0.0 && bestCost > straight) {
+        double r = sqrt(unit(rng)), angle = 2.0 * SE2_PI * unit(rng);
+        double major = 0.5 * bestCost, minor = 0.5 * sqrt(bestCost * bestCost - straight * straight);
+        double ex = major * r * cos(angle), ey = minor * r * sin(angle);
+        double heading = atan2(goal.getY() - start.getY(), goal.getX() - start.getX());
+        x = 0.5 * (start.getX() + goal.getX()) + ex * cos(heading) - ey * sin(heading);
+        y = 0.5 * (start.getY() + goal.getY()) + ex * sin(heading) + ey * cos(heading);
+    }
+    else if (unit(rng) < goalBias) {
+        x = goal.getX();
+        y = goal.getY();
+    }
+    else {
+        x = unit(rng) * width;
+        y = unit(rng) * height;
+    }
+}
+
+/**
+ * @brief Grows a tree from the start until the time budget or the node limit is used up.
+ *
+ * Each batch draws batchSize free samples, steers each to at most one step from its nearest
+ * node, and collects the nodes within the RRT* radius min(gamma * sqrt(log(n) / n), step) as
+ * its neighbours. After the parallel checks each candidate joins the tree under the neighbour
+ * that gives it the lowest cost, then every neighbour it can shorten is moved under it. A new
+ * node with a free segment to the goal, at most a step away, is remembered as a way to the
+ * goal; the best path is the cheapest of those after every batch.
+ *
+ * @param start The start; its heading is ignored.
+ * @param goal The goal; its heading is ignored.
+ * @param budgetMs Time budget in milliseconds.
+ * @param maxNodes Largest tree.
+ * @param path Receives the best path found, start and goal included.
+ * @return False if the start or goal is not free or no path was found.
+ */
+bool RrtPlanner::plan(const Pose& start, const Pose& goal, double budgetMs, size_t maxNodes, vector<Pose>& path) {
+    auto begin = chrono::steady_clock::now();
+    path.clear();
+    history.clear();
+    nodes.clear();
+    goalNodes.clear();
+    stats = RrtStats();
+    stats.bestCost = -1.0;
+    stats.firstSolutionUs = -1.0;
+    if (!obstacles || !isFree(start.getX(), start.getY()) || !isFree(goal.getX(), goal.getY())) {
+        cerr << "Error: The start or goal of the RRT* plan is not free!" << endl;
+        return false;
+    }
+    bucketsX = static_cast<int>(ceil(width / stepSize));
+    bucketsY = static_cast<int>(ceil(height / stepSize));
+    buckets.assign(static_cast<size_t>(bucketsX) * bucketsY, -1);
+    nodes.reserve(maxNodes > 1 ? maxNodes : 1);
+    addNode(static_cast<float>(start.getX()), static_cast<float>(start.getY()), -1, 0.0f);
+    const float gx = static_cast<float>(goal.getX()), gy = static_cast<float>(goal.getY());
+    const double gamma = 2.0 * sqrt(1.5 * freeArea / SE2_PI); // Above the RRT* bound for the plane
+    int bestNode = -1;
+    double bestCost = -1.0;
+    if (hypot(gx - start.getX(), gy - start.getY()) <= stepSize && isSegmentFree(start.getX(), start.getY(), gx, gy)) {
+        goalNodes.push_back(0);
+    }
+
+    auto elapsedUs = [&begin]() { return chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count(); };
+    while (nodes.size() < maxNodes && elapsedUs() < budgetMs * 1000.0) {
+        // Draw and steer the batch against the tree as it is now
+        candidates.clear();
+        nearNodes.clear();
+        double n = static_cast<double>(nodes.size());
+        double radius = n > 1.0 ? gamma * sqrt(log(n) / n) : stepSize;
+        radius = radius < stepSize ? radius : stepSize;
+        for (int b = 0; b < batchSize && nodes.size() + candidates.size() < maxNodes; b++) {
+            double sx, sy;
+            sample(start, goal, bestCost, sx, sy);
+            stats.samples++;
+            int nearest = findNearest(sx, sy);
+            double dx = sx - nodes[nearest].x, dy = sy - nodes[nearest].y;
+            double distance = hypot(dx, dy);
+            if (distance < 1e-6) {
+                continue;
+            }
+            double scale = distance > stepSize ? stepSize / distance : 1.0;
+            Candidate candidate = { static_cast<float>(nodes[nearest].x + dx * scale),
+                static_cast<float>(nodes[nearest].y + dy * scale), nearNodes.size(), 0 };
+            if (!isFree(candidate.x, candidate.y)) {
+                continue;
+            }
+            collectNear(candidate.x, candidate.y, radius);
+            bool listed = false;
+            for (size_t k = candidate.nearStart; k < nearNodes.size(); k++) {
+                listed = listed || nearNodes[k] == nearest;
+            }
+            if (!listed) {
+                nearNodes.push_back(nearest);
+            }
+            candidate.nearCount = nearNodes.size() - candidate.nearStart;
+            candidates.push_back(candidate);
+        }
+
+        // Check every neighbour segment of the batch
+        nearFree.assign(nearNodes.size(), 0);
+        auto check = [this](uint32_t task, int) {
+            const Candidate& candidate = candidates[task];
+            for (size_t k = candidate.nearStart; k < candidate.nearStart + candidate.nearCount; k++) {
+                const Node& near = nodes[nearNodes[k]];
+                nearFree[k] = isSegmentFree(near.x, near.y, candidate.x, candidate.y) ? 1 : 0;
+            }
+        };
+        if (pool) {
+            pool->parallelFor(static_cast<uint32_t>(candidates.size()), check);
+        }
+        else {
+            for (uint32_t task = 0; task < candidates.size(); task++) {
+                check(task, 0);
+            }
+        }
+        stats.segmentChecks += nearNodes.size();
+
+        // Insert and rewire one candidate after the other
+        for (size_t c = 0; c < candidates.size(); c++) {
+            const Candidate& candidate = candidates[c];
+            int parent = -1;
+            float cost = 0.0f;
+            for (size_t k = candidate.nearStart; k < candidate.nearStart + candidate.nearCount; k++) {
+                const Node& near = nodes[nearNodes[k]];
+                float through = near.cost + static_cast<float>(hypot(candidate.x - near.x, candidate.y - near.y));
+                if (nearFree[k] && (parent < 0 || through < cost)) {
+                    parent = nearNodes[k];
+                    cost = through;
+                }
+            }
+            if (parent < 0) {
+                continue;
+            }
+            int added = addNode(candidate.x, candidate.y, parent, cost);
+            for (size_t k = candidate.nearStart; k < candidate.nearStart + candidate.nearCount; k++) {
+                int near = nearNodes[k];
+                float through = cost + static_cast<float>(hypot(candidate.x - nodes[near].x, candidate.y - nodes[near].y));
+                if (nearFree[k] && near != parent && through < nodes[near].cost - 1e-5f) {
+                    reparent(near, added, through);
+                    stats.rewires++;
+                }
+            }
+            if (hypot(gx - candidate.x, gy - candidate.y) <= stepSize && isSegmentFree(candidate.x, candidate.y, gx, gy)) {
+                goalNodes.push_back(added);
+                stats.segmentChecks++;
+            }
+        }
+
+        // Rewiring can shorten any of the ways to the goal
+        for (size_t k = 0; k < goalNodes.size(); k++) {
+            const Node& node = nodes[goalNodes[k]];
+            double total = node.cost + hypot(gx - node.x, gy - node.y);
+            if (bestNode < 0 || total < bestCost) {
+                bestNode = goalNodes[k];
+                bestCost = total;
+            }
+        }
+        if (bestNode >= 0 && (history.empty() || bestCost < history.back().cost - 1e-9)) {
+            RrtCostSample point = { elapsedUs(), bestCost };
+            history.push_back(point);
+            stats.firstSolutionUs = stats.firstSolutionUs < 0.0 ? point.us : stats.firstSolutionUs;
+        }
+    }
+
+    stats.nodes = nodes.size();
+    stats.bestCost = bestCost;
+    if (bestNode >= 0) {
+        for (int n = bestNode; n >= 0; n = nodes[n].parent) {
+            path.push_back(Pose(nodes[n].x, nodes[n].y, 0.0));
+        }
+        reverse(path.begin(), path.end());
+        path.push_back(Pose(goal.getX(), goal.getY(), 0.0));
+        path[0] = Pose(start.getX(), start.getY(), 0.0);
+        for (size_t i = 0; i < path.size(); i++) {
+            const Pose& from = path[i > 0 && i + 1 == path.size() ? i - 1 : i];
+            const Pose& to = path[i + 1 < path.size() ? i + 1 : i];
+            path[i].setTh(atan2(to.getY() - from.getY(), to.getX() - from.getX()));
+        }
+    }
+    stats.lastUs = elapsedUs();
+    return bestNode >= 0;
+}
+
+/**
+ * @brief Returns the cost curve of the last plan: an entry each time the best path got shorter.
+ * @return The cost curve.
+ */
+const vector<RrtCostSample>& RrtPlanner::getHistory() const {
+    return history;
+}
+
+/**
+ * @brief Returns the counters of the last plan.
+ * @return The counters.
+ */
+RrtStats RrtPlanner::getStats() const {
+    return stats;
+}
@@ -0,0 +1,236 @@
+/**
+ * @file RrtPlanner.h
+ * @brief Declaration of the RrtPlanner class, an anytime RRT* / informed RRT* planner in continuous space.
+ * @date October 2026
+ */
+
+#ifndef RRTPLANNER_H
+#define RRTPLANNER_H
+
+#include "Map.h"
+#include "DistanceField.h"
+#include "Pose.h"
+#include "WorkStealingPool.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * @struct RrtStats
+ * @brief Counters of the last plan() of an RrtPlanner.
+ */
+struct RrtStats {
+    size_t nodes;                  /**< Nodes in the tree. */
+    unsigned long samples;         /**< Samples drawn, including those rejected in obstacles. */
+    unsigned long segmentChecks;   /**< Segments checked for collisions. */
+    unsigned long rewires;         /**< Nodes given a cheaper parent through a new node. */
+    double bestCost;               /**< Length of the best path in meters, or a negative value if none was found. */
+    double firstSolutionUs;        /**< Time to the first path, in microseconds. */
+    double lastUs;                 /**< Duration of the plan, in microseconds. */
+};
+
+/**
+ * @struct RrtCostSample
+ * @brief A point of the cost curve of a plan: the best path length after a given time.
+ */
+struct RrtCostSample {
+    double us;     /**< Time since the plan started, in microseconds. */
+    double cost;   /**< Length of the best path at that time, in meters. */
+};
+
+/**
+ * @class RrtPlanner
+ * @brief Grows an RRT* tree over the free plane of a Map, for paths not bound to the grid.
+ *
+ * Collisions are checked against a DistanceField of the map in which unknown cells count as
+ * obstacles: a point is free if its clearance exceeds the robot radius, and a segment is walked
+ * in steps as long as the clearance allows, so checks are cheap away from obstacles. The nodes
+ * live in one array reused between plans, and a grid hash of buckets one step wide answers the
+ * nearest and near-neighbour queries.
+ *
+ * Samples are processed in batches: the neighbours of every sample of a batch are looked up in
+ * the tree as it was before the batch, all their segments are checked in parallel on a
+ * WorkStealingPool, and the samples are then inserted and rewired one after the other. The
+ * checks are pure functions of the map, so the tree does not depend on the thread count.
+ * Once a path is found, samples are drawn from the ellipse of the points that could still
+ * shorten it (informed RRT*), which makes the cost converge much faster.
+ */
+class RrtPlanner {
+private:
+    /**
+     * @struct Node
+     * @brief A node of the tree.
+     */
+    struct Node {
+        float x;            /**< X in meters. */
+        float y;            /**< Y in meters. */
+        float cost;         /**< Length of the tree path from the start, in meters. */
+        int parent;         /**< Parent node, or -1 for the root. */
+        int firstChild;     /**< First child, or -1. */
+        int nextSibling;    /**< Next child of the same parent, or -1. */
+        int nextInBucket;   /**< Next node of the same hash bucket, or -1. */
+    };
+
+    /**
+     * @struct Candidate
+     * @brief A steered sample of the current batch and its neighbours.
+     */
+    struct Candidate {
+        float x;            /**< X in meters. */
+        float y;            /**< Y in meters. */
+        size_t nearStart;   /**< First neighbour in nearNodes. */
+        size_t nearCount;   /**< Number of neighbours. */
+    };
+
+    std::unique_ptr<Map> obstacles;           /**< Occupied and unknown cells of the planning map, as occupied cells. */
+    DistanceField field;                      /**< Clearance of the cells of the planning map. */
+    double robotRadius;                       /**< Radius of the robot in meters. */
+    double cellSize;                          /**< Edge of a cell in meters. */
+    double width;                             /**< Width of the map in meters. */
+    double height;                            /**< Height of the map in meters. */
+    double freeArea;                          /**< Area the robot can occupy, in square meters. */
+
+    double stepSize;                          /**< Longest edge of the tree, in meters. */
+    double goalBias;                          /**< Probability of sampling the goal. */
+    int batchSize;                            /**< Samples per batch. */
+    bool informed;                            /**< True to sample the informed ellipse once a path exists. */
+    std::unique_ptr<WorkStealingPool> pool;   /**< Workers for the collision checks, or nullptr to check on the caller. */
+    std::mt19937 rng;                         /**< Random generator of the samples. */
+
+    std::vector<Node> nodes;                  /**< Node pool; its capacity is kept between plans. */
+    std::vector<int> buckets;                 /**< First node of each hash bucket, or -1. */
+    int bucketsX;                             /**< Buckets along x. */
+    int bucketsY;                             /**< Buckets along y. */
+    std::vector<Candidate> candidates;        /**< Samples of the current batch. */
+    std::vector<int> nearNodes;               /**< Neighbours of the candidates. */
+    std::vector<unsigned char> nearFree;      /**< 1 if the segment from a neighbour to its candidate is free. */
+    std::vector<int> goalNodes;               /**< Nodes with a free segment to the goal. */
+    std::vector<int> stack;                   /**< Nodes whose subtree costs are being updated. */
+    std::vector<RrtCostSample> history;       /**< Cost curve of the last plan. */
+    RrtStats stats;                           /**< Counters. */
+
+    /**
+     * @brief Returns the hash bucket of a point.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @return Index of the bucket, bx * bucketsY + by.
+     */
+    int bucketOf(double x, double y) const;
+
+    /**
+     * @brief Finds the node closest to a point.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @return Index of the node.
+     */
+    int findNearest(double x, double y) const;
+
+    /**
+     * @brief Appends the nodes within a radius of a point to nearNodes.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @param radius The radius in meters.
+     */
+    void collectNear(double x, double y, double radius);
+
+    /**
+     * @brief Adds a node to the tree.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @param parent Parent node, or -1 for the root.
+     * @param cost Cost of the node in meters.
+     * @return Index of the node.
+     */
+    int addNode(float x, float y, int parent, float cost);
+
+    /**
+     * @brief Moves a node under a new parent and updates the costs of its subtree.
+     * @param node The node.
+     * @param parent The new parent.
+     * @param cost The new cost of the node in meters.
+     */
+    void reparent(int node, int parent, float cost);
+
+    /**
+     * @brief Draws a sample point.
+     * @param goal The goal.
+     * @param start The start.
+     * @param bestCost Length of the best path so far in meters, or a negative value if none.
+     * @param x Receives the x of the sample.
+     * @param y Receives the y of the sample.
+     */
+    void sample(const Pose& start, const Pose& goal, double bestCost, double& x, double& y);
+
+public:
+    /**
+     * @brief Constructor for the RrtPlanner class. The planner has no map until update() is called.
+     * @param radius Radius of the robot in meters.
+     * @param threadCount Workers for the collision checks, including the caller (0 = hardware concurrency, 1 = none).
+     */
+    explicit RrtPlanner(double radius = 0.25, int threadCount = 1);
+
+    /**
+     * @brief Takes the obstacles from a map: occupied and unknown cells are not entered.
+     * @param map The map.
+     */
+    void update(const Map& map);
+
+    /**
+     * @brief Sets the growth parameters.
+     * @param step Longest edge of the tree in meters; also the largest rewiring radius.
+     * @param bias Probability of sampling the goal, 0 to 1.
+     * @param batch Samples whose collisions are checked together (at least 1).
+     * @param useInformed True to sample the informed ellipse once a path exists.
+     */
+    void setParameters(double step = 0.5, double bias = 0.05, int batch = 64, bool useInformed = true);
+
+    /**
+     * @brief Reseeds the random generator, e.g. to repeat a plan.
+     * @param seed The seed.
+     */
+    void setSeed(unsigned int seed);
+
+    /**
+     * @brief Grows a tree from the start until the time budget or the node limit is used up.
+     * @param start The start; its heading is ignored.
+     * @param goal The goal; its heading is ignored.
+     * @param budgetMs Time budget in milliseconds.
+     * @param maxNodes Largest tree.
+     * @param path Receives the best path found, start and goal included; each heading (radians)
+     *        points along the following segment, the last along the one before it.
+     * @return False if the start or goal is not free or no path was found.
+     */
+    bool plan(const Pose& start, const Pose& goal, double budgetMs, size_t maxNodes, std::vector<Pose>& path);
+
+    /**
+     * @brief Tells whether the robot fits at a point.
+     * @param x X in meters.
+     * @param y Y in meters.
+     * @return True if the clearance of the point exceeds the robot radius.
+     */
+    bool isFree(double x, double y) const;
+
+    /**
+     * @brief Tells whether the robot can move along a segment.
+     * @param x0 X of the first end in meters.
+     * @param y0 Y of the first end in meters.
+     * @param x1 X of the second end in meters.
+     * @param y1 Y of the second end in meters.
+     * @return True if every point checked along the segment is free.
+     */
+    bool isSegmentFree(double x0, double y0, double x1, double y1) const;
+
+    /**
+     * @brief Returns the cost curve of the last plan: an entry each time the best path got shorter.
+     * @return The cost curve.
+     */
+    const std::vector<RrtCostSample>& getHistory() const;
+
+    /**
+     * @brief Returns the counters of the last plan.
+     * @return The counters.
+     */
+    RrtStats getStats() const;
+};
+
+#endif // RRTPLANNER_H
@@ -0,0 +1,184 @@
+/**
+ * @file RrtPlannerTest.cpp
+ * @brief Test and benchmark application for the RrtPlanner class.
+ * @details Checks the collision checks against the map, that planned paths stay clear of the
+ * obstacles, that the parallel checks grow the same tree as sequential ones, and prints the cost
+ * over time of RRT* and informed RRT* in a warehouse aisle map next to the grid A* path.
+ * @date October, 2026
+ */
+
+#include "RrtPlanner.h"
+#include "GridPlanner.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Marks a rectangle of cells.
+ * @param map The map.
+ * @param x0 First column.
+ * @param y0 First row.
+ * @param x1 Last column.
+ * @param y1 Last row.
+ * @param value The cell value.
+ */
+void fill(Map& map, int x0, int y0, int x1, int y1, int value) {
+    for (int x = x0; x <= x1; x++) {
+        for (int y = y0; y <= y1; y++) {
+            map.setGrid(x, y, value);
+        }
+    }
+}
+
+/**
+ * @brief Returns the distance from a point to the nearest occupied or unknown cell centre.
+ * @param map The map.
+ * @param x X in meters.
+ * @param y Y in meters.
+ * @return The distance in meters.
+ */
+double clearance(const Map& map, double x, double y) {
+    double best = 1e9;
+    for (int cx = 0; cx < map.getNumberX(); cx++) {
+        for (int cy = 0; cy < map.getNumberY(); cy++) {
+            if (map.getGrid(cx, cy) != Map::CELL_FREE) {
+                double d = hypot((cx + 0.5) * map.getGridSize() - x, (cy + 0.5) * map.getGridSize() - y);
+                best = d < best ? d : best;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Returns the length of a path.
+ * @param path The path.
+ * @return The length in meters.
+ */
+double pathLength(const vector<Pose>& path) {
+    double length = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        length += hypot(path[i].getX() - path[i - 1].getX(), path[i].getY() - path[i - 1].getY());
+    }
+    return length;
+}
+
+/**
+ * @brief Builds a warehouse: outer walls, rows of shelves with narrow aisles and a cross aisle.
+ * @param map The map, 0.05 m cells.
+ */
+void buildWarehouse(Map& map) {
+    const int nx = map.getNumberX(), ny = map.getNumberY();
+    fill(map, 0, 0, nx - 1, ny - 1, Map::CELL_FREE);
+    fill(map, 0, 0, nx - 1, 1, Map::CELL_OCCUPIED);
+    fill(map, 0, ny - 2, nx - 1, ny - 1, Map::CELL_OCCUPIED);
+    fill(map, 0, 0, 1, ny - 1, Map::CELL_OCCUPIED);
+    fill(map, nx - 2, 0, nx - 1, ny - 1, Map::CELL_OCCUPIED);
+    for (int x = 40; x + 20 < nx - 40; x += 36) { // Shelves 1 m deep, aisles 0.8 m wide
+        fill(map, x, 40, x + 19, ny / 2 - 12, Map::CELL_OCCUPIED);
+        fill(map, x, ny / 2 + 12, x + 19, ny - 41, Map::CELL_OCCUPIED);
+    }
+}
+
+/**
+ * @brief Main function for testing the RRT* planner.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: Points and segments are free only with the robot radius clear of occupied
+     * and unknown cells.
+     */
+    Map room(100, 100, 0.05);
+    fill(room, 0, 0, 99, 99, Map::CELL_FREE);
+    fill(room, 50, 0, 51, 69, Map::CELL_OCCUPIED); // A wall with a gap above it
+    fill(room, 0, 90, 99, 99, Map::CELL_UNKNOWN);
+    RrtPlanner planner(0.2);
+    planner.update(room);
+    assert(planner.isFree(1.0, 1.0) && !planner.isFree(2.55, 1.0) && !planner.isFree(2.4, 1.0));
+    assert(planner.isFree(2.2, 1.0) && !planner.isFree(2.7, 1.0) && planner.isFree(2.85, 1.0));
+    assert(!planner.isFree(1.0, 4.4) && !planner.isFree(-0.5, 1.0));
+    assert(!planner.isSegmentFree(1.0, 1.0, 4.0, 1.0) && planner.isSegmentFree(1.0, 4.0, 4.0, 4.0));
+    assert(planner.isSegmentFree(1.0, 1.0, 1.0, 4.0) && !planner.isSegmentFree(1.0, 4.0, 1.0, 4.7));
+
+    /**
+     * @test Test 2: A path around the wall keeps the robot radius clear of it everywhere and is
+     * not much longer than the shortest way through the gap.
+     */
+    vector<Pose> path;
+    planner.setParameters(0.5, 0.05, 32, true);
+    assert(planner.plan(Pose(1.0, 1.0, 0.0), Pose(4.0, 1.0, 0.0), 200.0, 4000, path));
+    assert(fabs(path.front().getX() - 1.0) < 1e-6 && fabs(path.back().getX() - 4.0) < 1e-6);
+    for (size_t i = 1; i < path.size(); i++) {
+        for (int k = 0; k <= 20; k++) {
+            double f = k / 20.0;
+            double x = path[i - 1].getX() + f * (path[i].getX() - path[i - 1].getX());
+            double y = path[i - 1].getY() + f * (path[i].getY() - path[i - 1].getY());
+            assert(clearance(room, x, y) > 0.2 - 0.05);
+        }
+    }
+    double around = 2.0 * hypot(1.55, 3.5 + 0.2 - 1.0); // Over the corner of the wall, less than a cell off
+    assert(pathLength(path) >= around - 0.1 && pathLength(path) < around * 1.1);
+    assert(fabs(planner.getStats().bestCost - pathLength(path)) < 1e-3);
+    const vector<RrtCostSample>& curve = planner.getHistory();
+    for (size_t i = 1; i < curve.size(); i++) {
+        assert(curve[i].cost < curve[i - 1].cost && curve[i].us >= curve[i - 1].us);
+    }
+    assert(!planner.plan(Pose(1.0, 1.0, 0.0), Pose(2.5, 1.0, 0.0), 10.0, 1000, path) && path.empty());
+
+    /**
+     * @test Test 3: Checking the collisions of a batch in parallel grows the same tree as
+     * checking them one by one.
+     */
+    Map warehouse(400, 300, 0.05);
+    buildWarehouse(warehouse);
+    RrtPlanner sequential(0.25, 1);
+    int threads = static_cast<int>(thread::hardware_concurrency());
+    RrtPlanner parallel(0.25, threads > 1 ? threads : 2);
+    sequential.update(warehouse);
+    parallel.update(warehouse);
+    Pose start(1.6, 2.0, 0.0), goal(18.3, 13.0, 0.0);
+    vector<Pose> other;
+    assert(sequential.plan(start, goal, 1e6, 5000, path));
+    assert(parallel.plan(start, goal, 1e6, 5000, other));
+    assert(path.size() == other.size() && sequential.getStats().bestCost == parallel.getStats().bestCost);
+    assert(sequential.getStats().segmentChecks == parallel.getStats().segmentChecks);
+
+    /**
+     * @test Test 4: Cost over time in the warehouse for RRT* and informed RRT*, against the
+     * 8-connected grid path.
+     */
+    GridPlanner grid(0.25);
+    grid.update(warehouse);
+    assert(grid.findPath(32, 40, 366, 260, path));
+    double gridCost = pathLength(path);
+    cout << "Grid A*: " << gridCost << " m in " << grid.getStats().lastUs << " us" << endl;
+    const double budgets[4] = { 10.0, 30.0, 100.0, 300.0 };
+    double informedCost = 0.0;
+    for (int mode = 0; mode < 3; mode++) {
+        RrtPlanner& runner = mode == 2 ? parallel : sequential;
+        runner.setParameters(0.5, 0.05, 64, mode > 0);
+        runner.setSeed(7);
+        assert(runner.plan(start, goal, budgets[3], 1000000, path));
+        const vector<RrtCostSample>& history = runner.getHistory();
+        cout << (mode == 0 ? "RRT*" : (mode == 1 ? "Informed RRT*" : "Informed RRT*, parallel checks"))
+             << ": first path " << history.front().cost << " m after " << history.front().us << " us;";
+        for (int b = 0; b < 4; b++) {
+            double cost = -1.0;
+            for (size_t i = 0; i < history.size() && history[i].us <= budgets[b] * 1000.0; i++) {
+                cost = history[i].cost;
+            }
+            cout << " " << cost << " m at " << budgets[b] << " ms;";
+        }
+        RrtStats stats = runner.getStats();
+        cout << " " << stats.nodes << " nodes, " << stats.segmentChecks << " segment checks" << endl;
+        informedCost = mode == 1 ? stats.bestCost : informedCost;
+    }
+    assert(informedCost > 0.0 && informedCost < gridCost);
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -7,23 +7,40 @@
  */
 
 #include "SafeNavigation.h"
+#include "Transform2D.h"
 #include <iostream>
 
 using namespace std;
 
+/**
+ * @brief Fraction of the cruise speed the robot keeps in the SLOW state.
+ */
+static const double SLOW_FACTOR = 0.4;
+
 /**
  * @brief Constructor for SafeNavigation class.
  * @param rc Pointer to a RobotControler object for controlling the robot's movement.
  * @param ir Pointer to an IRSensor object for detecting obstacles.
  */
 SafeNavigation::SafeNavigation(RobotControler* rc, IRSensor* ir)
-    : controller(rc), irSensor(ir), state(STOP) {}
+    : controller(rc), irSensor(ir), state(STOP), predictor(nullptr), vfh(nullptr), command(), streaming(false),
+      cruiseSpeed(0.2) {}
 
 /**
  * @brief Checks if an obstacle is detected by the IR sensor.
  * @return True if an obstacle is detected within a threshold distance, otherwise false.
  */
 bool SafeNavigation::isObstacleDetected() {
+    lock_guard<mutex> lock(navigationMutex);
+    return detectObstacle();
+}
+
+/**
+ * @brief Reads the IR sensors and checks if one of them detects an obstacle.
+ * The caller holds navigationMutex.
+ * @return True if an obstacle is detected within a threshold distance, otherwise false.
+ */
+bool SafeNavigation::detectObstacle() {
     irSensor->update(); // Update IR sensor readings
     for (int i = 0; i < 9; ++i) {
         if (irSensor->getRange(i) < 0.5) { // Assuming 0.5 is the threshold for detecting an obstacle
@@ -35,34 +52,219 @@ bool SafeNavigation::isObstacleDetected() {
 }
 
 /**
- * @brief Moves the robot forward safely, checking for obstacles.
+ * @brief Starts a move along x if neither the IR sensors nor the collision predictor object.
+ * A move the predictor wants slowed down starts at the reduced speed; a blocked move steers
+ * around the obstacle if a VFH planner is set. The caller holds navigationMutex.
+ * @param direction 1 to move forward, -1 to move backward.
  */
-void SafeNavigation::moveForwardSafe() {
-    if (!isObstacleDetected()) {
-        controller->moveForward(); // Start moving forward
-        state = MOVING;
+void SafeNavigation::moveSafe(int direction) {
+    command.vx = direction * cruiseSpeed;
+    command.vy = 0.0;
+    command.omega = 0.0;
+    streaming = false;
+    CollisionPredictor::Decision decision = CollisionPredictor::CLEAR;
+    if (predictor != nullptr) {
+        decision = predictor->evaluate(controller->getPose(), command);
+    }
+    if (detectObstacle() || decision == CollisionPredictor::STOP) {
+        if (vfh != nullptr) {
+            steerAround();
+        }
+        else {
+            controller->stop(); // May be moving already when called from checkSafety()
+            state = STOP;
+        }
+    }
+    else if (decision == CollisionPredictor::SLOW) {
+        controller->setVelocity(command.vx * SLOW_FACTOR, 0.0, 0.0);
+        state = SLOW;
     }
     else {
+        if (direction > 0) {
+            controller->moveForward(); // Start moving forward
+        }
+        else {
+            controller->moveBackward(); // Start moving backward
+        }
+        state = MOVING;
+    }
+}
+
+/**
+ * @brief Drives along the free direction the VFH planner finds closest to the direction of the
+ * move command, at most at cruise speed, or stops the robot if every direction is blocked or
+ * the collision predictor objects to the detour. The caller holds navigationMutex.
+ */
+void SafeNavigation::steerAround() {
+    VelocityCommand detour;
+    double target = command.vx < 0.0 ? SE2_PI : 0.0;
+    if (vfh == nullptr || !vfh->computeCommand(target, cruiseSpeed, detour)
+        || (predictor != nullptr && predictor->evaluate(controller->getPose(), detour) == CollisionPredictor::STOP)) {
+        controller->stop();
         state = STOP;
+        return;
     }
+    controller->setVelocity(detour.vx, detour.vy, 0.0);
+    state = AVOIDING;
+}
+
+/**
+ * @brief Moves the robot forward safely, checking for obstacles.
+ */
+void SafeNavigation::moveForwardSafe() {
+    lock_guard<mutex> lock(navigationMutex);
+    moveSafe(1);
 }
 
 /**
  * @brief Moves the robot backward safely, checking for obstacles.
  */
 void SafeNavigation::moveBackwardSafe() {
-    if (!isObstacleDetected()) {
-        controller->moveBackward(); // Start moving backward
-        state = MOVING;
+    lock_guard<mutex> lock(navigationMutex);
+    moveSafe(-1);
+}
+
+/**
+ * @brief Sends a body-frame velocity if neither the IR sensors nor the collision predictor object.
+ * Meant to be called every cycle by a local planner such as DwaPlanner: a velocity the predictor
+ * wants slowed down is sent at the reduced speed, and a zero velocity stops the robot.
+ * @param velocity The body-frame velocity.
+ */
+void SafeNavigation::driveSafe(const VelocityCommand& velocity) {
+    lock_guard<mutex> lock(navigationMutex);
+    drive(velocity);
+}
+
+/**
+ * @brief Sends a body-frame velocity if it is safe, as driveSafe(). The caller holds navigationMutex.
+ * @param velocity The body-frame velocity.
+ */
+void SafeNavigation::drive(const VelocityCommand& velocity) {
+    command = velocity;
+    streaming = true;
+    if (velocity.vx == 0.0 && velocity.vy == 0.0 && velocity.omega == 0.0) {
+        controller->setVelocity(0.0, 0.0, 0.0);
+        state = STOP;
+        return;
+    }
+    CollisionPredictor::Decision decision = CollisionPredictor::CLEAR;
+    if (predictor != nullptr) {
+        decision = predictor->evaluate(controller->getPose(), command);
+    }
+    if (detectObstacle() || decision == CollisionPredictor::STOP) {
+        controller->stop();
+        state = STOP;
+    }
+    else if (decision == CollisionPredictor::SLOW) {
+        controller->setVelocity(command.vx * SLOW_FACTOR, command.vy * SLOW_FACTOR, command.omega * SLOW_FACTOR);
+        state = SLOW;
     }
     else {
+        controller->setVelocity(command.vx, command.vy, command.omega);
+        state = MOVING;
+    }
+}
+
+/**
+ * @brief Stops the robot if it is moving and an obstacle is detected.
+ * Intended to be registered as a periodic task (see PeriodicExecutor) so that the
+ * obstacle check keeps running while the robot moves.
+ *
+ * With a collision predictor, the motion at cruise speed is also checked against the tracked
+ * obstacles: the robot slows down or stops as soon as a collision is predicted within the
+ * predictor's thresholds, typically well before an obstacle reaches the IR threshold, and
+ * returns to cruise speed once the way is clear again. While slow, the reduced velocity is sent
+ * again on every call, as a detour is while avoiding, so the command stream stays alive.
+ *
+ * With a VFH planner, a move command that would stop steers around the obstacle instead, along
+ * the free direction closest to the move's direction, and resumes the move once that direction
+ * is free again and the IR sensors are clear. Commands of driveSafe() are left to their planner.
+ */
+void SafeNavigation::checkSafety() {
+    lock_guard<mutex> lock(navigationMutex);
+    if (state == STOP) {
+        return;
+    }
+    if (state == AVOIDING) {
+        double target = command.vx < 0.0 ? SE2_PI : 0.0;
+        if (vfh != nullptr && vfh->isDirectionFree(target) && !detectObstacle()) {
+            moveSafe(command.vx < 0.0 ? -1 : 1); // Back on course
+        }
+        else {
+            steerAround();
+        }
+        return;
+    }
+    if (detectObstacle()) {
+        if (vfh != nullptr && !streaming) {
+            steerAround();
+            return;
+        }
+        controller->stop();
         state = STOP;
+        return;
+    }
+    CollisionPredictor::Decision decision = CollisionPredictor::CLEAR;
+    if (predictor != nullptr) {
+        decision = predictor->evaluate(controller->getPose(), command);
+    }
+    if (decision == CollisionPredictor::STOP) {
+        if (vfh != nullptr && !streaming) {
+            steerAround();
+            return;
+        }
+        controller->stop();
+        state = STOP;
+    }
+    else if (decision == CollisionPredictor::SLOW) {
+        // Sent on every tick, so that the streamer's deadman does not stop a robot that stays slow
+        controller->setVelocity(command.vx * SLOW_FACTOR, command.vy * SLOW_FACTOR, command.omega * SLOW_FACTOR);
+        state = SLOW;
+    }
+    else if (decision == CollisionPredictor::CLEAR && state == SLOW) {
+        if (streaming) {
+            drive(command); // Back to the full velocity
+        }
+        else {
+            moveSafe(command.vx < 0.0 ? -1 : 1); // Back to cruise speed
+        }
+    }
+}
+
+/**
+ * @brief Sets the collision predictor consulted before and while moving.
+ * @param collisionPredictor The predictor, or nullptr to rely on the IR sensors only. Its
+ *        obstacles are kept up to date by the caller, e.g. from an ObstacleTracker.
+ */
+void SafeNavigation::setCollisionPredictor(CollisionPredictor* collisionPredictor) {
+    lock_guard<mutex> lock(navigationMutex);
+    predictor = collisionPredictor;
+}
+
+/**
+ * @brief Sets the planner that steers a blocked move command around obstacles.
+ * @param planner The planner, or nullptr to stop instead. Its histogram is kept up to date by
+ *        the caller, e.g. with VfhPlanner::update() after each Lidar update.
+ */
+void SafeNavigation::setVfhPlanner(VfhPlanner* planner) {
+    lock_guard<mutex> lock(navigationMutex);
+    vfh = planner;
+}
+
+/**
+ * @brief Sets the speed of a move command, used to predict collisions.
+ * @param speed The speed in m/s; it should match the nominal speed of the robot API.
+ */
+void SafeNavigation::setCruiseSpeed(double speed) {
+    lock_guard<mutex> lock(navigationMutex);
+    if (speed > 0.0) {
+        cruiseSpeed = speed;
     }
 }
 
 /**
  * @brief Retrieves the current state of the robot.
- * @return The current state of the robot (STOP or MOVING).
+ * @return The current state of the robot (STOP, MOVING, SLOW or AVOIDING).
  */
 SafeNavigation::State SafeNavigation::getState() const {
     return state;
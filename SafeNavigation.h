@@ -10,14 +10,25 @@
 
 #include "RobotControler.h"
 #include "IRSensor.h"
+#include "CollisionPredictor.h"
+#include "VfhPlanner.h"
+#include <atomic>
 #include <iostream>
+#include <mutex>
 
+// Thread safety: the move commands, driveSafe() and the setters are called from the menu or
+// planner thread while checkSafety() runs on a PeriodicExecutor thread. Every public function
+// except getState() takes navigationMutex for its whole duration, so the sensor reads, the
+// state changes and the commands sent to the controller of one call never interleave with
+// those of another; getState() reads the atomic state without waiting.
 class SafeNavigation {
 public:
     // Enum to track the state of the robot
     enum State {
         STOP,
-        MOVING
+        MOVING,
+        SLOW, // Moving at reduced speed because a collision is predicted
+        AVOIDING // Steering around an obstacle along the direction chosen by the VFH planner
     };
 
     // Constructor
@@ -32,13 +43,53 @@ public:
     // Function to move the robot backward safely
     void moveBackwardSafe();
 
+    // Sends a body-frame velocity (e.g. from a local planner) if it is safe, slowed down if a
+    // collision is predicted; a zero velocity stops the robot
+    void driveSafe(const VelocityCommand& velocity);
+
+    // Stops the robot if it is moving and an obstacle is detected, and slows it down or stops it
+    // if the collision predictor sees a collision coming; with a VFH planner, a move command
+    // steers around the obstacle instead of stopping; meant to run periodically, more often than
+    // the deadman timeout of the command stream, since it resends the slowed or detour velocity
+    void checkSafety();
+
+    // Sets the predictor consulted before and while moving (nullptr to rely on the IR sensors only);
+    // its obstacles are kept up to date by the caller
+    void setCollisionPredictor(CollisionPredictor* predictor);
+
+    // Sets the planner that steers a blocked move command around obstacles (nullptr to stop
+    // instead); its histogram is kept up to date by the caller from the Lidar scans
+    void setVfhPlanner(VfhPlanner* planner);
+
+    // Sets the speed of a move command in m/s, used to predict collisions
+    void setCruiseSpeed(double speed);
+
     // Getter for the current state of the robot
     State getState() const;
 
 private:
     RobotControler* controller;
     IRSensor* irSensor;
-    State state; // The state of the robot (STOP or MOVING)
+    std::mutex navigationMutex; // Serializes the public functions, see the note on the class
+    std::atomic<State> state; // The state of the robot (STOP, MOVING, SLOW or AVOIDING)
+    CollisionPredictor* predictor; // Predicts collisions of the current motion, or nullptr
+    VfhPlanner* vfh; // Steers blocked move commands around obstacles, or nullptr
+    VelocityCommand command; // Velocity of the current or last move command
+    bool streaming; // True if the command came from driveSafe() rather than a move command
+    double cruiseSpeed; // Speed of a move command in m/s
+
+    // Reads the IR sensors and tells whether one of them sees an obstacle; the caller holds navigationMutex
+    bool detectObstacle();
+
+    // Sends a body-frame velocity if it is safe, as driveSafe(); the caller holds navigationMutex
+    void drive(const VelocityCommand& velocity);
+
+    // Starts a move along x at the given direction (1 forward, -1 backward) if it is safe
+    void moveSafe(int direction);
+
+    // Drives along the VFH direction closest to the direction of the move command, or stops the
+    // robot if there is none
+    void steerAround();
 };
 
 #endif // SAFENAVIGATION_H
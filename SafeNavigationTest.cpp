@@ -0,0 +1,181 @@
+/**
+ * @file SafeNavigationTest.cpp
+ * @brief Test application for the state transitions of the SafeNavigation class.
+ * @details Drives the robot towards a box the collision predictor reports, holds it in the SLOW
+ * state for longer than the deadman timeout of the command stream, steers it around an obstacle
+ * seen by a scripted IR sensor with the VFH planner, and checks that it returns to MOVING.
+ * @date October, 2026
+ */
+
+#include "SafeNavigation.h"
+#include "RobotControler.h"
+#include "CollisionPredictor.h"
+#include "VfhPlanner.h"
+#include "IRSensor.h"
+#include "FestoRobotAPI.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <thread>
+using namespace std;
+
+/**
+ * @class ScriptedIRSensor
+ * @brief IR sensor whose front reading is set by the test; the other sensors see nothing close.
+ */
+class ScriptedIRSensor : public IRSensor {
+public:
+    double front; /**< Range of the front sensor in meters. */
+
+    /**
+     * @brief Constructor for the ScriptedIRSensor class.
+     * @param api The robot API (not read).
+     */
+    explicit ScriptedIRSensor(FestoRobotAPI* api) : IRSensor(api), front(1.0) {}
+
+    /**
+     * @brief Does nothing; the readings are set by the test.
+     */
+    void update() override {}
+
+    /**
+     * @brief Returns a scripted reading.
+     * @param index Sensor index (0-8).
+     * @return The front range for sensor 4, 1 m otherwise.
+     */
+    double getRange(int index) override {
+        return index == 4 ? front : 1.0;
+    }
+};
+
+/**
+ * @brief Puts a box in the predictor a given gap ahead of the robot, replacing any other obstacle.
+ * @param predictor The predictor.
+ * @param controller The controller the pose is read from.
+ * @param gap Distance from the robot's circle to the box in meters (radius 0.25 m, box half size 0.2 m).
+ */
+void placeBox(CollisionPredictor& predictor, RobotControler& controller, double gap) {
+    Pose pose = controller.getPose();
+    double ahead = 0.25 + gap + 0.2;
+    predictor.clearObstacles();
+    predictor.addBox(pose.getX() + ahead * cos(pose.getTh()), pose.getY() + ahead * sin(pose.getTh()), 0.2, 0.2);
+}
+
+/**
+ * @brief Feeds the VFH planner a scan of open space, optionally with a wall 0.6 m ahead.
+ * @param vfh The planner.
+ * @param wallAhead True to block the beams within 30 degrees of straight ahead.
+ */
+void feedScan(VfhPlanner& vfh, bool wallAhead) {
+    float ranges[667];
+    for (int i = 0; i < 667; i++) {
+        double angle = -120.0 + i * 0.36;
+        ranges[i] = wallAhead && angle > -30.0 && angle < 30.0 ? 0.6f : 5.0f;
+    }
+    vfh.update(ranges, 667, -120.0, 0.36);
+}
+
+/**
+ * @brief Runs the safety check every 50 ms for a while, as a PeriodicExecutor task would.
+ * @param safeNav The navigation.
+ * @param predictor The predictor, whose box is kept at the same gap ahead.
+ * @param controller The controller.
+ * @param gap Gap to the box in meters, or a negative value for no box.
+ * @param ms Duration in milliseconds.
+ * @param expected State that must hold after every check.
+ */
+void runChecks(SafeNavigation& safeNav, CollisionPredictor& predictor, RobotControler& controller, double gap,
+    int ms, SafeNavigation::State expected) {
+    for (int t = 0; t < ms; t += 50) {
+        if (gap >= 0.0) {
+            placeBox(predictor, controller, gap);
+        }
+        safeNav.checkSafety();
+        assert(safeNav.getState() == expected);
+        this_thread::sleep_for(chrono::milliseconds(50));
+    }
+}
+
+/**
+ * @brief Main function for testing the SafeNavigation state transitions.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    FestoRobotAPI* robotAPI = new FestoRobotAPI();
+    RobotControler controller(new Pose(0.0, 0.0, 0.0), robotAPI); // Takes ownership of the pose and the API
+    ScriptedIRSensor irSensor(robotAPI);
+    CollisionPredictor predictor; // Radius 0.25 m, stop below 1 s, slow below 2.5 s
+    VfhPlanner vfh;
+    SafeNavigation safeNav(&controller, &irSensor);
+    safeNav.setCollisionPredictor(&predictor);
+    safeNav.setVfhPlanner(&vfh);
+    safeNav.setCruiseSpeed(0.2);
+    assert(controller.connectRobot());
+    CommandStreamer& streamer = controller.getStreamer();
+    feedScan(vfh, false);
+
+    /**
+     * @test Test 1: A box 1.5 s ahead at cruise speed slows a move command down, and the robot
+     * is still driven after twice the deadman timeout in the SLOW state.
+     */
+    placeBox(predictor, controller, 0.3);
+    safeNav.moveForwardSafe();
+    assert(safeNav.getState() == SafeNavigation::SLOW);
+    unsigned long trips = streamer.getDeadmanTrips();
+    runChecks(safeNav, predictor, controller, 0.3, 1000, SafeNavigation::SLOW);
+    assert(streamer.getDeadmanTrips() == trips);
+    assert(streamer.getCommanded().vx > 0.0);
+    cout << "SLOW for 1 s: commanded vx = " << streamer.getCommanded().vx << " m/s, no deadman stop" << endl;
+
+    /**
+     * @test Test 2: An obstacle at the front IR sensor makes the VFH planner steer around the
+     * wall in front, and the detour keeps being sent while AVOIDING.
+     */
+    predictor.clearObstacles();
+    feedScan(vfh, true);
+    irSensor.front = 0.3;
+    runChecks(safeNav, predictor, controller, -1.0, 1000, SafeNavigation::AVOIDING);
+    VelocityCommand detour = streamer.getCommanded();
+    assert(streamer.getDeadmanTrips() == trips);
+    assert(detour.vy != 0.0 || detour.vx != 0.0);
+    cout << "AVOIDING for 1 s: commanded (" << detour.vx << ", " << detour.vy << ") m/s" << endl;
+
+    /**
+     * @test Test 3: Once the IR sensors and the direction of the move are clear, the move command
+     * resumes at full speed.
+     */
+    irSensor.front = 1.0;
+    feedScan(vfh, false);
+    runChecks(safeNav, predictor, controller, -1.0, 200, SafeNavigation::MOVING);
+
+    /**
+     * @test Test 4: A streamed velocity is slowed down and kept alive the same way, returns to
+     * MOVING when the way is clear, and a zero velocity stops the robot.
+     */
+    VelocityCommand forward = { 0.2, 0.0, 0.0 };
+    placeBox(predictor, controller, 0.3);
+    safeNav.driveSafe(forward);
+    assert(safeNav.getState() == SafeNavigation::SLOW);
+    runChecks(safeNav, predictor, controller, 0.3, 800, SafeNavigation::SLOW);
+    assert(streamer.getDeadmanTrips() == trips && streamer.getCommanded().vx > 0.0);
+    predictor.clearObstacles();
+    safeNav.checkSafety();
+    assert(safeNav.getState() == SafeNavigation::MOVING);
+    VelocityCommand zero = { 0.0, 0.0, 0.0 };
+    safeNav.driveSafe(zero);
+    assert(safeNav.getState() == SafeNavigation::STOP);
+
+    /**
+     * @test Test 5: Without a VFH planner a box too close stops the robot.
+     */
+    safeNav.setVfhPlanner(nullptr);
+    placeBox(predictor, controller, 0.1);
+    safeNav.moveForwardSafe();
+    assert(safeNav.getState() == SafeNavigation::STOP);
+
+    controller.stop();
+    controller.disconnectRobot();
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
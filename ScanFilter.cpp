@@ -0,0 +1,283 @@
+/**
+ * @file ScanFilter.cpp
+ * @brief Implementation of the ScanFilter class.
+ * @date October 2026
+ */
+
+#include "ScanFilter.h"
+#include "SimdOps.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Median of three values as min and max operations, without branches.
+ * @param a First value.
+ * @param b Second value.
+ * @param c Third value.
+ * @return The median.
+ */
+static inline float median3(float a, float b, float c) {
+    float low = a < b ? a : b;
+    float high = a < b ? b : a;
+    float upper = high < c ? high : c;
+    return low > upper ? low : upper;
+}
+
+/**
+ * @brief Median of five values as min and max operations, without branches.
+ *
+ * The larger of the two pair minima and the smaller of the two pair maxima bracket the median
+ * of the four paired values; the median of those two and the fifth value is the median of all five.
+ *
+ * @param a First value.
+ * @param b Second value.
+ * @param c Third value.
+ * @param d Fourth value.
+ * @param e Fifth value.
+ * @return The median.
+ */
+static inline float median5(float a, float b, float c, float d, float e) {
+    float lowAB = a < b ? a : b;
+    float highAB = a < b ? b : a;
+    float lowCD = c < d ? c : d;
+    float highCD = c < d ? d : c;
+    return median3(lowAB > lowCD ? lowAB : lowCD, highAB < highCD ? highAB : highCD, e);
+}
+
+#ifdef SIMD_OPS_VECTOR
+
+/**
+ * @brief median3 on all lanes.
+ * @param a First lanes.
+ * @param b Second lanes.
+ * @param c Third lanes.
+ * @return The medians.
+ */
+static inline SimdOps::V median3(SimdOps::V a, SimdOps::V b, SimdOps::V c) {
+    typedef SimdOps S;
+    return S::maximum(S::minimum(a, b), S::minimum(S::maximum(a, b), c));
+}
+
+/**
+ * @brief median5 on all lanes.
+ * @param a First lanes.
+ * @param b Second lanes.
+ * @param c Third lanes.
+ * @param d Fourth lanes.
+ * @param e Fifth lanes.
+ * @return The medians.
+ */
+static inline SimdOps::V median5(SimdOps::V a, SimdOps::V b, SimdOps::V c, SimdOps::V d, SimdOps::V e) {
+    typedef SimdOps S;
+    return median3(S::maximum(S::minimum(a, b), S::minimum(c, d)), S::minimum(S::maximum(a, b), S::maximum(c, d)), e);
+}
+
+#endif
+
+/**
+ * @brief Replaces invalid and out-of-range values with 0.
+ * @param in The ranges.
+ * @param out Receives count gated ranges.
+ * @param count Number of ranges.
+ * @param low Smallest valid range, greater than 0.
+ * @param high Largest valid range.
+ * @return The number of values replaced.
+ */
+static int gate(const float* in, float* out, int count, float low, float high) {
+    int i = 0;
+    int invalid = 0;
+#ifdef SIMD_OPS_VECTOR
+    typedef SimdOps S;
+    const S::V lowV = S::set(low);
+    const S::V highV = S::set(high);
+    const S::V one = S::set(1.0f);
+    S::V rejected = S::set(0.0f);
+    for (; i + S::WIDTH <= count; i += S::WIDTH) {
+        S::V v = S::load(in + i);
+        S::V valid = S::bitAnd(S::greaterEqual(v, lowV), S::greaterEqual(highV, v)); // False for NaN
+        S::store(out + i, S::bitAnd(valid, v));
+        rejected = S::add(rejected, S::bitAndNot(valid, one));
+    }
+    float lanes[S::WIDTH];
+    S::store(lanes, rejected);
+    for (int lane = 0; lane < S::WIDTH; lane++) {
+        invalid += static_cast<int>(lanes[lane]);
+    }
+#endif
+    for (; i < count; i++) {
+        float v = in[i];
+        bool valid = v >= low && v <= high;
+        out[i] = valid ? v : 0.0f;
+        invalid += valid ? 0 : 1;
+    }
+    return invalid;
+}
+
+/**
+ * @brief Computes the element-wise median of 1, 3 or 5 rows.
+ * @param rows The rows.
+ * @param rowCount Number of rows: 1, 3 or 5.
+ * @param out Receives count medians.
+ * @param count Number of elements per row.
+ */
+static void medianOfRows(const float* const* rows, int rowCount, float* out, int count) {
+    int i = 0;
+    if (rowCount == 1) {
+        for (; i < count; i++) {
+            out[i] = rows[0][i];
+        }
+        return;
+    }
+#ifdef SIMD_OPS_VECTOR
+    typedef SimdOps S;
+    if (rowCount == 3) {
+        for (; i + S::WIDTH <= count; i += S::WIDTH) {
+            S::store(out + i, median3(S::load(rows[0] + i), S::load(rows[1] + i), S::load(rows[2] + i)));
+        }
+    }
+    else {
+        for (; i + S::WIDTH <= count; i += S::WIDTH) {
+            S::store(out + i, median5(S::load(rows[0] + i), S::load(rows[1] + i), S::load(rows[2] + i),
+                S::load(rows[3] + i), S::load(rows[4] + i)));
+        }
+    }
+#endif
+    if (rowCount == 3) {
+        for (; i < count; i++) {
+            out[i] = median3(rows[0][i], rows[1][i], rows[2][i]);
+        }
+    }
+    else {
+        for (; i < count; i++) {
+            out[i] = median5(rows[0][i], rows[1][i], rows[2][i], rows[3][i], rows[4][i]);
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of rows of a median window.
+ * @param window The configured window: 0, 1, 3 or 5.
+ * @return 1, 3 or 5.
+ */
+static int windowRows(int window) {
+    return window > 1 ? window : 1;
+}
+
+/**
+ * @brief Constructor for the ScanFilter class. The filter starts with a value-initialized config.
+ */
+ScanFilter::ScanFilter() : config(), stats(), historyBeams(0), historyNext(0) {}
+
+/**
+ * @brief Changes the settings and clears the history and the counters.
+ * @param settings The settings.
+ * @return True on success; false if the settings are invalid, in which case they are not changed.
+ */
+bool ScanFilter::configure(const ScanFilterConfig& settings) {
+    if (!(settings.minRange >= 0.0f) || !(settings.maxRange >= 0.0f)
+        || (settings.maxRange > 0.0f && settings.maxRange <= settings.minRange)) {
+        cerr << "Error: The scan filter needs 0 <= minRange < maxRange, or maxRange 0 for no limit." << endl;
+        return false;
+    }
+    if (windowRows(settings.spatialWindow) % 2 == 0 || windowRows(settings.spatialWindow) > 5
+        || windowRows(settings.temporalWindow) % 2 == 0 || windowRows(settings.temporalWindow) > 5) {
+        cerr << "Error: The scan filter median windows must be 0, 1, 3 or 5." << endl;
+        return false;
+    }
+    config = settings;
+    reset();
+    return true;
+}
+
+/**
+ * @brief Clears the history and the counters.
+ */
+void ScanFilter::reset() {
+    stats = ScanFilterStats();
+    history.clear();
+    historyBeams = 0;
+    historyNext = 0;
+}
+
+/**
+ * @brief Filters a scan.
+ *
+ * The gated scan is stored with its edge beams repeated, so the spatial median reads every
+ * neighbour of beam i at padded[i + k] and becomes the element-wise median of shifted rows. The
+ * temporal median is the element-wise median of the history slots. The history is filled with
+ * the first scan, and again whenever the number of beams changes, so it never mixes layouts.
+ *
+ * @param in The ranges in meters.
+ * @param out Receives count filtered ranges; 0 marks a beam without a valid return. May be in.
+ * @param count Number of ranges.
+ * @return The number of beams rejected by the range gate.
+ */
+int ScanFilter::apply(const float* in, float* out, int count) {
+    if (count <= 0) {
+        return 0;
+    }
+    chrono::steady_clock::time_point started = chrono::steady_clock::now();
+    const int spatialRows = windowRows(config.spatialWindow);
+    const int temporalRows = windowRows(config.temporalWindow);
+    const int half = spatialRows / 2;
+
+    padded.resize(count + 2 * half);
+    float low = config.minRange > FLT_MIN ? config.minRange : FLT_MIN;
+    float high = config.maxRange > 0.0f ? config.maxRange : FLT_MAX;
+    int invalid = gate(in, &padded[half], count, low, high);
+    for (int k = 0; k < half; k++) {
+        padded[k] = padded[half];
+        padded[half + count + k] = padded[half + count - 1];
+    }
+
+    const float* rows[5];
+    bool seed = false;
+    if (temporalRows > 1 && historyBeams != count) {
+        history.assign(static_cast<size_t>(temporalRows) * count, 0.0f);
+        historyBeams = count;
+        historyNext = 0;
+        seed = true;
+    }
+    float* spatialOut = temporalRows > 1 ? &history[static_cast<size_t>(historyNext) * count] : out;
+    for (int k = 0; k < spatialRows; k++) {
+        rows[k] = &padded[k];
+    }
+    medianOfRows(rows, spatialRows, spatialOut, count);
+
+    if (temporalRows > 1) {
+        for (int k = 0; k < temporalRows; k++) {
+            rows[k] = &history[static_cast<size_t>(k) * count];
+            if (seed && k != historyNext) {
+                copy(spatialOut, spatialOut + count, &history[static_cast<size_t>(k) * count]);
+            }
+        }
+        medianOfRows(rows, temporalRows, out, count);
+        historyNext = (historyNext + 1) % temporalRows;
+    }
+
+    stats.scans++;
+    stats.invalidBeams += invalid;
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - started).count();
+    stats.longestUs = stats.lastUs > stats.longestUs ? stats.lastUs : stats.longestUs;
+    return invalid;
+}
+
+/**
+ * @brief Returns the settings.
+ * @return The settings.
+ */
+const ScanFilterConfig& ScanFilter::getConfig() const {
+    return config;
+}
+
+/**
+ * @brief Returns the counters.
+ * @return The counters.
+ */
+const ScanFilterStats& ScanFilter::getStats() const {
+    return stats;
+}
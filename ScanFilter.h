@@ -0,0 +1,97 @@
+/**
+ * @file ScanFilter.h
+ * @brief Declaration of the ScanFilter class, the outlier rejection stage for Lidar scans.
+ * @date October 2026
+ */
+
+#ifndef SCANFILTER_H
+#define SCANFILTER_H
+
+#include <vector>
+
+/**
+ * @struct ScanFilterConfig
+ * @brief Settings of a ScanFilter. A value-initialized config only rejects invalid ranges.
+ */
+struct ScanFilterConfig {
+    float minRange;      /**< Ranges below this are invalid, in meters. */
+    float maxRange;      /**< Ranges above this are invalid, in meters; zero disables the limit. */
+    int spatialWindow;   /**< Beams in the median over neighbouring beams: 3 or 5; 0 or 1 disables it. */
+    int temporalWindow;  /**< Scans in the median over recent scans: 3 or 5; 0 or 1 disables it. */
+};
+
+/**
+ * @struct ScanFilterStats
+ * @brief Counters of a ScanFilter since configure() or reset().
+ */
+struct ScanFilterStats {
+    unsigned long scans;         /**< Scans filtered. */
+    unsigned long invalidBeams;  /**< Beams rejected by the range gate. */
+    double lastUs;               /**< Duration of the last apply() call, in microseconds. */
+    double longestUs;            /**< Longest apply() call, in microseconds. */
+};
+
+/**
+ * @class ScanFilter
+ * @brief Removes spurious returns from Lidar scans before they reach the map or a distance check.
+ *
+ * A scan passes three stages. The range gate replaces NaN, infinite, non-positive and
+ * out-of-range values with 0, the value the rest of the code already skips as "no return".
+ * The spatial median replaces each beam by the median of its neighbours, which removes single
+ * spikes such as mixed pixels at object edges and fills single dropouts. The temporal median
+ * replaces each beam by its median over the last few scans, which removes returns that appear
+ * in one scan only, such as reflections.
+ *
+ * The medians are sorting networks of min and max operations, so every stage is free of
+ * branches and runs on SimdOps vectors (see SimdOps.h).
+ */
+class ScanFilter {
+private:
+    ScanFilterConfig config;     /**< Current settings. */
+    ScanFilterStats stats;       /**< Counters. */
+    std::vector<float> padded;   /**< Gated scan with its edge beams repeated on both sides. */
+    std::vector<float> history;  /**< The last temporalWindow spatially filtered scans, one after another. */
+    int historyBeams;            /**< Beams per scan in the history, or 0 if it is empty. */
+    int historyNext;             /**< Slot of the history the next scan is written to. */
+
+public:
+    /**
+     * @brief Constructor for the ScanFilter class. The filter starts with a value-initialized config.
+     */
+    ScanFilter();
+
+    /**
+     * @brief Changes the settings and clears the history and the counters.
+     * @param settings The settings.
+     * @return True on success; false if the settings are invalid, in which case they are not changed.
+     */
+    bool configure(const ScanFilterConfig& settings);
+
+    /**
+     * @brief Clears the history and the counters.
+     */
+    void reset();
+
+    /**
+     * @brief Filters a scan.
+     * @param in The ranges in meters.
+     * @param out Receives count filtered ranges; 0 marks a beam without a valid return. May be in.
+     * @param count Number of ranges.
+     * @return The number of beams rejected by the range gate.
+     */
+    int apply(const float* in, float* out, int count);
+
+    /**
+     * @brief Returns the settings.
+     * @return The settings.
+     */
+    const ScanFilterConfig& getConfig() const;
+
+    /**
+     * @brief Returns the counters.
+     * @return The counters.
+     */
+    const ScanFilterStats& getStats() const;
+};
+
+#endif // SCANFILTER_H
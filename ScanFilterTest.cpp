@@ -0,0 +1,185 @@
+/**
+ * @file ScanFilterTest.cpp
+ * @brief Test and benchmark application for the ScanFilter class.
+ * @details Checks the range gate, the median networks against sorting, the removal of spikes
+ * across beams and across scans and the rejection of invalid settings, and measures the time
+ * per scan with both medians at their widest.
+ * @date October, 2026
+ */
+
+#include "ScanFilter.h"
+#include "SimdOps.h"
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Feeds every tuple of five levels through a temporal median and compares with sorting.
+ * @param window The temporal window: 3 or 5.
+ */
+void checkTemporalNetwork(int window) {
+    int tuples = 1;
+    for (int k = 0; k < window; k++) {
+        tuples *= 5;
+    }
+    ScanFilterConfig config = ScanFilterConfig();
+    config.temporalWindow = window;
+    ScanFilter filter;
+    assert(filter.configure(config));
+    vector<float> scan(tuples), out(tuples);
+    for (int k = 0, digits = 1; k < window; k++, digits *= 5) {
+        for (int t = 0; t < tuples; t++) {
+            scan[t] = 1.0f + (t / digits) % 5; // Digit k of t, shifted above 0 so that it is valid
+        }
+        filter.apply(&scan[0], &out[0], tuples);
+    }
+    for (int t = 0; t < tuples; t++) {
+        vector<float> values;
+        for (int k = 0, digits = 1; k < window; k++, digits *= 5) {
+            values.push_back(1.0f + (t / digits) % 5);
+        }
+        sort(values.begin(), values.end());
+        assert(out[t] == values[window / 2]);
+    }
+}
+
+/**
+ * @brief Main function for testing the scan filter.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    cout << "Backend: " << simdOpsBackend() << endl;
+
+    /**
+     * @test Test 1: The gate zeroes NaN, infinite, non-positive and out-of-range values and counts them.
+     */
+    const float nan = numeric_limits<float>::quiet_NaN();
+    const float inf = numeric_limits<float>::infinity();
+    ScanFilterConfig gateOnly = ScanFilterConfig();
+    ScanFilter filter;
+    vector<float> scan = { 1.0f, nan, 2.0f, 0.0f, -1.0f, inf, 3.0f, 0.01f, 5.5f, 4.0f, nan, 0.5f, 7.0f };
+    vector<float> out(scan.size());
+    assert(filter.apply(&scan[0], &out[0], static_cast<int>(scan.size())) == 5);
+    assert(out[0] == 1.0f && out[1] == 0.0f && out[3] == 0.0f && out[4] == 0.0f && out[5] == 0.0f);
+    assert(out[7] == 0.01f && out[12] == 7.0f);
+    gateOnly.minRange = 0.02f;
+    gateOnly.maxRange = 5.6f;
+    assert(filter.configure(gateOnly));
+    assert(filter.apply(&scan[0], &out[0], static_cast<int>(scan.size())) == 7);
+    assert(out[7] == 0.0f && out[8] == 5.5f && out[12] == 0.0f && out[11] == 0.5f);
+    assert(filter.getStats().scans == 1 && filter.getStats().invalidBeams == 7);
+    assert(filter.apply(&scan[0], &scan[0], static_cast<int>(scan.size())) == 7 && scan[1] == 0.0f); // In place
+
+    /**
+     * @test Test 2: The median networks agree with sorting for every tuple, including ties.
+     */
+    checkTemporalNetwork(3);
+    checkTemporalNetwork(5);
+
+    /**
+     * @test Test 3: The spatial median removes single spikes and dropouts and keeps step edges.
+     */
+    ScanFilterConfig spatial = ScanFilterConfig();
+    spatial.maxRange = 5.6f;
+    spatial.spatialWindow = 3;
+    assert(filter.configure(spatial));
+    const int beams = 667;
+    vector<float> wall(beams), filtered(beams);
+    for (int i = 0; i < beams; i++) {
+        wall[i] = i < 300 ? 1.0f : 3.0f;
+    }
+    vector<float> noisy = wall;
+    noisy[50] = 4.5f;   // Mixed pixel
+    noisy[120] = 0.0f;  // Dropout
+    noisy[200] = nan;
+    noisy[450] = 0.2f;  // Reflection
+    noisy[beams - 3] = 9.0f; // Beyond the maximum range, rejected by the gate
+    filter.apply(&noisy[0], &filtered[0], beams);
+    assert(filtered == wall);
+    noisy[51] = 4.5f; // Two neighbouring spikes need the wider window
+    filter.apply(&noisy[0], &filtered[0], beams);
+    assert(filtered[50] == 4.5f || filtered[51] == 4.5f);
+    spatial.spatialWindow = 5;
+    assert(filter.configure(spatial));
+    filter.apply(&noisy[0], &filtered[0], beams);
+    assert(filtered == wall);
+
+    /**
+     * @test Test 4: The temporal median removes returns seen in one scan and follows lasting changes.
+     */
+    ScanFilterConfig temporal = ScanFilterConfig();
+    temporal.temporalWindow = 3;
+    assert(filter.configure(temporal));
+    filter.apply(&wall[0], &filtered[0], beams);
+    noisy = wall;
+    for (int i = 100; i < 110; i++) {
+        noisy[i] = 0.3f; // A ghost spanning ten beams, for one scan only
+    }
+    filter.apply(&noisy[0], &filtered[0], beams);
+    assert(filtered == wall);
+    vector<float> moved(beams, 2.0f);
+    filter.apply(&moved[0], &filtered[0], beams);
+    assert(filtered == wall); // One scan of the new scene is outvoted
+    filter.apply(&moved[0], &filtered[0], beams);
+    assert(filtered == moved);
+    vector<float> shorter(beams - 7, 1.5f);
+    assert(filter.apply(&shorter[0], &filtered[0], beams - 7) == 0);
+    assert(filtered[0] == 1.5f && filtered[beams - 8] == 1.5f); // A new layout starts a new history
+
+    /**
+     * @test Test 5: Invalid settings are rejected and leave the filter unchanged.
+     */
+    ScanFilterConfig bad = spatial;
+    bad.spatialWindow = 4;
+    assert(!filter.configure(bad));
+    bad = spatial;
+    bad.temporalWindow = 7;
+    assert(!filter.configure(bad));
+    bad = spatial;
+    bad.minRange = 6.0f;
+    assert(!filter.configure(bad));
+    bad = spatial;
+    bad.minRange = nan;
+    assert(!filter.configure(bad));
+    assert(filter.getConfig().temporalWindow == 3 && filter.getConfig().spatialWindow == 0);
+
+    /**
+     * @test Test 6: Gate, five-beam and five-scan medians together stay under 50 microseconds per scan.
+     */
+    ScanFilterConfig full = ScanFilterConfig();
+    full.minRange = 0.02f;
+    full.maxRange = 5.6f;
+    full.spatialWindow = 5;
+    full.temporalWindow = 5;
+    assert(filter.configure(full));
+    mt19937 rng(3);
+    uniform_real_distribution<float> range(-0.5f, 6.0f);
+    vector<float> random(beams);
+    for (int i = 0; i < beams; i++) {
+        random[i] = range(rng);
+    }
+    const int scans = 20000;
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        random[s % beams] = range(rng);
+        filter.apply(&random[0], &filtered[0], beams);
+        checksum += filtered[s % beams];
+    }
+    double perScanUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / scans;
+    assert(filter.getStats().scans == static_cast<unsigned long>(scans));
+    assert(perScanUs < 50.0);
+    cout << "Filter, " << beams << " beams: " << perScanUs << " us/scan, longest "
+        << filter.getStats().longestUs << " us" << endl;
+    volatile double sink = checksum; // Keeps the timed loop from being optimized away
+    (void)sink;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
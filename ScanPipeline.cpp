@@ -0,0 +1,294 @@
+/**
+ * @file ScanPipeline.cpp
+ * @brief Implementation of the ScanPipeline class.
+ * @date October 2026
+ */
+
+#include "ScanPipeline.h"
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+/**
+ * @brief Returns the current time in seconds on the steady clock.
+ * @return The time in seconds.
+ */
+static double nowSeconds() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Constructor for the ScanPipeline class. Allocates all scans and commands up front.
+ *
+ * The scan pool holds enough scans to fill both queues plus one per stage in progress, so the
+ * sensor only runs out of scans if a stage leaks them. The command pool holds two queues' worth
+ * so that producers racing a full queue still find a free command.
+ *
+ * @param lidar Pointer to the Lidar sensor.
+ * @param mapper Pointer to the mapper (may be nullptr to skip mapping).
+ * @param controller Pointer to the robot controller (may be nullptr to skip dispatching).
+ * @param queueDepth Capacity of each scan queue.
+ * @param mapPolicy Backpressure policy of the sensor -> mapper queue.
+ * @param planPolicy Backpressure policy of the mapper -> planner queue.
+ * @param commandDepth Capacity of the command queue.
+ */
+ScanPipeline::ScanPipeline(LidarSensor* lidar, Mapper* mapper, RobotControler* controller,
+    uint32_t queueDepth, BackpressurePolicy mapPolicy, BackpressurePolicy planPolicy, uint32_t commandDepth)
+    : lidar(lidar), mapper(mapper), controller(controller),
+    mapQueue(queueDepth, mapPolicy), planQueue(queueDepth, planPolicy),
+    scanPool(mapQueue.capacity() + planQueue.capacity() + 3),
+    commandQueue(commandDepth, DROP_OLDEST), commandPool(2 * commandQueue.capacity()),
+    scansAcquired(0), scansMapped(0), scansPlanned(0), scanPoolExhausted(0),
+    commandsSubmitted(0), commandsDispatched(0), commandsCoalesced(0), commandsDropped(0) {}
+
+/**
+ * @brief Sets the planner stage callback.
+ * @param callback Called from planScan() for every scan.
+ */
+void ScanPipeline::setPlanner(PlannerCallback callback) {
+    planner = callback;
+}
+
+/**
+ * @brief Pushes a scan index to a queue and releases whatever the push displaced.
+ * @param queue The destination queue.
+ * @param index The scan index.
+ * @return True if the scan was queued.
+ */
+bool ScanPipeline::forwardScan(SpscQueue& queue, uint32_t index) {
+    uint32_t evicted;
+    PushResult result = queue.push(index, &evicted);
+    if (result == PUSH_EVICTED) {
+        scanPool.release(evicted);
+    }
+    else if (result == PUSH_REJECTED) {
+        scanPool.release(index);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Sensor stage: reads the Lidar and the pose into a pooled scan and queues it.
+ * @return True if a scan was queued.
+ */
+bool ScanPipeline::acquireScan() {
+    if (!lidar) {
+        return false;
+    }
+    uint32_t index;
+    if (!scanPool.acquire(index)) {
+        scanPoolExhausted.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    LidarScan& scan = scanPool[index];
+    lidar->update();
+    scan.timestamp = nowSeconds();
+    scan.pose = controller ? controller->getPose() : Pose(0.0, 0.0, 0.0);
+    scan.angleMin = lidar->getAngle(0);
+    scan.angleIncrement = lidar->getAngle(1) - scan.angleMin;
+    scan.rangeNumber = lidar->copyRanges(scan.ranges, LidarScan::MAX_BEAMS);
+    scansAcquired.fetch_add(1, memory_order_relaxed);
+    return forwardScan(mapQueue, index);
+}
+
+/**
+ * @brief Sensor stage for scans that are produced elsewhere (e.g. recordings or tests).
+ * @param scan The scan to copy into the pipeline.
+ * @return True if the scan was queued.
+ */
+bool ScanPipeline::submitScan(const LidarScan& scan) {
+    uint32_t index;
+    if (!scanPool.acquire(index)) {
+        scanPoolExhausted.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    scanPool[index] = scan;
+    scansAcquired.fetch_add(1, memory_order_relaxed);
+    return forwardScan(mapQueue, index);
+}
+
+/**
+ * @brief Mapper stage: integrates every queued scan and forwards it to the planner.
+ * @return The number of scans processed.
+ */
+int ScanPipeline::mapScan() {
+    int processed = 0;
+    uint32_t index;
+    while (mapQueue.pop(index)) {
+        if (mapper) {
+            mapper->updateMap(scanPool[index]);
+        }
+        scansMapped.fetch_add(1, memory_order_relaxed);
+        forwardScan(planQueue, index);
+        processed++;
+    }
+    return processed;
+}
+
+/**
+ * @brief Planner stage: runs the planner callback on every queued scan.
+ * @return The number of scans processed.
+ */
+int ScanPipeline::planScan() {
+    int processed = 0;
+    uint32_t index;
+    while (planQueue.pop(index)) {
+        if (planner) {
+            planner(scanPool[index], *this);
+        }
+        scanPool.release(index);
+        scansPlanned.fetch_add(1, memory_order_relaxed);
+        processed++;
+    }
+    return processed;
+}
+
+/**
+ * @brief Queues a velocity command. Safe from any thread.
+ * @param vx Forward velocity in m/s.
+ * @param vy Lateral velocity in m/s.
+ * @param omega Angular velocity in rad/s.
+ * @param source Identifier of the producer.
+ * @return True if the command was queued.
+ */
+bool ScanPipeline::submitCommand(double vx, double vy, double omega, int source) {
+    uint32_t index;
+    if (!commandPool.acquire(index)) {
+        commandsDropped.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    TimedCommand& command = commandPool[index];
+    command.timestamp = nowSeconds();
+    command.command.vx = vx;
+    command.command.vy = vy;
+    command.command.omega = omega;
+    command.source = source;
+
+    uint32_t evicted;
+    if (commandQueue.push(index, &evicted) == PUSH_EVICTED) {
+        commandPool.release(evicted);
+        commandsDropped.fetch_add(1, memory_order_relaxed);
+    }
+    commandsSubmitted.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Control stage: sends the newest queued command to the robot controller.
+ * @param command Receives the dispatched command (may be nullptr).
+ * @return True if a command was dispatched.
+ */
+bool ScanPipeline::dispatchCommand(TimedCommand* command) {
+    uint32_t index;
+    uint32_t latest = 0;
+    bool found = false;
+    while (commandQueue.pop(index)) {
+        if (found) {
+            commandPool.release(latest);
+            commandsCoalesced.fetch_add(1, memory_order_relaxed);
+        }
+        latest = index;
+        found = true;
+    }
+    if (!found) {
+        return false;
+    }
+
+    const TimedCommand& newest = commandPool[latest];
+    if (command) {
+        *command = newest;
+    }
+    if (controller) {
+        controller->setVelocity(newest.command.vx, newest.command.vy, newest.command.omega);
+    }
+    commandPool.release(latest);
+    commandsDispatched.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Returns the sensor -> mapper queue.
+ * @return Reference to the queue.
+ */
+const SpscQueue& ScanPipeline::getMapQueue() const {
+    return mapQueue;
+}
+
+/**
+ * @brief Returns the mapper -> planner queue.
+ * @return Reference to the queue.
+ */
+const SpscQueue& ScanPipeline::getPlanQueue() const {
+    return planQueue;
+}
+
+/**
+ * @brief Returns the command queue.
+ * @return Reference to the queue.
+ */
+const MpscQueue& ScanPipeline::getCommandQueue() const {
+    return commandQueue;
+}
+
+/**
+ * @brief Returns the number of scans currently available in the pool.
+ * @return The free scan count.
+ */
+uint32_t ScanPipeline::getFreeScans() const {
+    return scanPool.available();
+}
+
+/**
+ * @brief Returns the number of commands currently available in the pool.
+ * @return The free command count.
+ */
+uint32_t ScanPipeline::getFreeCommands() const {
+    return commandPool.available();
+}
+
+/**
+ * @brief Returns the number of sensor reads skipped because no scan was free.
+ * @return The exhaustion count.
+ */
+unsigned long ScanPipeline::getScanPoolExhausted() const {
+    return scanPoolExhausted.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of commands lost to a full queue or an empty pool.
+ * @return The drop count.
+ */
+unsigned long ScanPipeline::getCommandsDropped() const {
+    return commandsDropped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of commands superseded by a newer one before dispatch.
+ * @return The coalesce count.
+ */
+unsigned long ScanPipeline::getCommandsCoalesced() const {
+    return commandsCoalesced.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of commands sent to the robot.
+ * @return The dispatch count.
+ */
+unsigned long ScanPipeline::getCommandsDispatched() const {
+    return commandsDispatched.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Prints the stage and queue counters.
+ */
+void ScanPipeline::printStats() const {
+    cout << "Scans: acquired=" << scansAcquired.load() << ", mapped=" << scansMapped.load()
+        << ", planned=" << scansPlanned.load() << ", pool exhausted=" << scanPoolExhausted.load() << endl;
+    cout << "Map queue: dropped=" << mapQueue.getDropped() << ", rejected=" << mapQueue.getRejected()
+        << ", depth=" << mapQueue.size() << "/" << mapQueue.capacity() << endl;
+    cout << "Plan queue: dropped=" << planQueue.getDropped() << ", rejected=" << planQueue.getRejected()
+        << ", depth=" << planQueue.size() << "/" << planQueue.capacity() << endl;
+    cout << "Commands: submitted=" << commandsSubmitted.load() << ", dispatched=" << commandsDispatched.load()
+        << ", coalesced=" << commandsCoalesced.load() << ", dropped=" << commandsDropped.load() << endl;
+}
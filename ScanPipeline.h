@@ -0,0 +1,197 @@
+/**
+ * @file ScanPipeline.h
+ * @brief Declaration of the ScanPipeline class, which connects the Lidar sensor, the mapper and a
+ *        planner through lock-free queues of pooled scans and commands.
+ * @date October 2026
+ */
+
+#ifndef SCANPIPELINE_H
+#define SCANPIPELINE_H
+
+#include "LidarScan.h"
+#include "ObjectPool.h"
+#include "SpscQueue.h"
+#include "MpscQueue.h"
+#include "LidarSensor.h"
+#include "Mapper.h"
+#include "RobotControler.h"
+#include <atomic>
+#include <functional>
+
+class ScanPipeline;
+
+/**
+ * @brief Planner stage callback. Receives each scan after it has been mapped and may submit commands.
+ */
+typedef std::function<void(const LidarScan&, ScanPipeline&)> PlannerCallback;
+
+/**
+ * @class ScanPipeline
+ * @brief Moves Lidar scans from the sensor to the mapper to a planner, and commands from any
+ *        number of producers to the robot controller, without locks on the hot path.
+ *
+ * Every stage method is meant to run on its own thread (for example as a PeriodicExecutor task):
+ * - acquireScan(): sensor thread, fills a pooled LidarScan and queues it for the mapper.
+ * - mapScan(): mapper thread, integrates the scan and forwards it to the planner.
+ * - planScan(): planner thread, calls the planner callback and returns the scan to the pool.
+ * - dispatchCommand(): control thread, sends the newest submitted command to the robot.
+ *
+ * Scans and commands are preallocated and only their pool indices travel through the queues.
+ * Indices evicted by a DROP_OLDEST queue are released back to the pool by the producer that
+ * evicted them, so the pools never leak.
+ */
+class ScanPipeline {
+private:
+    LidarSensor* lidar;                  /**< Source of the scans. */
+    Mapper* mapper;                      /**< Consumer of the scans. */
+    RobotControler* controller;          /**< Receiver of the commands. */
+    PlannerCallback planner;             /**< Planner stage. */
+
+    SpscQueue mapQueue;                  /**< Sensor -> mapper. */
+    SpscQueue planQueue;                 /**< Mapper -> planner. */
+    ObjectPool<LidarScan> scanPool;      /**< Preallocated scans, sized from the queue capacities. */
+    MpscQueue commandQueue;              /**< Any producer -> control thread. */
+    ObjectPool<TimedCommand> commandPool; /**< Preallocated commands, sized from the queue capacity. */
+
+    std::atomic<unsigned long> scansAcquired;     /**< Scans read from the sensor. */
+    std::atomic<unsigned long> scansMapped;       /**< Scans integrated into the map. */
+    std::atomic<unsigned long> scansPlanned;      /**< Scans handed to the planner. */
+    std::atomic<unsigned long> scanPoolExhausted; /**< Sensor reads skipped for lack of a free scan. */
+    std::atomic<unsigned long> commandsSubmitted; /**< Commands accepted into the queue. */
+    std::atomic<unsigned long> commandsDispatched; /**< Commands sent to the robot. */
+    std::atomic<unsigned long> commandsCoalesced; /**< Older commands superseded before dispatch. */
+    std::atomic<unsigned long> commandsDropped;   /**< Commands lost to a full queue or empty pool. */
+
+    /**
+     * @brief Pushes a scan index to a queue and releases whatever the push displaced.
+     * @param queue The destination queue.
+     * @param index The scan index.
+     * @return True if the scan was queued.
+     */
+    bool forwardScan(SpscQueue& queue, uint32_t index);
+
+public:
+    /**
+     * @brief Constructor for the ScanPipeline class. Allocates all scans and commands up front.
+     * @param lidar Pointer to the Lidar sensor.
+     * @param mapper Pointer to the mapper (may be nullptr to skip mapping).
+     * @param controller Pointer to the robot controller (may be nullptr to skip dispatching).
+     * @param queueDepth Capacity of each scan queue.
+     * @param mapPolicy Backpressure policy of the sensor -> mapper queue.
+     * @param planPolicy Backpressure policy of the mapper -> planner queue.
+     * @param commandDepth Capacity of the command queue.
+     */
+    ScanPipeline(LidarSensor* lidar, Mapper* mapper, RobotControler* controller,
+        uint32_t queueDepth = 4, BackpressurePolicy mapPolicy = DROP_OLDEST,
+        BackpressurePolicy planPolicy = DROP_OLDEST, uint32_t commandDepth = 16);
+
+    /**
+     * @brief Sets the planner stage callback.
+     * @param callback Called from planScan() for every scan.
+     */
+    void setPlanner(PlannerCallback callback);
+
+    /**
+     * @brief Sensor stage: reads the Lidar and the pose into a pooled scan and queues it.
+     * @return True if a scan was queued.
+     */
+    bool acquireScan();
+
+    /**
+     * @brief Sensor stage for scans that are produced elsewhere (e.g. recordings or tests).
+     * @param scan The scan to copy into the pipeline.
+     * @return True if the scan was queued.
+     */
+    bool submitScan(const LidarScan& scan);
+
+    /**
+     * @brief Mapper stage: integrates every queued scan and forwards it to the planner.
+     * @return The number of scans processed.
+     */
+    int mapScan();
+
+    /**
+     * @brief Planner stage: runs the planner callback on every queued scan.
+     * @return The number of scans processed.
+     */
+    int planScan();
+
+    /**
+     * @brief Queues a velocity command. Safe from any thread.
+     * @param vx Forward velocity in m/s.
+     * @param vy Lateral velocity in m/s.
+     * @param omega Angular velocity in rad/s.
+     * @param source Identifier of the producer.
+     * @return True if the command was queued.
+     */
+    bool submitCommand(double vx, double vy, double omega, int source);
+
+    /**
+     * @brief Control stage: sends the newest queued command to the robot controller.
+     * Older queued commands are discarded, since only the latest velocity matters.
+     * @param command Receives the dispatched command (may be nullptr).
+     * @return True if a command was dispatched.
+     */
+    bool dispatchCommand(TimedCommand* command = nullptr);
+
+    /**
+     * @brief Returns the sensor -> mapper queue.
+     * @return Reference to the queue.
+     */
+    const SpscQueue& getMapQueue() const;
+
+    /**
+     * @brief Returns the mapper -> planner queue.
+     * @return Reference to the queue.
+     */
+    const SpscQueue& getPlanQueue() const;
+
+    /**
+     * @brief Returns the command queue.
+     * @return Reference to the queue.
+     */
+    const MpscQueue& getCommandQueue() const;
+
+    /**
+     * @brief Returns the number of scans currently available in the pool.
+     * @return The free scan count.
+     */
+    uint32_t getFreeScans() const;
+
+    /**
+     * @brief Returns the number of commands currently available in the pool.
+     * @return The free command count.
+     */
+    uint32_t getFreeCommands() const;
+
+    /**
+     * @brief Returns the number of sensor reads skipped because no scan was free.
+     * @return The exhaustion count.
+     */
+    unsigned long getScanPoolExhausted() const;
+
+    /**
+     * @brief Returns the number of commands lost to a full queue or an empty pool.
+     * @return The drop count.
+     */
+    unsigned long getCommandsDropped() const;
+
+    /**
+     * @brief Returns the number of commands superseded by a newer one before dispatch.
+     * @return The coalesce count.
+     */
+    unsigned long getCommandsCoalesced() const;
+
+    /**
+     * @brief Returns the number of commands sent to the robot.
+     * @return The dispatch count.
+     */
+    unsigned long getCommandsDispatched() const;
+
+    /**
+     * @brief Prints the stage and queue counters.
+     */
+    void printStats() const;
+};
+
+#endif // SCANPIPELINE_H
@@ -0,0 +1,137 @@
+/**
+ * @file ScanPipelineTest.cpp
+ * @brief Test application for the ScanPipeline class.
+ * @details Runs the sensor, mapper and planner stages on their own threads, lets the planner
+ * and a second producer submit commands, and checks that no pooled scan or command leaks.
+ * @date October, 2026
+ */
+
+#include "ScanPipeline.h"
+#include "RobotControler.h"
+#include "Mapper.h"
+#include "LidarSensor.h"
+#include "FestoRobotAPI.h"
+#include "Transform2D.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <thread>
+using namespace std;
+
+/**
+ * @brief Main function for testing the ScanPipeline class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    FestoRobotAPI* robotAPI = new FestoRobotAPI();
+    Pose* initialPose = new Pose(0.0, 0.0, 0.0);
+    RobotControler controller(initialPose, robotAPI); // Takes ownership of the pose and the API
+    LidarSensor lidar(robotAPI);
+    Mapper mapper(40, 40, 0.25, &controller, &lidar);
+
+    controller.connectRobot();
+
+    /**
+     * @test Test 1: A slow planner makes the drop-oldest queues discard stale scans, not leak them.
+     */
+    ScanPipeline pipeline(&lidar, &mapper, &controller, 2);
+    pipeline.setPlanner([](const LidarScan& scan, ScanPipeline& owner) {
+        assert(scan.rangeNumber > 0);
+        this_thread::sleep_for(chrono::milliseconds(20));
+        owner.submitCommand(0.1, 0.0, 0.0, 0);
+    });
+    uint32_t freeScans = pipeline.getFreeScans();
+
+    atomic<bool> running(true);
+    thread sensor([&]() {
+        while (running) {
+            pipeline.acquireScan();
+            this_thread::sleep_for(chrono::milliseconds(2));
+        }
+    });
+    thread mapping([&]() {
+        while (running) {
+            if (pipeline.mapScan() == 0) {
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+        }
+    });
+    thread planning([&]() {
+        while (running) {
+            if (pipeline.planScan() == 0) {
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+        }
+    });
+    thread teleop([&]() {
+        while (running) {
+            pipeline.submitCommand(0.0, 0.0, 0.1, 1);
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    });
+
+    TimedCommand dispatched;
+    for (int i = 0; i < 50; i++) {
+        pipeline.dispatchCommand(&dispatched);
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    running = false;
+    sensor.join();
+    mapping.join();
+    planning.join();
+    teleop.join();
+
+    pipeline.mapScan();
+    pipeline.planScan();
+    while (pipeline.dispatchCommand()) {}
+    pipeline.printStats();
+
+    unsigned long dropped = pipeline.getMapQueue().getDropped() + pipeline.getPlanQueue().getDropped();
+    assert(dropped > 0);
+    assert(pipeline.getScanPoolExhausted() == 0);
+    assert(pipeline.getFreeScans() == freeScans);
+    assert(pipeline.getCommandsDispatched() > 0);
+
+    /**
+     * @test Test 2: Only the newest command reaches the robot; older ones are coalesced.
+     */
+    pipeline.submitCommand(0.1, 0.0, 0.0, 0);
+    pipeline.submitCommand(0.2, 0.0, 0.0, 0);
+    pipeline.submitCommand(0.0, 0.0, 0.0, 2);
+    unsigned long coalesced = pipeline.getCommandsCoalesced();
+    assert(pipeline.dispatchCommand(&dispatched));
+    assert(dispatched.source == 2 && dispatched.command.vx == 0.0);
+    assert(pipeline.getCommandsCoalesced() == coalesced + 2);
+    assert(!pipeline.dispatchCommand());
+
+    /**
+     * @test Test 3: With REJECT, scans that do not fit are returned to the pool immediately.
+     */
+    ScanPipeline rejecting(&lidar, nullptr, nullptr, 2, REJECT, REJECT);
+    uint32_t rejectingFree = rejecting.getFreeScans();
+    int queued = 0;
+    for (int i = 0; i < 5; i++) {
+        queued += rejecting.acquireScan() ? 1 : 0;
+    }
+    assert(queued == 2 && rejecting.getMapQueue().getRejected() == 3);
+    assert(rejecting.getFreeScans() == rejectingFree - 2);
+
+    /**
+     * @test Test 4: A pooled scan is mapped with its heading in radians, as LidarScan documents.
+     */
+    static LidarScan turned; // Too large for the stack of some platforms
+    turned.timestamp = 0.0;
+    turned.pose = Pose(5.1, 5.1, SE2_PI / 2.0);
+    turned.angleMin = 0.0;
+    turned.angleIncrement = 1.0;
+    turned.rangeNumber = 1;
+    turned.ranges[0] = 2.0f;
+    Mapper turnedMap(40, 40, 0.25, nullptr, nullptr);
+    turnedMap.updateMap(turned);
+    assert(turnedMap.getMap().getGrid(20, 28) == Map::CELL_OCCUPIED); // (5.1 m, 7.1 m), straight ahead of the robot
+
+    controller.disconnectRobot();
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file ScanSegmenter.cpp
+ * @brief Implementation of the ScanSegmenter class.
+ * @date October 2026
+ */
+
+#include "ScanSegmenter.h"
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * @struct ClusterSums
+ * @brief Running totals of the cluster being grown.
+ */
+struct ClusterSums {
+    int firstBeam;       /**< First beam, or -1 if no cluster is open. */
+    int lastBeam;        /**< Last beam added. */
+    int count;           /**< Beams added. */
+    double sumX;         /**< Sum of the x coordinates. */
+    double sumY;         /**< Sum of the y coordinates. */
+    float minX, minY;    /**< Smallest coordinates. */
+    float maxX, maxY;    /**< Largest coordinates. */
+    float firstX, firstY; /**< First point. */
+    float lastX, lastY;  /**< Last point. */
+    int closestBeam;     /**< Beam with the shortest range. */
+    float closestRange;  /**< Shortest range. */
+    float closestX, closestY; /**< Closest point. */
+};
+
+/**
+ * @brief Constructor for the ScanSegmenter class.
+ * @param maxClusters Number of clusters a scan can produce; further ones are dropped.
+ * @param lambdaDegrees Shallowest incidence angle of a continuous surface, in degrees.
+ * @param rangeSigma Range noise of the sensor, in meters.
+ * @param minimumPoints Clusters with fewer beams are discarded as noise.
+ */
+ScanSegmenter::ScanSegmenter(size_t maxClusters, double lambdaDegrees, float rangeSigma, int minimumPoints)
+    : clusters(maxClusters), clusterCount(0), droppedClusters(0), lambda(degToRad(lambdaDegrees)),
+      sigma(rangeSigma), minPoints(minimumPoints > 1 ? minimumPoints : 1), layoutAngleMin(0.0), layoutIncrement(0.0) {}
+
+/**
+ * @brief Segments a scan.
+ *
+ * One pass over the beams: each valid beam is turned into a point with the cached sine and cosine
+ * of its angle and either added to the open cluster or, at a breakpoint, starts a new one. The
+ * squared distance between neighbouring points follows from their ranges and the constant angle
+ * between them, so the breakpoint test needs no square root.
+ *
+ * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees.
+ * @param angleIncrement Angle between beams in degrees.
+ * @param frame Frame the clusters are given in.
+ * @return The number of clusters.
+ */
+size_t ScanSegmenter::segment(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+    const Transform2D& frame) {
+    clusterCount = 0;
+    droppedClusters = 0;
+    if (rangeCount <= 0) {
+        return 0;
+    }
+    if (beamCos.size() != static_cast<size_t>(rangeCount) || angleMin != layoutAngleMin
+        || angleIncrement != layoutIncrement) {
+        beamCos.resize(rangeCount);
+        beamSin.resize(rangeCount);
+        pointX.resize(rangeCount);
+        pointY.resize(rangeCount);
+        for (int i = 0; i < rangeCount; i++) {
+            double angle = degToRad(angleMin + i * angleIncrement);
+            beamCos[i] = static_cast<float>(cos(angle));
+            beamSin[i] = static_cast<float>(sin(angle));
+        }
+        layoutAngleMin = angleMin;
+        layoutIncrement = angleIncrement;
+    }
+
+    const double step = fabs(degToRad(angleIncrement));
+    const float cosStep = static_cast<float>(cos(step));
+    const float slope = lambda > step ? static_cast<float>(sin(step) / sin(lambda - step)) : FLT_MAX;
+    const float noise = 3.0f * sigma;
+    const float fc = static_cast<float>(frame.getCos());
+    const float fs = static_cast<float>(frame.getSin());
+    const float tx = static_cast<float>(frame.getX());
+    const float ty = static_cast<float>(frame.getY());
+
+    ClusterSums open = ClusterSums();
+    open.firstBeam = -1;
+    float previousRange = 0.0f;
+    for (int i = 0; i <= rangeCount; i++) {
+        float r = i < rangeCount ? ranges[i] : 0.0f; // A sentinel closes the last cluster
+        bool valid = r > 0.0f;
+        if (open.firstBeam >= 0) {
+            bool joined = false;
+            if (valid) {
+                float limit = previousRange * slope + noise;
+                float squared = previousRange * previousRange + r * r - 2.0f * previousRange * r * cosStep;
+                joined = squared <= limit * limit;
+            }
+            if (!joined) {
+                if (open.count >= minPoints) {
+                    if (clusterCount < clusters.size()) {
+                        ScanCluster& c = clusters[clusterCount++];
+                        c.firstBeam = open.firstBeam;
+                        c.lastBeam = open.lastBeam;
+                        c.pointCount = open.count;
+                        c.centroidX = static_cast<float>(open.sumX / open.count);
+                        c.centroidY = static_cast<float>(open.sumY / open.count);
+                        c.minX = open.minX;
+                        c.minY = open.minY;
+                        c.maxX = open.maxX;
+                        c.maxY = open.maxY;
+                        c.width = sqrt((open.lastX - open.firstX) * (open.lastX - open.firstX)
+                            + (open.lastY - open.firstY) * (open.lastY - open.firstY));
+                        c.closestBeam = open.closestBeam;
+                        c.closestRange = open.closestRange;
+                        c.closestX = open.closestX;
+                        c.closestY = open.closestY;
+                    }
+                    else {
+                        droppedClusters++;
+                    }
+                }
+                open.firstBeam = -1;
+            }
+        }
+        if (!valid) {
+            continue;
+        }
+
+        float sx = r * beamCos[i];
+        float sy = r * beamSin[i];
+        float x = tx + fc * sx - fs * sy;
+        float y = ty + fs * sx + fc * sy;
+        pointX[i] = x;
+        pointY[i] = y;
+        if (open.firstBeam < 0) {
+            open.firstBeam = i;
+            open.count = 0;
+            open.sumX = open.sumY = 0.0;
+            open.minX = open.maxX = open.firstX = x;
+            open.minY = open.maxY = open.firstY = y;
+            open.closestRange = FLT_MAX;
+        }
+        open.lastBeam = i;
+        open.count++;
+        open.sumX += x;
+        open.sumY += y;
+        open.minX = x < open.minX ? x : open.minX;
+        open.minY = y < open.minY ? y : open.minY;
+        open.maxX = x > open.maxX ? x : open.maxX;
+        open.maxY = y > open.maxY ? y : open.maxY;
+        open.lastX = x;
+        open.lastY = y;
+        if (r < open.closestRange) {
+            open.closestBeam = i;
+            open.closestRange = r;
+            open.closestX = x;
+            open.closestY = y;
+        }
+        previousRange = r;
+    }
+    return clusterCount;
+}
+
+/**
+ * @brief Segments a pooled scan in the world frame given by its pose.
+ * @param scan The scan.
+ * @return The number of clusters.
+ */
+size_t ScanSegmenter::segment(const LidarScan& scan) {
+    return segment(scan.ranges, scan.rangeNumber, scan.angleMin, scan.angleIncrement, Transform2D(scan.pose));
+}
+
+/**
+ * @brief Segments the current scan of a Lidar sensor.
+ * @param lidar The sensor.
+ * @param frame Frame the clusters are given in.
+ * @return The number of clusters.
+ */
+size_t ScanSegmenter::segment(const LidarSensor& lidar, const Transform2D& frame) {
+    int rangeCount = lidar.getRangeNum();
+    if (rangeCount <= 0) {
+        clusterCount = 0;
+        droppedClusters = 0;
+        return 0;
+    }
+    sensorRanges.resize(rangeCount);
+    rangeCount = lidar.copyRanges(&sensorRanges[0], rangeCount);
+    double increment = rangeCount > 1 ? lidar.getAngle(1) - lidar.getAngle(0) : 0.0;
+    return segment(&sensorRanges[0], rangeCount, lidar.getAngle(0), increment, frame);
+}
+
+/**
+ * @brief Returns the number of clusters of the last scan.
+ * @return The number of clusters.
+ */
+size_t ScanSegmenter::getClusterCount() const {
+    return clusterCount;
+}
+
+/**
+ * @brief Returns a cluster of the last scan.
+ * @param index Index of the cluster, less than getClusterCount().
+ * @return The cluster.
+ */
+const ScanCluster& ScanSegmenter::getCluster(size_t index) const {
+    return clusters[index];
+}
+
+/**
+ * @brief Returns the clusters of the last scan.
+ * @return Pointer to getClusterCount() clusters.
+ */
+const ScanCluster* ScanSegmenter::getClusters() const {
+    return clusters.empty() ? nullptr : &clusters[0];
+}
+
+/**
+ * @brief Returns the points of the last scan, indexed by beam, in the frame given to segment().
+ * @return Pointer to one x per beam; only beams with a return hold a point.
+ */
+const float* ScanSegmenter::getPointsX() const {
+    return pointX.empty() ? nullptr : &pointX[0];
+}
+
+/**
+ * @brief Returns the points of the last scan, indexed by beam, in the frame given to segment().
+ * @return Pointer to one y per beam; only beams with a return hold a point.
+ */
+const float* ScanSegmenter::getPointsY() const {
+    return pointY.empty() ? nullptr : &pointY[0];
+}
+
+/**
+ * @brief Returns the number of clusters of the last scan that did not fit in the array.
+ * @return The number of dropped clusters.
+ */
+unsigned long ScanSegmenter::getDroppedClusters() const {
+    return droppedClusters;
+}
+
+/**
+ * @brief Returns the index of the cluster whose closest point is nearest to the sensor.
+ * @return The index, or -1 if the last scan has no clusters.
+ */
+long ScanSegmenter::findNearestCluster() const {
+    long nearest = -1;
+    for (size_t i = 0; i < clusterCount; i++) {
+        if (nearest < 0 || clusters[i].closestRange < clusters[nearest].closestRange) {
+            nearest = static_cast<long>(i);
+        }
+    }
+    return nearest;
+}
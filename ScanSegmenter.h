@@ -0,0 +1,156 @@
+/**
+ * @file ScanSegmenter.h
+ * @brief Declaration of the ScanSegmenter class, which splits Lidar scans into obstacle clusters.
+ * @date October 2026
+ */
+
+#ifndef SCANSEGMENTER_H
+#define SCANSEGMENTER_H
+
+#include "LidarScan.h"
+#include "LidarSensor.h"
+#include "Transform2D.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct ScanCluster
+ * @brief A group of neighbouring beams that hit the same object.
+ *
+ * Coordinates are in meters, in the frame given to ScanSegmenter::segment().
+ */
+struct ScanCluster {
+    int firstBeam;       /**< Index of the first beam. */
+    int lastBeam;        /**< Index of the last beam. */
+    int pointCount;      /**< Number of beams in the cluster. */
+    float centroidX;     /**< Mean x of the points. */
+    float centroidY;     /**< Mean y of the points. */
+    float minX;          /**< Smallest x of the points. */
+    float minY;          /**< Smallest y of the points. */
+    float maxX;          /**< Largest x of the points. */
+    float maxY;          /**< Largest y of the points. */
+    float width;         /**< Distance between the first and the last point. */
+    int closestBeam;     /**< Index of the beam with the shortest range. */
+    float closestRange;  /**< Shortest range, measured from the sensor. */
+    float closestX;      /**< X of the closest point. */
+    float closestY;      /**< Y of the closest point. */
+};
+
+/**
+ * @class ScanSegmenter
+ * @brief Groups the beams of a scan into clusters, one per object, in a single pass.
+ *
+ * Two neighbouring beams belong to the same cluster unless a beam has no valid return (a range
+ * of 0 or less, as left by ScanFilter) or the distance between their points exceeds the adaptive
+ * breakpoint threshold of Borges and Aldon:
+ *
+ *     D = r * sin(dPhi) / sin(lambda - dPhi) + 3 * sigma
+ *
+ * where r is the range of the earlier beam, dPhi the angle between beams, lambda the shallowest
+ * incidence angle at which a surface still counts as continuous and sigma the range noise. The
+ * threshold grows with the range, so a wall far away is not cut into pieces while two objects
+ * close by are still told apart.
+ *
+ * Clusters are written to an array allocated in the constructor; segment() does not allocate
+ * unless the beam layout changes.
+ */
+class ScanSegmenter {
+private:
+    std::vector<ScanCluster> clusters;  /**< Clusters of the last scan; only the first clusterCount are valid. */
+    size_t clusterCount;                /**< Number of clusters of the last scan. */
+    unsigned long droppedClusters;      /**< Clusters of the last scan that did not fit in the array. */
+    double lambda;                      /**< Shallowest incidence angle of a continuous surface, in radians. */
+    float sigma;                        /**< Range noise, in meters. */
+    int minPoints;                      /**< Clusters with fewer beams are discarded as noise. */
+    std::vector<float> beamCos;         /**< Cosine of each beam angle of the current layout. */
+    std::vector<float> beamSin;         /**< Sine of each beam angle of the current layout. */
+    std::vector<float> pointX;          /**< X of each beam's point in the last scan, in the output frame. */
+    std::vector<float> pointY;          /**< Y of each beam's point in the last scan, in the output frame. */
+    double layoutAngleMin;              /**< First beam angle the tables were built for, in degrees. */
+    double layoutIncrement;             /**< Beam increment the tables were built for, in degrees. */
+    std::vector<float> sensorRanges;    /**< Copy of the Lidar ranges for segment(const LidarSensor&). */
+
+public:
+    /**
+     * @brief Constructor for the ScanSegmenter class.
+     * @param maxClusters Number of clusters a scan can produce; further ones are dropped.
+     * @param lambdaDegrees Shallowest incidence angle of a continuous surface, in degrees.
+     * @param rangeSigma Range noise of the sensor, in meters.
+     * @param minimumPoints Clusters with fewer beams are discarded as noise.
+     */
+    explicit ScanSegmenter(size_t maxClusters = 128, double lambdaDegrees = 10.0, float rangeSigma = 0.01f,
+        int minimumPoints = 3);
+
+    /**
+     * @brief Segments a scan.
+     * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+     * @param rangeCount Number of ranges.
+     * @param angleMin Angle of the first beam in degrees.
+     * @param angleIncrement Angle between beams in degrees.
+     * @param frame Frame the clusters are given in: the sensor pose for world coordinates, or the
+     *        identity for sensor coordinates.
+     * @return The number of clusters.
+     */
+    size_t segment(const float* ranges, int rangeCount, double angleMin, double angleIncrement,
+        const Transform2D& frame = Transform2D());
+
+    /**
+     * @brief Segments a pooled scan in the world frame given by its pose.
+     * @param scan The scan.
+     * @return The number of clusters.
+     */
+    size_t segment(const LidarScan& scan);
+
+    /**
+     * @brief Segments the current scan of a Lidar sensor.
+     * @param lidar The sensor.
+     * @param frame Frame the clusters are given in.
+     * @return The number of clusters.
+     */
+    size_t segment(const LidarSensor& lidar, const Transform2D& frame = Transform2D());
+
+    /**
+     * @brief Returns the number of clusters of the last scan.
+     * @return The number of clusters.
+     */
+    size_t getClusterCount() const;
+
+    /**
+     * @brief Returns a cluster of the last scan.
+     * @param index Index of the cluster, less than getClusterCount(); clusters are ordered by beam.
+     * @return The cluster.
+     */
+    const ScanCluster& getCluster(size_t index) const;
+
+    /**
+     * @brief Returns the clusters of the last scan.
+     * @return Pointer to getClusterCount() clusters.
+     */
+    const ScanCluster* getClusters() const;
+
+    /**
+     * @brief Returns the points of the last scan, indexed by beam, in the frame given to segment().
+     * @return Pointer to one x per beam; only beams with a return hold a point.
+     */
+    const float* getPointsX() const;
+
+    /**
+     * @brief Returns the points of the last scan, indexed by beam, in the frame given to segment().
+     * @return Pointer to one y per beam; only beams with a return hold a point.
+     */
+    const float* getPointsY() const;
+
+    /**
+     * @brief Returns the number of clusters of the last scan that did not fit in the array.
+     * @return The number of dropped clusters.
+     */
+    unsigned long getDroppedClusters() const;
+
+    /**
+     * @brief Returns the index of the cluster whose closest point is nearest to the sensor.
+     * @return The index, or -1 if the last scan has no clusters.
+     */
+    long findNearestCluster() const;
+};
+
+#endif // SCANSEGMENTER_H
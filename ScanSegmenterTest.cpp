@@ -0,0 +1,238 @@
+/**
+ * @file ScanSegmenterTest.cpp
+ * @brief Test and benchmark application for the ScanSegmenter class.
+ * @details Segments simulated scans of walls and posts, checks the cluster statistics against
+ * values recomputed from the beams, the adaptive breakpoint threshold, the handling of missing
+ * returns, the output frames and the cluster capacity, and measures the time per scan.
+ * @date October, 2026
+ */
+
+#include "ScanSegmenter.h"
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+const int BEAMS = 667;              /**< Beams per simulated scan. */
+const double ANGLE_MIN = -120.0;    /**< Angle of the first beam in degrees. */
+const double INCREMENT = 0.36;      /**< Angle between beams in degrees. */
+
+/**
+ * @struct Post
+ * @brief A round obstacle.
+ */
+struct Post {
+    double x, y, radius;
+};
+
+/**
+ * @struct Wall
+ * @brief A straight obstacle from (x0, y0) to (x1, y1).
+ */
+struct Wall {
+    double x0, y0, x1, y1;
+};
+
+/**
+ * @brief Simulates a scan from the origin; beams that hit nothing within 5.6 m return 0.
+ * @param posts Round obstacles.
+ * @param walls Straight obstacles.
+ * @return The ranges.
+ */
+vector<float> simulate(const vector<Post>& posts, const vector<Wall>& walls) {
+    vector<float> ranges(BEAMS);
+    for (int i = 0; i < BEAMS; i++) {
+        double angle = degToRad(ANGLE_MIN + i * INCREMENT);
+        double dx = cos(angle), dy = sin(angle), best = 5.6;
+        for (const Post& p : posts) {
+            double along = p.x * dx + p.y * dy;
+            double across = p.x * dy - p.y * dx;
+            if (along > 0.0 && fabs(across) < p.radius) {
+                double t = along - sqrt(p.radius * p.radius - across * across);
+                best = t < best ? t : best;
+            }
+        }
+        for (const Wall& w : walls) {
+            double ex = w.x1 - w.x0, ey = w.y1 - w.y0;
+            double denominator = dx * ey - dy * ex;
+            if (fabs(denominator) > 1e-12) {
+                double t = (w.x0 * ey - w.y0 * ex) / denominator;
+                double u = (w.x0 * dy - w.y0 * dx) / denominator;
+                if (t > 0.0 && u >= 0.0 && u <= 1.0) {
+                    best = t < best ? t : best;
+                }
+            }
+        }
+        ranges[i] = best < 5.6 ? static_cast<float>(best) : 0.0f;
+    }
+    return ranges;
+}
+
+/**
+ * @brief Recomputes the statistics of a cluster from its beams and compares them.
+ * @param c The cluster.
+ * @param ranges The ranges of the scan.
+ * @param frame The frame the cluster is given in.
+ */
+void checkCluster(const ScanCluster& c, const vector<float>& ranges, const Transform2D& frame) {
+    double sumX = 0.0, sumY = 0.0, minX = 1e9, minY = 1e9, maxX = -1e9, maxY = -1e9, closest = 1e9;
+    double firstX = 0.0, firstY = 0.0, lastX = 0.0, lastY = 0.0, closestX = 0.0, closestY = 0.0;
+    int closestBeam = -1;
+    for (int i = c.firstBeam; i <= c.lastBeam; i++) {
+        assert(ranges[i] > 0.0f);
+        double angle = degToRad(ANGLE_MIN + i * INCREMENT), x, y;
+        frame.apply(ranges[i] * cos(angle), ranges[i] * sin(angle), x, y);
+        sumX += x;
+        sumY += y;
+        minX = x < minX ? x : minX;
+        minY = y < minY ? y : minY;
+        maxX = x > maxX ? x : maxX;
+        maxY = y > maxY ? y : maxY;
+        if (i == c.firstBeam) {
+            firstX = x;
+            firstY = y;
+        }
+        lastX = x;
+        lastY = y;
+        if (ranges[i] < closest) {
+            closest = ranges[i];
+            closestBeam = i;
+            closestX = x;
+            closestY = y;
+        }
+    }
+    assert(c.closestBeam == closestBeam && fabs(c.closestX - closestX) < 1e-4 && fabs(c.closestY - closestY) < 1e-4);
+    assert(c.pointCount == c.lastBeam - c.firstBeam + 1);
+    assert(fabs(c.centroidX - sumX / c.pointCount) < 1e-4 && fabs(c.centroidY - sumY / c.pointCount) < 1e-4);
+    assert(fabs(c.minX - minX) < 1e-4 && fabs(c.minY - minY) < 1e-4);
+    assert(fabs(c.maxX - maxX) < 1e-4 && fabs(c.maxY - maxY) < 1e-4);
+    assert(fabs(c.width - hypot(lastX - firstX, lastY - firstY)) < 1e-4);
+    assert(c.closestRange == static_cast<float>(closest));
+}
+
+/**
+ * @brief Main function for testing the scan segmenter.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: Two posts in front of a wall give five clusters: the posts and three pieces of wall.
+     */
+    vector<Post> posts = { { 1.5, 0.5, 0.1 }, { 1.5, -0.8, 0.1 } };
+    vector<Wall> walls = { { 3.0, -2.0, 3.0, 2.0 } };
+    vector<float> ranges = simulate(posts, walls);
+    ScanSegmenter segmenter;
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 5);
+    int postClusters = 0;
+    for (size_t i = 0; i < segmenter.getClusterCount(); i++) {
+        const ScanCluster& c = segmenter.getCluster(i);
+        checkCluster(c, ranges, Transform2D());
+        for (const Post& p : posts) {
+            if (hypot(c.centroidX - p.x, c.centroidY - p.y) < p.radius) {
+                postClusters++;
+                assert(fabs(c.closestRange - (hypot(p.x, p.y) - p.radius)) < 2e-3);
+                assert(c.width < 2.0 * p.radius + 1e-3);
+            }
+        }
+        assert(i == 0 || c.firstBeam > segmenter.getCluster(i - 1).lastBeam); // Ordered by beam
+    }
+    assert(postClusters == 2);
+    long nearest = segmenter.findNearestCluster();
+    assert(nearest >= 0 && fabs(segmenter.getCluster(nearest).centroidY - 0.5) < 0.1);
+
+    /**
+     * @test Test 2: The adaptive threshold keeps an oblique wall whole but separates objects close by.
+     */
+    vector<Wall> corridor = { { 0.3, 1.0, 5.0, 1.0 } }; // Seen at incidence angles from 73 down to 11 degrees
+    ranges = simulate(vector<Post>(), corridor);
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 1);
+    checkCluster(segmenter.getCluster(0), ranges, Transform2D());
+    vector<Wall> gap = { { 1.0, -1.0, 1.0, -0.05 }, { 1.0, 0.05, 1.0, 1.0 } }; // Ten centimeter doorway
+    ranges = simulate(vector<Post>(), gap);
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 2);
+    vector<Post> pair = { { 1.0, 0.0, 0.1 }, { 1.3, 0.12, 0.1 } }; // One partly behind the other, 12 cm apart
+    ranges = simulate(pair, vector<Wall>());
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 2);
+
+    /**
+     * @test Test 3: Missing returns split clusters and clusters below the minimum size are discarded.
+     */
+    ranges = simulate(vector<Post>(), walls);
+    size_t whole = segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+    assert(whole == 1);
+    int middle = (segmenter.getCluster(0).firstBeam + segmenter.getCluster(0).lastBeam) / 2;
+    ranges[middle] = 0.0f;
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 2);
+    assert(segmenter.getCluster(0).lastBeam == middle - 1 && segmenter.getCluster(1).firstBeam == middle + 1);
+    ranges[middle + 2] = 0.0f; // Leaves a single beam between two gaps
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 2);
+    ranges.assign(BEAMS, 0.0f);
+    ranges[10] = ranges[11] = 2.0f;
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 0);
+    assert(segmenter.findNearestCluster() == -1);
+    ScanSegmenter sensitive(16, 10.0, 0.01f, 1);
+    assert(sensitive.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 1);
+
+    /**
+     * @test Test 4: Clusters in a given frame match the sensor-frame clusters moved into that frame.
+     */
+    ranges = simulate(posts, walls);
+    Pose robot(4.0, -2.0, degToRad(35.0));
+    Transform2D frame(robot);
+    segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT);
+    vector<ScanCluster> local(segmenter.getClusters(), segmenter.getClusters() + segmenter.getClusterCount());
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT, frame) == local.size());
+    for (size_t i = 0; i < local.size(); i++) {
+        const ScanCluster& c = segmenter.getCluster(i);
+        checkCluster(c, ranges, frame);
+        double x, y;
+        frame.apply(local[i].centroidX, local[i].centroidY, x, y);
+        assert(fabs(c.centroidX - x) < 1e-4 && fabs(c.centroidY - y) < 1e-4);
+        assert(c.closestRange == local[i].closestRange && fabs(c.width - local[i].width) < 1e-4);
+    }
+    LidarScan scan;
+    scan.pose = robot;
+    scan.angleMin = ANGLE_MIN;
+    scan.angleIncrement = INCREMENT;
+    scan.rangeNumber = BEAMS;
+    copy(ranges.begin(), ranges.end(), scan.ranges);
+    assert(segmenter.segment(scan) == local.size());
+    for (size_t i = 0; i < segmenter.getClusterCount(); i++) {
+        checkCluster(segmenter.getCluster(i), ranges, frame);
+    }
+
+    /**
+     * @test Test 5: Clusters beyond the capacity are counted as dropped.
+     */
+    vector<Post> fence;
+    for (int k = 0; k < 10; k++) {
+        fence.push_back(Post{ 2.0, -2.0 + 0.4 * k, 0.08 });
+    }
+    ranges = simulate(fence, vector<Wall>());
+    ScanSegmenter small(4);
+    assert(small.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 4 && small.getDroppedClusters() == 6);
+    assert(segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT) == 10 && segmenter.getDroppedClusters() == 0);
+
+    /**
+     * @test Test 6: Time per scan of the single pass.
+     */
+    ranges = simulate(posts, walls);
+    const int scans = 20000;
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        ranges[s % BEAMS] += 1e-6f;
+        checksum += segmenter.segment(&ranges[0], BEAMS, ANGLE_MIN, INCREMENT, frame);
+        checksum += segmenter.getCluster(0).centroidX;
+    }
+    double perScanUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / scans;
+    cout << "Segmentation, " << BEAMS << " beams: " << perScanUs << " us/scan" << endl;
+    volatile double sink = checksum; // Keeps the timed loop from being optimized away
+    (void)sink;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
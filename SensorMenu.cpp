@@ -1,6 +1,7 @@
 ﻿#include <iostream>
 #include <iomanip>
 #include "SensorMenu.h"
+#include "Transform2D.h"
 using namespace std;
 
 /**
@@ -52,12 +53,13 @@ void SensorMenu::showMenu() {
         cout << "1. Display Pose\n";
         cout << "2. Display IR Sensor Data\n";
         cout << "3. Display Lidar Sensor Data\n";
-        cout << "4. Back to Main Menu\n";
+        cout << "4. Display Obstacles\n";
+        cout << "5. Back to Main Menu\n";
         cout << "Enter your choice: ";
         cin >> sensorChoice;
 
         handleChoice(); // Handle user choice
-    } while (sensorChoice != 4);
+    } while (sensorChoice != 5);
 }
 
 // Handle user choice
@@ -83,6 +85,9 @@ void SensorMenu::handleChoice() {
         displayLidarSensorData();
         break;
     case 4:
+        displayObstacles();
+        break;
+    case 5:
         cout << "Returning to main menu...\n";
         break;
     default:
@@ -107,7 +112,7 @@ void SensorMenu::displayPose() {
     cout << "\nRobot Pose:\n";
     cout << "X: " << robotPose.getX() << " meters\n";
     cout << "Y: " << robotPose.getY() << " meters\n";
-    cout << "Theta: " << robotPose.getTh() << " degrees\n";
+    cout << "Theta: " << radToDeg(robotPose.getTh()) << " degrees\n";
 }
 
 // Display IR sensor data
@@ -150,4 +155,29 @@ void SensorMenu::displayLidarSensorData() {
     double minRange = lidarSensor->getMin(minIndex);
     cout << "\nMaximum Range: " << maxRange << " meters at index " << maxIndex << "\n";
     cout << "Minimum Range: " << minRange << " meters at index " << minIndex << "\n";
+}
+
+// Display the obstacles seen by the Lidar sensor
+/**
+ * @brief Displays the obstacles seen by the Lidar sensor.
+ *
+ * Updates the Lidar sensor, groups the ranges into clusters of neighbouring beams
+ * and prints the centroid, width and closest distance of each cluster.
+ */
+void SensorMenu::displayObstacles() {
+    lidarSensor->update(); // Update sensor data
+    size_t count = segmenter.segment(*lidarSensor);
+    if (count == 0) {
+        cout << "\nNo obstacles detected.\n";
+        return;
+    }
+
+    cout << fixed << setprecision(2);
+    cout << "\nObstacles (robot frame):\n";
+    for (size_t i = 0; i < count; i++) {
+        const ScanCluster& obstacle = segmenter.getCluster(i);
+        cout << "Obstacle " << i << ": center (" << obstacle.centroidX << ", " << obstacle.centroidY
+            << ") meters, width " << obstacle.width << " meters, closest " << obstacle.closestRange
+            << " meters at " << lidarSensor->getAngle(obstacle.closestBeam) << " degrees\n";
+    }
 }
\ No newline at end of file
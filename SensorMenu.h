@@ -4,6 +4,7 @@
 #include "FestoRobotAPI.h"
 #include "IRSensor.h"
 #include "LidarSensor.h"
+#include "ScanSegmenter.h"
 #include "Pose.h"
 #include "RobotControler.h"
 
@@ -26,6 +27,7 @@ private:
     Pose robotPose;                 /**< Object representing the robot's current position (x, y, theta). */
     int sensorChoice;               /**< Variable to store the user's menu selection. */
     RobotControler* Control;        /**< Pointer to the robot controller for managing robot states. */
+    ScanSegmenter segmenter;        /**< Groups the Lidar ranges into obstacles for displayObstacles(). */
 
     /**
      * @brief Displays the robot's current position.
@@ -49,6 +51,14 @@ private:
      */
     void displayLidarSensorData();
 
+    /**
+     * @brief Displays the obstacles seen by the Lidar sensor.
+     *
+     * This function segments the current Lidar scan into clusters and prints
+     * the position, size and distance of each one.
+     */
+    void displayObstacles();
+
     /**
      * @brief Handles the user's menu selection.
      *
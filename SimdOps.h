@@ -0,0 +1,100 @@
+/**
+ * @file SimdOps.h
+ * @brief Thin wrapper over the x86 vector instructions used by the batch kernels.
+ * @date October 2026
+ *
+ * SimdOps names the float operations the kernels need, so one kernel body compiles to AVX2
+ * (/arch:AVX2, -mavx2) or SSE2 (every other x86 target). SIMD_OPS_VECTOR is defined when one
+ * of them is available; otherwise, or when SIMD_OPS_SCALAR is defined (e.g. to test the
+ * fallback on x86), the kernels use their plain loops. minimum() and maximum() are not called
+ * min() and max() because windows.h defines macros of those names.
+ */
+
+#ifndef SIMDOPS_H
+#define SIMDOPS_H
+
+#if defined(SIMD_OPS_SCALAR)
+// Plain loops were requested
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD_OPS_AVX2
+#define SIMD_OPS_VECTOR
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_OPS_SSE2
+#define SIMD_OPS_VECTOR
+#endif
+
+#if defined(SIMD_OPS_AVX2)
+
+/**
+ * @struct SimdOps
+ * @brief Eight float lanes on AVX2.
+ */
+struct SimdOps {
+    typedef __m256 V; ///< Vector of floats.
+    enum { WIDTH = 8 /**< Lanes per vector. */ };
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static V set(float f) { return _mm256_set1_ps(f); }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V div(V a, V b) { return _mm256_div_ps(a, b); }
+    static V sqrt(V a) { return _mm256_sqrt_ps(a); }
+    static V minimum(V a, V b) { return _mm256_min_ps(a, b); }
+    static V maximum(V a, V b) { return _mm256_max_ps(a, b); }
+    static V bitAnd(V a, V b) { return _mm256_and_ps(a, b); }
+    static V bitAndNot(V a, V b) { return _mm256_andnot_ps(a, b); }
+    static V bitXor(V a, V b) { return _mm256_xor_ps(a, b); }
+    static V less(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static V greaterEqual(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static V select(V mask, V a, V b) { return _mm256_blendv_ps(b, a, mask); }
+    static V signMask(V a) { return _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(a), 31)); }
+};
+
+#elif defined(SIMD_OPS_SSE2)
+
+/**
+ * @struct SimdOps
+ * @brief Four float lanes on SSE2.
+ */
+struct SimdOps {
+    typedef __m128 V; ///< Vector of floats.
+    enum { WIDTH = 4 /**< Lanes per vector. */ };
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static V set(float f) { return _mm_set1_ps(f); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V div(V a, V b) { return _mm_div_ps(a, b); }
+    static V sqrt(V a) { return _mm_sqrt_ps(a); }
+    static V minimum(V a, V b) { return _mm_min_ps(a, b); }
+    static V maximum(V a, V b) { return _mm_max_ps(a, b); }
+    static V bitAnd(V a, V b) { return _mm_and_ps(a, b); }
+    static V bitAndNot(V a, V b) { return _mm_andnot_ps(a, b); }
+    static V bitXor(V a, V b) { return _mm_xor_ps(a, b); }
+    static V less(V a, V b) { return _mm_cmplt_ps(a, b); }
+    static V greaterEqual(V a, V b) { return _mm_cmpge_ps(a, b); }
+    static V select(V mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    static V signMask(V a) { return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(a), 31)); }
+};
+
+#endif
+
+/**
+ * @brief Returns the instruction set SimdOps was compiled for.
+ * @return "AVX2", "SSE2" or "scalar".
+ */
+inline const char* simdOpsBackend() {
+#if defined(SIMD_OPS_AVX2)
+    return "AVX2";
+#elif defined(SIMD_OPS_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+#endif // SIMDOPS_H
@@ -0,0 +1,132 @@
+/**
+ * @file SpscQueue.cpp
+ * @brief Implementation of the SpscQueue class.
+ * @date October 2026
+ */
+
+#include "SpscQueue.h"
+#include <thread>
+using namespace std;
+
+/**
+ * @brief Constructor for the SpscQueue class. All storage is allocated here.
+ * @param capacity Minimum capacity; rounded up to a power of two.
+ * @param policy Behaviour when the queue is full.
+ */
+SpscQueue::SpscQueue(uint32_t capacity, BackpressurePolicy policy)
+    : policy(policy), head(0), tail(0), pushed(0), popped(0), dropped(0), rejected(0) {
+    uint64_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    slots = vector<atomic<uint32_t> >(static_cast<size_t>(size));
+    mask = size - 1;
+}
+
+/**
+ * @brief Queues an index. Producer thread only.
+ * @param index The index to queue.
+ * @param evicted Receives the evicted index when the result is PUSH_EVICTED (may be nullptr).
+ * @return The outcome of the push.
+ */
+PushResult SpscQueue::push(uint32_t index, uint32_t* evicted) {
+    const uint64_t t = tail.load(memory_order_relaxed);
+    PushResult result = PUSH_OK;
+    while (true) {
+        uint64_t h = head.load(memory_order_acquire);
+        if (t - h <= mask) {
+            break;
+        }
+        if (policy == REJECT) {
+            rejected.fetch_add(1, memory_order_relaxed);
+            return PUSH_REJECTED;
+        }
+        if (policy == BLOCK) {
+            this_thread::yield();
+            continue;
+        }
+        // DROP_OLDEST: claim the oldest slot exactly like the consumer would.
+        uint32_t victim = slots[h & mask].load(memory_order_relaxed);
+        if (head.compare_exchange_strong(h, h + 1, memory_order_acq_rel)) {
+            if (evicted) {
+                *evicted = victim;
+            }
+            dropped.fetch_add(1, memory_order_relaxed);
+            result = PUSH_EVICTED;
+            break;
+        }
+    }
+    slots[t & mask].store(index, memory_order_relaxed);
+    tail.store(t + 1, memory_order_release);
+    pushed.fetch_add(1, memory_order_relaxed);
+    return result;
+}
+
+/**
+ * @brief Removes the oldest index. Consumer thread only.
+ * @param index Receives the index.
+ * @return True if an index was removed, false if the queue was empty.
+ */
+bool SpscQueue::pop(uint32_t& index) {
+    uint64_t h = head.load(memory_order_acquire);
+    while (h != tail.load(memory_order_acquire)) {
+        uint32_t value = slots[h & mask].load(memory_order_relaxed);
+        // Fails only if the producer evicted this item meanwhile; h is reloaded by the CAS.
+        if (head.compare_exchange_weak(h, h + 1, memory_order_acq_rel)) {
+            index = value;
+            popped.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the number of queued items (approximate while threads are active).
+ * @return The queue depth.
+ */
+uint32_t SpscQueue::size() const {
+    uint64_t h = head.load(memory_order_acquire);
+    uint64_t t = tail.load(memory_order_acquire);
+    return t > h ? static_cast<uint32_t>(t - h) : 0;
+}
+
+/**
+ * @brief Returns the capacity of the queue.
+ * @return The capacity.
+ */
+uint32_t SpscQueue::capacity() const {
+    return static_cast<uint32_t>(mask + 1);
+}
+
+/**
+ * @brief Returns the number of items queued so far.
+ * @return The push count.
+ */
+unsigned long SpscQueue::getPushed() const {
+    return pushed.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items delivered to the consumer.
+ * @return The pop count.
+ */
+unsigned long SpscQueue::getPopped() const {
+    return popped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items evicted by DROP_OLDEST.
+ * @return The drop count.
+ */
+unsigned long SpscQueue::getDropped() const {
+    return dropped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of items refused by REJECT.
+ * @return The reject count.
+ */
+unsigned long SpscQueue::getRejected() const {
+    return rejected.load(memory_order_relaxed);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file SpscQueue.h
+ * @brief Declaration of the SpscQueue class, a bounded lock-free single-producer/single-consumer
+ *        queue of pool indices, and the backpressure policies shared with MpscQueue.
+ * @date October 2026
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief What a push does when the queue is full.
+ */
+enum BackpressurePolicy {
+    DROP_OLDEST, /**< Evict the oldest queued item and hand it back to the producer. */
+    BLOCK,       /**< Spin (yielding) until the consumer makes room. */
+    REJECT       /**< Refuse the new item. */
+};
+
+/**
+ * @brief Outcome of a push.
+ */
+enum PushResult {
+    PUSH_OK,       /**< The item was queued. */
+    PUSH_EVICTED,  /**< The item was queued after evicting the oldest one. */
+    PUSH_REJECTED  /**< The queue was full and the item was not queued. */
+};
+
+/**
+ * @class SpscQueue
+ * @brief Bounded lock-free ring buffer of 32-bit indices for one producer and one consumer.
+ *
+ * The queue moves indices into a preallocated ObjectPool instead of copying the objects.
+ * Head and tail are monotonically increasing 64-bit counters on separate cache lines. The
+ * consumer claims an item with a compare-and-swap on the head so that, under DROP_OLDEST,
+ * the producer can evict the oldest item with the same compare-and-swap; the evicted index
+ * is returned to the producer so it can be released to the pool.
+ */
+class SpscQueue {
+private:
+    std::vector<std::atomic<uint32_t> > slots; /**< Ring storage. */
+    uint64_t mask;                      /**< Capacity - 1 (capacity is a power of two). */
+    BackpressurePolicy policy;          /**< Full-queue behaviour. */
+    char pad0[64];                      /**< Keeps head on its own cache line. */
+    std::atomic<uint64_t> head;         /**< Next position to pop. */
+    char pad1[64];                      /**< Keeps tail on its own cache line. */
+    std::atomic<uint64_t> tail;         /**< Next position to push. */
+    char pad2[64];                      /**< Separates the counters from tail. */
+    std::atomic<unsigned long> pushed;  /**< Items queued. */
+    std::atomic<unsigned long> popped;  /**< Items delivered to the consumer. */
+    std::atomic<unsigned long> dropped; /**< Items evicted by DROP_OLDEST. */
+    std::atomic<unsigned long> rejected; /**< Items refused by REJECT. */
+
+public:
+    /**
+     * @brief Constructor for the SpscQueue class.
+     * @param capacity Minimum capacity; rounded up to a power of two.
+     * @param policy Behaviour when the queue is full.
+     */
+    SpscQueue(uint32_t capacity, BackpressurePolicy policy);
+
+    /**
+     * @brief Queues an index. Producer thread only.
+     * @param index The index to queue.
+     * @param evicted Receives the evicted index when the result is PUSH_EVICTED (may be nullptr).
+     * @return The outcome of the push.
+     */
+    PushResult push(uint32_t index, uint32_t* evicted);
+
+    /**
+     * @brief Removes the oldest index. Consumer thread only.
+     * @param index Receives the index.
+     * @return True if an index was removed, false if the queue was empty.
+     */
+    bool pop(uint32_t& index);
+
+    /**
+     * @brief Returns the number of queued items (approximate while threads are active).
+     * @return The queue depth.
+     */
+    uint32_t size() const;
+
+    /**
+     * @brief Returns the capacity of the queue.
+     * @return The capacity.
+     */
+    uint32_t capacity() const;
+
+    /**
+     * @brief Returns the number of items queued so far.
+     * @return The push count.
+     */
+    unsigned long getPushed() const;
+
+    /**
+     * @brief Returns the number of items delivered to the consumer.
+     * @return The pop count.
+     */
+    unsigned long getPopped() const;
+
+    /**
+     * @brief Returns the number of items evicted by DROP_OLDEST.
+     * @return The drop count.
+     */
+    unsigned long getDropped() const;
+
+    /**
+     * @brief Returns the number of items refused by REJECT.
+     * @return The reject count.
+     */
+    unsigned long getRejected() const;
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,442 @@
+/**
+ * @file TelemetryIndex.cpp
+ * @brief Implementation of the TelemetryIndex and TelemetryIndexWriter classes.
+ * @date October 2026
+ */
+
+#include "TelemetryIndex.h"
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+/**
+ * @brief Converts the spans of a chunk into index entries.
+ * @param chunkOffset File offset of the chunk.
+ * @param spans Per-type time spans of the chunk.
+ * @param out Receives up to RECORD_TYPE_COUNT entries.
+ * @return The number of entries.
+ */
+static int spansToEntries(uint64_t chunkOffset, const ChunkTypeSpans& spans, IndexEntry* out) {
+    int count = 0;
+    for (uint16_t type = 1; type < RECORD_TYPE_COUNT; type++) {
+        if (spans.count[type] == 0) {
+            continue;
+        }
+        IndexEntry& entry = out[count++];
+        entry.chunkOffset = chunkOffset;
+        entry.firstTimestamp = spans.first[type];
+        entry.lastTimestamp = spans.last[type];
+        entry.count = spans.count[type];
+        entry.type = type;
+        entry.reserved = 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Forgets all spans.
+ */
+void ChunkTypeSpans::reset() {
+    for (int type = 0; type < RECORD_TYPE_COUNT; type++) {
+        first[type] = 0.0;
+        last[type] = 0.0;
+        count[type] = 0;
+    }
+}
+
+/**
+ * @brief Adds a record to the spans. Padding and unknown types are ignored.
+ * @param type Type of the record.
+ * @param timestamp Time of the record in seconds.
+ */
+void ChunkTypeSpans::add(uint16_t type, double timestamp) {
+    if (type == RECORD_PADDING || type >= RECORD_TYPE_COUNT) {
+        return;
+    }
+    if (count[type] == 0) {
+        first[type] = timestamp;
+        last[type] = timestamp;
+    }
+    first[type] = timestamp < first[type] ? timestamp : first[type];
+    last[type] = timestamp > last[type] ? timestamp : last[type];
+    count[type]++;
+}
+
+/**
+ * @brief Returns the name of the sidecar index of a log.
+ * @param logName Name of the log file.
+ * @return The sidecar file name.
+ */
+string telemetryIndexName(const string& logName) {
+    return logName + ".idx";
+}
+
+/**
+ * @brief Constructor for the TelemetryIndexWriter class.
+ */
+TelemetryIndexWriter::TelemetryIndexWriter() : logEnd(0) {}
+
+/**
+ * @brief Opens the sidecar of a log, repairing it first if needed.
+ * @param logName Name of the log file, which must exist.
+ * @return True on success.
+ */
+bool TelemetryIndexWriter::open(const string& logName) {
+    close();
+    TelemetryReader reader;
+    TelemetryIndex index;
+    if (!reader.open(logName) || !index.load(reader, logName, true)) {
+        cerr << "Error: Could not prepare the telemetry index of " << logName << endl;
+        return false;
+    }
+    logEnd = reader.getFileSize();
+    reader.close();
+
+    file.open(telemetryIndexName(logName), ios::binary | ios::app);
+    if (!file.is_open()) {
+        cerr << "Failed to open telemetry index: " << telemetryIndexName(logName) << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Closes the sidecar. Later chunks are not indexed until the next open().
+ */
+void TelemetryIndexWriter::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+    file.clear();
+}
+
+/**
+ * @brief Checks whether the sidecar is open.
+ * @return True if open.
+ */
+bool TelemetryIndexWriter::isOpen() const {
+    return file.is_open();
+}
+
+/**
+ * @brief Records the chunk just written to the log.
+ * @param chunkSize Size of the chunk in bytes, including its header.
+ * @param spans Per-type time spans of the chunk.
+ * @return True on success; on failure the sidecar is closed.
+ */
+bool TelemetryIndexWriter::append(uint64_t chunkSize, const ChunkTypeSpans& spans) {
+    if (!isOpen()) {
+        return false;
+    }
+    IndexEntry chunkEntries[RECORD_TYPE_COUNT];
+    int count = spansToEntries(logEnd, spans, chunkEntries);
+    logEnd += chunkSize;
+    // All entries of a chunk go out in one write, so a crash tears at most the last chunk
+    file.write(reinterpret_cast<const char*>(chunkEntries), static_cast<streamsize>(count * sizeof(IndexEntry)));
+    file.flush();
+    if (file.fail()) {
+        cerr << "Error: Failed to write the telemetry index; it will be rebuilt on the next open." << endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Constructor for the TelemetryIndex class.
+ */
+TelemetryIndex::TelemetryIndex() : scannedChunks(0), chunksVisited(0), rebuilt(false) {}
+
+/**
+ * @brief Reads the entries of a sidecar.
+ * @param name Name of the sidecar.
+ * @param loaded Receives the entries.
+ * @param torn Set to true if the file ends in a partial entry, which is ignored.
+ * @return False if the sidecar is missing or damaged.
+ */
+bool TelemetryIndex::readSidecar(const string& name, vector<IndexEntry>& loaded, bool& torn) {
+    loaded.clear();
+    torn = false;
+    ifstream in(name, ios::binary | ios::ate);
+    if (!in.is_open()) {
+        return false;
+    }
+    uint64_t size = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+    IndexFileHeader header;
+    if (size < sizeof(header) || !in.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || header.magic != TELEMETRY_INDEX_MAGIC || header.version != TELEMETRY_INDEX_VERSION
+        || header.entrySize != sizeof(IndexEntry)) {
+        return false;
+    }
+    loaded.resize(static_cast<size_t>((size - sizeof(header)) / sizeof(IndexEntry)));
+    if (!loaded.empty() && !in.read(reinterpret_cast<char*>(&loaded[0]),
+        static_cast<streamsize>(loaded.size() * sizeof(IndexEntry)))) {
+        loaded.clear();
+        return false;
+    }
+    for (size_t i = 0; i < loaded.size(); i++) {
+        const IndexEntry& entry = loaded[i];
+        if (entry.type == RECORD_PADDING || entry.type >= RECORD_TYPE_COUNT || entry.count == 0
+            || !(entry.firstTimestamp <= entry.lastTimestamp)
+            || (i > 0 && entry.chunkOffset < loaded[i - 1].chunkOffset)) {
+            loaded.clear();
+            return false;
+        }
+    }
+    torn = (size - sizeof(header)) % sizeof(IndexEntry) != 0;
+    return true;
+}
+
+/**
+ * @brief Writes a complete sidecar.
+ * @param name Name of the sidecar.
+ * @param loaded The entries.
+ * @return True on success.
+ */
+bool TelemetryIndex::writeSidecar(const string& name, const vector<IndexEntry>& loaded) {
+    ofstream out(name, ios::binary | ios::trunc);
+    if (!out.is_open()) {
+        cerr << "Failed to open telemetry index: " << name << endl;
+        return false;
+    }
+    IndexFileHeader header;
+    header.magic = TELEMETRY_INDEX_MAGIC;
+    header.version = TELEMETRY_INDEX_VERSION;
+    header.entrySize = sizeof(IndexEntry);
+    header.reserved = 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!loaded.empty()) {
+        out.write(reinterpret_cast<const char*>(&loaded[0]), static_cast<streamsize>(loaded.size() * sizeof(IndexEntry)));
+    }
+    out.close();
+    if (out.fail()) {
+        cerr << "Error: Failed to write telemetry index: " << name << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Loads the index of a log. Chunks the sidecar does not cover are read from the log.
+ * @param reader Reader with the log open.
+ * @param logName Name of the log file.
+ * @param repair True to rewrite the sidecar if it is missing, damaged or behind.
+ * @return True on success.
+ */
+bool TelemetryIndex::load(TelemetryReader& reader, const string& logName, bool repair) {
+    clear();
+    if (!reader.isOpen()) {
+        cerr << "Error: Telemetry log is not open." << endl;
+        return false;
+    }
+    const string sidecar = telemetryIndexName(logName);
+    vector<IndexEntry> loaded;
+    bool torn = false;
+    bool usable = readSidecar(sidecar, loaded, torn);
+    size_t stored = loaded.size();
+
+    // The last indexed chunk is always scanned again: a crash may have torn its entries
+    uint64_t resume = 0;
+    if (!loaded.empty()) {
+        uint64_t lastChunk = loaded.back().chunkOffset;
+        if (reader.getChunkEnd(lastChunk) == 0) {
+            loaded.clear(); // The sidecar belongs to another (or a rewritten) log
+            usable = false;
+        }
+        else {
+            while (!loaded.empty() && loaded.back().chunkOffset == lastChunk) {
+                loaded.pop_back();
+            }
+            resume = lastChunk;
+        }
+    }
+    rebuilt = !usable;
+
+    if (resume < reader.getFileSize() && reader.seekChunk(resume)) {
+        ChunkTypeSpans spans;
+        spans.reset();
+        uint64_t current = reader.getChunkOffset();
+        scannedChunks = 1;
+        IndexEntry chunkEntries[RECORD_TYPE_COUNT];
+        RecordView view;
+        while (reader.next(view)) {
+            if (view.chunkOffset != current) {
+                int count = spansToEntries(current, spans, chunkEntries);
+                loaded.insert(loaded.end(), chunkEntries, chunkEntries + count);
+                spans.reset();
+                current = view.chunkOffset;
+                scannedChunks++;
+            }
+            spans.add(view.type, view.timestamp);
+        }
+        int count = spansToEntries(current, spans, chunkEntries);
+        loaded.insert(loaded.end(), chunkEntries, chunkEntries + count);
+    }
+    reader.rewind();
+
+    if (repair && (!usable || torn || loaded.size() != stored) && !writeSidecar(sidecar, loaded)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < loaded.size(); i++) {
+        entries[loaded[i].type].push_back(loaded[i]);
+    }
+    for (int type = 0; type < RECORD_TYPE_COUNT; type++) {
+        const vector<IndexEntry>& list = entries[type];
+        latestUpTo[type].resize(list.size());
+        earliestFrom[type].resize(list.size());
+        for (size_t i = 0; i < list.size(); i++) {
+            double last = list[i].lastTimestamp;
+            latestUpTo[type][i] = (i > 0 && latestUpTo[type][i - 1] > last) ? latestUpTo[type][i - 1] : last;
+        }
+        for (size_t i = list.size(); i-- > 0;) {
+            double first = list[i].firstTimestamp;
+            earliestFrom[type][i] = (i + 1 < list.size() && earliestFrom[type][i + 1] < first) ? earliestFrom[type][i + 1] : first;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Forgets the index.
+ */
+void TelemetryIndex::clear() {
+    for (int type = 0; type < RECORD_TYPE_COUNT; type++) {
+        entries[type].clear();
+        latestUpTo[type].clear();
+        earliestFrom[type].clear();
+    }
+    scannedChunks = 0;
+    chunksVisited = 0;
+    rebuilt = false;
+}
+
+/**
+ * @brief Finds the first entry of a type that can hold a record at or after a time.
+ * @param type Record type.
+ * @param time Time in seconds.
+ * @return Position in entries[type] (the size if there is none).
+ */
+size_t TelemetryIndex::firstEntry(uint16_t type, double time) const {
+    const vector<double>& latest = latestUpTo[type];
+    return static_cast<size_t>(lower_bound(latest.begin(), latest.end(), time) - latest.begin());
+}
+
+/**
+ * @brief Positions the reader at the first record of a type at or after a time.
+ * @param reader Reader with the indexed log open.
+ * @param type Record type.
+ * @param time Time in seconds.
+ * @param view Receives the record.
+ * @return False if no such record exists.
+ */
+bool TelemetryIndex::seek(TelemetryReader& reader, uint16_t type, double time, RecordView& view) {
+    chunksVisited = 0;
+    if (type >= RECORD_TYPE_COUNT) {
+        return false;
+    }
+    const vector<IndexEntry>& list = entries[type];
+    for (size_t i = firstEntry(type, time); i < list.size(); i++) {
+        if (list[i].lastTimestamp < time) {
+            continue;
+        }
+        if (!reader.seekChunk(list[i].chunkOffset) || reader.getChunkOffset() != list[i].chunkOffset) {
+            continue;
+        }
+        chunksVisited++;
+        while (reader.nextInChunk(view)) {
+            if (view.type == type && view.timestamp >= time) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Reads the records of a type in a time window, entering only the chunks that hold some.
+ * @param reader Reader with the indexed log open.
+ * @param type Record type.
+ * @param from Start of the window in seconds (inclusive).
+ * @param to End of the window in seconds (inclusive).
+ * @param callback Called for each record in file order.
+ * @return The number of records passed to the callback.
+ */
+unsigned long TelemetryIndex::readWindow(TelemetryReader& reader, uint16_t type, double from, double to,
+    const WindowCallback& callback) {
+    chunksVisited = 0;
+    if (type >= RECORD_TYPE_COUNT || from > to) {
+        return 0;
+    }
+    const vector<IndexEntry>& list = entries[type];
+    const vector<double>& earliest = earliestFrom[type];
+    size_t end = static_cast<size_t>(upper_bound(earliest.begin(), earliest.end(), to) - earliest.begin());
+    unsigned long delivered = 0;
+    for (size_t i = firstEntry(type, from); i < end; i++) {
+        if (list[i].lastTimestamp < from || list[i].firstTimestamp > to) {
+            continue;
+        }
+        if (!reader.seekChunk(list[i].chunkOffset) || reader.getChunkOffset() != list[i].chunkOffset) {
+            continue;
+        }
+        chunksVisited++;
+        RecordView view;
+        while (reader.nextInChunk(view)) {
+            if (view.type == type && view.timestamp >= from && view.timestamp <= to) {
+                callback(view);
+                delivered++;
+            }
+        }
+    }
+    return delivered;
+}
+
+/**
+ * @brief Returns the number of index entries of a type.
+ * @param type Record type.
+ * @return The entry count.
+ */
+size_t TelemetryIndex::getEntryCount(uint16_t type) const {
+    return type < RECORD_TYPE_COUNT ? entries[type].size() : 0;
+}
+
+/**
+ * @brief Returns the time span of a type in the log.
+ * @param type Record type.
+ * @param first Receives the earliest timestamp.
+ * @param last Receives the latest timestamp.
+ * @return False if the log holds no records of the type.
+ */
+bool TelemetryIndex::getTimeRange(uint16_t type, double& first, double& last) const {
+    if (type >= RECORD_TYPE_COUNT || entries[type].empty()) {
+        return false;
+    }
+    first = earliestFrom[type].front();
+    last = latestUpTo[type].back();
+    return true;
+}
+
+/**
+ * @brief Returns the number of chunks read from the log during the last load().
+ * @return 1 when the sidecar was complete (its last chunk is always checked again).
+ */
+unsigned long TelemetryIndex::getScannedChunks() const {
+    return scannedChunks;
+}
+
+/**
+ * @brief Returns the number of chunks entered by the last seek() or readWindow().
+ * @return The chunk count.
+ */
+unsigned long TelemetryIndex::getChunksVisited() const {
+    return chunksVisited;
+}
+
+/**
+ * @brief Checks whether the last load() had to rebuild the index from the log.
+ * @return True if no usable sidecar was found.
+ */
+bool TelemetryIndex::wasRebuilt() const {
+    return rebuilt;
+}
@@ -0,0 +1,258 @@
+/**
+ * @file TelemetryIndex.h
+ * @brief Declaration of the TelemetryIndex and TelemetryIndexWriter classes, a sparse per-type
+ *        time index of a telemetry log kept in a sidecar file.
+ * @date October 2026
+ *
+ * The sidecar of "session.tlog" is "session.tlog.idx": an IndexFileHeader followed by one
+ * IndexEntry per record type per chunk, in the order the chunks were written. An entry only
+ * records the time span of one type inside one chunk, so the index stays a few hundred bytes
+ * per megabyte of log while a seek still lands on the right chunk.
+ */
+
+#ifndef TELEMETRYINDEX_H
+#define TELEMETRYINDEX_H
+
+#include "TelemetryLog.h"
+#include "TelemetryReader.h"
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+/** @brief Sidecar magic, "TIDX" in a little-endian file. */
+const uint32_t TELEMETRY_INDEX_MAGIC = 0x58444954;
+
+/** @brief Current sidecar format version. */
+const uint16_t TELEMETRY_INDEX_VERSION = 1;
+
+/**
+ * @struct IndexFileHeader
+ * @brief Header at the start of a sidecar file.
+ */
+struct IndexFileHeader {
+    uint32_t magic;          /**< TELEMETRY_INDEX_MAGIC. */
+    uint16_t version;        /**< TELEMETRY_INDEX_VERSION. */
+    uint16_t entrySize;      /**< sizeof(IndexEntry). */
+    uint64_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct IndexEntry
+ * @brief Time span of one record type inside one chunk.
+ */
+struct IndexEntry {
+    uint64_t chunkOffset;    /**< File offset of the chunk. */
+    double firstTimestamp;   /**< Earliest timestamp of the type in the chunk. */
+    double lastTimestamp;    /**< Latest timestamp of the type in the chunk. */
+    uint32_t count;          /**< Records of the type in the chunk. */
+    uint16_t type;           /**< One of TelemetryRecordType. */
+    uint16_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct ChunkTypeSpans
+ * @brief Per-type time spans of the chunk under construction, collected by the writers.
+ */
+struct ChunkTypeSpans {
+    double first[RECORD_TYPE_COUNT];  /**< Earliest timestamp per type. */
+    double last[RECORD_TYPE_COUNT];   /**< Latest timestamp per type. */
+    uint32_t count[RECORD_TYPE_COUNT]; /**< Records per type (0 if the type is absent). */
+
+    /**
+     * @brief Forgets all spans.
+     */
+    void reset();
+
+    /**
+     * @brief Adds a record to the spans. Padding and unknown types are ignored.
+     * @param type Type of the record.
+     * @param timestamp Time of the record in seconds.
+     */
+    void add(uint16_t type, double timestamp);
+};
+
+/**
+ * @brief Returns the name of the sidecar index of a log.
+ * @param logName Name of the log file.
+ * @return The sidecar file name.
+ */
+std::string telemetryIndexName(const std::string& logName);
+
+/**
+ * @class TelemetryIndexWriter
+ * @brief Appends the index entries of each chunk a writer adds to a log.
+ *
+ * open() first brings the sidecar in line with the log (rebuilding it if it is missing,
+ * damaged or behind), so the entries appended afterwards always continue a complete index.
+ * Entries are appended after their chunk is written; a crash in between leaves the sidecar
+ * one chunk behind, which the next open() or TelemetryIndex::load() repairs.
+ */
+class TelemetryIndexWriter {
+private:
+    std::ofstream file;      /**< Sidecar, opened for appending. */
+    uint64_t logEnd;         /**< Offset at which the next chunk of the log starts. */
+
+public:
+    /**
+     * @brief Constructor for the TelemetryIndexWriter class.
+     */
+    TelemetryIndexWriter();
+
+    /**
+     * @brief Opens the sidecar of a log, repairing it first if needed.
+     * @param logName Name of the log file, which must exist.
+     * @return True on success.
+     */
+    bool open(const std::string& logName);
+
+    /**
+     * @brief Closes the sidecar. Later chunks are not indexed until the next open().
+     */
+    void close();
+
+    /**
+     * @brief Checks whether the sidecar is open.
+     * @return True if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Records the chunk just written to the log.
+     * @param chunkSize Size of the chunk in bytes, including its header.
+     * @param spans Per-type time spans of the chunk.
+     * @return True on success; on failure the sidecar is closed.
+     */
+    bool append(uint64_t chunkSize, const ChunkTypeSpans& spans);
+};
+
+/**
+ * @class TelemetryIndex
+ * @brief In-memory time index of a log, loaded from its sidecar, for seeking and window reads.
+ *
+ * Timestamps need not be monotonic across chunks (the asynchronous writer interleaves threads),
+ * so for each type the index keeps the running maximum of the span ends and the running
+ * minimum (from the back) of the span starts. Both are sorted, which makes finding the first
+ * and last chunk that can hold a given time a binary search.
+ */
+class TelemetryIndex {
+public:
+    /**
+     * @brief Callback receiving the records of a window.
+     */
+    typedef std::function<void(const RecordView&)> WindowCallback;
+
+private:
+    std::vector<IndexEntry> entries[RECORD_TYPE_COUNT]; /**< Entries per type, in file order. */
+    std::vector<double> latestUpTo[RECORD_TYPE_COUNT];  /**< Maximum lastTimestamp of entries [0, i]. */
+    std::vector<double> earliestFrom[RECORD_TYPE_COUNT]; /**< Minimum firstTimestamp of entries [i, end). */
+    unsigned long scannedChunks; /**< Chunks read from the log during the last load(). */
+    unsigned long chunksVisited; /**< Chunks entered by the last seek() or readWindow(). */
+    bool rebuilt;                /**< True if the last load() found no usable sidecar. */
+
+    /**
+     * @brief Reads the entries of a sidecar.
+     * @param name Name of the sidecar.
+     * @param loaded Receives the entries.
+     * @param torn Set to true if the file ends in a partial entry, which is ignored.
+     * @return False if the sidecar is missing or damaged.
+     */
+    static bool readSidecar(const std::string& name, std::vector<IndexEntry>& loaded, bool& torn);
+
+    /**
+     * @brief Writes a complete sidecar.
+     * @param name Name of the sidecar.
+     * @param loaded The entries.
+     * @return True on success.
+     */
+    static bool writeSidecar(const std::string& name, const std::vector<IndexEntry>& loaded);
+
+    /**
+     * @brief Finds the first entry of a type that can hold a record at or after a time.
+     * @param type Record type.
+     * @param time Time in seconds.
+     * @return Position in entries[type] (the size if there is none).
+     */
+    size_t firstEntry(uint16_t type, double time) const;
+
+public:
+    /**
+     * @brief Constructor for the TelemetryIndex class.
+     */
+    TelemetryIndex();
+
+    /**
+     * @brief Loads the index of a log. Chunks the sidecar does not cover are read from the log.
+     * @param reader Reader with the log open.
+     * @param logName Name of the log file.
+     * @param repair True to rewrite the sidecar if it is missing, damaged or behind. Do not
+     *        repair while another process is appending to the log.
+     * @return True on success.
+     */
+    bool load(TelemetryReader& reader, const std::string& logName, bool repair = true);
+
+    /**
+     * @brief Forgets the index.
+     */
+    void clear();
+
+    /**
+     * @brief Positions the reader at the first record of a type at or after a time.
+     * Subsequent calls to reader.next() continue from there in file order.
+     * @param reader Reader with the indexed log open.
+     * @param type Record type.
+     * @param time Time in seconds.
+     * @param view Receives the record.
+     * @return False if no such record exists.
+     */
+    bool seek(TelemetryReader& reader, uint16_t type, double time, RecordView& view);
+
+    /**
+     * @brief Reads the records of a type in a time window, entering only the chunks that hold some.
+     * @param reader Reader with the indexed log open.
+     * @param type Record type.
+     * @param from Start of the window in seconds (inclusive).
+     * @param to End of the window in seconds (inclusive).
+     * @param callback Called for each record in file order.
+     * @return The number of records passed to the callback.
+     */
+    unsigned long readWindow(TelemetryReader& reader, uint16_t type, double from, double to,
+        const WindowCallback& callback);
+
+    /**
+     * @brief Returns the number of index entries of a type.
+     * @param type Record type.
+     * @return The entry count.
+     */
+    size_t getEntryCount(uint16_t type) const;
+
+    /**
+     * @brief Returns the time span of a type in the log.
+     * @param type Record type.
+     * @param first Receives the earliest timestamp.
+     * @param last Receives the latest timestamp.
+     * @return False if the log holds no records of the type.
+     */
+    bool getTimeRange(uint16_t type, double& first, double& last) const;
+
+    /**
+     * @brief Returns the number of chunks read from the log during the last load().
+     * @return 1 when the sidecar was complete (its last chunk is always checked again).
+     */
+    unsigned long getScannedChunks() const;
+
+    /**
+     * @brief Returns the number of chunks entered by the last seek() or readWindow().
+     * @return The chunk count.
+     */
+    unsigned long getChunksVisited() const;
+
+    /**
+     * @brief Checks whether the last load() had to rebuild the index from the log.
+     * @return True if no usable sidecar was found.
+     */
+    bool wasRebuilt() const;
+};
+
+#endif // TELEMETRYINDEX_H
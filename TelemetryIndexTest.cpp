@@ -0,0 +1,255 @@
+/**
+ * @file TelemetryIndexTest.cpp
+ * @brief Test application for the TelemetryIndex and TelemetryIndexWriter classes.
+ * @details Records a session, then checks seeks and time windows against a sequential scan,
+ * rebuilds a missing sidecar, repairs a torn one, indexes a log written by several threads
+ * with the asynchronous writer, and measures the seek time.
+ * @date October, 2026
+ */
+
+#include "TelemetryWriter.h"
+#include "TelemetryReader.h"
+#include "TelemetryIndex.h"
+#include "AsyncLogWriter.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Writes scans from first to first + count - 1 at 10 Hz, each followed by a pose.
+ * @param writer The open writer.
+ * @param first Number of the first scan.
+ * @param count Number of scans.
+ */
+void writeSession(TelemetryWriter& writer, int first, int count) {
+    LidarScanRecord fixed = { 0.0, 0.0, 0.0, -120.0f, 0.36f, 667, 0 };
+    float ranges[667] = { 0.0f };
+    for (int s = first; s < first + count; s++) {
+        double t = s * 0.1;
+        ranges[0] = static_cast<float>(s);
+        writer.append(RECORD_LIDAR_SCAN, t, &fixed, sizeof(fixed), ranges, sizeof(ranges));
+        PoseRecord pose = { s * 0.01, 0.0, 0.0 };
+        writer.append(RECORD_POSE, t + 0.05, &pose, sizeof(pose));
+    }
+}
+
+/**
+ * @brief Finds the first record of a type at or after a time by reading the whole log.
+ * @param reader The open reader.
+ * @param type Record type.
+ * @param time Time in seconds.
+ * @param found Receives the timestamp of the record.
+ * @return False if there is no such record.
+ */
+bool linearSeek(TelemetryReader& reader, uint16_t type, double time, double& found) {
+    reader.rewind();
+    RecordView view;
+    while (reader.next(view)) {
+        if (view.type == type && view.timestamp >= time) {
+            found = view.timestamp;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Counts the records of a type in a time window by reading the whole log.
+ * @param reader The open reader.
+ * @param type Record type.
+ * @param from Start of the window.
+ * @param to End of the window.
+ * @return The record count.
+ */
+unsigned long linearCount(TelemetryReader& reader, uint16_t type, double from, double to) {
+    reader.rewind();
+    RecordView view;
+    unsigned long count = 0;
+    while (reader.next(view)) {
+        if (view.type == type && view.timestamp >= from && view.timestamp <= to) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Returns the size of a file.
+ * @param name Name of the file.
+ * @return The size in bytes.
+ */
+long long fileSizeOf(const string& name) {
+    ifstream in(name, ios::binary | ios::ate);
+    return in.is_open() ? static_cast<long long>(in.tellg()) : -1;
+}
+
+/**
+ * @brief Main function for testing the telemetry index.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const string fileName = "telemetry_index_test.tlog";
+    const string indexName = telemetryIndexName(fileName);
+    remove(fileName.c_str());
+    remove(indexName.c_str());
+
+    /**
+     * @test Test 1: The writer keeps the sidecar complete, so loading it reads no chunk but the last.
+     */
+    TelemetryWriter writer;
+    assert(writer.open(fileName));
+    writer.setFlushThresholds(64 * 1024, 10.0);
+    writeSession(writer, 0, 5000);
+    assert(writer.close());
+    unsigned long chunks = writer.getChunksWritten();
+    cout << "Log: " << fileSizeOf(fileName) << " bytes in " << chunks << " chunks, index: "
+        << fileSizeOf(indexName) << " bytes" << endl;
+
+    TelemetryReader reader;
+    assert(reader.open(fileName));
+    TelemetryIndex index;
+    assert(index.load(reader, fileName));
+    assert(!index.wasRebuilt() && index.getScannedChunks() == 1);
+    assert(index.getEntryCount(RECORD_LIDAR_SCAN) == chunks && index.getEntryCount(RECORD_POSE) == chunks);
+    assert(index.getEntryCount(RECORD_COMMAND) == 0);
+    double first = 0.0;
+    double last = 0.0;
+    assert(index.getTimeRange(RECORD_POSE, first, last) && first == 0.05 && last == 4999 * 0.1 + 0.05);
+
+    /**
+     * @test Test 2: A seek finds the same record as a sequential scan and enters one chunk.
+     */
+    double times[] = { -5.0, 0.0, 0.07, 123.456, 250.0, 499.9, 499.95 };
+    for (double time : times) {
+        RecordView view;
+        double expected = 0.0;
+        assert(index.seek(reader, RECORD_POSE, time, view));
+        assert(linearSeek(reader, RECORD_POSE, time, expected) && view.timestamp == expected);
+        assert(index.getChunksVisited() <= 2);
+    }
+    RecordView view;
+    assert(!index.seek(reader, RECORD_POSE, 500.0, view));
+
+    // Reading continues in file order after a seek
+    assert(index.seek(reader, RECORD_LIDAR_SCAN, 300.0, view));
+    const float* ranges = view.array<LidarScanRecord, float>(667);
+    assert(ranges[0] == 3000.0f);
+    assert(reader.next(view) && view.type == RECORD_POSE && view.as<PoseRecord>()->x == 30.0);
+
+    /**
+     * @test Test 3: A window returns exactly its records and enters only the chunks that hold them.
+     */
+    unsigned long windowed = index.readWindow(reader, RECORD_LIDAR_SCAN, 100.0, 110.0, [](const RecordView& record) {
+        assert(record.type == RECORD_LIDAR_SCAN && record.timestamp >= 100.0 && record.timestamp <= 110.0);
+    });
+    assert(windowed == linearCount(reader, RECORD_LIDAR_SCAN, 100.0, 110.0) && windowed == 101);
+    unsigned long perChunk = 5000 / chunks;
+    assert(index.getChunksVisited() <= windowed / perChunk + 2);
+    cout << "Window of " << windowed << " scans entered " << index.getChunksVisited() << " of " << chunks
+        << " chunks" << endl;
+    assert(index.readWindow(reader, RECORD_POSE, 600.0, 700.0, [](const RecordView&) {}) == 0);
+    reader.close();
+
+    /**
+     * @test Test 4: A missing sidecar is rebuilt from the log and written back.
+     */
+    remove(indexName.c_str());
+    assert(reader.open(fileName));
+    assert(index.load(reader, fileName));
+    assert(index.wasRebuilt() && index.getScannedChunks() == chunks);
+    assert(index.getEntryCount(RECORD_POSE) == chunks);
+    assert(index.seek(reader, RECORD_POSE, 123.456, view) && view.timestamp == 1235 * 0.1 + 0.05);
+    assert(index.load(reader, fileName) && !index.wasRebuilt() && index.getScannedChunks() == 1);
+    reader.close();
+
+    /**
+     * @test Test 5: A torn sidecar is repaired and later sessions are appended to it.
+     */
+    long long sidecarSize = fileSizeOf(indexName);
+    {
+        ifstream in(indexName, ios::binary);
+        vector<char> bytes(static_cast<size_t>(sidecarSize));
+        in.read(&bytes[0], sidecarSize);
+        ofstream out(indexName, ios::binary | ios::trunc);
+        out.write(&bytes[0], sidecarSize - 3 * sizeof(IndexEntry) - 5); // A crash in the middle of an entry
+    }
+    assert(writer.open(fileName));
+    assert(fileSizeOf(indexName) == sidecarSize); // Repaired when the writer opened the log
+    writeSession(writer, 5000, 1000);
+    assert(writer.close());
+    assert(reader.open(fileName));
+    assert(index.load(reader, fileName) && !index.wasRebuilt() && index.getScannedChunks() == 1);
+    assert(index.seek(reader, RECORD_LIDAR_SCAN, 550.0, view));
+    ranges = view.array<LidarScanRecord, float>(667);
+    assert(ranges[0] == 5500.0f);
+    assert(index.readWindow(reader, RECORD_POSE, 495.0, 505.0, [](const RecordView&) {}) == 100);
+    reader.close();
+
+    /**
+     * @test Test 6: Records of interleaved threads have overlapping chunk spans and are still all found.
+     */
+    remove(fileName.c_str());
+    remove(indexName.c_str());
+    AsyncLogWriter asyncWriter;
+    asyncWriter.configure(256 * 1024, 16 * 1024, 0.001);
+    assert(asyncWriter.open(fileName, false));
+    vector<thread> producers;
+    for (int p = 0; p < 2; p++) {
+        producers.push_back(thread([&asyncWriter, p]() {
+            for (int i = 0; i < 20000; i++) {
+                // The second thread lags 3 s behind, so chunk spans overlap
+                PoseRecord pose = { static_cast<double>(i), static_cast<double>(p), 0.0 };
+                while (!asyncWriter.append(RECORD_POSE, i * 0.01 - p * 3.0, &pose, sizeof(pose))) {
+                    this_thread::yield();
+                }
+            }
+        }));
+    }
+    for (thread& producer : producers) {
+        producer.join();
+    }
+    assert(asyncWriter.close());
+    assert(reader.open(fileName));
+    assert(index.load(reader, fileName) && !index.wasRebuilt());
+    double windows[][2] = { { -3.0, -2.0 }, { 10.0, 10.5 }, { 50.0, 60.0 }, { 196.0, 200.0 } };
+    for (auto& window : windows) {
+        unsigned long found = index.readWindow(reader, RECORD_POSE, window[0], window[1], [](const RecordView&) {});
+        assert(found == linearCount(reader, RECORD_POSE, window[0], window[1]));
+    }
+    double expected = 0.0;
+    assert(index.seek(reader, RECORD_POSE, 42.0, view));
+    assert(linearSeek(reader, RECORD_POSE, 42.0, expected) && view.timestamp == expected);
+    reader.close();
+
+    /**
+     * @test Test 7: Seek time on the recorded session.
+     */
+    remove(fileName.c_str());
+    remove(indexName.c_str());
+    assert(writer.open(fileName));
+    writeSession(writer, 0, 20000);
+    assert(writer.close());
+    assert(reader.open(fileName));
+    auto start = chrono::steady_clock::now();
+    assert(index.load(reader, fileName));
+    double loadMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    const int seeks = 10000;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < seeks; i++) {
+        assert(index.seek(reader, RECORD_POSE, (i * 7919 % 19990) * 0.1, view));
+    }
+    double seekUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / seeks;
+    cout << "Index of " << writer.getChunksWritten() << " chunks loaded in " << loadMs << " ms, "
+        << seekUs << " us per seek" << endl;
+    reader.close();
+
+    remove(fileName.c_str());
+    remove(indexName.c_str());
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file TelemetryLog.cpp
+ * @brief Implementation of the helper functions shared by the telemetry log classes.
+ * @date October 2026
+ */
+
+#include "TelemetryLog.h"
+#include <cstdlib>
+#include <cstring>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+using namespace std;
+
+/**
+ * @brief Builds the CRC-32 lookup table on first use.
+ * @return The 256-entry table.
+ */
+static const uint32_t* crcTable() {
+    static uint32_t table[256];
+    static bool built = false;
+    if (!built) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        built = true;
+    }
+    return table;
+}
+
+/**
+ * @brief Computes or continues a CRC-32 (IEEE 802.3 polynomial).
+ * @param data Bytes to checksum.
+ * @param size Number of bytes.
+ * @param crc CRC of the preceding bytes, or 0 to start.
+ * @return The CRC of all bytes so far.
+ */
+uint32_t telemetryCrc32(const void* data, size_t size, uint32_t crc) {
+    static const uint32_t* table = crcTable(); // Thread-safe initialization
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Fills in the ChunkHeader at the start of a chunk buffer, including the payload CRC.
+ * @param chunk The chunk: space for a ChunkHeader followed by payloadSize bytes of records.
+ * @param payloadSize Size of the records.
+ * @param records Number of records, padding included.
+ * @param first Earliest record timestamp.
+ * @param last Latest record timestamp.
+ */
+void telemetryFinishChunk(uint8_t* chunk, size_t payloadSize, uint32_t records, double first, double last) {
+    ChunkHeader header;
+    header.magic = TELEMETRY_MAGIC;
+    header.version = TELEMETRY_VERSION;
+    header.headerSize = sizeof(ChunkHeader);
+    header.payloadSize = static_cast<uint32_t>(payloadSize);
+    header.recordCount = records;
+    header.firstTimestamp = first;
+    header.lastTimestamp = last;
+    header.crc = telemetryCrc32(chunk + sizeof(ChunkHeader), payloadSize);
+    header.flags = 0;
+    memcpy(chunk, &header, sizeof(header));
+}
+
+/**
+ * @brief Allocates memory aligned for large sequential I/O.
+ * @param size Number of bytes.
+ * @param alignment Alignment in bytes (a power of two).
+ * @return The memory, or nullptr on failure.
+ */
+void* telemetryAlloc(size_t size, size_t alignment) {
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignment, size) != 0) {
+        return nullptr;
+    }
+    return memory;
+#endif
+}
+
+/**
+ * @brief Releases memory obtained from telemetryAlloc.
+ * @param memory The memory (may be nullptr).
+ */
+void telemetryFree(void* memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
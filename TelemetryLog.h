@@ -0,0 +1,176 @@
+/**
+ * @file TelemetryLog.h
+ * @brief On-disk layout of the binary telemetry log shared by TelemetryWriter and TelemetryReader.
+ * @date October 2026
+ *
+ * A log is a sequence of chunks. Each chunk is a ChunkHeader followed by payloadSize bytes of
+ * records; each record is a RecordHeader followed by its payload, padded to a multiple of 8
+ * bytes so that every header and payload is 8-byte aligned in a memory-mapped file. All values
+ * are stored in the byte order of the recording machine (little-endian on all supported targets).
+ */
+
+#ifndef TELEMETRYLOG_H
+#define TELEMETRYLOG_H
+
+#include <cstddef>
+#include <cstdint>
+
+/** @brief Chunk magic, "TLOG" in a little-endian file. */
+const uint32_t TELEMETRY_MAGIC = 0x474F4C54;
+
+/** @brief Current format version. */
+const uint16_t TELEMETRY_VERSION = 1;
+
+/**
+ * @brief Types of the records stored in a telemetry log.
+ */
+enum TelemetryRecordType {
+    RECORD_PADDING = 0,    /**< Filler that aligns a chunk for direct I/O; skipped by readers. */
+    RECORD_LIDAR_SCAN = 1, /**< LidarScanRecord followed by float ranges[count]. */
+    RECORD_IR_FRAME = 2,   /**< IRFrameRecord followed by double ranges[count]. */
+    RECORD_POSE = 3,       /**< PoseRecord. */
+    RECORD_COMMAND = 4,    /**< CommandRecord. */
+    RECORD_MAP_DELTA = 5,  /**< MapDeltaRecord followed by MapCellRecord cells[count]. */
+    RECORD_TYPE_COUNT = 6  /**< One past the largest record type. */
+};
+
+/**
+ * @struct ChunkHeader
+ * @brief Header of a chunk of records.
+ */
+struct ChunkHeader {
+    uint32_t magic;          /**< TELEMETRY_MAGIC. */
+    uint16_t version;        /**< TELEMETRY_VERSION. */
+    uint16_t headerSize;     /**< sizeof(ChunkHeader), so that later versions can extend it. */
+    uint32_t payloadSize;    /**< Bytes of records following the header. */
+    uint32_t recordCount;    /**< Number of records in the chunk. */
+    double firstTimestamp;   /**< Earliest record timestamp in the chunk, in seconds. */
+    double lastTimestamp;    /**< Latest record timestamp in the chunk, in seconds. */
+    uint32_t crc;            /**< CRC-32 of the payload. */
+    uint32_t flags;          /**< Reserved, written as 0. */
+};
+
+/**
+ * @struct RecordHeader
+ * @brief Header of one record inside a chunk.
+ */
+struct RecordHeader {
+    uint16_t type;           /**< One of TelemetryRecordType. */
+    uint16_t reserved;       /**< Written as 0. */
+    uint32_t size;           /**< Payload size in bytes, without padding. */
+    double timestamp;        /**< Time of the record in seconds. */
+};
+
+/**
+ * @struct LidarScanRecord
+ * @brief Fixed part of a RECORD_LIDAR_SCAN payload.
+ */
+struct LidarScanRecord {
+    double x;                /**< Robot x at acquisition. */
+    double y;                /**< Robot y at acquisition. */
+    double th;               /**< Robot heading at acquisition (radians). */
+    float angleMin;          /**< Angle of the first beam in degrees. */
+    float angleIncrement;    /**< Angle between beams in degrees. */
+    uint32_t count;          /**< Number of ranges that follow. */
+    uint32_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct IRFrameRecord
+ * @brief Fixed part of a RECORD_IR_FRAME payload.
+ */
+struct IRFrameRecord {
+    uint32_t count;          /**< Number of ranges that follow. */
+    uint32_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct PoseRecord
+ * @brief Payload of a RECORD_POSE record.
+ */
+struct PoseRecord {
+    double x;                /**< X coordinate. */
+    double y;                /**< Y coordinate. */
+    double th;               /**< Heading (radians). */
+};
+
+/**
+ * @struct CommandRecord
+ * @brief Payload of a RECORD_COMMAND record.
+ */
+struct CommandRecord {
+    double vx;               /**< Forward velocity in m/s. */
+    double vy;               /**< Lateral velocity in m/s. */
+    double omega;            /**< Angular velocity in rad/s. */
+    int32_t source;          /**< Producer of the command. */
+    uint32_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct MapDeltaRecord
+ * @brief Fixed part of a RECORD_MAP_DELTA payload.
+ */
+struct MapDeltaRecord {
+    uint32_t count;          /**< Number of cells that follow. */
+    uint32_t reserved;       /**< Written as 0. */
+};
+
+/**
+ * @struct MapCellRecord
+ * @brief One changed map cell in a RECORD_MAP_DELTA payload.
+ */
+struct MapCellRecord {
+    int32_t x;               /**< Cell column. */
+    int32_t y;               /**< Cell row. */
+    int32_t value;           /**< New cell value (Map::CELL_*). */
+};
+
+static_assert(sizeof(ChunkHeader) == 40, "ChunkHeader layout changed");
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader layout changed");
+static_assert(sizeof(LidarScanRecord) == 40, "LidarScanRecord layout changed");
+static_assert(sizeof(CommandRecord) == 32, "CommandRecord layout changed");
+static_assert(sizeof(MapCellRecord) == 12, "MapCellRecord layout changed");
+
+/**
+ * @brief Rounds a size up to the 8-byte record alignment.
+ * @param size Size in bytes.
+ * @return The padded size.
+ */
+inline size_t telemetryAlign(size_t size) {
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+/**
+ * @brief Fills in the ChunkHeader at the start of a chunk buffer, including the payload CRC.
+ * @param chunk The chunk: space for a ChunkHeader followed by payloadSize bytes of records.
+ * @param payloadSize Size of the records.
+ * @param records Number of records, padding included.
+ * @param first Earliest record timestamp.
+ * @param last Latest record timestamp.
+ */
+void telemetryFinishChunk(uint8_t* chunk, size_t payloadSize, uint32_t records, double first, double last);
+
+/**
+ * @brief Computes or continues a CRC-32 (IEEE 802.3 polynomial).
+ * @param data Bytes to checksum.
+ * @param size Number of bytes.
+ * @param crc CRC of the preceding bytes, or 0 to start.
+ * @return The CRC of all bytes so far.
+ */
+uint32_t telemetryCrc32(const void* data, size_t size, uint32_t crc = 0);
+
+/**
+ * @brief Allocates memory aligned for large sequential I/O.
+ * @param size Number of bytes.
+ * @param alignment Alignment in bytes (a power of two).
+ * @return The memory, or nullptr on failure. Release with telemetryFree.
+ */
+void* telemetryAlloc(size_t size, size_t alignment);
+
+/**
+ * @brief Releases memory obtained from telemetryAlloc.
+ * @param memory The memory (may be nullptr).
+ */
+void telemetryFree(void* memory);
+
+#endif // TELEMETRYLOG_H
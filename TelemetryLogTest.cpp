@@ -0,0 +1,171 @@
+/**
+ * @file TelemetryLogTest.cpp
+ * @brief Test application for the TelemetryWriter and TelemetryReader classes.
+ * @details Writes a session of scans, poses and commands, reads it back from the memory-mapped
+ * file, checks that corrupt and truncated chunks are skipped, and measures the write and read
+ * throughput.
+ * @date October, 2026
+ */
+
+#include "TelemetryWriter.h"
+#include "TelemetryReader.h"
+#include "LidarScan.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+using namespace std;
+
+/**
+ * @brief Writes a session of count scans, each followed by a pose and a command.
+ * @param writer The open writer.
+ * @param count Number of scans.
+ */
+void writeSession(TelemetryWriter& writer, int count) {
+    LidarScanRecord fixed = { 0.0, 0.0, 0.0, -120.0f, 0.36f, 667, 0 };
+    float ranges[667];
+    for (int s = 0; s < count; s++) {
+        double t = s * 0.1;
+        fixed.x = s * 0.01;
+        for (int i = 0; i < 667; i++) {
+            ranges[i] = static_cast<float>(s + i);
+        }
+        writer.append(RECORD_LIDAR_SCAN, t, &fixed, sizeof(fixed), ranges, sizeof(ranges));
+        PoseRecord pose = { s * 0.01, 0.0, 0.0 };
+        writer.append(RECORD_POSE, t + 0.01, &pose, sizeof(pose));
+        CommandRecord command = { 0.1, 0.0, 0.0, s, 0 };
+        writer.append(RECORD_COMMAND, t + 0.02, &command, sizeof(command));
+    }
+}
+
+/**
+ * @brief Main function for testing the telemetry log classes.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    const char* fileName = "telemetry_test.tlog";
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 1: Every record comes back in order with its payload.
+     */
+    TelemetryWriter writer;
+    assert(writer.open(fileName));
+    writer.setFlushThresholds(64 * 1024, 10.0);
+    writeSession(writer, 1000);
+    assert(writer.close());
+    assert(writer.getRecordsWritten() == 3000);
+    cout << "Wrote " << writer.getRecordsWritten() << " records in " << writer.getChunksWritten()
+        << " chunks (" << writer.getBytesWritten() << " bytes)" << endl;
+
+    TelemetryReader reader;
+    assert(reader.open(fileName));
+    RecordView view;
+    int count = 0;
+    uint64_t middleChunk = 0;
+    while (reader.next(view)) {
+        middleChunk = count == 2000 ? reader.getChunkOffset() : middleChunk;
+        int s = count / 3;
+        if (count % 3 == 0) {
+            const LidarScanRecord* fixed = view.as<LidarScanRecord>();
+            assert(view.type == RECORD_LIDAR_SCAN && fixed->count == 667);
+            const float* ranges = view.array<LidarScanRecord, float>(667);
+            assert(ranges[666] == static_cast<float>(s + 666));
+        }
+        else if (count % 3 == 2) {
+            assert(view.type == RECORD_COMMAND && view.as<CommandRecord>()->source == s);
+        }
+        count++;
+    }
+    assert(count == 3000 && reader.getCorruptChunks() == 0 && !reader.isTruncated());
+    reader.close();
+
+    /**
+     * @test Test 2: A damaged chunk and a chunk whose size points past the end of the file are
+     * skipped without losing the chunks after them, and a torn final chunk ends the log cleanly.
+     */
+    {
+        fstream damage(fileName, ios::in | ios::out | ios::binary);
+        damage.seekp(100 * 1024);
+        damage.write("garbage!", 8);
+        uint32_t oversized = 0x7ffffff8u;
+        damage.seekp(static_cast<streamoff>(middleChunk + offsetof(ChunkHeader, payloadSize)));
+        damage.write(reinterpret_cast<const char*>(&oversized), sizeof(oversized));
+    }
+    assert(middleChunk > 100 * 1024 && reader.open(fileName));
+    count = 0;
+    while (reader.next(view)) {
+        count++;
+    }
+    assert(reader.getCorruptChunks() == 2 && !reader.isTruncated());
+    assert(count < 3000 && count > 2700);
+    reader.close();
+    {
+        ofstream torn(fileName, ios::app | ios::binary);
+        ChunkHeader header = { TELEMETRY_MAGIC, TELEMETRY_VERSION, sizeof(ChunkHeader), 4096, 1, 0.0, 0.0, 0, 0 };
+        torn.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        torn.write("partial", 7);
+    }
+    assert(reader.open(fileName));
+    count = 0;
+    while (reader.next(view)) {
+        count++;
+    }
+    cout << "After damage: " << count << " records, " << reader.getCorruptChunks() << " corrupt chunk(s)" << endl;
+    assert(reader.getCorruptChunks() == 2 && reader.isTruncated());
+    assert(count < 3000 && count > 2700);
+    reader.close();
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 3: A partly filled chunk is written once it is older than the age threshold.
+     */
+    assert(writer.open(fileName));
+    writer.setFlushThresholds(1 << 20, 0.05);
+    PoseRecord pose = { 1.0, 2.0, 3.0 };
+    writer.append(RECORD_POSE, 0.0, &pose, sizeof(pose));
+    assert(writer.getChunksWritten() == 0);
+    this_thread::sleep_for(chrono::milliseconds(60));
+    writer.flushIfDue();
+    assert(writer.getChunksWritten() == 1);
+    writer.close();
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    /**
+     * @test Test 4: Throughput with 1 MiB chunks.
+     */
+    assert(writer.open(fileName));
+    writer.setFlushThresholds(1 << 20, 1.0);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    writeSession(writer, 20000);
+    writer.close();
+    double writeSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    assert(reader.open(fileName));
+    double checksum = 0.0;
+    count = 0;
+    while (reader.next(view)) {
+        if (view.type == RECORD_LIDAR_SCAN) {
+            checksum += view.array<LidarScanRecord, float>(667)[0];
+        }
+        count++;
+    }
+    double readSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double megabytes = reader.getFileSize() / 1048576.0;
+    assert(count == 60000 && checksum > 0.0);
+    cout << "Write: " << megabytes / writeSeconds << " MB/s, read: " << megabytes / readSeconds
+        << " MB/s (" << megabytes << " MB)" << endl;
+    reader.close();
+    remove(fileName);
+    remove(telemetryIndexName(fileName).c_str());
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,327 @@
+/**
+ * @file TelemetryReader.cpp
+ * @brief Implementation of the TelemetryReader class.
+ * @date October 2026
+ */
+
+#include "TelemetryReader.h"
+#include <cstring>
+#include <iostream>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+/**
+ * @brief Copies a RECORD_LIDAR_SCAN payload into a LidarScan.
+ * @param scan Receives the scan.
+ * @return False if the record is not a valid lidar scan.
+ */
+bool RecordView::toLidarScan(LidarScan& scan) const {
+    const LidarScanRecord* fixed = as<LidarScanRecord>();
+    if (type != RECORD_LIDAR_SCAN || !fixed || fixed->count > LidarScan::MAX_BEAMS) {
+        return false;
+    }
+    const float* ranges = array<LidarScanRecord, float>(fixed->count);
+    if (!ranges) {
+        return false;
+    }
+    scan.timestamp = timestamp;
+    scan.pose = Pose(fixed->x, fixed->y, fixed->th);
+    scan.angleMin = fixed->angleMin;
+    scan.angleIncrement = fixed->angleIncrement;
+    scan.rangeNumber = static_cast<int>(fixed->count);
+    memcpy(scan.ranges, ranges, fixed->count * sizeof(float));
+    return true;
+}
+
+/**
+ * @brief Constructor for the TelemetryReader class.
+ */
+TelemetryReader::TelemetryReader()
+    : base(nullptr), fileSize(0), nextChunk(0), recordOffset(0), chunkEnd(0), chunkStart(0),
+    verifyCrc(true), corruptChunks(0), truncated(false),
+#ifdef _WIN32
+    fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {}
+#else
+    fileDescriptor(-1) {}
+#endif
+
+/**
+ * @brief Destructor for the TelemetryReader class. Unmaps the file.
+ */
+TelemetryReader::~TelemetryReader() {
+    close();
+}
+
+/**
+ * @brief Maps a log file into memory.
+ * @param name Name of the log file.
+ * @param verify True to check the CRC of every chunk.
+ * @return True on success.
+ */
+bool TelemetryReader::open(const string& name, bool verify) {
+    close();
+    verifyCrc = verify;
+#ifdef _WIN32
+    fileHandle = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        cerr << "Failed to open telemetry log: " << name << endl;
+        return false;
+    }
+    LARGE_INTEGER size;
+    GetFileSizeEx(fileHandle, &size);
+    fileSize = static_cast<uint64_t>(size.QuadPart);
+    if (fileSize > 0) {
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle) {
+            base = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+#else
+    fileDescriptor = ::open(name.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        cerr << "Failed to open telemetry log: " << name << endl;
+        return false;
+    }
+    struct stat info;
+    fstat(fileDescriptor, &info);
+    fileSize = static_cast<uint64_t>(info.st_size);
+    if (fileSize > 0) {
+        void* mapped = mmap(nullptr, static_cast<size_t>(fileSize), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        if (mapped != MAP_FAILED) {
+            base = static_cast<const uint8_t*>(mapped);
+            madvise(mapped, static_cast<size_t>(fileSize), MADV_SEQUENTIAL);
+        }
+    }
+#endif
+    if (fileSize > 0 && !base) {
+        cerr << "Failed to map telemetry log: " << name << endl;
+        close();
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+/**
+ * @brief Unmaps the file. Invalidates all RecordViews.
+ */
+void TelemetryReader::close() {
+#ifdef _WIN32
+    if (base) {
+        UnmapViewOfFile(base);
+    }
+    if (mappingHandle) {
+        CloseHandle(mappingHandle);
+        mappingHandle = nullptr;
+    }
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle);
+        fileHandle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (base) {
+        munmap(const_cast<uint8_t*>(base), static_cast<size_t>(fileSize));
+    }
+    if (fileDescriptor >= 0) {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+#endif
+    base = nullptr;
+    fileSize = 0;
+    rewind();
+}
+
+/**
+ * @brief Checks whether a log is mapped.
+ * @return True if open.
+ */
+bool TelemetryReader::isOpen() const {
+#ifdef _WIN32
+    return fileHandle != INVALID_HANDLE_VALUE;
+#else
+    return fileDescriptor >= 0;
+#endif
+}
+
+/**
+ * @brief Restarts the iteration at the beginning of the log.
+ */
+void TelemetryReader::rewind() {
+    nextChunk = 0;
+    recordOffset = 0;
+    chunkEnd = 0;
+    chunkStart = 0;
+    corruptChunks = 0;
+    truncated = false;
+}
+
+/**
+ * @brief Validates the chunk at an offset.
+ * @param offset Offset of the candidate chunk header.
+ * @return 1 if valid, 0 if invalid, -1 if it extends past the end of the file.
+ */
+int TelemetryReader::checkChunk(uint64_t offset) const {
+    if (offset + sizeof(ChunkHeader) > fileSize) {
+        return -1;
+    }
+    const ChunkHeader* header = reinterpret_cast<const ChunkHeader*>(base + offset);
+    if (header->magic != TELEMETRY_MAGIC || header->version != TELEMETRY_VERSION
+        || header->headerSize < sizeof(ChunkHeader) || header->payloadSize % 8 != 0) {
+        return 0;
+    }
+    if (offset + header->headerSize + header->payloadSize > fileSize) {
+        return -1;
+    }
+    if (verifyCrc && telemetryCrc32(base + offset + header->headerSize, header->payloadSize) != header->crc) {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Moves to the next valid chunk at or after nextChunk.
+ *
+ * After a bad header or CRC the following 8-byte boundaries are searched for the next valid
+ * chunk. A header whose size runs past the end of the file is searched past in the same way:
+ * if a valid chunk follows, its size was corrupt and it counts as a corrupt chunk; otherwise
+ * it is the torn final chunk of an interrupted write and the log is marked truncated.
+ *
+ * @return True if a chunk was entered.
+ */
+bool TelemetryReader::enterNextChunk() {
+    bool skipping = false;
+    bool overrun = false; // The first bad header runs past the end of the file
+    while (nextChunk < fileSize) {
+        int status = checkChunk(nextChunk);
+        if (status == 1) {
+            corruptChunks += overrun ? 1 : 0;
+            const ChunkHeader* header = reinterpret_cast<const ChunkHeader*>(base + nextChunk);
+            chunkStart = nextChunk;
+            recordOffset = nextChunk + header->headerSize;
+            chunkEnd = recordOffset + header->payloadSize;
+            nextChunk = chunkEnd;
+            return true;
+        }
+        if (!skipping) {
+            skipping = true;
+            overrun = status < 0;
+            corruptChunks += overrun ? 0 : 1;
+        }
+        nextChunk += 8; // Chunks start on 8-byte boundaries; search for the next header
+    }
+    truncated = truncated || overrun;
+    return false;
+}
+
+/**
+ * @brief Returns the next record.
+ * @param view Receives the record.
+ * @return False at the end of the log.
+ */
+bool TelemetryReader::next(RecordView& view) {
+    while (!nextInChunk(view)) {
+        if (!enterNextChunk()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the next record of the current chunk without moving on to the next chunk.
+ * @param view Receives the record.
+ * @return False when the current chunk has no more records.
+ */
+bool TelemetryReader::nextInChunk(RecordView& view) {
+    while (recordOffset + sizeof(RecordHeader) <= chunkEnd) {
+        const RecordHeader* header = reinterpret_cast<const RecordHeader*>(base + recordOffset);
+        uint64_t recordSize = telemetryAlign(sizeof(RecordHeader) + header->size);
+        if (recordOffset + recordSize > chunkEnd) {
+            // A record that overruns its chunk means the CRC was not checked; drop the rest of the chunk
+            corruptChunks++;
+            recordOffset = chunkEnd;
+            return false;
+        }
+        recordOffset += recordSize;
+        if (header->type == RECORD_PADDING) {
+            continue;
+        }
+        view.type = header->type;
+        view.timestamp = header->timestamp;
+        view.size = header->size;
+        view.data = reinterpret_cast<const uint8_t*>(header) + sizeof(RecordHeader);
+        view.chunkOffset = chunkStart;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Continues the iteration at the first valid chunk at or after an offset.
+ * @param offset File offset, normally the start of a chunk.
+ * @return True if a chunk was found.
+ */
+bool TelemetryReader::seekChunk(uint64_t offset) {
+    nextChunk = offset;
+    recordOffset = 0;
+    chunkEnd = 0;
+    truncated = false;
+    return enterNextChunk();
+}
+
+/**
+ * @brief Returns the offset of the chunk the iteration is currently in.
+ * @return The chunk offset.
+ */
+uint64_t TelemetryReader::getChunkOffset() const {
+    return chunkStart;
+}
+
+/**
+ * @brief Returns the end offset of the chunk at an offset.
+ * @param offset File offset of a chunk.
+ * @return The end offset, or 0 if there is no valid chunk at the offset.
+ */
+uint64_t TelemetryReader::getChunkEnd(uint64_t offset) const {
+    if (checkChunk(offset) != 1) {
+        return 0;
+    }
+    const ChunkHeader* header = reinterpret_cast<const ChunkHeader*>(base + offset);
+    return offset + header->headerSize + header->payloadSize;
+}
+
+/**
+ * @brief Returns the size of the mapped file.
+ * @return The size in bytes.
+ */
+uint64_t TelemetryReader::getFileSize() const {
+    return fileSize;
+}
+
+/**
+ * @brief Returns the number of chunks skipped because of a bad header, size or CRC.
+ * @return The corrupt chunk count.
+ */
+unsigned long TelemetryReader::getCorruptChunks() const {
+    return corruptChunks;
+}
+
+/**
+ * @brief Checks whether the log ends with an incomplete chunk.
+ * @return True if the last chunk is truncated.
+ */
+bool TelemetryReader::isTruncated() const {
+    return truncated;
+}
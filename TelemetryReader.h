@@ -0,0 +1,192 @@
+/**
+ * @file TelemetryReader.h
+ * @brief Declaration of the TelemetryReader class, which iterates the records of a memory-mapped telemetry log.
+ * @date October 2026
+ */
+
+#ifndef TELEMETRYREADER_H
+#define TELEMETRYREADER_H
+
+#include "TelemetryLog.h"
+#include "LidarScan.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @struct RecordView
+ * @brief A record of a telemetry log, pointing into the mapped file.
+ *
+ * The view stays valid until the reader is closed. Payloads are 8-byte aligned, so the
+ * accessors cast them in place instead of copying.
+ */
+struct RecordView {
+    uint16_t type;           /**< One of TelemetryRecordType. */
+    double timestamp;        /**< Time of the record in seconds. */
+    uint32_t size;           /**< Payload size in bytes. */
+    const uint8_t* data;     /**< Payload. */
+    uint64_t chunkOffset;    /**< File offset of the chunk holding the record. */
+
+    /**
+     * @brief Interprets the start of the payload as a record structure.
+     * @tparam T The payload structure (e.g. PoseRecord).
+     * @return Pointer to the structure, or nullptr if the payload is too small.
+     */
+    template <typename T>
+    const T* as() const {
+        return size >= sizeof(T) ? reinterpret_cast<const T*>(data) : nullptr;
+    }
+
+    /**
+     * @brief Returns the array that follows the fixed part of a payload.
+     * @tparam Fixed The fixed part of the payload (e.g. LidarScanRecord).
+     * @tparam Element The array element type (e.g. float).
+     * @param count Number of elements the fixed part claims.
+     * @return Pointer to the array, or nullptr if the payload is too small.
+     */
+    template <typename Fixed, typename Element>
+    const Element* array(uint32_t count) const {
+        if (size < sizeof(Fixed) || (size - sizeof(Fixed)) / sizeof(Element) < count) {
+            return nullptr;
+        }
+        return reinterpret_cast<const Element*>(data + sizeof(Fixed));
+    }
+
+    /**
+     * @brief Copies a RECORD_LIDAR_SCAN payload into a LidarScan.
+     * @param scan Receives the scan.
+     * @return False if the record is not a valid lidar scan.
+     */
+    bool toLidarScan(LidarScan& scan) const;
+};
+
+/**
+ * @class TelemetryReader
+ * @brief Maps a telemetry log into memory and iterates its records without copying them.
+ *
+ * Every chunk is checked for its magic, size and CRC before its records are returned. A chunk
+ * that fails the check is counted and skipped by searching for the next chunk header; a chunk
+ * that runs past the end of the file (a write interrupted by a crash) ends the iteration.
+ */
+class TelemetryReader {
+private:
+    const uint8_t* base;     /**< Start of the mapped file. */
+    uint64_t fileSize;       /**< Size of the mapped file. */
+    uint64_t nextChunk;      /**< Offset where the next chunk is expected. */
+    uint64_t recordOffset;   /**< Offset of the next record in the current chunk. */
+    uint64_t chunkEnd;       /**< End offset of the current chunk. */
+    uint64_t chunkStart;     /**< Offset of the current chunk. */
+    bool verifyCrc;          /**< True to check the CRC of every chunk. */
+    unsigned long corruptChunks; /**< Chunks skipped because of a bad header, size or CRC. */
+    bool truncated;          /**< True if a chunk runs past the end of the file and no valid chunk follows it. */
+#ifdef _WIN32
+    void* fileHandle;        /**< Handle of the open file. */
+    void* mappingHandle;     /**< Handle of the file mapping. */
+#else
+    int fileDescriptor;      /**< Descriptor of the open file. */
+#endif
+
+    /**
+     * @brief Validates the chunk at an offset.
+     * @param offset Offset of the candidate chunk header.
+     * @return 1 if valid, 0 if invalid, -1 if it extends past the end of the file.
+     */
+    int checkChunk(uint64_t offset) const;
+
+    /**
+     * @brief Moves to the next valid chunk at or after nextChunk.
+     * @return True if a chunk was entered.
+     */
+    bool enterNextChunk();
+
+public:
+    /**
+     * @brief Constructor for the TelemetryReader class.
+     */
+    TelemetryReader();
+
+    /**
+     * @brief Destructor for the TelemetryReader class. Unmaps the file.
+     */
+    ~TelemetryReader();
+
+    TelemetryReader(const TelemetryReader&) = delete;
+    TelemetryReader& operator=(const TelemetryReader&) = delete;
+
+    /**
+     * @brief Maps a log file into memory.
+     * @param name Name of the log file.
+     * @param verify True to check the CRC of every chunk.
+     * @return True on success.
+     */
+    bool open(const std::string& name, bool verify = true);
+
+    /**
+     * @brief Unmaps the file. Invalidates all RecordViews.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a log is mapped.
+     * @return True if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Returns the next record.
+     * @param view Receives the record.
+     * @return False at the end of the log.
+     */
+    bool next(RecordView& view);
+
+    /**
+     * @brief Returns the next record of the current chunk without moving on to the next chunk.
+     * @param view Receives the record.
+     * @return False when the current chunk has no more records.
+     */
+    bool nextInChunk(RecordView& view);
+
+    /**
+     * @brief Continues the iteration at the first valid chunk at or after an offset.
+     * @param offset File offset, normally the start of a chunk.
+     * @return True if a chunk was found.
+     */
+    bool seekChunk(uint64_t offset);
+
+    /**
+     * @brief Returns the offset of the chunk the iteration is currently in.
+     * @return The chunk offset.
+     */
+    uint64_t getChunkOffset() const;
+
+    /**
+     * @brief Returns the end offset of the chunk at an offset.
+     * @param offset File offset of a chunk.
+     * @return The end offset, or 0 if there is no valid chunk at the offset.
+     */
+    uint64_t getChunkEnd(uint64_t offset) const;
+
+    /**
+     * @brief Restarts the iteration at the beginning of the log.
+     */
+    void rewind();
+
+    /**
+     * @brief Returns the size of the mapped file.
+     * @return The size in bytes.
+     */
+    uint64_t getFileSize() const;
+
+    /**
+     * @brief Returns the number of chunks skipped because of a bad header, size or CRC.
+     * @return The corrupt chunk count.
+     */
+    unsigned long getCorruptChunks() const;
+
+    /**
+     * @brief Checks whether the log ends with an incomplete chunk.
+     * @return True if the last chunk is truncated.
+     */
+    bool isTruncated() const;
+};
+
+#endif // TELEMETRYREADER_H
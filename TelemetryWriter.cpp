@@ -0,0 +1,305 @@
+/**
+ * @file TelemetryWriter.cpp
+ * @brief Implementation of the TelemetryWriter class.
+ * @date October 2026
+ */
+
+#include "TelemetryWriter.h"
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+/** @brief Alignment of the chunk buffer, matching the page size. */
+static const size_t BUFFER_ALIGNMENT = 4096;
+
+/** @brief Default chunk size in bytes. */
+static const size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+
+/**
+ * @brief Constructor for the TelemetryWriter class.
+ */
+TelemetryWriter::TelemetryWriter()
+    : buffer(nullptr), capacity(0), used(sizeof(ChunkHeader)), recordCount(0), firstTimestamp(0.0),
+    lastTimestamp(0.0), maxAgeSeconds(1.0), bytesWritten(0), recordsWritten(0), chunksWritten(0), archiver(nullptr) {
+    spans.reset();
+    setFlushThresholds(DEFAULT_CHUNK_BYTES, maxAgeSeconds);
+}
+
+/**
+ * @brief Destructor for the TelemetryWriter class. Writes any buffered records.
+ */
+TelemetryWriter::~TelemetryWriter() {
+    if (isOpen()) {
+        close();
+    }
+    telemetryFree(buffer);
+}
+
+/**
+ * @brief Opens a log for appending, creating it if necessary.
+ * @param name Name of the log file.
+ * @return True on success.
+ */
+bool TelemetryWriter::open(const string& name) {
+    if (isOpen()) {
+        close();
+    }
+    file.open(name, ios::binary | ios::app);
+    if (!file.is_open()) {
+        cerr << "Failed to open telemetry log: " << name << endl;
+        return false;
+    }
+    fileName = name;
+    index.open(name); // Without an index the log is still complete; readers rebuild the index
+    bytesWritten = 0;
+    recordsWritten = 0;
+    chunksWritten = 0;
+    return true;
+}
+
+/**
+ * @brief Writes any buffered records and closes the log.
+ * @return True on success.
+ */
+bool TelemetryWriter::close() {
+    if (!isOpen()) {
+        return false;
+    }
+    bool flushed = flush();
+    file.close();
+    index.close();
+    return flushed && !file.fail();
+}
+
+/**
+ * @brief Checks whether a log is open.
+ * @return True if open.
+ */
+bool TelemetryWriter::isOpen() const {
+    return file.is_open();
+}
+
+/**
+ * @brief Sets the flush thresholds. Takes effect for the next chunk.
+ * @param chunkBytes Chunk size in bytes (the buffer is reallocated if it changes).
+ * @param maxAge Oldest buffered record age in seconds that forces a flush.
+ * @return True on success.
+ */
+bool TelemetryWriter::setFlushThresholds(size_t chunkBytes, double maxAge) {
+    if (chunkBytes < 2 * sizeof(ChunkHeader) || chunkBytes > UINT32_MAX) {
+        cerr << "Error: Invalid telemetry chunk size." << endl;
+        return false;
+    }
+    maxAgeSeconds = maxAge;
+    if (chunkBytes == capacity) {
+        return true;
+    }
+    if (recordCount > 0 && !flush()) {
+        return false;
+    }
+    uint8_t* resized = static_cast<uint8_t*>(telemetryAlloc(chunkBytes, BUFFER_ALIGNMENT));
+    if (!resized) {
+        cerr << "Error: Could not allocate the telemetry buffer." << endl;
+        return false;
+    }
+    telemetryFree(buffer);
+    buffer = resized;
+    capacity = chunkBytes;
+    return true;
+}
+
+/**
+ * @brief Sends closed segments to an archiver.
+ * @param segmentArchiver The started archiver, or nullptr to append to one file.
+ */
+void TelemetryWriter::setArchiver(LogArchiver* segmentArchiver) {
+    archiver = segmentArchiver;
+}
+
+/**
+ * @brief Appends a record.
+ * @param type One of TelemetryRecordType.
+ * @param timestamp Time of the record in seconds.
+ * @param payload The payload.
+ * @param size Payload size in bytes.
+ * @return True on success.
+ */
+bool TelemetryWriter::append(uint16_t type, double timestamp, const void* payload, uint32_t size) {
+    return append(type, timestamp, payload, size, nullptr, 0);
+}
+
+/**
+ * @brief Appends a record whose payload is a fixed part followed by an array.
+ * @param type One of TelemetryRecordType.
+ * @param timestamp Time of the record in seconds.
+ * @param head The fixed part of the payload.
+ * @param headSize Size of the fixed part.
+ * @param body The array part of the payload (may be nullptr if bodySize is 0).
+ * @param bodySize Size of the array part.
+ * @return True on success.
+ */
+bool TelemetryWriter::append(uint16_t type, double timestamp, const void* head, uint32_t headSize,
+    const void* body, uint32_t bodySize) {
+    if (!isOpen()) {
+        cerr << "Error: Telemetry log is not open." << endl;
+        return false;
+    }
+    size_t payloadSize = static_cast<size_t>(headSize) + bodySize;
+    size_t recordSize = telemetryAlign(sizeof(RecordHeader) + payloadSize);
+
+    if (used + recordSize > capacity && !flush()) {
+        return false;
+    }
+
+    // A record larger than a whole chunk gets a chunk of its own
+    uint8_t* target = buffer;
+    uint8_t* oversized = nullptr;
+    if (sizeof(ChunkHeader) + recordSize > capacity) {
+        oversized = static_cast<uint8_t*>(telemetryAlloc(sizeof(ChunkHeader) + recordSize, BUFFER_ALIGNMENT));
+        if (!oversized) {
+            cerr << "Error: Could not allocate an oversized telemetry chunk." << endl;
+            return false;
+        }
+        target = oversized;
+    }
+
+    uint8_t* record = target + (oversized ? sizeof(ChunkHeader) : used);
+    RecordHeader header;
+    header.type = type;
+    header.reserved = 0;
+    header.size = static_cast<uint32_t>(payloadSize);
+    header.timestamp = timestamp;
+    memcpy(record, &header, sizeof(header));
+    if (headSize > 0) {
+        memcpy(record + sizeof(header), head, headSize);
+    }
+    if (bodySize > 0) {
+        memcpy(record + sizeof(header) + headSize, body, bodySize);
+    }
+    memset(record + sizeof(header) + payloadSize, 0, recordSize - sizeof(header) - payloadSize);
+
+    if (oversized) {
+        ChunkTypeSpans single;
+        single.reset();
+        single.add(type, timestamp);
+        bool written = writeChunk(oversized, recordSize, 1, timestamp, timestamp, single);
+        telemetryFree(oversized);
+        return written;
+    }
+
+    if (recordCount == 0) {
+        firstTimestamp = timestamp;
+        lastTimestamp = timestamp;
+        oldestBuffered = chrono::steady_clock::now();
+    }
+    firstTimestamp = timestamp < firstTimestamp ? timestamp : firstTimestamp;
+    lastTimestamp = timestamp > lastTimestamp ? timestamp : lastTimestamp;
+    spans.add(type, timestamp);
+    recordCount++;
+    used += recordSize;
+    return flushIfDue();
+}
+
+/**
+ * @brief Writes the buffered records as a chunk.
+ * @return True on success (also when nothing was buffered).
+ */
+bool TelemetryWriter::flush() {
+    if (recordCount == 0) {
+        return true;
+    }
+    bool written = writeChunk(buffer, used - sizeof(ChunkHeader), recordCount, firstTimestamp, lastTimestamp, spans);
+    used = sizeof(ChunkHeader);
+    recordCount = 0;
+    spans.reset();
+    return written;
+}
+
+/**
+ * @brief Flushes if the oldest buffered record is older than the age threshold.
+ * @return True on success.
+ */
+bool TelemetryWriter::flushIfDue() {
+    if (recordCount == 0) {
+        return true;
+    }
+    double age = chrono::duration<double>(chrono::steady_clock::now() - oldestBuffered).count();
+    if (age >= maxAgeSeconds) {
+        return flush();
+    }
+    return true;
+}
+
+/**
+ * @brief Writes a complete chunk to the file.
+ * @param chunk The chunk, starting with a ChunkHeader whose fields are filled in here.
+ * @param payloadSize Size of the records following the header.
+ * @param records Number of records in the chunk.
+ * @param first Earliest record timestamp.
+ * @param last Latest record timestamp.
+ * @param chunkSpans Per-type time spans of the records, for the index.
+ * @return True on success.
+ */
+bool TelemetryWriter::writeChunk(uint8_t* chunk, size_t payloadSize, uint32_t records, double first, double last,
+    const ChunkTypeSpans& chunkSpans) {
+    telemetryFinishChunk(chunk, payloadSize, records, first, last);
+
+    size_t total = sizeof(ChunkHeader) + payloadSize;
+    file.write(reinterpret_cast<const char*>(chunk), static_cast<streamsize>(total));
+    file.flush();
+    if (file.fail()) {
+        cerr << "Error: Failed to write telemetry chunk to " << fileName << endl;
+        file.clear();
+        index.close(); // Offsets are unknown after a partial write
+        return false;
+    }
+    index.append(total, chunkSpans);
+    bytesWritten += total;
+    recordsWritten += records;
+    chunksWritten++;
+    if (archiver && archiver->addBytes(total)) {
+        return rotateSegment();
+    }
+    return true;
+}
+
+/**
+ * @brief Closes the file, hands it to the archiver as a segment and opens a new one under the same name.
+ * @return True if the log is open afterwards.
+ */
+bool TelemetryWriter::rotateSegment() {
+    file.close();
+    index.close();
+    archiver->archive(); // On failure the same file is opened again
+    file.open(fileName, ios::binary | ios::app);
+    if (!file.is_open()) {
+        cerr << "Error: Failed to reopen telemetry log after rotation: " << fileName << endl;
+        return false;
+    }
+    index.open(fileName);
+    return true;
+}
+
+/**
+ * @brief Returns the number of bytes written since open().
+ * @return The byte count.
+ */
+uint64_t TelemetryWriter::getBytesWritten() const {
+    return bytesWritten;
+}
+
+/**
+ * @brief Returns the number of records written since open().
+ * @return The record count.
+ */
+unsigned long TelemetryWriter::getRecordsWritten() const {
+    return recordsWritten;
+}
+
+/**
+ * @brief Returns the number of chunks written since open().
+ * @return The chunk count.
+ */
+unsigned long TelemetryWriter::getChunksWritten() const {
+    return chunksWritten;
+}
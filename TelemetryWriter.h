@@ -0,0 +1,168 @@
+/**
+ * @file TelemetryWriter.h
+ * @brief Declaration of the TelemetryWriter class, which appends records to a binary telemetry log.
+ * @date October 2026
+ */
+
+#ifndef TELEMETRYWRITER_H
+#define TELEMETRYWRITER_H
+
+#include "TelemetryLog.h"
+#include "TelemetryIndex.h"
+#include "LogArchiver.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/**
+ * @class TelemetryWriter
+ * @brief Batches records into chunks in a large aligned buffer and appends each chunk with one write.
+ *
+ * A chunk is written when the buffer cannot take the next record, when its oldest record is
+ * older than the age threshold, or on flush(). Nothing reaches the file between chunk writes,
+ * so a crash loses at most the records of the unwritten chunk; the reader skips a torn chunk
+ * at the end of the file by its size and CRC. Each written chunk is also recorded in the
+ * sidecar time index (see TelemetryIndex.h). With an archiver the file is rotated after the
+ * chunk that fills the active segment.
+ */
+class TelemetryWriter {
+private:
+    std::ofstream file;          /**< Output file, opened for appending. */
+    std::string fileName;        /**< Name of the open file. */
+    uint8_t* buffer;             /**< Chunk under construction: ChunkHeader followed by records. */
+    size_t capacity;             /**< Size of the buffer in bytes. */
+    size_t used;                 /**< Bytes of the buffer in use, including the chunk header. */
+    uint32_t recordCount;        /**< Records in the chunk under construction. */
+    double firstTimestamp;       /**< Earliest buffered record timestamp. */
+    double lastTimestamp;        /**< Latest buffered record timestamp. */
+    double maxAgeSeconds;        /**< Age of the oldest buffered record that forces a flush. */
+    std::chrono::steady_clock::time_point oldestBuffered; /**< When the first buffered record was added. */
+    uint64_t bytesWritten;       /**< Bytes written to the file since open(). */
+    unsigned long recordsWritten; /**< Records written to the file since open(). */
+    unsigned long chunksWritten; /**< Chunks written to the file since open(). */
+    ChunkTypeSpans spans;        /**< Per-type time spans of the buffered records. */
+    TelemetryIndexWriter index;  /**< Sidecar time index of the file. */
+    LogArchiver* archiver;       /**< Receives closed segments, or nullptr. */
+
+    /**
+     * @brief Closes the file, hands it to the archiver as a segment and opens a new one under the same name.
+     * @return True if the log is open afterwards.
+     */
+    bool rotateSegment();
+
+    /**
+     * @brief Writes a complete chunk to the file.
+     * @param chunk The chunk, starting with a ChunkHeader whose fields are filled in here.
+     * @param payloadSize Size of the records following the header.
+     * @param records Number of records in the chunk.
+     * @param first Earliest record timestamp.
+     * @param last Latest record timestamp.
+     * @param chunkSpans Per-type time spans of the records, for the index.
+     * @return True on success.
+     */
+    bool writeChunk(uint8_t* chunk, size_t payloadSize, uint32_t records, double first, double last,
+        const ChunkTypeSpans& chunkSpans);
+
+public:
+    /**
+     * @brief Constructor for the TelemetryWriter class.
+     */
+    TelemetryWriter();
+
+    /**
+     * @brief Destructor for the TelemetryWriter class. Writes any buffered records.
+     */
+    ~TelemetryWriter();
+
+    TelemetryWriter(const TelemetryWriter&) = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    /**
+     * @brief Opens a log for appending, creating it if necessary.
+     * @param name Name of the log file.
+     * @return True on success.
+     */
+    bool open(const std::string& name);
+
+    /**
+     * @brief Writes any buffered records and closes the log.
+     * @return True on success.
+     */
+    bool close();
+
+    /**
+     * @brief Checks whether a log is open.
+     * @return True if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Sets the flush thresholds. Takes effect for the next chunk.
+     * @param chunkBytes Chunk size in bytes (the buffer is reallocated if it changes).
+     * @param maxAge Oldest buffered record age in seconds that forces a flush.
+     * @return True on success.
+     */
+    bool setFlushThresholds(size_t chunkBytes, double maxAge);
+
+    /**
+     * @brief Sends closed segments to an archiver, which decides when to rotate.
+     * @param segmentArchiver The started archiver, or nullptr to append to one file.
+     */
+    void setArchiver(LogArchiver* segmentArchiver);
+
+    /**
+     * @brief Appends a record.
+     * @param type One of TelemetryRecordType.
+     * @param timestamp Time of the record in seconds.
+     * @param payload The payload.
+     * @param size Payload size in bytes.
+     * @return True on success.
+     */
+    bool append(uint16_t type, double timestamp, const void* payload, uint32_t size);
+
+    /**
+     * @brief Appends a record whose payload is a fixed part followed by an array, without copying them together first.
+     * @param type One of TelemetryRecordType.
+     * @param timestamp Time of the record in seconds.
+     * @param head The fixed part of the payload.
+     * @param headSize Size of the fixed part.
+     * @param body The array part of the payload (may be nullptr if bodySize is 0).
+     * @param bodySize Size of the array part.
+     * @return True on success.
+     */
+    bool append(uint16_t type, double timestamp, const void* head, uint32_t headSize, const void* body, uint32_t bodySize);
+
+    /**
+     * @brief Writes the buffered records as a chunk.
+     * @return True on success (also when nothing was buffered).
+     */
+    bool flush();
+
+    /**
+     * @brief Flushes if the oldest buffered record is older than the age threshold.
+     * Meant for periodic callers when records arrive too rarely to trigger the check in append().
+     * @return True on success.
+     */
+    bool flushIfDue();
+
+    /**
+     * @brief Returns the number of bytes written since open().
+     * @return The byte count.
+     */
+    uint64_t getBytesWritten() const;
+
+    /**
+     * @brief Returns the number of records written since open().
+     * @return The record count.
+     */
+    unsigned long getRecordsWritten() const;
+
+    /**
+     * @brief Returns the number of chunks written since open().
+     * @return The chunk count.
+     */
+    unsigned long getChunksWritten() const;
+};
+
+#endif // TELEMETRYWRITER_H
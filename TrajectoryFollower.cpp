@@ -0,0 +1,318 @@
+/**
+ * @file TrajectoryFollower.cpp
+ * @brief Implementation of the TrajectoryFollower class for closed-loop waypoint tracking.
+ * @date October 2026
+ */
+
+#include "TrajectoryFollower.h"
+#include "Transform2D.h"
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * @brief Lowest speed cap of a timed path in m/s, so that the robot leaves the start and the
+ * sharp corners where the timed speed is 0.
+ */
+static const double MIN_PROFILE_SPEED = 0.02;
+
+/**
+ * @brief Constructor for the TrajectoryFollower class.
+ * @param controller Pointer to the robot controller.
+ */
+TrajectoryFollower::TrajectoryFollower(RobotControler* controller)
+    : controller(controller), segment(0), finished(true), metrics(),
+      lookahead(0.4), maxSpeed(0.2), maxDecel(0.3), maxAngularSpeed(0.5), headingGain(1.5),
+      goalTolerance(0.05), headingTolerance(0.05), searchWindow(16), rateHz(50.0), budgetUs(1000.0),
+      running(false) {}
+
+/**
+ * @brief Destructor; stops the control thread.
+ */
+TrajectoryFollower::~TrajectoryFollower() {
+    stop();
+}
+
+/**
+ * @brief Replaces the path and resets the progress.
+ * @param waypoints Waypoints to follow (x, y in meters, th in radians).
+ */
+void TrajectoryFollower::setPath(const vector<Pose>& waypoints) {
+    lock_guard<mutex> lock(pathMutex);
+    installPath(waypoints, vector<double>());
+}
+
+/**
+ * @brief Replaces the path with a timed one and resets the progress.
+ * @param waypoints Waypoints to follow (x, y in meters, th in radians).
+ * @param speeds Speed at each waypoint in m/s; ignored unless there is one per waypoint.
+ */
+void TrajectoryFollower::setPath(const vector<Pose>& waypoints, const vector<double>& speeds) {
+    lock_guard<mutex> lock(pathMutex); // One critical section, so no cycle sees the path without its speeds
+    installPath(waypoints, speeds);
+}
+
+/**
+ * @brief Replaces the path and speeds and resets the progress. The caller holds pathMutex.
+ * @param waypoints Waypoints to follow.
+ * @param speeds Speed at each waypoint in m/s; ignored unless there is one per waypoint.
+ */
+void TrajectoryFollower::installPath(const vector<Pose>& waypoints, const vector<double>& speeds) {
+    path = waypoints;
+    cumulative.assign(path.size(), 0.0);
+    for (size_t i = 1; i < path.size(); i++) {
+        cumulative[i] = cumulative[i - 1] + path[i - 1].findDistanceTo(path[i]);
+    }
+    segment = 0;
+    finished = path.empty();
+    metrics = FollowerMetrics();
+    metrics.remainingDistance = path.empty() ? 0.0 : cumulative.back();
+    if (speeds.size() == path.size()) {
+        speedLimits = speeds;
+    }
+    else {
+        speedLimits.clear();
+    }
+}
+
+/**
+ * @brief Sets the tracking parameters.
+ * @param lookaheadDistance Lookahead distance in meters.
+ * @param speed Maximum translational speed in m/s.
+ * @param angularSpeed Maximum angular speed in rad/s.
+ * @param tolerance Position tolerance at the goal in meters.
+ */
+void TrajectoryFollower::setParameters(double lookaheadDistance, double speed, double angularSpeed, double tolerance) {
+    lock_guard<mutex> lock(pathMutex);
+    lookahead = lookaheadDistance;
+    maxSpeed = speed;
+    maxAngularSpeed = angularSpeed;
+    goalTolerance = tolerance;
+}
+
+/**
+ * @brief Sets the control rate and the per-cycle compute budget.
+ * @param hz Control rate in Hz.
+ * @param cycleBudgetUs Compute budget per cycle in microseconds.
+ */
+void TrajectoryFollower::setRate(double hz, double cycleBudgetUs) {
+    lock_guard<mutex> lock(pathMutex);
+    rateHz = hz > 0.0 ? hz : 50.0;
+    budgetUs = cycleBudgetUs;
+}
+
+/**
+ * @brief Computes the pure-pursuit velocity command for a pose.
+ * @param pose Current robot pose.
+ * @param command Output body-frame velocity.
+ * @return True when the final waypoint has been reached.
+ */
+bool TrajectoryFollower::computeCommand(const Pose& pose, VelocityCommand& command) {
+    chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+    lock_guard<mutex> lock(pathMutex);
+    command = VelocityCommand{ 0.0, 0.0, 0.0 };
+    if (path.empty()) {
+        finished = true;
+        return true;
+    }
+
+    const double px = pose.getX();
+    const double py = pose.getY();
+    const size_t last = path.size() - 1;
+
+    // Project the robot onto the path, searching a bounded window ahead of the last segment.
+    double bestDistSq = -1.0;
+    double bestT = 0.0;
+    size_t bestSeg = segment;
+    size_t windowEnd = segment + static_cast<size_t>(searchWindow);
+    if (windowEnd > last) windowEnd = last;
+    for (size_t i = segment; i < windowEnd; i++) {
+        double ax = path[i].getX(), ay = path[i].getY();
+        double dx = path[i + 1].getX() - ax, dy = path[i + 1].getY() - ay;
+        double lenSq = dx * dx + dy * dy;
+        double t = lenSq > 0.0 ? ((px - ax) * dx + (py - ay) * dy) / lenSq : 0.0;
+        if (t < 0.0) t = 0.0;
+        if (t > 1.0) t = 1.0;
+        double cx = ax + t * dx - px, cy = ay + t * dy - py;
+        double distSq = cx * cx + cy * cy;
+        if (bestDistSq < 0.0 || distSq < bestDistSq) {
+            bestDistSq = distSq;
+            bestSeg = i;
+            bestT = t;
+        }
+    }
+    double along;
+    if (bestDistSq < 0.0) {
+        // Single waypoint path: track it directly.
+        bestSeg = last;
+        bestT = 0.0;
+        bestDistSq = (path[last].getX() - px) * (path[last].getX() - px) + (path[last].getY() - py) * (path[last].getY() - py);
+        along = cumulative[last];
+    }
+    else {
+        along = cumulative[bestSeg] + bestT * (cumulative[bestSeg + 1] - cumulative[bestSeg]);
+    }
+    segment = bestSeg;
+    double remaining = cumulative[last] - along;
+
+    // Walk the lookahead distance along the path (bounded by the same window).
+    double targetX = path[last].getX();
+    double targetY = path[last].getY();
+    double goalAlong = along + lookahead;
+    size_t walkEnd = bestSeg + static_cast<size_t>(searchWindow);
+    if (walkEnd > last) walkEnd = last;
+    for (size_t i = bestSeg; i < walkEnd; i++) {
+        if (cumulative[i + 1] >= goalAlong) {
+            double len = cumulative[i + 1] - cumulative[i];
+            double t = len > 0.0 ? (goalAlong - cumulative[i]) / len : 1.0;
+            targetX = path[i].getX() + t * (path[i + 1].getX() - path[i].getX());
+            targetY = path[i].getY() + t * (path[i + 1].getY() - path[i].getY());
+            break;
+        }
+        if (i + 1 == walkEnd) {
+            targetX = path[i + 1].getX();
+            targetY = path[i + 1].getY();
+        }
+    }
+
+    double goalDx = path[last].getX() - px;
+    double goalDy = path[last].getY() - py;
+    double goalDist = sqrt(goalDx * goalDx + goalDy * goalDy);
+    double headingTarget = path[bestSeg + 1 <= last ? bestSeg + 1 : last].getTh();
+    double headingError = normalizeAngle(headingTarget - pose.getTh());
+
+    bool positionReached = remaining < goalTolerance && goalDist < goalTolerance;
+    if (positionReached && fabs(headingError) < headingTolerance) {
+        finished = true;
+    }
+    else {
+        // Speed limited so that the robot can stop at the goal with maxDecel.
+        double distanceLeft = remaining > goalDist ? remaining : goalDist;
+        double speed = sqrt(2.0 * maxDecel * distanceLeft);
+        if (speed > maxSpeed) speed = maxSpeed;
+        if (!speedLimits.empty()) {
+            double limit = bestSeg < last ? speedLimits[bestSeg] + bestT * (speedLimits[bestSeg + 1] - speedLimits[bestSeg])
+                                          : speedLimits[last];
+            if (limit < MIN_PROFILE_SPEED) limit = MIN_PROFILE_SPEED;
+            if (speed > limit) speed = limit;
+        }
+
+        double wx = targetX - px;
+        double wy = targetY - py;
+        double norm = sqrt(wx * wx + wy * wy);
+        if (norm > 1e-9 && !positionReached) {
+            double c = cos(pose.getTh());
+            double s = sin(pose.getTh());
+            command.vx = speed * (c * wx + s * wy) / norm;
+            command.vy = speed * (-s * wx + c * wy) / norm;
+        }
+        double omega = headingGain * headingError;
+        if (omega > maxAngularSpeed) omega = maxAngularSpeed;
+        if (omega < -maxAngularSpeed) omega = -maxAngularSpeed;
+        command.omega = fabs(headingError) < headingTolerance ? 0.0 : omega;
+    }
+
+    double elapsedUs = chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count();
+    metrics.cycles++;
+    metrics.lastCycleUs = elapsedUs;
+    if (elapsedUs > metrics.maxCycleUs) metrics.maxCycleUs = elapsedUs;
+    metrics.meanCycleUs += (elapsedUs - metrics.meanCycleUs) / static_cast<double>(metrics.cycles);
+    if (elapsedUs > budgetUs) metrics.budgetOverruns++;
+    metrics.crossTrackError = sqrt(bestDistSq);
+    metrics.remainingDistance = remaining;
+    return finished;
+}
+
+/**
+ * @brief Runs one control cycle: reads the pose, computes and sends the command.
+ * @return True when the final waypoint has been reached.
+ */
+bool TrajectoryFollower::step() {
+    VelocityCommand command;
+    bool done = computeCommand(controller->getPose(), command);
+    controller->setVelocity(command.vx, command.vy, command.omega);
+    return done;
+}
+
+/**
+ * @brief Starts following the path on a background thread at the configured rate.
+ * @return True if the thread was started, false if it was already running or there is no path.
+ */
+bool TrajectoryFollower::start() {
+    if (running) {
+        return false;
+    }
+    {
+        lock_guard<mutex> lock(pathMutex);
+        if (path.empty()) {
+            return false;
+        }
+    }
+    if (worker.joinable()) {
+        worker.join();
+    }
+    running = true;
+    worker = thread(&TrajectoryFollower::run, this);
+    return true;
+}
+
+/**
+ * @brief Stops the control thread and the robot.
+ */
+void TrajectoryFollower::stop() {
+    bool wasRunning = running.exchange(false);
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (wasRunning) {
+        controller->setVelocity(0.0, 0.0, 0.0);
+    }
+}
+
+/**
+ * @brief Returns whether the final waypoint has been reached.
+ * @return True if finished, false otherwise.
+ */
+bool TrajectoryFollower::isFinished() {
+    lock_guard<mutex> lock(pathMutex);
+    return finished;
+}
+
+/**
+ * @brief Returns whether the control thread is running.
+ * @return True if running, false otherwise.
+ */
+bool TrajectoryFollower::isRunning() const {
+    return running;
+}
+
+/**
+ * @brief Returns a snapshot of the cycle statistics.
+ * @return The metrics.
+ */
+FollowerMetrics TrajectoryFollower::getMetrics() {
+    lock_guard<mutex> lock(pathMutex);
+    return metrics;
+}
+
+/**
+ * @brief Control thread body. Runs step() at absolute deadlines until the goal is reached.
+ */
+void TrajectoryFollower::run() {
+    chrono::steady_clock::duration period;
+    {
+        lock_guard<mutex> lock(pathMutex);
+        period = chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(1.0 / rateHz));
+    }
+    chrono::steady_clock::time_point next = chrono::steady_clock::now();
+    while (running) {
+        if (step()) {
+            break;
+        }
+        next += period;
+        this_thread::sleep_until(next);
+    }
+    controller->setVelocity(0.0, 0.0, 0.0);
+    running = false;
+}
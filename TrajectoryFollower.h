@@ -0,0 +1,169 @@
+/**
+ * @file TrajectoryFollower.h
+ * @brief Declaration of the TrajectoryFollower class, a pure-pursuit tracker for Pose waypoint paths.
+ * @date October 2026
+ */
+
+#ifndef TRAJECTORYFOLLOWER_H
+#define TRAJECTORYFOLLOWER_H
+
+#include "RobotControler.h"
+#include "CommandStreamer.h"
+#include "Pose.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct FollowerMetrics
+ * @brief Timing and tracking statistics of the follower's control cycles.
+ */
+struct FollowerMetrics {
+    unsigned long cycles;         /**< Number of control cycles executed. */
+    unsigned long budgetOverruns; /**< Cycles whose compute time exceeded the budget. */
+    double lastCycleUs;           /**< Compute time of the last cycle in microseconds. */
+    double maxCycleUs;            /**< Largest compute time in microseconds. */
+    double meanCycleUs;           /**< Mean compute time in microseconds. */
+    double crossTrackError;       /**< Distance from the robot to the path in meters (last cycle). */
+    double remainingDistance;     /**< Path length left to the final waypoint in meters. */
+};
+
+/**
+ * @class TrajectoryFollower
+ * @brief Tracks a list of Pose waypoints with omnidirectional pure pursuit.
+ *
+ * Each cycle the robot pose is projected onto the path, a lookahead point is taken a fixed
+ * distance further along it, and the body-frame velocity toward that point is sent with
+ * RobotControler::setVelocity(). Because the base is holonomic, translation and heading are
+ * controlled independently: the heading follows the waypoint headings (radians). The
+ * projection and lookahead searches only visit a bounded window of segments, so the
+ * per-cycle cost does not grow with the path length. A path timed by PathSmoother also carries
+ * a speed per waypoint, which caps the speed at the robot's place on the path.
+ */
+class TrajectoryFollower {
+private:
+    RobotControler* controller;    /**< Controller used to read the pose and send velocities. */
+
+    std::mutex pathMutex;          /**< Protects the path, progress and metrics. */
+    std::vector<Pose> path;        /**< Waypoints to follow. */
+    std::vector<double> cumulative; /**< Path length from the first waypoint to each waypoint. */
+    std::vector<double> speedLimits; /**< Speed at each waypoint in m/s, or empty for no limit. */
+    size_t segment;                /**< Index of the segment the robot was last projected onto. */
+    bool finished;                 /**< True once the final waypoint is reached. */
+    FollowerMetrics metrics;       /**< Cycle statistics. */
+
+    double lookahead;              /**< Lookahead distance in meters. */
+    double maxSpeed;               /**< Maximum translational speed in m/s. */
+    double maxDecel;               /**< Deceleration used to slow down before the goal in m/s^2. */
+    double maxAngularSpeed;        /**< Maximum angular speed in rad/s. */
+    double headingGain;            /**< Proportional gain of the heading controller. */
+    double goalTolerance;          /**< Position tolerance at the final waypoint in meters. */
+    double headingTolerance;       /**< Heading tolerance at the final waypoint in radians. */
+    int searchWindow;              /**< Maximum number of segments visited per search. */
+    double rateHz;                 /**< Control rate in Hz. */
+    double budgetUs;               /**< Per-cycle compute budget in microseconds. */
+
+    std::thread worker;            /**< Control thread. */
+    std::atomic<bool> running;     /**< True while the control thread runs. */
+
+    /**
+     * @brief Control thread body.
+     */
+    void run();
+
+    /**
+     * @brief Replaces the path and speeds and resets the progress. The caller holds pathMutex.
+     * @param waypoints Waypoints to follow.
+     * @param speeds Speed at each waypoint in m/s; ignored unless there is one per waypoint.
+     */
+    void installPath(const std::vector<Pose>& waypoints, const std::vector<double>& speeds);
+
+public:
+    /**
+     * @brief Constructor for the TrajectoryFollower class.
+     * @param controller Pointer to the robot controller.
+     */
+    explicit TrajectoryFollower(RobotControler* controller);
+
+    /**
+     * @brief Destructor; stops the control thread.
+     */
+    ~TrajectoryFollower();
+
+    /**
+     * @brief Replaces the path and resets the progress.
+     * @param waypoints Waypoints to follow (x, y in meters, th in radians).
+     */
+    void setPath(const std::vector<Pose>& waypoints);
+
+    /**
+     * @brief Replaces the path with a timed one and resets the progress.
+     * @param waypoints Waypoints to follow (x, y in meters, th in radians).
+     * @param speeds Speed at each waypoint in m/s, e.g. from PathSmoother::smooth(); the speed
+     *        interpolated at the robot's projection caps the command.
+     */
+    void setPath(const std::vector<Pose>& waypoints, const std::vector<double>& speeds);
+
+    /**
+     * @brief Sets the tracking parameters.
+     * @param lookaheadDistance Lookahead distance in meters.
+     * @param speed Maximum translational speed in m/s.
+     * @param angularSpeed Maximum angular speed in rad/s.
+     * @param tolerance Position tolerance at the goal in meters.
+     */
+    void setParameters(double lookaheadDistance, double speed, double angularSpeed, double tolerance);
+
+    /**
+     * @brief Sets the control rate and the per-cycle compute budget.
+     * @param hz Control rate in Hz.
+     * @param cycleBudgetUs Compute budget per cycle in microseconds.
+     */
+    void setRate(double hz, double cycleBudgetUs);
+
+    /**
+     * @brief Computes the velocity command for a pose without touching the robot.
+     * Advances the path progress and updates the metrics.
+     * @param pose Current robot pose.
+     * @param command Output body-frame velocity.
+     * @return True when the final waypoint has been reached.
+     */
+    bool computeCommand(const Pose& pose, VelocityCommand& command);
+
+    /**
+     * @brief Runs one control cycle: reads the pose, computes and sends the command.
+     * @return True when the final waypoint has been reached.
+     */
+    bool step();
+
+    /**
+     * @brief Starts following the path on a background thread at the configured rate.
+     * @return True if the thread was started, false if it was already running or there is no path.
+     */
+    bool start();
+
+    /**
+     * @brief Stops the control thread and the robot.
+     */
+    void stop();
+
+    /**
+     * @brief Returns whether the final waypoint has been reached.
+     * @return True if finished, false otherwise.
+     */
+    bool isFinished();
+
+    /**
+     * @brief Returns whether the control thread is running.
+     * @return True if running, false otherwise.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Returns a snapshot of the cycle statistics.
+     * @return The metrics.
+     */
+    FollowerMetrics getMetrics();
+};
+
+#endif // TRAJECTORYFOLLOWER_H
@@ -0,0 +1,101 @@
+/**
+ * @file TrajectoryFollowerTest.cpp
+ * @brief Test application for the TrajectoryFollower class.
+ * @details Checks the pure-pursuit commands on synthetic poses, then follows a square path
+ * with the robot and prints the per-cycle compute metrics.
+ * @date October, 2026
+ */
+
+#include "TrajectoryFollower.h"
+#include "RobotControler.h"
+#include "Pose.h"
+#include "FestoRobotAPI.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Main function for testing the TrajectoryFollower class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    Pose* position = new Pose(0.0, 0.0, 0.0);
+    FestoRobotAPI* robotino = new FestoRobotAPI();
+    RobotControler control(position, robotino);
+    TrajectoryFollower follower(&control);
+
+    /**
+     * @test Test 1: A robot left of a straight path is steered forward and back to the right.
+     */
+    vector<Pose> line;
+    for (int i = 0; i <= 10; i++) {
+        line.push_back(Pose(0.2 * i, 0.0, 0.0));
+    }
+    follower.setPath(line);
+    VelocityCommand command;
+    bool done = follower.computeCommand(Pose(0.5, 0.2, 0.0), command);
+    cout << "Command: vx=" << command.vx << " vy=" << command.vy << " omega=" << command.omega << endl;
+    assert(!done);
+    assert(command.vx > 0.0 && command.vy < 0.0 && "Command does not point toward the path!");
+    assert(fabs(follower.getMetrics().crossTrackError - 0.2) < 1e-9);
+
+    /**
+     * @test Test 2: The command is expressed in the robot frame.
+     */
+    follower.computeCommand(Pose(0.5, 0.0, 1.5707963), command);
+    assert(command.vy < 0.0 && fabs(command.vx) < 1e-3 && "Command is not in the body frame!");
+
+    /**
+     * @test Test 3: The goal is reported when the robot is on the final waypoint.
+     */
+    done = follower.computeCommand(Pose(2.0, 0.0, 0.0), command);
+    assert(done && command.vx == 0.0 && command.vy == 0.0);
+
+    /**
+     * @test Test 4: The speeds of a timed path cap the command, but never stop the robot on the
+     * way, and a path without speeds drops the cap.
+     */
+    vector<double> speeds(line.size(), 0.05);
+    speeds.front() = 0.0;
+    speeds.back() = 0.0;
+    follower.setPath(line, speeds);
+    follower.computeCommand(Pose(1.0, 0.0, 0.0), command);
+    assert(fabs(hypot(command.vx, command.vy) - 0.05) < 1e-9);
+    follower.setPath(line, speeds);
+    follower.computeCommand(Pose(0.0, 0.0, 0.0), command);
+    assert(command.vx > 0.0 && command.vx < 0.05);
+    follower.setPath(line);
+    follower.computeCommand(Pose(1.0, 0.0, 0.0), command);
+    assert(fabs(command.vx - 0.2) < 1e-9);
+
+    /**
+     * @test Test 5: Follow a 1 m square on the robot at 50 Hz.
+     */
+    control.connectRobot();
+    vector<Pose> square;
+    square.push_back(Pose(0.0, 0.0, 0.0));
+    square.push_back(Pose(1.0, 0.0, 0.0));
+    square.push_back(Pose(1.0, 1.0, 0.0));
+    square.push_back(Pose(0.0, 1.0, 0.0));
+    square.push_back(Pose(0.0, 0.0, 0.0));
+    follower.setPath(square);
+    follower.setParameters(0.3, 0.2, 0.5, 0.1);
+    follower.setRate(50.0, 1000.0);
+    follower.start();
+    for (int i = 0; i < 600 && follower.isRunning(); i++) {
+        Sleep(100);
+    }
+    follower.stop();
+
+    FollowerMetrics metrics = follower.getMetrics();
+    cout << "Cycles: " << metrics.cycles << endl;
+    cout << "Mean cycle time: " << metrics.meanCycleUs << " us, max: " << metrics.maxCycleUs << " us" << endl;
+    cout << "Budget overruns: " << metrics.budgetOverruns << endl;
+    cout << "Remaining distance: " << metrics.remainingDistance << " m" << endl;
+    cout << "Finished: " << (follower.isFinished() ? "yes" : "no") << endl;
+
+    control.disconnectRobot();
+    return 0;
+}
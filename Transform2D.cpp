@@ -0,0 +1,41 @@
+/**
+ * @file Transform2D.cpp
+ * @brief Implementation of the batch point transforms of the Transform2D class.
+ * @date October 2026
+ */
+
+#include "Transform2D.h"
+
+/**
+ * @brief Moves points from child to parent coordinates.
+ * @param xs X coordinates in the child frame.
+ * @param ys Y coordinates in the child frame.
+ * @param count Number of points.
+ * @param outX Receives the x coordinates (may be xs).
+ * @param outY Receives the y coordinates (may be ys).
+ */
+void Transform2D::apply(const float* xs, const float* ys, size_t count, float* outX, float* outY) const {
+    // Float copies of the coefficients keep the loop in single precision, so it vectorizes
+    const float fc = static_cast<float>(c);
+    const float fs = static_cast<float>(s);
+    const float fx = static_cast<float>(tx);
+    const float fy = static_cast<float>(ty);
+    for (size_t i = 0; i < count; i++) {
+        float x = xs[i];
+        float y = ys[i];
+        outX[i] = fc * x - fs * y + fx;
+        outY[i] = fs * x + fc * y + fy;
+    }
+}
+
+/**
+ * @brief Moves points from parent to child coordinates.
+ * @param xs X coordinates in the parent frame.
+ * @param ys Y coordinates in the parent frame.
+ * @param count Number of points.
+ * @param outX Receives the x coordinates (may be xs).
+ * @param outY Receives the y coordinates (may be ys).
+ */
+void Transform2D::applyInverse(const float* xs, const float* ys, size_t count, float* outX, float* outY) const {
+    inverse().apply(xs, ys, count, outX, outY);
+}
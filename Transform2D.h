@@ -0,0 +1,234 @@
+/**
+ * @file Transform2D.h
+ * @brief Declaration of the Transform2D class, a rigid transform in the plane (SE(2)), and angle helpers.
+ * @date October 2026
+ */
+
+#ifndef TRANSFORM2D_H
+#define TRANSFORM2D_H
+
+#include "Pose.h"
+#include <cmath>
+#include <cstddef>
+
+/** @brief Pi, usable in constant expressions. */
+constexpr double SE2_PI = 3.14159265358979323846;
+
+/**
+ * @brief Converts degrees to radians.
+ * @param degrees The angle in degrees.
+ * @return The angle in radians.
+ */
+constexpr double degToRad(double degrees) {
+    return degrees * (SE2_PI / 180.0);
+}
+
+/**
+ * @brief Converts radians to degrees.
+ * @param radians The angle in radians.
+ * @return The angle in degrees.
+ */
+constexpr double radToDeg(double radians) {
+    return radians * (180.0 / SE2_PI);
+}
+
+/**
+ * @brief Wraps an angle to the range [-pi, pi).
+ * @param angle Angle in radians.
+ * @return The wrapped angle.
+ */
+inline double normalizeAngle(double angle) {
+    if (angle >= -SE2_PI && angle < SE2_PI) {
+        return angle;
+    }
+    angle = std::fmod(angle + SE2_PI, 2.0 * SE2_PI);
+    if (angle < 0.0) {
+        angle += 2.0 * SE2_PI;
+    }
+    return angle - SE2_PI;
+}
+
+/**
+ * @brief Returns the signed smallest rotation from one angle to another.
+ * @param to Target angle in radians.
+ * @param from Start angle in radians.
+ * @return to - from wrapped to [-pi, pi).
+ */
+inline double angleDifference(double to, double from) {
+    return normalizeAngle(to - from);
+}
+
+/**
+ * @brief Wraps the sum or difference of two angles in [-pi, pi) back into that range.
+ * @param angle Angle in radians in [-2 pi, 2 pi).
+ * @return The wrapped angle.
+ */
+constexpr double wrapOnce(double angle) {
+    return angle >= SE2_PI ? angle - 2.0 * SE2_PI : (angle < -SE2_PI ? angle + 2.0 * SE2_PI : angle);
+}
+
+/**
+ * @class Transform2D
+ * @brief A rigid transform in the plane: a rotation by th followed by a translation by (x, y).
+ *
+ * The sine and cosine of the heading are computed once, when the transform is made from an
+ * angle, and carried through composition and inversion, so chains of transforms and the points
+ * moved by them need no further trigonometry. Headings are radians, kept in [-pi, pi).
+ *
+ * A transform read as a pose is the pose of a child frame in its parent frame: apply() moves a
+ * point from child to parent coordinates, and a * b is the pose of b's child in a's parent.
+ */
+class Transform2D {
+private:
+    double tx;    /**< Translation along x. */
+    double ty;    /**< Translation along y. */
+    double th;    /**< Rotation in radians, in [-pi, pi). */
+    double c;     /**< Cosine of th. */
+    double s;     /**< Sine of th. */
+
+    /**
+     * @brief Constructs a transform from all of its parts.
+     * @param x Translation along x.
+     * @param y Translation along y.
+     * @param theta Rotation in radians, in [-pi, pi).
+     * @param cosTheta Cosine of theta.
+     * @param sinTheta Sine of theta.
+     */
+    constexpr Transform2D(double x, double y, double theta, double cosTheta, double sinTheta)
+        : tx(x), ty(y), th(theta), c(cosTheta), s(sinTheta) {}
+
+public:
+    /**
+     * @brief Constructs the identity transform.
+     */
+    constexpr Transform2D() : tx(0.0), ty(0.0), th(0.0), c(1.0), s(0.0) {}
+
+    /**
+     * @brief Constructs a transform from a translation and a rotation.
+     * @param x Translation along x.
+     * @param y Translation along y.
+     * @param theta Rotation in radians (any value; it is wrapped).
+     */
+    Transform2D(double x, double y, double theta)
+        : tx(x), ty(y), th(normalizeAngle(theta)), c(std::cos(theta)), s(std::sin(theta)) {}
+
+    /**
+     * @brief Constructs the transform of a pose.
+     * @param pose The pose (th in radians).
+     */
+    explicit Transform2D(const Pose& pose) : Transform2D(pose.getX(), pose.getY(), pose.getTh()) {}
+
+    /**
+     * @brief Constructs a transform whose rotation is known by its sine and cosine.
+     * @param x Translation along x.
+     * @param y Translation along y.
+     * @param theta Rotation in radians, in [-pi, pi).
+     * @param cosTheta Cosine of theta.
+     * @param sinTheta Sine of theta.
+     * @return The transform.
+     */
+    static constexpr Transform2D fromCosSin(double x, double y, double theta, double cosTheta, double sinTheta) {
+        return Transform2D(x, y, theta, cosTheta, sinTheta);
+    }
+
+    /** @brief Returns the translation along x. @return The x translation. */
+    constexpr double getX() const { return tx; }
+    /** @brief Returns the translation along y. @return The y translation. */
+    constexpr double getY() const { return ty; }
+    /** @brief Returns the rotation. @return The angle in radians, in [-pi, pi). */
+    constexpr double getTh() const { return th; }
+    /** @brief Returns the cosine of the rotation. @return The cosine. */
+    constexpr double getCos() const { return c; }
+    /** @brief Returns the sine of the rotation. @return The sine. */
+    constexpr double getSin() const { return s; }
+
+    /**
+     * @brief Returns the transform as a pose.
+     * @return The pose (th in radians).
+     */
+    Pose toPose() const { return Pose(tx, ty, th); }
+
+    /**
+     * @brief Composes two transforms: applying the result equals applying other, then this.
+     * @param other The transform applied first.
+     * @return The composition.
+     */
+    constexpr Transform2D operator*(const Transform2D& other) const {
+        return Transform2D(tx + c * other.tx - s * other.ty, ty + s * other.tx + c * other.ty,
+            wrapOnce(th + other.th), c * other.c - s * other.s, s * other.c + c * other.s);
+    }
+
+    /**
+     * @brief Composes another transform onto this one (this = this * other).
+     * @param other The transform applied first.
+     * @return This transform.
+     */
+    Transform2D& operator*=(const Transform2D& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    /**
+     * @brief Returns the inverse transform.
+     * @return The transform that undoes this one.
+     */
+    constexpr Transform2D inverse() const {
+        return Transform2D(-(c * tx + s * ty), s * tx - c * ty, wrapOnce(-th), c, -s);
+    }
+
+    /**
+     * @brief Returns another transform expressed relative to this one (inverse() * other).
+     * @param other The transform, in the same parent frame as this one.
+     * @return other seen from this one's child frame.
+     */
+    constexpr Transform2D relative(const Transform2D& other) const {
+        return Transform2D(c * (other.tx - tx) + s * (other.ty - ty), -s * (other.tx - tx) + c * (other.ty - ty),
+            wrapOnce(other.th - th), c * other.c + s * other.s, c * other.s - s * other.c);
+    }
+
+    /**
+     * @brief Moves a point from child to parent coordinates.
+     * @param x X in the child frame.
+     * @param y Y in the child frame.
+     * @param outX Receives x in the parent frame.
+     * @param outY Receives y in the parent frame.
+     */
+    void apply(double x, double y, double& outX, double& outY) const {
+        outX = tx + c * x - s * y;
+        outY = ty + s * x + c * y;
+    }
+
+    /**
+     * @brief Moves a point from parent to child coordinates.
+     * @param x X in the parent frame.
+     * @param y Y in the parent frame.
+     * @param outX Receives x in the child frame.
+     * @param outY Receives y in the child frame.
+     */
+    void applyInverse(double x, double y, double& outX, double& outY) const {
+        outX = c * (x - tx) + s * (y - ty);
+        outY = -s * (x - tx) + c * (y - ty);
+    }
+
+    /**
+     * @brief Moves points from child to parent coordinates.
+     * @param xs X coordinates in the child frame.
+     * @param ys Y coordinates in the child frame.
+     * @param count Number of points.
+     * @param outX Receives the x coordinates (may be xs).
+     * @param outY Receives the y coordinates (may be ys).
+     */
+    void apply(const float* xs, const float* ys, size_t count, float* outX, float* outY) const;
+
+    /**
+     * @brief Moves points from parent to child coordinates.
+     * @param xs X coordinates in the parent frame.
+     * @param ys Y coordinates in the parent frame.
+     * @param count Number of points.
+     * @param outX Receives the x coordinates (may be xs).
+     * @param outY Receives the y coordinates (may be ys).
+     */
+    void applyInverse(const float* xs, const float* ys, size_t count, float* outX, float* outY) const;
+};
+
+#endif // TRANSFORM2D_H
@@ -0,0 +1,180 @@
+/**
+ * @file Transform2DTest.cpp
+ * @brief Test and benchmark application for the Transform2D class and the SE(2) operations of Pose.
+ * @details Checks the angle helpers, the group laws of composition and inversion, the Pose
+ * wrappers, compile-time evaluation, drift over long chains and the batch point transforms,
+ * and compares a chain of transforms applied to scans with per-point trigonometry.
+ * @date October, 2026
+ */
+
+#include "Transform2D.h"
+#include "PointCloud2D.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Checks whether two transforms are equal within a tolerance, including the cached sine and cosine.
+ * @param a First transform.
+ * @param b Second transform.
+ * @param tolerance Largest difference allowed.
+ * @return True if equal.
+ */
+bool sameTransform(const Transform2D& a, const Transform2D& b, double tolerance) {
+    return fabs(a.getX() - b.getX()) <= tolerance && fabs(a.getY() - b.getY()) <= tolerance
+        && fabs(angleDifference(a.getTh(), b.getTh())) <= tolerance && fabs(a.getCos() - b.getCos()) <= tolerance
+        && fabs(a.getSin() - b.getSin()) <= tolerance;
+}
+
+/**
+ * @brief Main function for testing the SE(2) operations.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    /**
+     * @test Test 1: Angles wrap to [-pi, pi) and convert between degrees and radians.
+     */
+    assert(normalizeAngle(SE2_PI) == -SE2_PI && normalizeAngle(-SE2_PI) == -SE2_PI);
+    assert(fabs(normalizeAngle(3.0 * SE2_PI + 0.25) - (-SE2_PI + 0.25)) < 1e-12);
+    assert(fabs(normalizeAngle(-7.0) - (-7.0 + 2.0 * SE2_PI)) < 1e-12);
+    assert(normalizeAngle(1.0) == 1.0);
+    assert(fabs(angleDifference(degToRad(-170.0), degToRad(170.0)) - degToRad(20.0)) < 1e-12);
+    static_assert(degToRad(180.0) == SE2_PI && radToDeg(SE2_PI) == 180.0, "Conversions are constant expressions");
+    static_assert(wrapOnce(1.5 * SE2_PI) == 1.5 * SE2_PI - 2.0 * SE2_PI, "wrapOnce is a constant expression");
+
+    /**
+     * @test Test 2: Composition and inversion follow the group laws and compose by moving points.
+     */
+    mt19937 rng(5);
+    uniform_real_distribution<double> value(-10.0, 10.0);
+    for (int i = 0; i < 1000; i++) {
+        Transform2D a(value(rng), value(rng), value(rng));
+        Transform2D b(value(rng), value(rng), value(rng));
+        Transform2D c(value(rng), value(rng), value(rng));
+        assert(sameTransform(a * a.inverse(), Transform2D(), 1e-12));
+        assert(sameTransform((a * b) * c, a * (b * c), 1e-11));
+        assert(sameTransform(a.relative(b), a.inverse() * b, 1e-12));
+        assert(sameTransform(a * a.relative(b), b, 1e-11));
+        assert(a.getTh() >= -SE2_PI && a.getTh() < SE2_PI && (a * b).getTh() >= -SE2_PI && (a * b).getTh() < SE2_PI);
+        double px = value(rng), py = value(rng), bx, by, abx, aby, x, y;
+        b.apply(px, py, bx, by);
+        a.apply(bx, by, abx, aby);
+        (a * b).apply(px, py, x, y);
+        assert(fabs(x - abx) < 1e-11 && fabs(y - aby) < 1e-11);
+        (a * b).applyInverse(x, y, x, y);
+        assert(fabs(x - px) < 1e-11 && fabs(y - py) < 1e-11);
+    }
+    Transform2D quarter(1.0, 2.0, SE2_PI / 2);
+    double qx, qy;
+    quarter.apply(1.0, 0.0, qx, qy);
+    assert(fabs(qx - 1.0) < 1e-15 && fabs(qy - 3.0) < 1e-15);
+
+    /**
+     * @test Test 3: Pose composition, inverse and relative poses agree with Transform2D.
+     */
+    Pose robot(2.0, 1.0, SE2_PI / 2);
+    Pose step(1.0, 0.0, SE2_PI / 2); // One meter ahead, then a left turn
+    Pose moved = robot.compose(step);
+    assert(fabs(moved.getX() - 2.0) < 1e-12 && fabs(moved.getY() - 2.0) < 1e-12);
+    assert(fabs(moved.getTh() + SE2_PI) < 1e-12); // pi wraps to -pi
+    Pose back = moved.relativeTo(robot);
+    assert(fabs(back.getX() - 1.0) < 1e-12 && fabs(back.getY()) < 1e-12);
+    assert(fabs(angleDifference(back.getTh(), SE2_PI / 2)) < 1e-12);
+    Pose identity = robot.compose(robot.inverse());
+    assert(fabs(identity.getX()) < 1e-12 && fabs(identity.getY()) < 1e-12 && fabs(identity.getTh()) < 1e-12);
+    assert(fabs(Pose(0.0, 0.0, 5.0).normalized().getTh() - (5.0 - 2.0 * SE2_PI)) < 1e-12);
+    Pose sum = robot + step; // Component-wise addition is unchanged
+    assert(sum.getX() == 3.0 && sum.getTh() == SE2_PI);
+
+    /**
+     * @test Test 4: Transforms with known sine and cosine compose at compile time.
+     */
+    constexpr Transform2D turn = Transform2D::fromCosSin(1.0, 0.0, SE2_PI / 2, 0.0, 1.0);
+    constexpr Transform2D twice = turn * turn;
+    constexpr Transform2D undone = twice * twice.inverse();
+    static_assert(twice.getX() == 1.0 && twice.getY() == 1.0 && twice.getCos() == -1.0, "Composition is constexpr");
+    static_assert(twice.getTh() == -SE2_PI, "Composition wraps the heading");
+    static_assert(undone.getX() == 0.0 && undone.getY() == 0.0 && undone.getTh() == 0.0, "Inversion is constexpr");
+
+    /**
+     * @test Test 5: A long odometry chain keeps its cached sine and cosine consistent with its heading.
+     */
+    Transform2D chain;
+    Transform2D increment(0.01, 0.0005, 0.003);
+    for (int i = 0; i < 100000; i++) {
+        chain *= increment;
+    }
+    assert(fabs(chain.getCos() - cos(chain.getTh())) < 1e-9 && fabs(chain.getSin() - sin(chain.getTh())) < 1e-9);
+    assert(fabs(chain.getCos() * chain.getCos() + chain.getSin() * chain.getSin() - 1.0) < 1e-9);
+    assert(fabs(chain.getTh() - normalizeAngle(100000 * 0.003)) < 1e-9);
+
+    /**
+     * @test Test 6: Batch transforms match the scalar ones, in place or not, and the cloud uses them.
+     */
+    const size_t count = 1003;
+    vector<float> xs(count), ys(count), outX(count), outY(count);
+    for (size_t i = 0; i < count; i++) {
+        xs[i] = static_cast<float>(value(rng));
+        ys[i] = static_cast<float>(value(rng));
+    }
+    Transform2D frame(3.0, -4.0, 2.5);
+    frame.apply(&xs[0], &ys[0], count, &outX[0], &outY[0]);
+    PointCloud2D cloud;
+    for (size_t i = 0; i < count; i++) {
+        double x, y;
+        frame.apply(xs[i], ys[i], x, y);
+        assert(fabs(outX[i] - x) < 1e-4 && fabs(outY[i] - y) < 1e-4);
+        cloud.push(xs[i], ys[i]);
+    }
+    frame.applyInverse(&outX[0], &outY[0], count, &outX[0], &outY[0]);
+    cloud.transform(frame);
+    for (size_t i = 0; i < count; i++) {
+        assert(fabs(outX[i] - xs[i]) < 1e-4 && fabs(outY[i] - ys[i]) < 1e-4);
+        double x, y;
+        frame.apply(xs[i], ys[i], x, y);
+        assert(fabs(cloud.x()[i] - x) < 1e-4 && fabs(cloud.y()[i] - y) < 1e-4);
+    }
+
+    /**
+     * @test Test 7: Benchmark of a sensor-robot-map chain: composed once versus trigonometry per point.
+     */
+    Pose mount(0.2, 0.0, 0.05);
+    const int scans = 5000;
+    const int beams = 667;
+    vector<float> ranges(beams, 4.0f);
+    double checksum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        Pose robotPose(s * 0.001, 1.0, s * 0.0002);
+        for (int i = 0; i < beams; i++) {
+            double angle = degToRad(-120.0 + i * 0.36);
+            double sx = mount.getX() + ranges[i] * cos(mount.getTh() + angle);
+            double sy = mount.getY() + ranges[i] * sin(mount.getTh() + angle);
+            double x = robotPose.getX() + sx * cos(robotPose.getTh()) - sy * sin(robotPose.getTh());
+            double y = robotPose.getY() + sx * sin(robotPose.getTh()) + sy * cos(robotPose.getTh());
+            checksum += x + y;
+        }
+    }
+    double perPointMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    start = chrono::steady_clock::now();
+    Transform2D sensor(mount);
+    for (int s = 0; s < scans; s++) {
+        Transform2D robotFrame(s * 0.001, 1.0, s * 0.0002);
+        cloud.fromPolar(&ranges[0], beams, -120.0, 0.36);
+        cloud.transform(robotFrame * sensor);
+        for (size_t i = 0; i < cloud.size(); i++) {
+            checksum -= cloud.x()[i] + cloud.y()[i];
+        }
+    }
+    double composedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    assert(fabs(checksum) < 1e-3 * scans * beams);
+    cout << "Per-point trigonometry: " << perPointMs * 1000.0 / scans << " us/scan, composed transform: "
+        << composedMs * 1000.0 / scans << " us/scan" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,359 @@
+/**
+ * @file VfhPlanner.cpp
+ * @brief Implementation of the VfhPlanner class.
+ * @date October 2026
+ */
+
+#include "VfhPlanner.h"
+#include "Transform2D.h"
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+const int VfhPlanner::MAX_SMOOTHING = 8;
+const double VfhPlanner::MIN_SPEED_FACTOR = 0.25;
+
+/**
+ * @brief Width of a bin of the range tables in meters.
+ */
+static const double RANGE_BIN = 0.01;
+
+/**
+ * @brief Constructor for the VfhPlanner class.
+ * @param radius Radius of the robot in meters.
+ * @param safety Extra distance kept from obstacles in meters.
+ * @param range Returns beyond this range are ignored, in meters.
+ * @param sectorDegrees Angular size of a sector in degrees; 360 should be a multiple of it.
+ */
+VfhPlanner::VfhPlanner(double radius, double safety, double range, double sectorDegrees)
+    : robotRadius(radius > 0.0 ? radius : 0.0), safetyDistance(safety > 0.0 ? safety : 0.0),
+      maxRange(range > RANGE_BIN ? range : 2.0), sectorSize(0.0), sectorCount(0), smoothing(2), wideSectors(0),
+      lowThreshold(0.6f), highThreshold(0.7f), targetWeight(5.0), previousWeight(2.0), layoutAngleMin(0.0),
+      layoutIncrement(0.0), previousDirection(0.0), hasPrevious(false), stats() {
+    double size = sectorDegrees > 0.0 && sectorDegrees <= 90.0 ? sectorDegrees : 5.0;
+    sectorCount = static_cast<int>(360.0 / size + 0.5);
+    sectorSize = 2.0 * SE2_PI / sectorCount;
+    wideSectors = static_cast<int>(degToRad(80.0) / sectorSize + 0.5);
+    polar.assign(sectorCount, 0.0f);
+    density.assign(sectorCount, 0.0f);
+    blocked.assign(sectorCount, 1); // Nothing is known to be free before the first scan
+    unseen.assign(sectorCount, 1);
+    buildRangeTables();
+}
+
+/**
+ * @brief Rebuilds the range tables for the current footprint and maximum range.
+ */
+void VfhPlanner::buildRangeTables() {
+    size_t bins = static_cast<size_t>(maxRange / RANGE_BIN) + 1;
+    rangeMagnitude.resize(bins);
+    rangeSpread.resize(bins);
+    double enlarged = robotRadius + safetyDistance;
+    for (size_t b = 0; b < bins; b++) {
+        double d = (b + 0.5) * RANGE_BIN;
+        double ratio = d / maxRange;
+        rangeMagnitude[b] = ratio < 1.0 ? static_cast<float>(1.0 - ratio * ratio) : 0.0f;
+        double spread = d > enlarged ? asin(enlarged / d) : SE2_PI / 2.0;
+        rangeSpread[b] = static_cast<float>(spread / sectorSize);
+    }
+}
+
+/**
+ * @brief Returns the sector a body-frame angle falls in.
+ * @param angle The angle in radians.
+ * @return The sector index.
+ */
+int VfhPlanner::sectorOf(double angle) const {
+    int k = static_cast<int>(floor((normalizeAngle(angle) + SE2_PI) / sectorSize));
+    if (k < 0) {
+        return 0;
+    }
+    return k < sectorCount ? k : k - sectorCount;
+}
+
+/**
+ * @brief Sets the hysteresis thresholds of the binary histogram.
+ * @param low Density below which a sector becomes free.
+ * @param high Density above which a sector becomes blocked; at least low.
+ * @return True if the thresholds were accepted.
+ */
+bool VfhPlanner::setThresholds(float low, float high) {
+    if (low < 0.0f || high < low || high > 1.0f) {
+        cerr << "Error: VFH thresholds must satisfy 0 <= low <= high <= 1." << endl;
+        return false;
+    }
+    lowThreshold = low;
+    highThreshold = high;
+    return true;
+}
+
+/**
+ * @brief Sets the smoothing and the width of a wide valley.
+ * @param halfWidth Half-width of the triangular smoothing window in sectors, 0 to MAX_SMOOTHING.
+ * @param wideDegrees Valleys at least this wide, in degrees, are wide.
+ * @return True if the settings were accepted.
+ */
+bool VfhPlanner::setValleys(int halfWidth, double wideDegrees) {
+    if (halfWidth < 0 || halfWidth > MAX_SMOOTHING || wideDegrees <= 0.0 || wideDegrees > 360.0) {
+        cerr << "Error: Invalid VFH smoothing or valley width." << endl;
+        return false;
+    }
+    smoothing = halfWidth;
+    wideSectors = static_cast<int>(degToRad(wideDegrees) / sectorSize + 0.5);
+    wideSectors = wideSectors > 1 ? wideSectors : 1;
+    return true;
+}
+
+/**
+ * @brief Sets the weights of the cost of a candidate direction.
+ * @param target Weight of the deviation from the target direction.
+ * @param previous Weight of the change from the previous direction.
+ */
+void VfhPlanner::setWeights(double target, double previous) {
+    targetWeight = target > 0.0 ? target : 0.0;
+    previousWeight = previous > 0.0 ? previous : 0.0;
+}
+
+/**
+ * @brief Builds the histograms from a scan.
+ *
+ * One pass over the beams fills the polar histogram from the tables; each return only touches
+ * the sectors of its enlarged obstacle. Smoothing and thresholding are one pass over the sectors.
+ *
+ * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+ * @param rangeCount Number of ranges.
+ * @param angleMin Angle of the first beam in degrees, in the body frame.
+ * @param angleIncrement Angle between beams in degrees.
+ * @return The number of blocked sectors.
+ */
+int VfhPlanner::update(const float* ranges, int rangeCount, double angleMin, double angleIncrement) {
+    auto start = chrono::steady_clock::now();
+    if (rangeCount < 0) {
+        rangeCount = 0;
+    }
+    if (beamSector.size() != static_cast<size_t>(rangeCount) || angleMin != layoutAngleMin
+        || angleIncrement != layoutIncrement) {
+        beamSector.resize(rangeCount);
+        unseen.assign(sectorCount, 1);
+        for (int i = 0; i < rangeCount; i++) {
+            double angle = normalizeAngle(degToRad(angleMin + i * angleIncrement));
+            double position = (angle + SE2_PI) / sectorSize;
+            beamSector[i] = static_cast<float>(position);
+            unseen[sectorOf(angle)] = 0;
+        }
+        layoutAngleMin = angleMin;
+        layoutIncrement = angleIncrement;
+    }
+
+    for (int k = 0; k < sectorCount; k++) {
+        polar[k] = unseen[k] ? 1.0f : 0.0f;
+    }
+    const float limit = static_cast<float>(maxRange);
+    const float binsPerMeter = static_cast<float>(1.0 / RANGE_BIN);
+    for (int i = 0; i < rangeCount; i++) {
+        float r = ranges[i];
+        if (r <= 0.0f || r >= limit) {
+            continue;
+        }
+        size_t bin = static_cast<size_t>(r * binsPerMeter);
+        bin = bin < rangeMagnitude.size() ? bin : rangeMagnitude.size() - 1;
+        float magnitude = rangeMagnitude[bin];
+        float spread = rangeSpread[bin];
+        int first = static_cast<int>(floor(beamSector[i] - spread));
+        int last = static_cast<int>(floor(beamSector[i] + spread));
+        for (int k = first; k <= last; k++) {
+            int sector = k < 0 ? k + sectorCount : (k >= sectorCount ? k - sectorCount : k);
+            polar[sector] = magnitude > polar[sector] ? magnitude : polar[sector];
+        }
+    }
+
+    const float norm = 1.0f / static_cast<float>((smoothing + 1) * (smoothing + 1));
+    int blockedCount = 0;
+    for (int k = 0; k < sectorCount; k++) {
+        float sum = 0.0f;
+        for (int j = -smoothing; j <= smoothing; j++) {
+            int sector = k + j;
+            sector = sector < 0 ? sector + sectorCount : (sector >= sectorCount ? sector - sectorCount : sector);
+            sum += static_cast<float>(smoothing + 1 - (j < 0 ? -j : j)) * polar[sector];
+        }
+        density[k] = sum * norm;
+        if (density[k] > highThreshold) {
+            blocked[k] = 1;
+        }
+        else if (density[k] < lowThreshold) {
+            blocked[k] = 0;
+        }
+        blockedCount += blocked[k];
+    }
+
+    stats.scans++;
+    stats.lastBlockedSectors = blockedCount;
+    stats.lastUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    stats.longestUs = stats.lastUs > stats.longestUs ? stats.lastUs : stats.longestUs;
+    return blockedCount;
+}
+
+/**
+ * @brief Builds the histograms from the current scan of a Lidar sensor.
+ * @param lidar The sensor.
+ * @return The number of blocked sectors.
+ */
+int VfhPlanner::update(const LidarSensor& lidar) {
+    int rangeCount = lidar.getRangeNum();
+    if (rangeCount <= 0) {
+        return update(nullptr, 0, 0.0, 0.0);
+    }
+    sensorRanges.resize(rangeCount);
+    rangeCount = lidar.copyRanges(&sensorRanges[0], rangeCount);
+    double increment = rangeCount > 1 ? lidar.getAngle(1) - lidar.getAngle(0) : 0.0;
+    return update(&sensorRanges[0], rangeCount, lidar.getAngle(0), increment);
+}
+
+/**
+ * @brief Chooses the direction of travel.
+ *
+ * The sectors are walked once around the circle starting after a blocked one, so a valley that
+ * wraps past 180 degrees is seen whole. Each valley offers its candidates and the cheapest one
+ * wins.
+ *
+ * @param targetAngle Direction to the target in radians, in the body frame.
+ * @param direction Receives the chosen direction in radians, in the body frame.
+ * @return False if every sector is blocked.
+ */
+bool VfhPlanner::computeDirection(double targetAngle, double& direction) {
+    const double target = normalizeAngle(targetAngle);
+    int firstBlocked = -1;
+    for (int k = 0; k < sectorCount && firstBlocked < 0; k++) {
+        if (blocked[k]) {
+            firstBlocked = k;
+        }
+    }
+    if (firstBlocked < 0) {
+        direction = target;
+        previousDirection = direction;
+        hasPrevious = true;
+        return true;
+    }
+
+    double bestCost = 0.0;
+    bool found = false;
+    int valleyStart = -1;
+    for (int j = 1; j <= sectorCount; j++) {
+        int u = firstBlocked + j; // Unwrapped sector index
+        bool free = !blocked[u % sectorCount];
+        if (free && valleyStart < 0) {
+            valleyStart = u;
+        }
+        if (free || valleyStart < 0) {
+            continue;
+        }
+        double first = -SE2_PI + valleyStart * sectorSize;
+        double last = -SE2_PI + u * sectorSize;
+        valleyStart = -1;
+        double candidates[3];
+        int candidateCount = 0;
+        if (last - first < wideSectors * sectorSize - 1e-9) {
+            candidates[candidateCount++] = 0.5 * (first + last);
+        }
+        else {
+            double right = first + 0.5 * wideSectors * sectorSize;
+            double left = last - 0.5 * wideSectors * sectorSize;
+            candidates[candidateCount++] = right;
+            candidates[candidateCount++] = left;
+            double t = target;
+            while (t < first) {
+                t += 2.0 * SE2_PI;
+            }
+            if (t >= right && t <= left) {
+                candidates[candidateCount++] = t;
+            }
+        }
+        for (int c = 0; c < candidateCount; c++) {
+            double angle = normalizeAngle(candidates[c]);
+            double cost = targetWeight * fabs(angleDifference(angle, target));
+            if (hasPrevious) {
+                cost += previousWeight * fabs(angleDifference(angle, previousDirection));
+            }
+            if (!found || cost < bestCost) {
+                bestCost = cost;
+                direction = angle;
+                found = true;
+            }
+        }
+    }
+    if (!found) {
+        stats.blockedQueries++;
+        return false;
+    }
+    previousDirection = direction;
+    hasPrevious = true;
+    return true;
+}
+
+/**
+ * @brief Chooses the direction of travel and turns it into a body-frame velocity.
+ * The speed falls with the density in the chosen direction, down to MIN_SPEED_FACTOR of the
+ * requested speed.
+ * @param targetAngle Direction to the target in radians, in the body frame.
+ * @param speed Speed in free space, in m/s.
+ * @param command Receives the velocity; zero if every sector is blocked.
+ * @return False if every sector is blocked.
+ */
+bool VfhPlanner::computeCommand(double targetAngle, double speed, VelocityCommand& command) {
+    command.vx = command.vy = command.omega = 0.0;
+    double direction = 0.0;
+    if (!computeDirection(targetAngle, direction)) {
+        return false;
+    }
+    double factor = 1.0 - density[sectorOf(direction)];
+    factor = factor > MIN_SPEED_FACTOR ? factor : MIN_SPEED_FACTOR;
+    command.vx = speed * factor * cos(direction);
+    command.vy = speed * factor * sin(direction);
+    return true;
+}
+
+/**
+ * @brief Tells whether a direction is free in the binary histogram of the last scan.
+ * @param angle The direction in radians, in the body frame.
+ * @return True if the direction's sector is free.
+ */
+bool VfhPlanner::isDirectionFree(double angle) const {
+    return !blocked[sectorOf(angle)];
+}
+
+/**
+ * @brief Returns the number of sectors.
+ * @return The number of sectors.
+ */
+int VfhPlanner::getSectorCount() const {
+    return sectorCount;
+}
+
+/**
+ * @brief Returns the smoothed polar histogram of the last scan.
+ * @return Pointer to getSectorCount() densities.
+ */
+const float* VfhPlanner::getDensity() const {
+    return &density[0];
+}
+
+/**
+ * @brief Returns the counters.
+ * @return The counters.
+ */
+VfhStats VfhPlanner::getStats() const {
+    return stats;
+}
+
+/**
+ * @brief Clears the histograms, the previous direction and the counters.
+ */
+void VfhPlanner::reset() {
+    polar.assign(sectorCount, 0.0f);
+    density.assign(sectorCount, 0.0f);
+    blocked.assign(sectorCount, 1);
+    hasPrevious = false;
+    previousDirection = 0.0;
+    stats = VfhStats();
+}
@@ -0,0 +1,191 @@
+/**
+ * @file VfhPlanner.h
+ * @brief Declaration of the VfhPlanner class, Vector Field Histogram (VFH+) obstacle avoidance on raw Lidar scans.
+ * @date October 2026
+ */
+
+#ifndef VFHPLANNER_H
+#define VFHPLANNER_H
+
+#include "LidarSensor.h"
+#include "CommandStreamer.h"
+#include <vector>
+
+/**
+ * @struct VfhStats
+ * @brief Counters of a VfhPlanner since construction or reset().
+ */
+struct VfhStats {
+    unsigned long scans;          /**< Scans turned into histograms. */
+    unsigned long blockedQueries; /**< Direction queries that found every sector blocked. */
+    int lastBlockedSectors;       /**< Blocked sectors of the last scan. */
+    double lastUs;                /**< Duration of the last update() call, in microseconds. */
+    double longestUs;             /**< Longest update() call, in microseconds. */
+};
+
+/**
+ * @class VfhPlanner
+ * @brief Picks a free direction of travel from a polar obstacle histogram of the last scan.
+ *
+ * Every return closer than the maximum range adds a magnitude 1 - (d / maxRange)^2 to the
+ * sectors within the angle asin((robotRadius + safetyDistance) / d) of its beam, which enlarges
+ * the obstacle by the robot size; a sector keeps the largest magnitude it receives. The polar
+ * histogram is smoothed with a triangular window and turned into a binary one with two
+ * thresholds, so a sector near a threshold does not flicker between scans. Sectors the sensor
+ * does not see count as blocked.
+ *
+ * Runs of free sectors are the valleys. A narrow valley offers its centre; a wide one offers
+ * the target direction if it lies inside, and otherwise the directions half a wide valley in
+ * from each edge. The candidate closest to the target, weighted against the change from the
+ * previous direction, is chosen. The base is omnidirectional, so the direction is driven
+ * without turning and the VFH+ masking of directions the robot cannot turn into is not needed.
+ *
+ * The sector and spread of each beam and the magnitude and spread of each centimetre of range
+ * are tabulated when the beam layout changes; update() does not allocate or call trigonometric
+ * functions otherwise.
+ */
+class VfhPlanner {
+private:
+    double robotRadius;                 /**< Radius of the robot in meters. */
+    double safetyDistance;              /**< Extra distance kept from obstacles in meters. */
+    double maxRange;                    /**< Returns beyond this range are ignored, in meters. */
+    double sectorSize;                  /**< Angular size of a sector in radians. */
+    int sectorCount;                    /**< Number of sectors around the robot. */
+    int smoothing;                      /**< Half-width of the smoothing window in sectors. */
+    int wideSectors;                    /**< Valleys at least this wide are wide. */
+    float lowThreshold;                 /**< Density below which a sector becomes free. */
+    float highThreshold;                /**< Density above which a sector becomes blocked. */
+    double targetWeight;                /**< Cost weight of the deviation from the target. */
+    double previousWeight;              /**< Cost weight of the change from the previous direction. */
+
+    std::vector<float> polar;           /**< Largest magnitude per sector of the last scan. */
+    std::vector<float> density;         /**< Smoothed polar histogram. */
+    std::vector<unsigned char> blocked; /**< Binary histogram: 1 for a blocked sector. */
+    std::vector<unsigned char> unseen;  /**< 1 for a sector no beam of the layout falls in. */
+    std::vector<float> beamSector;      /**< Position of each beam in sectors from -180 degrees. */
+    std::vector<float> rangeMagnitude;  /**< Magnitude of a return per centimetre of range. */
+    std::vector<float> rangeSpread;     /**< Enlargement per centimetre of range, in sectors. */
+    double layoutAngleMin;              /**< First beam angle the tables were built for, in degrees. */
+    double layoutIncrement;             /**< Beam increment the tables were built for, in degrees. */
+    std::vector<float> sensorRanges;    /**< Copy of the Lidar ranges for update(const LidarSensor&). */
+    double previousDirection;           /**< Last chosen direction in radians. */
+    bool hasPrevious;                   /**< True once a direction was chosen. */
+    VfhStats stats;                     /**< Counters. */
+
+    /**
+     * @brief Rebuilds the range tables for the current footprint and maximum range.
+     */
+    void buildRangeTables();
+
+    /**
+     * @brief Returns the sector a body-frame angle falls in.
+     * @param angle The angle in radians.
+     * @return The sector index.
+     */
+    int sectorOf(double angle) const;
+
+public:
+    /** @brief Largest smoothing half-width accepted, in sectors. */
+    static const int MAX_SMOOTHING;
+    /** @brief Fraction of the requested speed kept next to an obstacle. */
+    static const double MIN_SPEED_FACTOR;
+
+    /**
+     * @brief Constructor for the VfhPlanner class.
+     * @param radius Radius of the robot in meters.
+     * @param safety Extra distance kept from obstacles in meters.
+     * @param range Returns beyond this range are ignored, in meters.
+     * @param sectorDegrees Angular size of a sector in degrees; 360 should be a multiple of it.
+     */
+    explicit VfhPlanner(double radius = 0.25, double safety = 0.1, double range = 2.0, double sectorDegrees = 5.0);
+
+    /**
+     * @brief Sets the hysteresis thresholds of the binary histogram.
+     * @param low Density below which a sector becomes free.
+     * @param high Density above which a sector becomes blocked; at least low.
+     * @return True if the thresholds were accepted.
+     */
+    bool setThresholds(float low, float high);
+
+    /**
+     * @brief Sets the smoothing and the width of a wide valley.
+     * @param halfWidth Half-width of the triangular smoothing window in sectors, 0 to MAX_SMOOTHING.
+     * @param wideDegrees Valleys at least this wide, in degrees, are wide.
+     * @return True if the settings were accepted.
+     */
+    bool setValleys(int halfWidth, double wideDegrees);
+
+    /**
+     * @brief Sets the weights of the cost of a candidate direction.
+     * @param target Weight of the deviation from the target direction.
+     * @param previous Weight of the change from the previous direction.
+     */
+    void setWeights(double target, double previous);
+
+    /**
+     * @brief Builds the histograms from a scan.
+     * @param ranges The ranges in meters; 0 or less marks a beam without a return.
+     * @param rangeCount Number of ranges.
+     * @param angleMin Angle of the first beam in degrees, in the body frame.
+     * @param angleIncrement Angle between beams in degrees.
+     * @return The number of blocked sectors.
+     */
+    int update(const float* ranges, int rangeCount, double angleMin, double angleIncrement);
+
+    /**
+     * @brief Builds the histograms from the current scan of a Lidar sensor.
+     * @param lidar The sensor.
+     * @return The number of blocked sectors.
+     */
+    int update(const LidarSensor& lidar);
+
+    /**
+     * @brief Chooses the direction of travel.
+     * @param targetAngle Direction to the target in radians, in the body frame.
+     * @param direction Receives the chosen direction in radians, in the body frame.
+     * @return False if every sector is blocked.
+     */
+    bool computeDirection(double targetAngle, double& direction);
+
+    /**
+     * @brief Chooses the direction of travel and turns it into a body-frame velocity, slowed down
+     * as the density in that direction grows.
+     * @param targetAngle Direction to the target in radians, in the body frame.
+     * @param speed Speed in free space, in m/s.
+     * @param command Receives the velocity; zero if every sector is blocked.
+     * @return False if every sector is blocked.
+     */
+    bool computeCommand(double targetAngle, double speed, VelocityCommand& command);
+
+    /**
+     * @brief Tells whether a direction is free in the binary histogram of the last scan.
+     * @param angle The direction in radians, in the body frame.
+     * @return True if the direction's sector is free.
+     */
+    bool isDirectionFree(double angle) const;
+
+    /**
+     * @brief Returns the number of sectors.
+     * @return The number of sectors.
+     */
+    int getSectorCount() const;
+
+    /**
+     * @brief Returns the smoothed polar histogram of the last scan.
+     * @return Pointer to getSectorCount() densities; sector k spans -180 + k * size degrees onwards.
+     */
+    const float* getDensity() const;
+
+    /**
+     * @brief Returns the counters.
+     * @return The counters.
+     */
+    VfhStats getStats() const;
+
+    /**
+     * @brief Clears the histograms, the previous direction and the counters.
+     */
+    void reset();
+};
+
+#endif // VFHPLANNER_H
@@ -0,0 +1,180 @@
+/**
+ * @file VfhPlannerTest.cpp
+ * @brief Test and benchmark application for the VfhPlanner class.
+ * @details Builds scans of simulated round obstacles in the layout of the robot's Lidar, checks
+ * the directions chosen in free space, in front of an obstacle and in a corridor, the hysteresis
+ * of the binary histogram, drives a simulated robot through a field of obstacles, and measures
+ * the time per scan.
+ * @date October, 2026
+ */
+
+#include "VfhPlanner.h"
+#include "Transform2D.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+/** @brief Number of beams of the robot's Lidar. */
+const int BEAMS = 667;
+
+/**
+ * @struct Disc
+ * @brief A round obstacle.
+ */
+struct Disc {
+    double x;      /**< X of the centre in meters. */
+    double y;      /**< Y of the centre in meters. */
+    double radius; /**< Radius in meters. */
+};
+
+/**
+ * @brief Simulates a scan of the Lidar (-120 to 120 degrees in steps of 0.36) among discs.
+ * @param discs The obstacles.
+ * @param x X of the sensor in meters.
+ * @param y Y of the sensor in meters.
+ * @param ranges Receives BEAMS ranges; 0 for a beam without a return within 4 m.
+ */
+void simulateScan(const vector<Disc>& discs, double x, double y, vector<float>& ranges) {
+    ranges.assign(BEAMS, 0.0f);
+    for (int i = 0; i < BEAMS; i++) {
+        double angle = degToRad(-120.0 + i * 0.36);
+        double dx = cos(angle), dy = sin(angle);
+        double best = 4.0;
+        for (size_t d = 0; d < discs.size(); d++) {
+            double ox = discs[d].x - x, oy = discs[d].y - y;
+            double along = ox * dx + oy * dy;
+            double across = ox * ox + oy * oy - along * along;
+            double r2 = discs[d].radius * discs[d].radius;
+            if (along > 0.0 && across < r2) {
+                double hit = along - sqrt(r2 - across);
+                best = hit > 0.0 && hit < best ? hit : best;
+            }
+        }
+        ranges[i] = best < 4.0 ? static_cast<float>(best) : 0.0f;
+    }
+}
+
+/**
+ * @brief Main function for testing the VFH planner.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    vector<float> ranges;
+    vector<Disc> discs;
+    double direction = 0.0;
+    VelocityCommand command;
+
+    /**
+     * @test Test 1: In free space the target direction is taken at full speed; before the first
+     * scan and behind the robot, where the Lidar does not see, every direction is blocked.
+     */
+    VfhPlanner vfh;
+    assert(vfh.getSectorCount() == 72);
+    assert(!vfh.computeDirection(0.0, direction) && vfh.getStats().blockedQueries == 1);
+    simulateScan(discs, 0.0, 0.0, ranges);
+    vfh.update(&ranges[0], BEAMS, -120.0, 0.36);
+    assert(vfh.computeCommand(0.3, 0.2, command));
+    assert(fabs(command.vx - 0.2 * cos(0.3)) < 1e-9 && fabs(command.vy - 0.2 * sin(0.3)) < 1e-9);
+    assert(command.omega == 0.0);
+    assert(vfh.isDirectionFree(degToRad(90.0)) && !vfh.isDirectionFree(SE2_PI));
+
+    /**
+     * @test Test 2: An obstacle straight ahead blocks the forward direction; the chosen direction
+     * passes it with room for the robot.
+     */
+    vfh.reset();
+    discs.push_back(Disc{ 1.0, 0.0, 0.2 });
+    simulateScan(discs, 0.0, 0.0, ranges);
+    vfh.update(&ranges[0], BEAMS, -120.0, 0.36);
+    assert(!vfh.isDirectionFree(0.0));
+    assert(vfh.computeCommand(0.0, 0.3, command));
+    direction = atan2(command.vy, command.vx);
+    double passing = asin((0.2 + 0.25 + 0.1) / 1.0); // Disc radius plus robot radius plus safety distance
+    assert(fabs(direction) > passing && fabs(direction) < degToRad(90.0));
+
+    /**
+     * @test Test 3: In a corridor the walls block the sides, and a target at an angle is replaced
+     * by a direction along the corridor.
+     */
+    vfh.reset();
+    discs.clear();
+    for (double x = -0.5; x < 4.0; x += 0.05) {
+        discs.push_back(Disc{ x, 0.65, 0.05 });
+        discs.push_back(Disc{ x, -0.65, 0.05 });
+    }
+    simulateScan(discs, 0.0, 0.0, ranges);
+    vfh.update(&ranges[0], BEAMS, -120.0, 0.36);
+    assert(!vfh.isDirectionFree(degToRad(90.0)) && !vfh.isDirectionFree(degToRad(-90.0)));
+    assert(vfh.isDirectionFree(0.0));
+    assert(vfh.computeDirection(degToRad(60.0), direction));
+    assert(fabs(direction) < degToRad(15.0));
+
+    /**
+     * @test Test 4: A density between the two thresholds keeps each sector as it was, so the
+     * binary histogram does not flicker; the speed falls with the density of the direction.
+     */
+    VfhPlanner hysteresis;
+    vector<float> ring(BEAMS, 1.183f); // Magnitude about 0.65, between the default 0.6 and 0.7
+    vector<float> open(BEAMS, 0.0f);
+    hysteresis.update(&ring[0], BEAMS, -120.0, 0.36);
+    assert(!hysteresis.isDirectionFree(0.0)); // Blocked before the first scan, and stays so
+    hysteresis.update(&open[0], BEAMS, -120.0, 0.36);
+    assert(hysteresis.isDirectionFree(0.0));
+    hysteresis.update(&ring[0], BEAMS, -120.0, 0.36);
+    assert(hysteresis.isDirectionFree(0.0)); // Free, and stays so
+    assert(hysteresis.computeCommand(0.0, 0.3, command));
+    assert(command.vx > 0.3 * VfhPlanner::MIN_SPEED_FACTOR && command.vx < 0.5 * 0.3);
+    vector<float> close(BEAMS, 0.8f);
+    hysteresis.update(&close[0], BEAMS, -120.0, 0.36);
+    assert(!hysteresis.isDirectionFree(0.0));
+
+    /**
+     * @test Test 5: A simulated robot crosses a field of obstacles to a goal 6 m ahead, without
+     * turning and without touching any of them.
+     */
+    discs.clear();
+    discs.push_back(Disc{ 1.5, 0.1, 0.3 });
+    discs.push_back(Disc{ 3.0, -0.8, 0.3 });
+    discs.push_back(Disc{ 3.2, 0.9, 0.25 });
+    discs.push_back(Disc{ 4.5, 0.0, 0.35 });
+    VfhPlanner field;
+    double x = 0.0, y = 0.0;
+    const double dt = 0.1;
+    double closest = 1e9;
+    int cycles = 0;
+    for (; cycles < 300 && hypot(6.0 - x, -y) > 0.1; cycles++) {
+        simulateScan(discs, x, y, ranges);
+        field.update(&ranges[0], BEAMS, -120.0, 0.36);
+        assert(field.computeCommand(atan2(-y, 6.0 - x), 0.4, command));
+        x += command.vx * dt;
+        y += command.vy * dt;
+        for (size_t d = 0; d < discs.size(); d++) {
+            double gap = hypot(discs[d].x - x, discs[d].y - y) - discs[d].radius;
+            closest = gap < closest ? gap : closest;
+        }
+    }
+    assert(hypot(6.0 - x, -y) <= 0.1);
+    assert(closest > 0.25);
+    cout << "Crossed the field in " << cycles * dt << " s, closest approach " << closest << " m" << endl;
+
+    /**
+     * @test Test 6: Building the histogram of a full scan takes a few microseconds.
+     */
+    simulateScan(discs, 0.0, 0.0, ranges);
+    const int runs = 2000;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < runs; r++) {
+        ranges[r % BEAMS] += 0.001f;
+        field.update(&ranges[0], BEAMS, -120.0, 0.36);
+        field.computeDirection(0.0, direction);
+    }
+    double perScanUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / runs;
+    assert(perScanUs < 1000.0);
+    cout << "Histogram and direction of a " << BEAMS << "-beam scan: " << perScanUs << " us" << endl;
+
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file WorkStealingPool.cpp
+ * @brief Implementation of the WorkStealingPool class.
+ * @date October 2026
+ */
+
+#include "WorkStealingPool.h"
+using namespace std;
+
+/**
+ * @brief Packs a task range into one 64-bit word.
+ * @param begin First task of the range.
+ * @param end One past the last task of the range.
+ * @return The packed range.
+ */
+static uint64_t packRange(uint32_t begin, uint32_t end) {
+    return (static_cast<uint64_t>(begin) << 32) | end;
+}
+
+/**
+ * @brief Constructor for the WorkStealingPool class. Starts the background threads.
+ * @param threadCount Number of workers including the calling thread (0 = hardware concurrency).
+ */
+WorkStealingPool::WorkStealingPool(int threadCount)
+    : threadCount(threadCount), body(nullptr), generation(0), activeWorkers(0), shuttingDown(false), steals(0) {
+    if (this->threadCount <= 0) {
+        this->threadCount = static_cast<int>(thread::hardware_concurrency());
+        if (this->threadCount <= 0) {
+            this->threadCount = 1;
+        }
+    }
+    ranges.reset(new Range[this->threadCount]);
+    for (int i = 0; i < this->threadCount; i++) {
+        ranges[i].bounds.store(0, memory_order_relaxed);
+    }
+    for (int i = 1; i < this->threadCount; i++) {
+        threads.push_back(thread(&WorkStealingPool::workerLoop, this, i));
+    }
+}
+
+/**
+ * @brief Destructor for the WorkStealingPool class. Stops and joins the background threads.
+ */
+WorkStealingPool::~WorkStealingPool() {
+    {
+        lock_guard<mutex> lock(stateMutex);
+        shuttingDown = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+/**
+ * @brief Runs body(task, worker) for every task in [0, count) and returns when all have finished.
+ * @param count Number of tasks.
+ * @param body The loop body.
+ */
+void WorkStealingPool::parallelFor(uint32_t count, const ParallelBody& body) {
+    if (count == 0) {
+        return;
+    }
+    this->body = &body;
+    for (int i = 0; i < threadCount; i++) {
+        uint32_t begin = static_cast<uint32_t>(static_cast<uint64_t>(count) * i / threadCount);
+        uint32_t end = static_cast<uint32_t>(static_cast<uint64_t>(count) * (i + 1) / threadCount);
+        ranges[i].bounds.store(packRange(begin, end), memory_order_relaxed);
+    }
+    {
+        lock_guard<mutex> lock(stateMutex);
+        activeWorkers = threadCount - 1;
+        generation++;
+    }
+    wake.notify_all();
+
+    runTasks(0);
+
+    unique_lock<mutex> lock(stateMutex);
+    finished.wait(lock, [this]() { return activeWorkers == 0; });
+    this->body = nullptr;
+}
+
+/**
+ * @brief Background worker: waits for loops and runs its share of them.
+ * @param worker Index of the worker.
+ */
+void WorkStealingPool::workerLoop(int worker) {
+    unsigned long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lock(stateMutex);
+            wake.wait(lock, [this, seen]() { return shuttingDown || generation != seen; });
+            if (shuttingDown) {
+                return;
+            }
+            seen = generation;
+        }
+        runTasks(worker);
+        {
+            lock_guard<mutex> lock(stateMutex);
+            activeWorkers--;
+        }
+        finished.notify_one();
+    }
+}
+
+/**
+ * @brief Runs tasks from the worker's own range and steals until no work is left.
+ * @param worker Index of the worker.
+ */
+void WorkStealingPool::runTasks(int worker) {
+    atomic<uint64_t>& own = ranges[worker].bounds;
+    while (true) {
+        uint64_t current = own.load(memory_order_acquire);
+        uint32_t begin = static_cast<uint32_t>(current >> 32);
+        uint32_t end = static_cast<uint32_t>(current);
+        if (begin < end) {
+            if (own.compare_exchange_weak(current, packRange(begin + 1, end), memory_order_acq_rel)) {
+                (*body)(begin, worker);
+            }
+        }
+        else if (!steal(worker)) {
+            return; // Tasks are never added during a loop, so no range left means no work left
+        }
+    }
+}
+
+/**
+ * @brief Tries to move half of another worker's remaining tasks to this worker.
+ *
+ * The thief's own range is empty at this point, so no other thread modifies it and a plain
+ * store is enough to publish the stolen tasks.
+ *
+ * @param worker Index of the thief.
+ * @return True if tasks were stolen.
+ */
+bool WorkStealingPool::steal(int worker) {
+    while (true) {
+        // Pick the victim with the most remaining work
+        int victim = -1;
+        uint64_t victimBounds = 0;
+        uint32_t largest = 0;
+        for (int i = 1; i < threadCount; i++) {
+            int candidate = (worker + i) % threadCount;
+            uint64_t bounds = ranges[candidate].bounds.load(memory_order_acquire);
+            uint32_t begin = static_cast<uint32_t>(bounds >> 32);
+            uint32_t end = static_cast<uint32_t>(bounds);
+            if (begin < end && end - begin > largest) {
+                largest = end - begin;
+                victim = candidate;
+                victimBounds = bounds;
+            }
+        }
+        if (victim < 0) {
+            return false;
+        }
+
+        uint32_t begin = static_cast<uint32_t>(victimBounds >> 32);
+        uint32_t end = static_cast<uint32_t>(victimBounds);
+        uint32_t middle = begin + (end - begin) / 2;
+        if (ranges[victim].bounds.compare_exchange_strong(victimBounds, packRange(begin, middle), memory_order_acq_rel)) {
+            ranges[worker].bounds.store(packRange(middle, end), memory_order_release);
+            steals.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+        // The victim's range changed meanwhile; look again.
+    }
+}
+
+/**
+ * @brief Returns the number of workers, including the calling thread.
+ * @return The worker count.
+ */
+int WorkStealingPool::getThreadCount() const {
+    return threadCount;
+}
+
+/**
+ * @brief Returns the number of successful steals since construction.
+ * @return The steal count.
+ */
+unsigned long WorkStealingPool::getSteals() const {
+    return steals.load(memory_order_relaxed);
+}
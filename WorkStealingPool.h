@@ -0,0 +1,113 @@
+/**
+ * @file WorkStealingPool.h
+ * @brief Declaration of the WorkStealingPool class, a fixed set of worker threads that run
+ *        parallel loops with lock-free work stealing.
+ * @date October 2026
+ */
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Body of a parallel loop. Receives the task index and the index of the worker running it.
+ */
+typedef std::function<void(uint32_t task, int worker)> ParallelBody;
+
+/**
+ * @class WorkStealingPool
+ * @brief Runs the iterations of a loop on a fixed set of threads and balances uneven work by stealing.
+ *
+ * Each call to parallelFor() splits the task range evenly between the workers. A worker takes
+ * tasks from the front of its own range; when that is empty it steals the upper half of the
+ * largest remaining range of another worker. Every range is a single 64-bit atomic (begin, end)
+ * updated by compare-and-swap, so scheduling takes no locks. The calling thread acts as worker 0.
+ */
+class WorkStealingPool {
+private:
+    /**
+     * @struct Range
+     * @brief Remaining task range of one worker, padded to its own cache line.
+     */
+    struct Range {
+        std::atomic<uint64_t> bounds; /**< begin in the high 32 bits, end in the low 32 bits. */
+        char pad[56];                 /**< Keeps neighbouring ranges on separate cache lines. */
+    };
+
+    int threadCount;                    /**< Number of workers including the calling thread. */
+    std::unique_ptr<Range[]> ranges;    /**< One range per worker. */
+    std::vector<std::thread> threads;   /**< Background workers 1..threadCount-1. */
+    const ParallelBody* body;           /**< Body of the loop in progress. */
+
+    std::mutex stateMutex;              /**< Guards the generation and the wake-ups. */
+    std::condition_variable wake;       /**< Signals a new loop or shutdown to the workers. */
+    std::condition_variable finished;   /**< Signals the caller that all workers are done. */
+    unsigned long generation;           /**< Incremented for every loop. */
+    int activeWorkers;                  /**< Background workers still running the current loop. */
+    bool shuttingDown;                  /**< True when the destructor has been called. */
+    std::atomic<unsigned long> steals;  /**< Successful steals since construction. */
+
+    /**
+     * @brief Background worker: waits for loops and runs its share of them.
+     * @param worker Index of the worker.
+     */
+    void workerLoop(int worker);
+
+    /**
+     * @brief Runs tasks from the worker's own range and steals until no work is left.
+     * @param worker Index of the worker.
+     */
+    void runTasks(int worker);
+
+    /**
+     * @brief Tries to move half of another worker's remaining tasks to this worker.
+     * @param worker Index of the thief.
+     * @return True if tasks were stolen.
+     */
+    bool steal(int worker);
+
+public:
+    /**
+     * @brief Constructor for the WorkStealingPool class. Starts the background threads.
+     * @param threadCount Number of workers including the calling thread (0 = hardware concurrency).
+     */
+    explicit WorkStealingPool(int threadCount = 0);
+
+    /**
+     * @brief Destructor for the WorkStealingPool class. Stops and joins the background threads.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Runs body(task, worker) for every task in [0, count) and returns when all have finished.
+     * Must not be called concurrently or from inside a body.
+     * @param count Number of tasks.
+     * @param body The loop body.
+     */
+    void parallelFor(uint32_t count, const ParallelBody& body);
+
+    /**
+     * @brief Returns the number of workers, including the calling thread.
+     * @return The worker count.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Returns the number of successful steals since construction.
+     * @return The steal count.
+     */
+    unsigned long getSteals() const;
+};
+
+#endif // WORKSTEALINGPOOL_H
@@ -0,0 +1,80 @@
+/**
+ * @file WorkStealingPoolTest.cpp
+ * @brief Test application for the WorkStealingPool class.
+ * @details Runs balanced and deliberately unbalanced loops and checks that every task runs
+ * exactly once and that idle workers steal from busy ones.
+ * @date October, 2026
+ */
+
+#include "WorkStealingPool.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief Main function for testing the WorkStealingPool class.
+ * @return Returns 0 upon successful execution.
+ */
+int main() {
+    WorkStealingPool pool(4);
+    assert(pool.getThreadCount() == 4);
+
+    /**
+     * @test Test 1: Every task of a loop runs exactly once.
+     */
+    const uint32_t count = 100000;
+    vector<atomic<int> > runs(count);
+    for (uint32_t i = 0; i < count; i++) {
+        runs[i] = 0;
+    }
+    pool.parallelFor(count, [&runs](uint32_t task, int) {
+        runs[task]++;
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        assert(runs[i] == 1);
+    }
+
+    /**
+     * @test Test 2: When all the work sits in worker 0's share, the other workers steal it.
+     */
+    vector<atomic<int> > perWorker(4);
+    for (int i = 0; i < 4; i++) {
+        perWorker[i] = 0;
+    }
+    pool.parallelFor(64, [&perWorker](uint32_t task, int worker) {
+        if (task < 16) {
+            this_thread::sleep_for(chrono::milliseconds(5));
+        }
+        perWorker[worker]++;
+    });
+    int total = 0;
+    for (int i = 0; i < 4; i++) {
+        cout << "Worker " << i << " ran " << perWorker[i] << " tasks" << endl;
+        total += perWorker[i];
+    }
+    assert(total == 64);
+    assert(pool.getSteals() > 0);
+    assert(perWorker[0] < 16);
+
+    /**
+     * @test Test 3: The pool can be reused for many short loops, including empty ones.
+     */
+    atomic<long> sum(0);
+    for (int loop = 0; loop < 1000; loop++) {
+        pool.parallelFor(loop % 7, [&sum](uint32_t task, int) { sum += task; });
+    }
+    long expected = 0;
+    for (int loop = 0; loop < 1000; loop++) {
+        int n = loop % 7;
+        expected += n * (n - 1) / 2;
+    }
+    assert(sum == expected);
+
+    cout << "Steals: " << pool.getSteals() << endl;
+    cout << "All tests passed successfully!" << endl;
+    return 0;
+}